@@ -0,0 +1,13 @@
+#pragma once
+
+// Export macro for the Backend shared library.
+// BACKEND_EXPORTS is defined by Backend/CMakeLists.txt when building the DLL.
+#if defined(_WIN32)
+    #if defined(BACKEND_EXPORTS)
+        #define BACKEND_API __declspec(dllexport)
+    #else
+        #define BACKEND_API __declspec(dllimport)
+    #endif
+#else
+    #define BACKEND_API
+#endif
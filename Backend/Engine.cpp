@@ -1,7 +1,33 @@
-﻿#include <iostream>
-#if defined(_WIN32)
-    #define BACKEND_API __declspec(dllexport)
-#else
-    #define BACKEND_API
-#endif
-namespace Backend { BACKEND_API void Init() { std::cout << "Engine Init"; } }
+﻿#include <atomic>
+#include "Engine.h"
+#include "Geometry/MeshKernels.h"
+#include "Jobs/JobSystem.h"
+#include "Logging/Log.h"
+
+namespace Backend {
+    BACKEND_API void Init() {
+        // The calling thread (the UI thread) becomes job worker 0
+        Jobs::Initialize();
+        GE_LOG_INFO(Engine, "Engine Init (mesh kernels: {}, job threads: {})",
+                    Geometry::KernelLevelName(Geometry::GetKernelLevel()), Jobs::ThreadCount());
+    }
+
+    BACKEND_API void Shutdown() {
+        Jobs::Shutdown();
+        SetRedrawHandler(nullptr);
+    }
+
+    namespace {
+        std::atomic<RedrawHandler> s_redraw_handler{ nullptr };
+    }
+
+    BACKEND_API void SetRedrawHandler(RedrawHandler handler) {
+        s_redraw_handler.store(handler, std::memory_order_release);
+    }
+
+    BACKEND_API void RequestRedraw() {
+        if (RedrawHandler handler = s_redraw_handler.load(std::memory_order_acquire)) {
+            handler();
+        }
+    }
+}
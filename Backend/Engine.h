@@ -0,0 +1,26 @@
+#pragma once
+
+// Backend entry points called by the Frontend executables.
+
+#include "BackendAPI.h"
+
+namespace Backend {
+
+    BACKEND_API void Init();
+    BACKEND_API void Shutdown();
+
+    // ============================================================================
+    // REDRAW NOTIFICATION
+    // ============================================================================
+
+    // The Frontend installs a handler that wakes its (possibly idle) event loop.
+    // The handler must be safe to call from any thread.
+    using RedrawHandler = void (*)();
+
+    BACKEND_API void SetRedrawHandler(RedrawHandler handler);
+
+    // Thread-safe; call when async work finishes and the UI should show the
+    // result. No-op until a handler is installed.
+    BACKEND_API void RequestRedraw();
+
+}
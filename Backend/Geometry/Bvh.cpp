@@ -0,0 +1,772 @@
+#include "Geometry/Bvh.h"
+#include "Jobs/JobSystem.h"
+#include "Profiling/Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <memory>
+#include <mutex>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GE_BVH_SSE 1
+#endif
+
+namespace Backend::Geometry {
+
+    namespace {
+
+        constexpr int kBins = 16;
+        constexpr std::uint32_t kMaxLeafSize = 16;
+        // Past this depth splits fall back to median cuts, which bounds the
+        // tree depth and with it the fixed traversal stacks below
+        constexpr std::uint32_t kBalancedDepth = 40;
+        constexpr int kStackSize = 256;
+        constexpr std::size_t kParallelBinning = 1 << 17;
+        constexpr std::uint32_t kLeafEntry = 0x80000000u;
+
+        float HalfArea(const Aabb& box) {
+            if (!box.IsValid()) return 0.0f;
+            const glm::vec3 e = box.Extent();
+            return e.x * e.y + e.y * e.z + e.z * e.x;
+        }
+
+        bool Overlaps(const Aabb& a, const Aabb& b) {
+            return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+                   a.min.y <= b.max.y && a.max.y >= b.min.y &&
+                   a.min.z <= b.max.z && a.max.z >= b.min.z;
+        }
+
+        bool OutsidePlane(const glm::vec4& plane, const Aabb& box) {
+            const glm::vec3 p(plane.x >= 0.0f ? box.max.x : box.min.x,
+                              plane.y >= 0.0f ? box.max.y : box.min.y,
+                              plane.z >= 0.0f ? box.max.z : box.min.z);
+            return plane.x * p.x + plane.y * p.y + plane.z * p.z + plane.w < 0.0f;
+        }
+
+        bool InFrustum(const Frustum& frustum, const Aabb& box) {
+            if (!box.IsValid()) return false;
+            for (const glm::vec4& plane : frustum.planes) {
+                if (OutsidePlane(plane, box)) return false;
+            }
+            return true;
+        }
+
+        void SetLane(BvhNode4& node, int lane, const Aabb& box) {
+            node.min_x[lane] = box.min.x; node.min_y[lane] = box.min.y; node.min_z[lane] = box.min.z;
+            node.max_x[lane] = box.max.x; node.max_y[lane] = box.max.y; node.max_z[lane] = box.max.z;
+        }
+
+        Aabb LaneBounds(const BvhNode4& node, int lane) {
+            Aabb box;
+            box.min = glm::vec3(node.min_x[lane], node.min_y[lane], node.min_z[lane]);
+            box.max = glm::vec3(node.max_x[lane], node.max_y[lane], node.max_z[lane]);
+            return box;
+        }
+
+        Aabb NodeBounds(const BvhNode4& node) {
+            Aabb box;
+            for (int lane = 0; lane < 4; ++lane) {
+                if (node.child[lane] != BvhNode4::kEmpty) box.Expand(LaneBounds(node, lane));
+            }
+            return box;
+        }
+
+        // ============================================================================
+        // NODE TESTS (4 children at once)
+        // ============================================================================
+
+        struct RayPrep {
+            float origin[3];
+            float inv_dir[3];
+            bool negative[3];
+        };
+
+        RayPrep PrepareRay(const Ray& ray) {
+            RayPrep prep;
+            for (int axis = 0; axis < 3; ++axis) {
+                // Keep 1/d finite so slab distances never become 0 * inf = NaN
+                float d = ray.direction[axis];
+                if (std::abs(d) < 1e-20f) d = std::copysign(1e-20f, d);
+                prep.origin[axis] = ray.origin[axis];
+                prep.inv_dir[axis] = 1.0f / d;
+                prep.negative[axis] = d < 0.0f;
+            }
+            return prep;
+        }
+
+        // Slabs are picked by direction sign, so empty lanes (min > max) miss
+        // without a separate validity mask. Returns a lane bitmask.
+        int IntersectRay4(const BvhNode4& node, const RayPrep& ray, float t_min, float t_max, float* t_near) {
+            const float* near_x = ray.negative[0] ? node.max_x : node.min_x;
+            const float* far_x = ray.negative[0] ? node.min_x : node.max_x;
+            const float* near_y = ray.negative[1] ? node.max_y : node.min_y;
+            const float* far_y = ray.negative[1] ? node.min_y : node.max_y;
+            const float* near_z = ray.negative[2] ? node.max_z : node.min_z;
+            const float* far_z = ray.negative[2] ? node.min_z : node.max_z;
+#if defined(GE_BVH_SSE)
+            const __m128 ox = _mm_set1_ps(ray.origin[0]), oy = _mm_set1_ps(ray.origin[1]), oz = _mm_set1_ps(ray.origin[2]);
+            const __m128 ix = _mm_set1_ps(ray.inv_dir[0]), iy = _mm_set1_ps(ray.inv_dir[1]), iz = _mm_set1_ps(ray.inv_dir[2]);
+            const __m128 t0x = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(near_x), ox), ix);
+            const __m128 t0y = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(near_y), oy), iy);
+            const __m128 t0z = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(near_z), oz), iz);
+            const __m128 t1x = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(far_x), ox), ix);
+            const __m128 t1y = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(far_y), oy), iy);
+            const __m128 t1z = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(far_z), oz), iz);
+            const __m128 enter = _mm_max_ps(_mm_max_ps(t0x, t0y), _mm_max_ps(t0z, _mm_set1_ps(t_min)));
+            const __m128 exit = _mm_min_ps(_mm_min_ps(t1x, t1y), _mm_min_ps(t1z, _mm_set1_ps(t_max)));
+            _mm_storeu_ps(t_near, enter);
+            return _mm_movemask_ps(_mm_cmple_ps(enter, exit));
+#else
+            int mask = 0;
+            for (int lane = 0; lane < 4; ++lane) {
+                const float enter = std::max(std::max((near_x[lane] - ray.origin[0]) * ray.inv_dir[0],
+                                                      (near_y[lane] - ray.origin[1]) * ray.inv_dir[1]),
+                                             std::max((near_z[lane] - ray.origin[2]) * ray.inv_dir[2], t_min));
+                const float exit = std::min(std::min((far_x[lane] - ray.origin[0]) * ray.inv_dir[0],
+                                                     (far_y[lane] - ray.origin[1]) * ray.inv_dir[1]),
+                                            std::min((far_z[lane] - ray.origin[2]) * ray.inv_dir[2], t_max));
+                t_near[lane] = enter;
+                mask |= (enter <= exit ? 1 : 0) << lane;
+            }
+            return mask;
+#endif
+        }
+
+        int OverlapAabb4(const BvhNode4& node, const Aabb& box) {
+#if defined(GE_BVH_SSE)
+            __m128 hit = _mm_and_ps(_mm_cmple_ps(_mm_load_ps(node.min_x), _mm_set1_ps(box.max.x)),
+                                    _mm_cmpge_ps(_mm_load_ps(node.max_x), _mm_set1_ps(box.min.x)));
+            hit = _mm_and_ps(hit, _mm_and_ps(_mm_cmple_ps(_mm_load_ps(node.min_y), _mm_set1_ps(box.max.y)),
+                                             _mm_cmpge_ps(_mm_load_ps(node.max_y), _mm_set1_ps(box.min.y))));
+            hit = _mm_and_ps(hit, _mm_and_ps(_mm_cmple_ps(_mm_load_ps(node.min_z), _mm_set1_ps(box.max.z)),
+                                             _mm_cmpge_ps(_mm_load_ps(node.max_z), _mm_set1_ps(box.min.z))));
+            return _mm_movemask_ps(hit);
+#else
+            int mask = 0;
+            for (int lane = 0; lane < 4; ++lane) {
+                mask |= (Overlaps(LaneBounds(node, lane), box) ? 1 : 0) << lane;
+            }
+            return mask;
+#endif
+        }
+
+        // Returns lanes not outside any plane; `inside` gets the lanes fully
+        // inside all of them (their subtrees need no further tests)
+        int IntersectFrustum4(const BvhNode4& node, const Frustum& frustum, int& inside) {
+#if defined(GE_BVH_SSE)
+            __m128 outside = _mm_setzero_ps();
+            __m128 straddle = _mm_setzero_ps();
+            for (const glm::vec4& plane : frustum.planes) {
+                const __m128 a = _mm_set1_ps(plane.x), b = _mm_set1_ps(plane.y), c = _mm_set1_ps(plane.z);
+                const __m128 d = _mm_set1_ps(plane.w);
+                // Positive vertex decides "outside", negative vertex decides "inside"
+                const __m128 px = _mm_load_ps(plane.x >= 0.0f ? node.max_x : node.min_x);
+                const __m128 py = _mm_load_ps(plane.y >= 0.0f ? node.max_y : node.min_y);
+                const __m128 pz = _mm_load_ps(plane.z >= 0.0f ? node.max_z : node.min_z);
+                const __m128 nx = _mm_load_ps(plane.x >= 0.0f ? node.min_x : node.max_x);
+                const __m128 ny = _mm_load_ps(plane.y >= 0.0f ? node.min_y : node.max_y);
+                const __m128 nz = _mm_load_ps(plane.z >= 0.0f ? node.min_z : node.max_z);
+                const __m128 dp = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, px), _mm_mul_ps(b, py)), _mm_add_ps(_mm_mul_ps(c, pz), d));
+                const __m128 dn = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, nx), _mm_mul_ps(b, ny)), _mm_add_ps(_mm_mul_ps(c, nz), d));
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(dp, _mm_setzero_ps()));
+                straddle = _mm_or_ps(straddle, _mm_cmplt_ps(dn, _mm_setzero_ps()));
+            }
+            const int visible = ~_mm_movemask_ps(outside) & 0xF;
+            inside = visible & ~_mm_movemask_ps(straddle);
+            return visible;
+#else
+            int visible = 0;
+            inside = 0;
+            for (int lane = 0; lane < 4; ++lane) {
+                const Aabb box = LaneBounds(node, lane);
+                bool out = false, straddle = false;
+                for (const glm::vec4& plane : frustum.planes) {
+                    out = out || OutsidePlane(plane, box);
+                    const glm::vec3 n(plane.x >= 0.0f ? box.min.x : box.max.x,
+                                      plane.y >= 0.0f ? box.min.y : box.max.y,
+                                      plane.z >= 0.0f ? box.min.z : box.max.z);
+                    straddle = straddle || plane.x * n.x + plane.y * n.y + plane.z * n.z + plane.w < 0.0f;
+                }
+                visible |= (out ? 0 : 1) << lane;
+                inside |= (out || straddle ? 0 : 1) << lane;
+            }
+            return visible;
+#endif
+        }
+
+        // ============================================================================
+        // BUILD
+        // ============================================================================
+
+        struct BuildRange {
+            std::uint32_t begin = 0;
+            std::uint32_t end = 0;
+            Aabb bounds;
+            Aabb centroid_bounds;
+
+            std::uint32_t Count() const { return end - begin; }
+        };
+
+        struct Bin {
+            Aabb bounds;
+            Aabb centroids;
+            std::uint32_t count = 0;
+        };
+
+        struct BinSet {
+            Bin bins[3][kBins];
+
+            void Merge(const BinSet& other) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    for (int i = 0; i < kBins; ++i) {
+                        bins[axis][i].bounds.Expand(other.bins[axis][i].bounds);
+                        bins[axis][i].centroids.Expand(other.bins[axis][i].centroids);
+                        bins[axis][i].count += other.bins[axis][i].count;
+                    }
+                }
+            }
+        };
+
+        struct BuildContext {
+            const Aabb* bounds = nullptr;
+            std::vector<glm::vec3> centroids;
+            std::uint32_t* indices = nullptr;
+            BvhNode4* nodes = nullptr;
+            std::atomic<std::uint32_t> node_count{ 0 };
+            std::uint32_t max_leaf_size = 4;
+            std::uint32_t parallel_threshold = 0;
+            Jobs::JobCounter counter;
+        };
+
+        int BinOf(float c, float origin, float scale) {
+            const int bin = static_cast<int>((c - origin) * scale);
+            return std::clamp(bin, 0, kBins - 1);
+        }
+
+        void Accumulate(const BuildContext& ctx, std::uint32_t lo, std::uint32_t hi,
+                        const glm::vec3& origin, const glm::vec3& scale, BinSet& out) {
+            for (std::uint32_t i = lo; i < hi; ++i) {
+                const std::uint32_t prim = ctx.indices[i];
+                const glm::vec3& c = ctx.centroids[prim];
+                for (int axis = 0; axis < 3; ++axis) {
+                    Bin& bin = out.bins[axis][BinOf(c[axis], origin[axis], scale[axis])];
+                    bin.bounds.Expand(ctx.bounds[prim]);
+                    bin.centroids.Expand(c);
+                    bin.count += 1;
+                }
+            }
+        }
+
+        void ComputeRangeBounds(const BuildContext& ctx, BuildRange& range) {
+            range.bounds = Aabb{};
+            range.centroid_bounds = Aabb{};
+            for (std::uint32_t i = range.begin; i < range.end; ++i) {
+                const std::uint32_t prim = ctx.indices[i];
+                range.bounds.Expand(ctx.bounds[prim]);
+                range.centroid_bounds.Expand(ctx.centroids[prim]);
+            }
+        }
+
+        // Binned SAH over all three axes; median split when SAH cannot separate
+        // the range (coincident centroids) or once the tree is deep
+        void SplitRange(BuildContext& ctx, const BuildRange& range, bool balanced, BuildRange& left, BuildRange& right) {
+            const glm::vec3 extent = range.centroid_bounds.Extent();
+
+            if (!balanced) {
+                glm::vec3 scale(0.0f);
+                for (int axis = 0; axis < 3; ++axis) {
+                    if (extent[axis] > 0.0f) scale[axis] = kBins * (1.0f - 1e-5f) / extent[axis];
+                }
+                const glm::vec3 origin = range.centroid_bounds.min;
+
+                auto bins = std::make_unique<BinSet>();
+                if (range.Count() >= kParallelBinning && Jobs::IsInitialized()) {
+                    std::mutex merge_mutex;
+                    Jobs::ParallelFor(range.begin, range.end, kParallelBinning / 8, [&](std::size_t lo, std::size_t hi) {
+                        auto local = std::make_unique<BinSet>();
+                        Accumulate(ctx, static_cast<std::uint32_t>(lo), static_cast<std::uint32_t>(hi), origin, scale, *local);
+                        std::lock_guard<std::mutex> lock(merge_mutex);
+                        bins->Merge(*local);
+                    });
+                } else {
+                    Accumulate(ctx, range.begin, range.end, origin, scale, *bins);
+                }
+
+                // Cost of splitting after bin i: A(left) * N(left) + A(right) * N(right)
+                float best_cost = std::numeric_limits<float>::max();
+                int best_axis = -1, best_bin = -1;
+                for (int axis = 0; axis < 3; ++axis) {
+                    if (extent[axis] <= 0.0f) continue;
+                    const Bin* axis_bins = bins->bins[axis];
+                    float right_cost[kBins];
+                    Aabb acc;
+                    std::uint32_t count = 0;
+                    for (int i = kBins - 1; i > 0; --i) {
+                        acc.Expand(axis_bins[i].bounds);
+                        count += axis_bins[i].count;
+                        right_cost[i] = HalfArea(acc) * static_cast<float>(count);
+                    }
+                    acc = Aabb{};
+                    count = 0;
+                    for (int i = 0; i < kBins - 1; ++i) {
+                        acc.Expand(axis_bins[i].bounds);
+                        count += axis_bins[i].count;
+                        const float cost = HalfArea(acc) * static_cast<float>(count) + right_cost[i + 1];
+                        if (cost < best_cost) {
+                            best_cost = cost;
+                            best_axis = axis;
+                            best_bin = i;
+                        }
+                    }
+                }
+
+                if (best_axis >= 0) {
+                    const float origin_axis = origin[best_axis];
+                    const float scale_axis = scale[best_axis];
+                    const std::uint32_t* first = std::partition(ctx.indices + range.begin, ctx.indices + range.end,
+                        [&](std::uint32_t prim) {
+                            return BinOf(ctx.centroids[prim][best_axis], origin_axis, scale_axis) <= best_bin;
+                        });
+                    const auto mid = static_cast<std::uint32_t>(first - ctx.indices);
+                    if (mid != range.begin && mid != range.end) {
+                        left = BuildRange{ range.begin, mid, {}, {} };
+                        right = BuildRange{ mid, range.end, {}, {} };
+                        for (int i = 0; i < kBins; ++i) {
+                            BuildRange& side = i <= best_bin ? left : right;
+                            side.bounds.Expand(bins->bins[best_axis][i].bounds);
+                            side.centroid_bounds.Expand(bins->bins[best_axis][i].centroids);
+                        }
+                        return;
+                    }
+                }
+            }
+
+            const int axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+            const std::uint32_t mid = range.begin + range.Count() / 2;
+            std::nth_element(ctx.indices + range.begin, ctx.indices + mid, ctx.indices + range.end,
+                [&](std::uint32_t a, std::uint32_t b) { return ctx.centroids[a][axis] < ctx.centroids[b][axis]; });
+            left = BuildRange{ range.begin, mid, {}, {} };
+            right = BuildRange{ mid, range.end, {}, {} };
+            ComputeRangeBounds(ctx, left);
+            ComputeRangeBounds(ctx, right);
+        }
+
+        // Fills node `node_index` by splitting `range` into up to four children,
+        // always splitting the child with the largest surface area next
+        void BuildNode(BuildContext& ctx, std::uint32_t node_index, const BuildRange& range, std::uint32_t depth) {
+            BuildRange children[4];
+            children[0] = range;
+            int child_count = 1;
+            const bool balanced = depth >= kBalancedDepth;
+
+            while (child_count < 4) {
+                int best = -1;
+                float best_area = -1.0f;
+                for (int i = 0; i < child_count; ++i) {
+                    const float area = HalfArea(children[i].bounds);
+                    if (children[i].Count() > ctx.max_leaf_size && area > best_area) {
+                        best = i;
+                        best_area = area;
+                    }
+                }
+                if (best < 0) break;
+                BuildRange left, right;
+                SplitRange(ctx, children[best], balanced, left, right);
+                children[best] = left;
+                children[child_count++] = right;
+            }
+
+            BvhNode4& node = ctx.nodes[node_index];
+            for (int lane = 0; lane < 4; ++lane) {
+                if (lane >= child_count) {
+                    SetLane(node, lane, Aabb{});
+                    node.child[lane] = BvhNode4::kEmpty;
+                    node.count[lane] = 0;
+                    continue;
+                }
+                const BuildRange& child = children[lane];
+                SetLane(node, lane, child.bounds);
+                if (child.Count() <= ctx.max_leaf_size) {
+                    node.child[lane] = child.begin;
+                    node.count[lane] = static_cast<std::uint8_t>(child.Count());
+                    continue;
+                }
+
+                // Children are allocated after their parent, so reverse index
+                // order is a valid bottom-up order for Refit
+                const std::uint32_t child_index = ctx.node_count.fetch_add(1, std::memory_order_relaxed);
+                node.child[lane] = child_index;
+                node.count[lane] = 0;
+                if (child.Count() >= ctx.parallel_threshold) {
+                    BuildContext* shared = &ctx;
+                    Jobs::Run([shared, child_index, child, depth]() {
+                        BuildNode(*shared, child_index, child, depth + 1);
+                    }, &ctx.counter);
+                } else {
+                    BuildNode(ctx, child_index, child, depth + 1);
+                }
+            }
+        }
+
+        // ============================================================================
+        // TRIANGLES
+        // ============================================================================
+
+        glm::vec3 Vertex(const MeshView& mesh, std::uint32_t i) {
+            return glm::vec3(mesh.x[i], mesh.y[i], mesh.z[i]);
+        }
+
+        void ComputeTriangleBounds(const MeshView& mesh, std::vector<Aabb>& out) {
+            out.resize(mesh.triangle_count);
+            Jobs::ParallelFor(0, mesh.triangle_count, 16384, [&](std::size_t lo, std::size_t hi) {
+                for (std::size_t t = lo; t < hi; ++t) {
+                    Aabb box;
+                    box.Expand(Vertex(mesh, mesh.i0[t]));
+                    box.Expand(Vertex(mesh, mesh.i1[t]));
+                    box.Expand(Vertex(mesh, mesh.i2[t]));
+                    out[t] = box;
+                }
+            });
+        }
+
+        // Moller-Trumbore, two-sided
+        bool IntersectTriangle(const MeshView& mesh, std::uint32_t t, const Ray& ray, float& out_t, float& out_u, float& out_v) {
+            const glm::vec3 a = Vertex(mesh, mesh.i0[t]);
+            const glm::vec3 e1 = Vertex(mesh, mesh.i1[t]) - a;
+            const glm::vec3 e2 = Vertex(mesh, mesh.i2[t]) - a;
+            const glm::vec3 p = glm::cross(ray.direction, e2);
+            const float det = glm::dot(e1, p);
+            if (std::abs(det) < 1e-20f) return false;
+            const float inv_det = 1.0f / det;
+            const glm::vec3 s = ray.origin - a;
+            const float u = glm::dot(s, p) * inv_det;
+            if (u < 0.0f || u > 1.0f) return false;
+            const glm::vec3 q = glm::cross(s, e1);
+            const float v = glm::dot(ray.direction, q) * inv_det;
+            if (v < 0.0f || u + v > 1.0f) return false;
+            out_t = glm::dot(e2, q) * inv_det;
+            out_u = u;
+            out_v = v;
+            return true;
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // FRUSTUM
+    // ============================================================================
+
+    Frustum Frustum::FromMatrix(const glm::mat4& m) {
+        const glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+        const glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+        const glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+        const glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+        Frustum frustum;
+        frustum.planes[0] = row3 + row0;   // Left
+        frustum.planes[1] = row3 - row0;   // Right
+        frustum.planes[2] = row3 + row1;   // Bottom
+        frustum.planes[3] = row3 - row1;   // Top
+        frustum.planes[4] = row3 + row2;   // Near
+        frustum.planes[5] = row3 - row2;   // Far
+        for (glm::vec4& plane : frustum.planes) {
+            const float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+            if (length > 0.0f) plane = plane * (1.0f / length);
+        }
+        return frustum;
+    }
+
+    // ============================================================================
+    // BUILD / REFIT
+    // ============================================================================
+
+    void Bvh::Build(std::span<const Aabb> bounds, const BvhBuildConfig& config) {
+        GE_PROFILE_FUNCTION();
+        Clear();
+        if (bounds.empty()) return;
+        const auto count = static_cast<std::uint32_t>(bounds.size());
+
+        BuildContext ctx;
+        ctx.bounds = bounds.data();
+        ctx.max_leaf_size = std::clamp<std::uint32_t>(config.max_leaf_size, 1, kMaxLeafSize);
+        ctx.parallel_threshold = std::max<std::uint32_t>(config.parallel_threshold, ctx.max_leaf_size + 1);
+        ctx.centroids.resize(count);
+        m_indices.resize(count);
+        ctx.indices = m_indices.data();
+
+        BuildRange root{ 0, count, {}, {} };
+        std::mutex root_mutex;
+        Jobs::ParallelFor(0, count, 16384, [&](std::size_t lo, std::size_t hi) {
+            Aabb local_bounds, local_centroids;
+            for (std::size_t i = lo; i < hi; ++i) {
+                // Invalid boxes (never-updated entities) sit at the origin
+                const glm::vec3 c = bounds[i].IsValid() ? bounds[i].Center() : glm::vec3(0.0f);
+                ctx.centroids[i] = c;
+                ctx.indices[i] = static_cast<std::uint32_t>(i);
+                local_bounds.Expand(bounds[i]);
+                local_centroids.Expand(c);
+            }
+            std::lock_guard<std::mutex> lock(root_mutex);
+            root.bounds.Expand(local_bounds);
+            root.centroid_bounds.Expand(local_centroids);
+        });
+
+        // Every inner node has at least two children, so there are fewer inner
+        // nodes than primitives. The scratch array is left uninitialized and
+        // only the pages actually used get touched.
+        std::unique_ptr<BvhNode4[]> scratch(new BvhNode4[count]);
+        ctx.nodes = scratch.get();
+        ctx.node_count = 1;
+        BuildNode(ctx, 0, root, 0);
+        Jobs::Wait(ctx.counter);
+
+        m_nodes.assign(scratch.get(), scratch.get() + ctx.node_count.load());
+        m_slot_bounds.resize(count);
+        for (std::uint32_t slot = 0; slot < count; ++slot) {
+            m_slot_bounds[slot] = bounds[m_indices[slot]];
+        }
+        m_bounds = root.bounds;
+    }
+
+    void Bvh::Refit(std::span<const Aabb> bounds) {
+        GE_PROFILE_FUNCTION();
+        if (m_nodes.empty() || bounds.size() != m_indices.size()) return;
+
+        // Leaf lanes are independent; inner lanes then go bottom-up, which is
+        // reverse allocation order
+        Jobs::ParallelFor(0, m_nodes.size(), 1024, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t n = lo; n < hi; ++n) {
+                BvhNode4& node = m_nodes[n];
+                for (int lane = 0; lane < 4; ++lane) {
+                    if (!node.IsLeaf(lane)) continue;
+                    Aabb box;
+                    for (std::uint32_t slot = node.child[lane]; slot < node.child[lane] + node.count[lane]; ++slot) {
+                        m_slot_bounds[slot] = bounds[m_indices[slot]];
+                        box.Expand(m_slot_bounds[slot]);
+                    }
+                    SetLane(node, lane, box);
+                }
+            }
+        });
+        for (std::size_t n = m_nodes.size(); n-- > 0;) {
+            BvhNode4& node = m_nodes[n];
+            for (int lane = 0; lane < 4; ++lane) {
+                if (node.child[lane] != BvhNode4::kEmpty && !node.IsLeaf(lane)) {
+                    SetLane(node, lane, NodeBounds(m_nodes[node.child[lane]]));
+                }
+            }
+        }
+        m_bounds = NodeBounds(m_nodes[0]);
+    }
+
+    void Bvh::Clear() {
+        m_nodes.clear();
+        m_indices.clear();
+        m_slot_bounds.clear();
+        m_bounds = Aabb{};
+    }
+
+    BvhStats Bvh::ComputeStats() const {
+        BvhStats stats;
+        stats.node_count = m_nodes.size();
+        if (m_nodes.empty()) return stats;
+
+        // Traversal cost 1 per inner box test, 1 per primitive, weighted by the
+        // chance of reaching the box (area ratio to the root)
+        const double root_area = std::max(HalfArea(m_bounds), 1e-30f);
+        struct Entry { std::uint32_t node; std::uint32_t depth; };
+        std::vector<Entry> stack{ { 0, 1 } };
+        while (!stack.empty()) {
+            const Entry entry = stack.back();
+            stack.pop_back();
+            stats.max_depth = std::max(stats.max_depth, entry.depth);
+            const BvhNode4& node = m_nodes[entry.node];
+            for (int lane = 0; lane < 4; ++lane) {
+                if (node.child[lane] == BvhNode4::kEmpty) continue;
+                const double area = HalfArea(LaneBounds(node, lane)) / root_area;
+                if (node.IsLeaf(lane)) {
+                    stats.leaf_count += 1;
+                    stats.sah_cost += area * node.count[lane];
+                } else {
+                    stats.sah_cost += area;
+                    stack.push_back({ node.child[lane], entry.depth + 1 });
+                }
+            }
+        }
+        return stats;
+    }
+
+    // ============================================================================
+    // QUERIES
+    // ============================================================================
+
+    void Bvh::VisitSubtree(std::uint32_t root, VisitFn fn, void* ctx) const {
+        std::uint32_t stack[kStackSize];
+        int top = 0;
+        stack[top++] = root;
+        while (top > 0) {
+            const BvhNode4& node = m_nodes[stack[--top]];
+            for (int lane = 0; lane < 4; ++lane) {
+                if (node.child[lane] == BvhNode4::kEmpty) continue;
+                if (node.IsLeaf(lane)) {
+                    for (std::uint32_t slot = node.child[lane]; slot < node.child[lane] + node.count[lane]; ++slot) {
+                        fn(ctx, m_indices[slot]);
+                    }
+                } else {
+                    stack[top++] = node.child[lane];
+                }
+            }
+        }
+    }
+
+    void Bvh::QueryAabbImpl(const Aabb& box, VisitFn fn, void* ctx) const {
+        if (m_nodes.empty() || !box.IsValid()) return;
+        std::uint32_t stack[kStackSize];
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const BvhNode4& node = m_nodes[stack[--top]];
+            int mask = OverlapAabb4(node, box);
+            while (mask) {
+                const int lane = std::countr_zero(static_cast<unsigned>(mask));
+                mask &= mask - 1;
+                if (!node.IsLeaf(lane)) {
+                    stack[top++] = node.child[lane];
+                    continue;
+                }
+                for (std::uint32_t slot = node.child[lane]; slot < node.child[lane] + node.count[lane]; ++slot) {
+                    if (Overlaps(m_slot_bounds[slot], box)) fn(ctx, m_indices[slot]);
+                }
+            }
+        }
+    }
+
+    void Bvh::QueryFrustumImpl(const Frustum& frustum, VisitFn fn, void* ctx) const {
+        if (m_nodes.empty()) return;
+        std::uint32_t stack[kStackSize];
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const BvhNode4& node = m_nodes[stack[--top]];
+            int inside = 0;
+            int mask = IntersectFrustum4(node, frustum, inside);
+            while (mask) {
+                const int lane = std::countr_zero(static_cast<unsigned>(mask));
+                mask &= mask - 1;
+                if (node.child[lane] == BvhNode4::kEmpty) continue;
+                const bool contained = (inside >> lane) & 1;
+                if (!node.IsLeaf(lane)) {
+                    if (contained) {
+                        VisitSubtree(node.child[lane], fn, ctx);
+                    } else {
+                        stack[top++] = node.child[lane];
+                    }
+                    continue;
+                }
+                for (std::uint32_t slot = node.child[lane]; slot < node.child[lane] + node.count[lane]; ++slot) {
+                    if (contained || InFrustum(frustum, m_slot_bounds[slot])) fn(ctx, m_indices[slot]);
+                }
+            }
+        }
+    }
+
+    void Bvh::RaycastImpl(const Ray& ray, RayFn fn, void* ctx) const {
+        if (m_nodes.empty()) return;
+        const RayPrep prep = PrepareRay(ray);
+        float t_max = ray.t_max;
+
+        // Entries are node indices, or kLeafEntry | node << 2 | lane for leaves,
+        // each with the distance at which the ray enters its box
+        std::uint32_t stack[kStackSize];
+        float stack_t[kStackSize];
+        int top = 0;
+        stack[top] = 0;
+        stack_t[top++] = ray.t_min;
+
+        while (top > 0) {
+            --top;
+            if (stack_t[top] > t_max) continue;   // A closer hit was found since it was pushed
+            const std::uint32_t entry = stack[top];
+
+            if (entry & kLeafEntry) {
+                const BvhNode4& node = m_nodes[(entry & ~kLeafEntry) >> 2];
+                const int lane = static_cast<int>(entry & 3);
+                for (std::uint32_t slot = node.child[lane]; slot < node.child[lane] + node.count[lane]; ++slot) {
+                    if (fn(ctx, m_indices[slot], t_max)) return;
+                }
+                continue;
+            }
+
+            const BvhNode4& node = m_nodes[entry];
+            alignas(16) float t_near[4];
+            int mask = IntersectRay4(node, prep, ray.t_min, t_max, t_near);
+            if (!mask) continue;
+
+            // Push far to near so the nearest child is popped first
+            int lanes[4];
+            int hits = 0;
+            while (mask) {
+                const int lane = std::countr_zero(static_cast<unsigned>(mask));
+                mask &= mask - 1;
+                int at = hits++;
+                while (at > 0 && t_near[lanes[at - 1]] < t_near[lane]) {
+                    lanes[at] = lanes[at - 1];
+                    --at;
+                }
+                lanes[at] = lane;
+            }
+            for (int i = 0; i < hits; ++i) {
+                const int lane = lanes[i];
+                stack[top] = node.IsLeaf(lane) ? kLeafEntry | (entry << 2) | static_cast<std::uint32_t>(lane) : node.child[lane];
+                stack_t[top++] = t_near[lane];
+            }
+        }
+    }
+
+    // ============================================================================
+    // TRIANGLE BVH
+    // ============================================================================
+
+    void TriangleBvh::Build(const MeshView& mesh, const BvhBuildConfig& config) {
+        GE_PROFILE_FUNCTION();
+        m_mesh = mesh;
+        std::vector<Aabb> bounds;
+        ComputeTriangleBounds(mesh, bounds);
+        m_bvh.Build(bounds, config);
+    }
+
+    void TriangleBvh::Refit() {
+        GE_PROFILE_FUNCTION();
+        std::vector<Aabb> bounds;
+        ComputeTriangleBounds(m_mesh, bounds);
+        m_bvh.Refit(bounds);
+    }
+
+    bool TriangleBvh::Raycast(const Ray& ray, RayHit& hit) const {
+        RayHit best;
+        m_bvh.Raycast(ray, [&](std::uint32_t triangle, float& t_max) {
+            float t, u, v;
+            if (IntersectTriangle(m_mesh, triangle, ray, t, u, v) && t >= ray.t_min && t < t_max) {
+                t_max = t;
+                best = RayHit{ t, triangle, u, v };
+            }
+            return false;
+        });
+        hit = best;
+        return best.IsHit();
+    }
+
+    bool TriangleBvh::Occluded(const Ray& ray) const {
+        bool occluded = false;
+        m_bvh.Raycast(ray, [&](std::uint32_t triangle, float& t_max) {
+            float t, u, v;
+            occluded = IntersectTriangle(m_mesh, triangle, ray, t, u, v) && t >= ray.t_min && t <= t_max;
+            return occluded;
+        });
+        return occluded;
+    }
+
+} // namespace Backend::Geometry
@@ -0,0 +1,176 @@
+#pragma once
+
+// Bounding volume hierarchy over axis-aligned boxes.
+//
+// Built top-down with binned SAH directly into 4-wide nodes: each node stores
+// its four child boxes as SoA lanes (min_x[4], ..., max_z[4]) so one SSE test
+// checks all children against a ray, box or frustum plane. Nodes are 128 bytes,
+// allocated parent-before-child in one flat array, and leaves reference a
+// contiguous run of the reordered primitive list (with a copy of their boxes
+// in the same order, so leaf tests stay sequential). Large subtrees are built
+// as jobs on the Backend job system.
+//
+// Bvh is primitive-agnostic: box and frustum queries are exact against the
+// primitive boxes, ray casts hand candidates to the caller for the exact test.
+// TriangleBvh wraps it for ray casts against a MeshView; Scene keeps one over
+// entity world bounds. Refit() updates boxes for moved primitives
+// without touching the topology; rebuild when motion is large enough that
+// query times degrade.
+
+#include "BackendAPI.h"
+#include "Geometry/MeshSoA.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Backend::Geometry {
+
+    // ============================================================================
+    // QUERY TYPES
+    // ============================================================================
+
+    struct Ray {
+        glm::vec3 origin = glm::vec3(0.0f);
+        glm::vec3 direction = glm::vec3(0.0f, 0.0f, 1.0f);   // Need not be normalized; t is in its units
+        float t_min = 0.0f;
+        float t_max = std::numeric_limits<float>::max();
+    };
+
+    struct RayHit {
+        float t = std::numeric_limits<float>::max();
+        std::uint32_t primitive = 0xFFFFFFFFu;
+        float u = 0.0f;     // Barycentrics of corners 1 and 2
+        float v = 0.0f;
+
+        bool IsHit() const { return primitive != 0xFFFFFFFFu; }
+    };
+
+    // Planes as (normal, d) with normal pointing inward: inside when dot(n, p) + d >= 0
+    struct Frustum {
+        glm::vec4 planes[6];
+
+        // Gribb/Hartmann extraction from a column-major view-projection matrix
+        // (OpenGL clip space, z in [-w, w])
+        BACKEND_API static Frustum FromMatrix(const glm::mat4& view_projection);
+    };
+
+    // ============================================================================
+    // NODE LAYOUT
+    // ============================================================================
+
+    // Trivially constructible so large node arrays can be allocated untouched
+    struct alignas(64) BvhNode4 {
+        static constexpr std::uint32_t kEmpty = 0xFFFFFFFFu;
+
+        float min_x[4], min_y[4], min_z[4];
+        float max_x[4], max_y[4], max_z[4];
+        std::uint32_t child[4];     // Inner: node index. Leaf: first primitive slot. kEmpty: unused.
+        std::uint8_t count[4];      // Primitives in a leaf, 0 for inner children
+
+        bool IsLeaf(int i) const { return count[i] != 0; }
+    };
+    static_assert(sizeof(BvhNode4) == 128);
+
+    struct BvhBuildConfig {
+        std::uint32_t max_leaf_size = 4;
+        std::uint32_t parallel_threshold = 16384;   // Subtrees at least this large become jobs
+    };
+
+    struct BvhStats {
+        std::size_t node_count = 0;
+        std::size_t leaf_count = 0;
+        std::uint32_t max_depth = 0;
+        double sah_cost = 0.0;      // Relative to the root area; lower traces faster
+    };
+
+    // ============================================================================
+    // BVH
+    // ============================================================================
+
+    class BACKEND_API Bvh {
+    public:
+        // Primitive ids are indices into `bounds`
+        void Build(std::span<const Aabb> bounds, const BvhBuildConfig& config = {});
+
+        // Same primitives (same count and ids) with new boxes
+        void Refit(std::span<const Aabb> bounds);
+
+        void Clear();
+        bool IsEmpty() const { return m_nodes.empty(); }
+        std::size_t PrimitiveCount() const { return m_indices.size(); }
+        const Aabb& Bounds() const { return m_bounds; }
+        std::span<const BvhNode4> Nodes() const { return m_nodes; }
+        BvhStats ComputeStats() const;
+
+        // fn(std::uint32_t primitive) for every primitive whose box overlaps `box`
+        template <typename Fn>
+        void QueryAabb(const Aabb& box, Fn&& fn) const {
+            QueryAabbImpl(box, &Thunk<Fn>, &fn);
+        }
+
+        // fn(std::uint32_t primitive) for every primitive whose box is not
+        // fully outside `frustum` (conservative, like any box/plane test)
+        template <typename Fn>
+        void QueryFrustum(const Frustum& frustum, Fn&& fn) const {
+            QueryFrustumImpl(frustum, &Thunk<Fn>, &fn);
+        }
+
+        // fn(std::uint32_t primitive, float& t_max) -> bool for primitives in
+        // leaves the ray reaches, nearest subtrees first. Lower t_max on a hit to
+        // prune the rest; return true to stop (any-hit queries).
+        template <typename Fn>
+        void Raycast(const Ray& ray, Fn&& fn) const {
+            RaycastImpl(ray, [](void* ctx, std::uint32_t primitive, float& t_max) {
+                return (*static_cast<std::remove_reference_t<Fn>*>(ctx))(primitive, t_max);
+            }, &fn);
+        }
+
+    private:
+        using VisitFn = void (*)(void*, std::uint32_t);
+        using RayFn = bool (*)(void*, std::uint32_t, float&);
+
+        template <typename Fn>
+        static void Thunk(void* ctx, std::uint32_t primitive) {
+            (*static_cast<std::remove_reference_t<Fn>*>(ctx))(primitive);
+        }
+
+        void QueryAabbImpl(const Aabb& box, VisitFn fn, void* ctx) const;
+        void QueryFrustumImpl(const Frustum& frustum, VisitFn fn, void* ctx) const;
+        void RaycastImpl(const Ray& ray, RayFn fn, void* ctx) const;
+        void VisitSubtree(std::uint32_t node, VisitFn fn, void* ctx) const;
+
+        AlignedVector<BvhNode4> m_nodes;
+        std::vector<std::uint32_t> m_indices;   // Leaf slots -> primitive ids
+        std::vector<Aabb> m_slot_bounds;        // Primitive boxes in slot order
+        Aabb m_bounds;
+    };
+
+    // ============================================================================
+    // TRIANGLE BVH
+    // ============================================================================
+
+    // Non-owning: the mesh must outlive the BVH and keep its topology.
+    // Moving vertices in place is fine after Refit().
+    class BACKEND_API TriangleBvh {
+    public:
+        void Build(const MeshView& mesh, const BvhBuildConfig& config = {});
+        void Refit();
+
+        // Closest hit within [t_min, t_max]; false if nothing was hit
+        bool Raycast(const Ray& ray, RayHit& hit) const;
+        // Any hit within [t_min, t_max] (shadow / occlusion rays)
+        bool Occluded(const Ray& ray) const;
+
+        const Bvh& Hierarchy() const { return m_bvh; }
+        const MeshView& Mesh() const { return m_mesh; }
+
+    private:
+        MeshView m_mesh;
+        Bvh m_bvh;
+    };
+
+} // namespace Backend::Geometry
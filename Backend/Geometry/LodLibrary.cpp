@@ -0,0 +1,175 @@
+#include "Geometry/LodLibrary.h"
+#include "Engine.h"
+#include "Profiling/Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Backend::Geometry {
+
+    LodLibrary::LodLibrary() {
+        m_thread = std::thread(&LodLibrary::BuilderLoop, this);
+    }
+
+    LodLibrary::~LodLibrary() {
+        Stop();
+    }
+
+    void LodLibrary::Stop() {
+        if (!m_thread.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+            m_queue.clear();
+            for (auto& [id, entry] : m_entries) entry.building = false;
+        }
+        m_wake.notify_one();
+        m_thread.join();
+    }
+
+    // ============================================================================
+    // UI THREAD
+    // ============================================================================
+
+    std::uint32_t LodLibrary::Add(MeshSoA mesh) {
+        auto shared = std::make_shared<const MeshSoA>(std::move(mesh));
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const std::uint32_t id = m_next_id++;
+        m_entries[id].mesh = std::move(shared);
+        ++m_generation;
+        return id;
+    }
+
+    bool LodLibrary::Remove(std::uint32_t id) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // A build in flight for `id` finds the entry gone and drops its result
+        if (m_entries.erase(id) == 0) return false;
+        std::erase_if(m_queue, [id](const auto& request) { return request.first == id; });
+        ++m_generation;
+        return true;
+    }
+
+    bool LodLibrary::Contains(std::uint32_t id) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_entries.contains(id);
+    }
+
+    bool LodLibrary::RequestLods(std::uint32_t id, const LodChainOptions& options) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const auto it = m_entries.find(id);
+            if (m_stop || it == m_entries.end()) return false;
+            it->second.building = true;
+            bool replaced = false;
+            for (auto& request : m_queue) {
+                if (request.first == id) {
+                    request.second = options;
+                    replaced = true;
+                }
+            }
+            if (!replaced) m_queue.emplace_back(id, options);
+        }
+        m_wake.notify_one();
+        return true;
+    }
+
+    bool LodLibrary::GetInfo(std::uint32_t id, LodMeshInfo& out) const {
+        std::shared_ptr<const MeshSoA> mesh;
+        std::shared_ptr<const LodChain> lods;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const auto it = m_entries.find(id);
+            if (it == m_entries.end()) return false;
+            mesh = it->second.mesh;
+            lods = it->second.lods;
+            out.building = it->second.building;
+            out.build_ms = it->second.build_ms;
+        }
+        out.triangles = mesh->TriangleCount();
+        out.vertices = mesh->VertexCount();
+        out.levels.clear();
+        if (lods) {
+            for (const MeshLod& lod : *lods) out.levels.push_back({ lod.mesh.TriangleCount(), lod.error });
+        }
+        return true;
+    }
+
+    std::shared_ptr<const MeshSoA> LodLibrary::GetMesh(std::uint32_t id) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto it = m_entries.find(id);
+        return it != m_entries.end() ? it->second.mesh : nullptr;
+    }
+
+    std::shared_ptr<const LodLibrary::LodChain> LodLibrary::GetLods(std::uint32_t id) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto it = m_entries.find(id);
+        return it != m_entries.end() ? it->second.lods : nullptr;
+    }
+
+    std::vector<std::uint32_t> LodLibrary::Ids() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<std::uint32_t> ids;
+        ids.reserve(m_entries.size());
+        for (const auto& [id, entry] : m_entries) ids.push_back(id);
+        return ids;
+    }
+
+    std::uint64_t LodLibrary::Generation() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_generation;
+    }
+
+    void LodLibrary::Flush() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_drained.wait(lock, [this] { return m_stop || (m_queue.empty() && !m_busy); });
+    }
+
+    // ============================================================================
+    // BUILDER THREAD
+    // ============================================================================
+
+    void LodLibrary::BuilderLoop() {
+        Profiling::SetThreadName("LOD Builder");
+        for (;;) {
+            std::uint32_t id = 0;
+            LodChainOptions options;
+            std::shared_ptr<const MeshSoA> mesh;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_busy = false;
+                if (m_queue.empty()) m_drained.notify_all();
+                m_wake.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+                if (m_stop) break;
+                id = m_queue.front().first;
+                options = m_queue.front().second;
+                m_queue.pop_front();
+                mesh = m_entries.at(id).mesh;
+                m_busy = true;
+            }
+
+            GE_PROFILE_ZONE("LodLibrary::Build");
+            const auto start = std::chrono::steady_clock::now();
+            auto lods = std::make_shared<const LodChain>(BuildLodChain(mesh->View(), options));
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                const auto it = m_entries.find(id);
+                if (it != m_entries.end() && it->second.mesh == mesh) {
+                    it->second.lods = std::move(lods);
+                    it->second.build_ms = ms;
+                    // A newer request for the same mesh keeps it marked as building
+                    it->second.building = std::any_of(m_queue.begin(), m_queue.end(),
+                                                      [id](const auto& request) { return request.first == id; });
+                    ++m_generation;
+                }
+            }
+            RequestRedraw();
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_busy = false;
+        m_drained.notify_all();
+    }
+
+} // namespace Backend::Geometry
@@ -0,0 +1,97 @@
+#pragma once
+
+// Mesh library with background LOD chain generation.
+//
+// Meshes are immutable once added and handed out as shared_ptrs, so the
+// viewport, the renderer upload path and the builder can all read them
+// without holding the library lock. RequestLods() queues a chain build on a
+// builder thread owned by the library (the decimator itself fans out over the
+// job system); the finished chain replaces the previous one atomically and a
+// redraw is requested so the viewport can pick it up.
+
+#include "BackendAPI.h"
+#include "Geometry/Simplify.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Backend::Geometry {
+
+    struct LodLevelInfo {
+        std::size_t triangles = 0;
+        float error = 0.0f;
+    };
+
+    struct LodMeshInfo {
+        std::size_t triangles = 0;
+        std::size_t vertices = 0;
+        bool building = false;
+        double build_ms = 0.0;              // Last completed chain
+        std::vector<LodLevelInfo> levels;   // Empty until a chain was built
+    };
+
+    class BACKEND_API LodLibrary {
+    public:
+        using LodChain = std::vector<MeshLod>;
+
+        LodLibrary();
+        ~LodLibrary();
+
+        LodLibrary(const LodLibrary&) = delete;
+        LodLibrary& operator=(const LodLibrary&) = delete;
+
+        // Returns the new mesh id (usable as a MeshHandle and renderer mesh id)
+        std::uint32_t Add(MeshSoA mesh);
+        bool Remove(std::uint32_t id);
+        bool Contains(std::uint32_t id) const;
+
+        // Queues a chain build; a pending request for the same mesh is replaced.
+        // False for unknown ids or after Stop().
+        bool RequestLods(std::uint32_t id, const LodChainOptions& options = {});
+
+        bool GetInfo(std::uint32_t id, LodMeshInfo& out) const;
+        std::shared_ptr<const MeshSoA> GetMesh(std::uint32_t id) const;
+        // Null until a chain was built; level 0 is the source mesh
+        std::shared_ptr<const LodChain> GetLods(std::uint32_t id) const;
+        std::vector<std::uint32_t> Ids() const;
+
+        // Bumped whenever a mesh or chain is added or removed
+        std::uint64_t Generation() const;
+
+        // Blocks until every queued build finished
+        void Flush();
+
+        // Finishes the build in flight, drops queued ones and joins the builder
+        // (before Backend::Shutdown; the destructor calls it too)
+        void Stop();
+
+    private:
+        struct Entry {
+            std::shared_ptr<const MeshSoA> mesh;
+            std::shared_ptr<const LodChain> lods;
+            bool building = false;
+            double build_ms = 0.0;
+        };
+
+        void BuilderLoop();
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_drained;
+        std::unordered_map<std::uint32_t, Entry> m_entries;
+        std::deque<std::pair<std::uint32_t, LodChainOptions>> m_queue;
+        std::uint32_t m_next_id = 0;
+        std::uint64_t m_generation = 0;
+        bool m_busy = false;
+        bool m_stop = false;
+        std::thread m_thread;
+    };
+
+} // namespace Backend::Geometry
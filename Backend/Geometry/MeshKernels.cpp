@@ -0,0 +1,274 @@
+#include "Geometry/MeshKernels.h"
+#include "Geometry/MeshKernelsInternal.h"
+#include "Jobs/JobSystem.h"
+#include "Geometry/Primitives.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <mutex>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #include <immintrin.h>
+#endif
+
+namespace Backend::Geometry {
+
+    // ============================================================================
+    // SCALAR FALLBACK
+    // ============================================================================
+
+    namespace {
+
+        using Corners = Shared::Geometry::Triangle3<float>;
+
+        inline Corners LoadCorners(const MeshView& m, std::size_t t) {
+            const std::uint32_t a = m.i0[t], b = m.i1[t], c = m.i2[t];
+            return Corners{ { m.x[a], m.y[a], m.z[a] }, { m.x[b], m.y[b], m.z[b] }, { m.x[c], m.y[c], m.z[c] } };
+        }
+
+        inline void Cross(const Corners& k, float& nx, float& ny, float& nz) {
+            const Shared::Geometry::Point3<float> n = Shared::Geometry::FaceNormal(k);
+            nx = n.x;
+            ny = n.y;
+            nz = n.z;
+        }
+
+        inline float Area(const Corners& k) {
+            return Shared::Geometry::Area(k);
+        }
+
+        inline float Perimeter(const Corners& k) {
+            return Shared::Geometry::Perimeter(k);
+        }
+
+        void ScalarAreas(const MeshView& m, std::size_t first, std::size_t count, float* out) {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = Area(LoadCorners(m, first + i));
+            }
+        }
+
+        void ScalarPerimeters(const MeshView& m, std::size_t first, std::size_t count, float* out) {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = Perimeter(LoadCorners(m, first + i));
+            }
+        }
+
+        void ScalarFaceNormals(const MeshView& m, std::size_t first, std::size_t count,
+                               float* nx, float* ny, float* nz) {
+            for (std::size_t i = 0; i < count; ++i) {
+                float x, y, z;
+                Cross(LoadCorners(m, first + i), x, y, z);
+                const float len = std::sqrt(x * x + y * y + z * z);
+                const float inv = len > 0.0f ? 1.0f / len : 0.0f;
+                nx[i] = x * inv;
+                ny[i] = y * inv;
+                nz[i] = z * inv;
+            }
+        }
+
+        void ScalarBounds(const float* x, const float* y, const float* z, std::size_t count,
+                          float out_min[3], float out_max[3]) {
+            for (std::size_t i = 0; i < count; ++i) {
+                out_min[0] = std::min(out_min[0], x[i]); out_max[0] = std::max(out_max[0], x[i]);
+                out_min[1] = std::min(out_min[1], y[i]); out_max[1] = std::max(out_max[1], y[i]);
+                out_min[2] = std::min(out_min[2], z[i]); out_max[2] = std::max(out_max[2], z[i]);
+            }
+        }
+
+        void ScalarSums(const MeshView& m, std::size_t first, std::size_t count,
+                        double* area, double* perimeter) {
+            for (std::size_t i = 0; i < count; ++i) {
+                const Corners k = LoadCorners(m, first + i);
+                *area += Area(k);
+                *perimeter += Perimeter(k);
+            }
+        }
+
+        const Internal::KernelTable s_scalar_kernels = {
+            ScalarAreas,
+            ScalarPerimeters,
+            ScalarFaceNormals,
+            ScalarBounds,
+            ScalarSums
+        };
+
+        // ============================================================================
+        // CPU DETECTION
+        // ============================================================================
+
+        KernelLevel DetectKernelLevel() {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_cpu_init();
+            if (Internal::GetAVX2Kernels() && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+                return KernelLevel::AVX2;
+            }
+            if (Internal::GetSSEKernels() && __builtin_cpu_supports("sse2")) {
+                return KernelLevel::SSE;
+            }
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            int info[4] = {};
+            __cpuid(info, 1);
+            const bool sse2 = (info[3] & (1 << 26)) != 0;
+            const bool fma = (info[2] & (1 << 12)) != 0;
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            const bool avx = (info[2] & (1 << 28)) != 0;
+            bool ymm_enabled = false;
+            if (osxsave && avx) {
+                ymm_enabled = (_xgetbv(0) & 0x6) == 0x6;
+            }
+            __cpuidex(info, 7, 0);
+            const bool avx2 = (info[1] & (1 << 5)) != 0;
+            if (Internal::GetAVX2Kernels() && avx2 && fma && ymm_enabled) {
+                return KernelLevel::AVX2;
+            }
+            if (Internal::GetSSEKernels() && sse2) {
+                return KernelLevel::SSE;
+            }
+#endif
+            return KernelLevel::Scalar;
+        }
+
+        const KernelLevel s_supported_level = DetectKernelLevel();
+        std::atomic<KernelLevel> s_active_level{ s_supported_level };
+
+        const Internal::KernelTable& Kernels() {
+            switch (s_active_level.load(std::memory_order_relaxed)) {
+                case KernelLevel::AVX2: return *Internal::GetAVX2Kernels();
+                case KernelLevel::SSE:  return *Internal::GetSSEKernels();
+                case KernelLevel::Scalar:
+                default:                return s_scalar_kernels;
+            }
+        }
+
+    } // namespace
+
+    const Internal::KernelTable& Internal::GetScalarKernels() { return s_scalar_kernels; }
+
+    // ============================================================================
+    // PUBLIC API
+    // ============================================================================
+
+    KernelLevel GetSupportedKernelLevel() { return s_supported_level; }
+    KernelLevel GetKernelLevel() { return s_active_level.load(std::memory_order_relaxed); }
+
+    void SetKernelLevel(KernelLevel level) {
+        s_active_level.store(std::min(level, s_supported_level), std::memory_order_relaxed);
+    }
+
+    const char* KernelLevelName(KernelLevel level) {
+        switch (level) {
+            case KernelLevel::AVX2: return "AVX2";
+            case KernelLevel::SSE:  return "SSE2";
+            case KernelLevel::Scalar:
+            default:                return "Scalar";
+        }
+    }
+
+    void ComputeTriangleAreas(const MeshView& mesh, std::size_t first, std::size_t count,
+                              std::span<float> out_areas) {
+        assert(first + count <= mesh.triangle_count && out_areas.size() >= count);
+        Kernels().triangle_areas(mesh, first, count, out_areas.data());
+    }
+
+    void ComputeTrianglePerimeters(const MeshView& mesh, std::size_t first, std::size_t count,
+                                   std::span<float> out_perimeters) {
+        assert(first + count <= mesh.triangle_count && out_perimeters.size() >= count);
+        Kernels().triangle_perimeters(mesh, first, count, out_perimeters.data());
+    }
+
+    void ComputeFaceNormals(const MeshView& mesh, std::size_t first, std::size_t count,
+                            std::span<float> out_nx, std::span<float> out_ny, std::span<float> out_nz) {
+        assert(first + count <= mesh.triangle_count);
+        assert(out_nx.size() >= count && out_ny.size() >= count && out_nz.size() >= count);
+        Kernels().face_normals(mesh, first, count, out_nx.data(), out_ny.data(), out_nz.data());
+    }
+
+    void ComputeVertexNormals(const MeshView& mesh,
+                              std::span<float> out_nx, std::span<float> out_ny, std::span<float> out_nz) {
+        assert(out_nx.size() >= mesh.vertex_count);
+        assert(out_ny.size() >= mesh.vertex_count && out_nz.size() >= mesh.vertex_count);
+
+        std::fill_n(out_nx.data(), mesh.vertex_count, 0.0f);
+        std::fill_n(out_ny.data(), mesh.vertex_count, 0.0f);
+        std::fill_n(out_nz.data(), mesh.vertex_count, 0.0f);
+
+        // The scatter is inherently scalar; the unnormalised cross product
+        // already carries the 2x area weight.
+        for (std::size_t t = 0; t < mesh.triangle_count; ++t) {
+            float nx, ny, nz;
+            Cross(LoadCorners(mesh, t), nx, ny, nz);
+            for (const std::uint32_t v : { mesh.i0[t], mesh.i1[t], mesh.i2[t] }) {
+                out_nx[v] += nx;
+                out_ny[v] += ny;
+                out_nz[v] += nz;
+            }
+        }
+
+        for (std::size_t v = 0; v < mesh.vertex_count; ++v) {
+            const float len = std::sqrt(out_nx[v] * out_nx[v] + out_ny[v] * out_ny[v] + out_nz[v] * out_nz[v]);
+            const float inv = len > 0.0f ? 1.0f / len : 0.0f;
+            out_nx[v] *= inv;
+            out_ny[v] *= inv;
+            out_nz[v] *= inv;
+        }
+    }
+
+    Aabb ComputeBounds(const MeshView& mesh) {
+        Aabb box;
+        if (mesh.vertex_count == 0) return box;
+        float mn[3] = { box.min.x, box.min.y, box.min.z };
+        float mx[3] = { box.max.x, box.max.y, box.max.z };
+        Kernels().bounds(mesh.x, mesh.y, mesh.z, mesh.vertex_count, mn, mx);
+        box.min = glm::vec3(mn[0], mn[1], mn[2]);
+        box.max = glm::vec3(mx[0], mx[1], mx[2]);
+        return box;
+    }
+
+    MeshMetrics ComputeMetrics(const MeshView& mesh, std::size_t first, std::size_t count) {
+        assert(first + count <= mesh.triangle_count);
+        MeshMetrics metrics;
+        metrics.triangle_count = count;
+        Kernels().area_perimeter_sums(mesh, first, count, &metrics.surface_area, &metrics.perimeter_sum);
+        return metrics;
+    }
+
+    MeshMetrics ComputeMetrics(const MeshView& mesh) {
+        MeshMetrics metrics = ComputeMetrics(mesh, 0, mesh.triangle_count);
+        metrics.bounds = ComputeBounds(mesh);
+        return metrics;
+    }
+
+    MeshMetrics ComputeMetricsParallel(const MeshView& mesh) {
+        // Chunks large enough that per-chunk overhead stays under the kernel cost
+        constexpr std::size_t kTriangleGrain = 64 * 1024;
+        constexpr std::size_t kVertexGrain = 256 * 1024;
+
+        MeshMetrics metrics;
+        metrics.triangle_count = mesh.triangle_count;
+        std::mutex merge_mutex;
+
+        Jobs::ParallelFor(0, mesh.triangle_count, kTriangleGrain, [&](std::size_t begin, std::size_t end) {
+            const MeshMetrics partial = ComputeMetrics(mesh, begin, end - begin);
+            std::lock_guard<std::mutex> lock(merge_mutex);
+            metrics.surface_area += partial.surface_area;
+            metrics.perimeter_sum += partial.perimeter_sum;
+        });
+
+        Jobs::ParallelFor(0, mesh.vertex_count, kVertexGrain, [&](std::size_t begin, std::size_t end) {
+            MeshView slice = mesh;
+            slice.x += begin;
+            slice.y += begin;
+            slice.z += begin;
+            slice.vertex_count = end - begin;
+            const Aabb partial = ComputeBounds(slice);
+            std::lock_guard<std::mutex> lock(merge_mutex);
+            metrics.bounds.Expand(partial);
+        });
+
+        return metrics;
+    }
+
+} // namespace Backend::Geometry
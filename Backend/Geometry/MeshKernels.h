@@ -0,0 +1,71 @@
+#pragma once
+
+// Batched geometry metrics over SoA meshes.
+// Each call processes a contiguous triangle range so callers can split huge
+// meshes into chunks. The implementation is picked once at startup (AVX2,
+// SSE or scalar) based on what the CPU supports.
+
+#include "BackendAPI.h"
+#include "Geometry/MeshSoA.h"
+#include <cstddef>
+#include <span>
+
+namespace Backend::Geometry {
+
+    enum class KernelLevel {
+        Scalar,
+        SSE,
+        AVX2
+    };
+
+    struct MeshMetrics {
+        double surface_area = 0.0;
+        double perimeter_sum = 0.0;   // Sum of all triangle perimeters
+        std::size_t triangle_count = 0;
+        Aabb bounds;
+    };
+
+    // ============================================================================
+    // DISPATCH
+    // ============================================================================
+
+    // Best level supported by this CPU and build
+    BACKEND_API KernelLevel GetSupportedKernelLevel();
+    BACKEND_API KernelLevel GetKernelLevel();
+    // Clamped to the supported level; useful for benchmarking and A/B checks
+    BACKEND_API void SetKernelLevel(KernelLevel level);
+    BACKEND_API const char* KernelLevelName(KernelLevel level);
+
+    // ============================================================================
+    // PER-TRIANGLE KERNELS
+    // Output spans must hold `count` elements; triangles [first, first + count).
+    // ============================================================================
+
+    BACKEND_API void ComputeTriangleAreas(const MeshView& mesh, std::size_t first, std::size_t count,
+                                          std::span<float> out_areas);
+
+    BACKEND_API void ComputeTrianglePerimeters(const MeshView& mesh, std::size_t first, std::size_t count,
+                                               std::span<float> out_perimeters);
+
+    // Unit face normals, written as three SoA streams. Degenerate faces get (0,0,0).
+    BACKEND_API void ComputeFaceNormals(const MeshView& mesh, std::size_t first, std::size_t count,
+                                        std::span<float> out_nx, std::span<float> out_ny, std::span<float> out_nz);
+
+    // ============================================================================
+    // WHOLE-MESH KERNELS
+    // ============================================================================
+
+    // Area-weighted vertex normals; outputs hold mesh.vertex_count elements
+    BACKEND_API void ComputeVertexNormals(const MeshView& mesh,
+                                          std::span<float> out_nx, std::span<float> out_ny, std::span<float> out_nz);
+
+    BACKEND_API Aabb ComputeBounds(const MeshView& mesh);
+
+    // Single fused pass: surface area + perimeter sum over triangles [first, first + count)
+    BACKEND_API MeshMetrics ComputeMetrics(const MeshView& mesh, std::size_t first, std::size_t count);
+    BACKEND_API MeshMetrics ComputeMetrics(const MeshView& mesh);
+
+    // Same result as ComputeMetrics, split across the job system workers
+    BACKEND_API MeshMetrics ComputeMetricsParallel(const MeshView& mesh);
+
+} // namespace Backend::Geometry
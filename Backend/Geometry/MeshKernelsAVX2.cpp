@@ -0,0 +1,170 @@
+// AVX2 + FMA kernels: 8 triangles per iteration using hardware gathers.
+// This file is compiled with -mavx2 -mfma (or /arch:AVX2), see
+// Backend/CMakeLists.txt. It is only called when CPU detection in
+// MeshKernels.cpp reports AVX2 and FMA support.
+
+#include "Geometry/MeshKernelsInternal.h"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+#include <algorithm>
+
+namespace Backend::Geometry::Internal {
+
+    namespace {
+
+        struct Tri8 {
+            __m256 ax, ay, az, bx, by, bz, cx, cy, cz;
+        };
+
+        inline Tri8 Load8(const MeshView& m, std::size_t t) {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m.i0 + t));
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m.i1 + t));
+            const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m.i2 + t));
+            return Tri8{
+                _mm256_i32gather_ps(m.x, a, 4), _mm256_i32gather_ps(m.y, a, 4), _mm256_i32gather_ps(m.z, a, 4),
+                _mm256_i32gather_ps(m.x, b, 4), _mm256_i32gather_ps(m.y, b, 4), _mm256_i32gather_ps(m.z, b, 4),
+                _mm256_i32gather_ps(m.x, c, 4), _mm256_i32gather_ps(m.y, c, 4), _mm256_i32gather_ps(m.z, c, 4)
+            };
+        }
+
+        inline void Cross8(const Tri8& t, __m256& nx, __m256& ny, __m256& nz) {
+            const __m256 e1x = _mm256_sub_ps(t.bx, t.ax), e1y = _mm256_sub_ps(t.by, t.ay), e1z = _mm256_sub_ps(t.bz, t.az);
+            const __m256 e2x = _mm256_sub_ps(t.cx, t.ax), e2y = _mm256_sub_ps(t.cy, t.ay), e2z = _mm256_sub_ps(t.cz, t.az);
+            nx = _mm256_fmsub_ps(e1y, e2z, _mm256_mul_ps(e1z, e2y));
+            ny = _mm256_fmsub_ps(e1z, e2x, _mm256_mul_ps(e1x, e2z));
+            nz = _mm256_fmsub_ps(e1x, e2y, _mm256_mul_ps(e1y, e2x));
+        }
+
+        inline __m256 Length8(__m256 x, __m256 y, __m256 z) {
+            return _mm256_sqrt_ps(_mm256_fmadd_ps(x, x, _mm256_fmadd_ps(y, y, _mm256_mul_ps(z, z))));
+        }
+
+        inline __m256 Area8(const Tri8& t) {
+            __m256 nx, ny, nz;
+            Cross8(t, nx, ny, nz);
+            return _mm256_mul_ps(_mm256_set1_ps(0.5f), Length8(nx, ny, nz));
+        }
+
+        inline __m256 Perimeter8(const Tri8& t) {
+            const __m256 ab = Length8(_mm256_sub_ps(t.bx, t.ax), _mm256_sub_ps(t.by, t.ay), _mm256_sub_ps(t.bz, t.az));
+            const __m256 bc = Length8(_mm256_sub_ps(t.cx, t.bx), _mm256_sub_ps(t.cy, t.by), _mm256_sub_ps(t.cz, t.bz));
+            const __m256 ca = Length8(_mm256_sub_ps(t.ax, t.cx), _mm256_sub_ps(t.ay, t.cy), _mm256_sub_ps(t.az, t.cz));
+            return _mm256_add_ps(_mm256_add_ps(ab, bc), ca);
+        }
+
+        inline double HorizontalSum(__m256 v) {
+            // Widen to double before the final adds to keep the block sum exact-ish
+            const __m256d lo = _mm256_cvtps_pd(_mm256_castps256_ps128(v));
+            const __m256d hi = _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1));
+            const __m256d s = _mm256_add_pd(lo, hi);
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, s);
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        }
+
+        inline float HorizontalMin(__m256 v) {
+            __m128 m = _mm_min_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+            m = _mm_min_ps(m, _mm_movehl_ps(m, m));
+            m = _mm_min_ss(m, _mm_shuffle_ps(m, m, 0x1));
+            return _mm_cvtss_f32(m);
+        }
+
+        inline float HorizontalMax(__m256 v) {
+            __m128 m = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+            m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+            m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 0x1));
+            return _mm_cvtss_f32(m);
+        }
+
+        void AVX2Areas(const MeshView& m, std::size_t first, std::size_t count, float* out) {
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                _mm256_storeu_ps(out + i, Area8(Load8(m, first + i)));
+            }
+            GetScalarKernels().triangle_areas(m, first + i, count - i, out + i);
+        }
+
+        void AVX2Perimeters(const MeshView& m, std::size_t first, std::size_t count, float* out) {
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                _mm256_storeu_ps(out + i, Perimeter8(Load8(m, first + i)));
+            }
+            GetScalarKernels().triangle_perimeters(m, first + i, count - i, out + i);
+        }
+
+        void AVX2FaceNormals(const MeshView& m, std::size_t first, std::size_t count,
+                             float* nx, float* ny, float* nz) {
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 one = _mm256_set1_ps(1.0f);
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 x, y, z;
+                Cross8(Load8(m, first + i), x, y, z);
+                const __m256 len = Length8(x, y, z);
+                const __m256 valid = _mm256_cmp_ps(len, zero, _CMP_GT_OQ);
+                const __m256 inv = _mm256_and_ps(valid, _mm256_div_ps(one, len));
+                _mm256_storeu_ps(nx + i, _mm256_mul_ps(x, inv));
+                _mm256_storeu_ps(ny + i, _mm256_mul_ps(y, inv));
+                _mm256_storeu_ps(nz + i, _mm256_mul_ps(z, inv));
+            }
+            GetScalarKernels().face_normals(m, first + i, count - i, nx + i, ny + i, nz + i);
+        }
+
+        void AVX2Bounds(const float* x, const float* y, const float* z, std::size_t count,
+                        float out_min[3], float out_max[3]) {
+            __m256 mnx = _mm256_set1_ps(out_min[0]), mny = _mm256_set1_ps(out_min[1]), mnz = _mm256_set1_ps(out_min[2]);
+            __m256 mxx = _mm256_set1_ps(out_max[0]), mxy = _mm256_set1_ps(out_max[1]), mxz = _mm256_set1_ps(out_max[2]);
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                const __m256 vx = _mm256_loadu_ps(x + i), vy = _mm256_loadu_ps(y + i), vz = _mm256_loadu_ps(z + i);
+                mnx = _mm256_min_ps(mnx, vx); mxx = _mm256_max_ps(mxx, vx);
+                mny = _mm256_min_ps(mny, vy); mxy = _mm256_max_ps(mxy, vy);
+                mnz = _mm256_min_ps(mnz, vz); mxz = _mm256_max_ps(mxz, vz);
+            }
+            out_min[0] = HorizontalMin(mnx); out_max[0] = HorizontalMax(mxx);
+            out_min[1] = HorizontalMin(mny); out_max[1] = HorizontalMax(mxy);
+            out_min[2] = HorizontalMin(mnz); out_max[2] = HorizontalMax(mxz);
+            GetScalarKernels().bounds(x + i, y + i, z + i, count - i, out_min, out_max);
+        }
+
+        void AVX2Sums(const MeshView& m, std::size_t first, std::size_t count,
+                      double* area, double* perimeter) {
+            std::size_t i = 0;
+            while (i + 8 <= count) {
+                const std::size_t block_end = std::min(count, i + kSumBlock);
+                __m256 area_acc = _mm256_setzero_ps();
+                __m256 perim_acc = _mm256_setzero_ps();
+                for (; i + 8 <= block_end; i += 8) {
+                    const Tri8 t = Load8(m, first + i);
+                    area_acc = _mm256_add_ps(area_acc, Area8(t));
+                    perim_acc = _mm256_add_ps(perim_acc, Perimeter8(t));
+                }
+                *area += HorizontalSum(area_acc);
+                *perimeter += HorizontalSum(perim_acc);
+            }
+            GetScalarKernels().area_perimeter_sums(m, first + i, count - i, area, perimeter);
+        }
+
+        const KernelTable s_avx2_kernels = {
+            AVX2Areas,
+            AVX2Perimeters,
+            AVX2FaceNormals,
+            AVX2Bounds,
+            AVX2Sums
+        };
+
+    } // namespace
+
+    const KernelTable* GetAVX2Kernels() { return &s_avx2_kernels; }
+
+} // namespace Backend::Geometry::Internal
+
+#else
+
+namespace Backend::Geometry::Internal {
+    const KernelTable* GetAVX2Kernels() { return nullptr; }
+}
+
+#endif
@@ -0,0 +1,31 @@
+#pragma once
+
+// Function table shared by the scalar/SSE/AVX2 translation units.
+// Not part of the public Backend API.
+
+#include "Geometry/MeshSoA.h"
+#include <cstddef>
+
+namespace Backend::Geometry::Internal {
+
+    struct KernelTable {
+        void (*triangle_areas)(const MeshView&, std::size_t first, std::size_t count, float* out);
+        void (*triangle_perimeters)(const MeshView&, std::size_t first, std::size_t count, float* out);
+        void (*face_normals)(const MeshView&, std::size_t first, std::size_t count,
+                             float* nx, float* ny, float* nz);
+        void (*bounds)(const float* x, const float* y, const float* z, std::size_t count,
+                       float out_min[3], float out_max[3]);
+        void (*area_perimeter_sums)(const MeshView&, std::size_t first, std::size_t count,
+                                    double* area, double* perimeter);
+    };
+
+    // Triangles per partial sum before folding into double accumulators.
+    // Keeps float rounding error bounded on meshes with millions of faces.
+    inline constexpr std::size_t kSumBlock = 1024;
+
+    const KernelTable& GetScalarKernels();
+    // nullptr when the translation unit was built without the instruction set
+    const KernelTable* GetSSEKernels();
+    const KernelTable* GetAVX2Kernels();
+
+} // namespace Backend::Geometry::Internal
@@ -0,0 +1,169 @@
+// SSE2 kernels: 4 triangles per iteration.
+// SSE2 has no gather, so corner positions are assembled with scalar loads;
+// the arithmetic (cross products, square roots, reductions) runs 4-wide.
+
+#include "Geometry/MeshKernelsInternal.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+#include <emmintrin.h>
+#include <algorithm>
+#include <cmath>
+
+namespace Backend::Geometry::Internal {
+
+    namespace {
+
+        struct Tri4 {
+            __m128 ax, ay, az, bx, by, bz, cx, cy, cz;
+        };
+
+        inline __m128 Gather4(const float* s, std::uint32_t a, std::uint32_t b, std::uint32_t c, std::uint32_t d) {
+            return _mm_setr_ps(s[a], s[b], s[c], s[d]);
+        }
+
+        inline Tri4 Load4(const MeshView& m, std::size_t t) {
+            const std::uint32_t* i0 = m.i0 + t;
+            const std::uint32_t* i1 = m.i1 + t;
+            const std::uint32_t* i2 = m.i2 + t;
+            return Tri4{
+                Gather4(m.x, i0[0], i0[1], i0[2], i0[3]),
+                Gather4(m.y, i0[0], i0[1], i0[2], i0[3]),
+                Gather4(m.z, i0[0], i0[1], i0[2], i0[3]),
+                Gather4(m.x, i1[0], i1[1], i1[2], i1[3]),
+                Gather4(m.y, i1[0], i1[1], i1[2], i1[3]),
+                Gather4(m.z, i1[0], i1[1], i1[2], i1[3]),
+                Gather4(m.x, i2[0], i2[1], i2[2], i2[3]),
+                Gather4(m.y, i2[0], i2[1], i2[2], i2[3]),
+                Gather4(m.z, i2[0], i2[1], i2[2], i2[3])
+            };
+        }
+
+        inline void Cross4(const Tri4& t, __m128& nx, __m128& ny, __m128& nz) {
+            const __m128 e1x = _mm_sub_ps(t.bx, t.ax), e1y = _mm_sub_ps(t.by, t.ay), e1z = _mm_sub_ps(t.bz, t.az);
+            const __m128 e2x = _mm_sub_ps(t.cx, t.ax), e2y = _mm_sub_ps(t.cy, t.ay), e2z = _mm_sub_ps(t.cz, t.az);
+            nx = _mm_sub_ps(_mm_mul_ps(e1y, e2z), _mm_mul_ps(e1z, e2y));
+            ny = _mm_sub_ps(_mm_mul_ps(e1z, e2x), _mm_mul_ps(e1x, e2z));
+            nz = _mm_sub_ps(_mm_mul_ps(e1x, e2y), _mm_mul_ps(e1y, e2x));
+        }
+
+        inline __m128 Length4(__m128 x, __m128 y, __m128 z) {
+            return _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+        }
+
+        inline __m128 Area4(const Tri4& t) {
+            __m128 nx, ny, nz;
+            Cross4(t, nx, ny, nz);
+            return _mm_mul_ps(_mm_set1_ps(0.5f), Length4(nx, ny, nz));
+        }
+
+        inline __m128 Perimeter4(const Tri4& t) {
+            const __m128 ab = Length4(_mm_sub_ps(t.bx, t.ax), _mm_sub_ps(t.by, t.ay), _mm_sub_ps(t.bz, t.az));
+            const __m128 bc = Length4(_mm_sub_ps(t.cx, t.bx), _mm_sub_ps(t.cy, t.by), _mm_sub_ps(t.cz, t.bz));
+            const __m128 ca = Length4(_mm_sub_ps(t.ax, t.cx), _mm_sub_ps(t.ay, t.cy), _mm_sub_ps(t.az, t.cz));
+            return _mm_add_ps(_mm_add_ps(ab, bc), ca);
+        }
+
+        inline double HorizontalSum(__m128 v) {
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, v);
+            return static_cast<double>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+        }
+
+        void SSEAreas(const MeshView& m, std::size_t first, std::size_t count, float* out) {
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                _mm_storeu_ps(out + i, Area4(Load4(m, first + i)));
+            }
+            GetScalarKernels().triangle_areas(m, first + i, count - i, out + i);
+        }
+
+        void SSEPerimeters(const MeshView& m, std::size_t first, std::size_t count, float* out) {
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                _mm_storeu_ps(out + i, Perimeter4(Load4(m, first + i)));
+            }
+            GetScalarKernels().triangle_perimeters(m, first + i, count - i, out + i);
+        }
+
+        void SSEFaceNormals(const MeshView& m, std::size_t first, std::size_t count,
+                            float* nx, float* ny, float* nz) {
+            const __m128 zero = _mm_setzero_ps();
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 x, y, z;
+                Cross4(Load4(m, first + i), x, y, z);
+                const __m128 len = Length4(x, y, z);
+                // Degenerate faces: mask the reciprocal to zero instead of producing NaN
+                const __m128 valid = _mm_cmpgt_ps(len, zero);
+                const __m128 inv = _mm_and_ps(valid, _mm_div_ps(_mm_set1_ps(1.0f), len));
+                _mm_storeu_ps(nx + i, _mm_mul_ps(x, inv));
+                _mm_storeu_ps(ny + i, _mm_mul_ps(y, inv));
+                _mm_storeu_ps(nz + i, _mm_mul_ps(z, inv));
+            }
+            GetScalarKernels().face_normals(m, first + i, count - i, nx + i, ny + i, nz + i);
+        }
+
+        void SSEBounds(const float* x, const float* y, const float* z, std::size_t count,
+                       float out_min[3], float out_max[3]) {
+            __m128 mnx = _mm_set1_ps(out_min[0]), mny = _mm_set1_ps(out_min[1]), mnz = _mm_set1_ps(out_min[2]);
+            __m128 mxx = _mm_set1_ps(out_max[0]), mxy = _mm_set1_ps(out_max[1]), mxz = _mm_set1_ps(out_max[2]);
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                const __m128 vx = _mm_loadu_ps(x + i), vy = _mm_loadu_ps(y + i), vz = _mm_loadu_ps(z + i);
+                mnx = _mm_min_ps(mnx, vx); mxx = _mm_max_ps(mxx, vx);
+                mny = _mm_min_ps(mny, vy); mxy = _mm_max_ps(mxy, vy);
+                mnz = _mm_min_ps(mnz, vz); mxz = _mm_max_ps(mxz, vz);
+            }
+
+            alignas(16) float lanes[6][4];
+            _mm_store_ps(lanes[0], mnx); _mm_store_ps(lanes[1], mny); _mm_store_ps(lanes[2], mnz);
+            _mm_store_ps(lanes[3], mxx); _mm_store_ps(lanes[4], mxy); _mm_store_ps(lanes[5], mxz);
+            for (int axis = 0; axis < 3; ++axis) {
+                for (int lane = 0; lane < 4; ++lane) {
+                    out_min[axis] = std::min(out_min[axis], lanes[axis][lane]);
+                    out_max[axis] = std::max(out_max[axis], lanes[axis + 3][lane]);
+                }
+            }
+            GetScalarKernels().bounds(x + i, y + i, z + i, count - i, out_min, out_max);
+        }
+
+        void SSESums(const MeshView& m, std::size_t first, std::size_t count,
+                     double* area, double* perimeter) {
+            std::size_t i = 0;
+            while (i + 4 <= count) {
+                const std::size_t block_end = std::min(count, i + kSumBlock);
+                __m128 area_acc = _mm_setzero_ps();
+                __m128 perim_acc = _mm_setzero_ps();
+                for (; i + 4 <= block_end; i += 4) {
+                    const Tri4 t = Load4(m, first + i);
+                    area_acc = _mm_add_ps(area_acc, Area4(t));
+                    perim_acc = _mm_add_ps(perim_acc, Perimeter4(t));
+                }
+                *area += HorizontalSum(area_acc);
+                *perimeter += HorizontalSum(perim_acc);
+            }
+            GetScalarKernels().area_perimeter_sums(m, first + i, count - i, area, perimeter);
+        }
+
+        const KernelTable s_sse_kernels = {
+            SSEAreas,
+            SSEPerimeters,
+            SSEFaceNormals,
+            SSEBounds,
+            SSESums
+        };
+
+    } // namespace
+
+    const KernelTable* GetSSEKernels() { return &s_sse_kernels; }
+
+} // namespace Backend::Geometry::Internal
+
+#else
+
+namespace Backend::Geometry::Internal {
+    const KernelTable* GetSSEKernels() { return nullptr; }
+}
+
+#endif
@@ -0,0 +1,143 @@
+#pragma once
+
+// Structure-of-arrays triangle mesh storage.
+// Every attribute lives in its own 64-byte aligned stream so the batched
+// kernels in MeshKernels.h can stream x/y/z and the three index columns
+// with full-width vector loads.
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <span>
+#include <vector>
+
+namespace Backend::Geometry {
+
+    // ============================================================================
+    // ALIGNED STORAGE
+    // ============================================================================
+
+    template <typename T, std::size_t Alignment = 64>
+    struct AlignedAllocator {
+        using value_type = T;
+
+        template <typename U>
+        struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+        AlignedAllocator() noexcept = default;
+        template <typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+        T* allocate(std::size_t n) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+        }
+
+        void deallocate(T* p, std::size_t) noexcept {
+            ::operator delete(p, std::align_val_t(Alignment));
+        }
+
+        template <typename U>
+        bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+    };
+
+    template <typename T>
+    using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+    // ============================================================================
+    // BOUNDS
+    // ============================================================================
+
+    struct Aabb {
+        glm::vec3 min = glm::vec3(std::numeric_limits<float>::max());
+        glm::vec3 max = glm::vec3(std::numeric_limits<float>::lowest());
+
+        bool IsValid() const { return min.x <= max.x && min.y <= max.y && min.z <= max.z; }
+
+        void Expand(const glm::vec3& p) {
+            min = glm::min(min, p);
+            max = glm::max(max, p);
+        }
+
+        void Expand(const Aabb& other) {
+            min = glm::min(min, other.min);
+            max = glm::max(max, other.max);
+        }
+
+        glm::vec3 Center() const { return (min + max) * 0.5f; }
+        glm::vec3 Extent() const { return max - min; }
+    };
+
+    // ============================================================================
+    // MESH VIEW (non-owning, what the kernels consume)
+    // ============================================================================
+
+    struct MeshView {
+        const float* x = nullptr;
+        const float* y = nullptr;
+        const float* z = nullptr;
+        std::size_t vertex_count = 0;
+
+        // One column per triangle corner: triangle t is (i0[t], i1[t], i2[t])
+        const std::uint32_t* i0 = nullptr;
+        const std::uint32_t* i1 = nullptr;
+        const std::uint32_t* i2 = nullptr;
+        std::size_t triangle_count = 0;
+    };
+
+    // ============================================================================
+    // OWNING MESH
+    // ============================================================================
+
+    struct MeshSoA {
+        AlignedVector<float> x, y, z;
+        AlignedVector<std::uint32_t> i0, i1, i2;
+
+        std::size_t VertexCount() const { return x.size(); }
+        std::size_t TriangleCount() const { return i0.size(); }
+
+        void Reserve(std::size_t vertices, std::size_t triangles) {
+            x.reserve(vertices); y.reserve(vertices); z.reserve(vertices);
+            i0.reserve(triangles); i1.reserve(triangles); i2.reserve(triangles);
+        }
+
+        void Clear() {
+            x.clear(); y.clear(); z.clear();
+            i0.clear(); i1.clear(); i2.clear();
+        }
+
+        std::uint32_t AddVertex(const glm::vec3& p) {
+            x.push_back(p.x); y.push_back(p.y); z.push_back(p.z);
+            return static_cast<std::uint32_t>(x.size() - 1);
+        }
+
+        void AddTriangle(std::uint32_t a, std::uint32_t b, std::uint32_t c) {
+            i0.push_back(a); i1.push_back(b); i2.push_back(c);
+        }
+
+        glm::vec3 GetVertex(std::size_t i) const { return glm::vec3(x[i], y[i], z[i]); }
+
+        MeshView View() const {
+            return MeshView{
+                x.data(), y.data(), z.data(), x.size(),
+                i0.data(), i1.data(), i2.data(), i0.size()
+            };
+        }
+
+        // Convert from the usual interleaved position + flat index list layout
+        static MeshSoA FromInterleaved(std::span<const glm::vec3> positions,
+                                       std::span<const std::uint32_t> indices) {
+            MeshSoA mesh;
+            mesh.Reserve(positions.size(), indices.size() / 3);
+            for (const glm::vec3& p : positions) {
+                mesh.AddVertex(p);
+            }
+            for (std::size_t i = 0; i + 2 < indices.size(); i += 3) {
+                mesh.AddTriangle(indices[i], indices[i + 1], indices[i + 2]);
+            }
+            return mesh;
+        }
+    };
+
+} // namespace Backend::Geometry
@@ -0,0 +1,641 @@
+#include "Geometry/Simplify.h"
+#include "Jobs/JobSystem.h"
+#include "Memory/Arena.h"
+#include "Profiling/Profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory_resource>
+#include <utility>
+
+namespace Backend::Geometry {
+
+    namespace {
+
+        using Tri = std::array<std::uint32_t, 3>;
+
+        constexpr std::uint32_t kNone = 0xFFFFFFFFu;
+        // Weight of the perpendicular planes that keep open boundaries in place
+        constexpr double kBoundaryWeight = 10.0;
+        constexpr int kMaxParallelPhases = 4;
+        // Parallel phases stop once the excess over the target is this small;
+        // the serial cleanup only has a sliver left to remove
+        constexpr double kTargetSlack = 0.02;
+        constexpr std::uint32_t kMaxGridDim = 64;
+        // Scratch a worker keeps between cells; a whole-mesh pass may exceed it
+        constexpr std::size_t kKeepScratchBytes = std::size_t(32) << 20;
+
+        // ============================================================================
+        // QUADRICS
+        // ============================================================================
+
+        // Symmetric 4x4 error quadric (upper triangle) of area-weighted planes.
+        // `area` counts face planes only, so Error() is an area-weighted RMS
+        // distance and boundary planes act as an extra penalty on top.
+        struct Quadric {
+            double a2 = 0.0, ab = 0.0, ac = 0.0, ad = 0.0;
+            double b2 = 0.0, bc = 0.0, bd = 0.0;
+            double c2 = 0.0, cd = 0.0;
+            double d2 = 0.0;
+            double area = 0.0;
+
+            void AddPlane(const glm::vec3& n, float d, double w) {
+                const double a = n.x, b = n.y, c = n.z, e = d;
+                a2 += w * a * a; ab += w * a * b; ac += w * a * c; ad += w * a * e;
+                b2 += w * b * b; bc += w * b * c; bd += w * b * e;
+                c2 += w * c * c; cd += w * c * e;
+                d2 += w * e * e;
+            }
+
+            Quadric& operator+=(const Quadric& o) {
+                a2 += o.a2; ab += o.ab; ac += o.ac; ad += o.ad;
+                b2 += o.b2; bc += o.bc; bd += o.bd;
+                c2 += o.c2; cd += o.cd;
+                d2 += o.d2;
+                area += o.area;
+                return *this;
+            }
+
+            double Evaluate(const glm::vec3& p) const {
+                const double x = p.x, y = p.y, z = p.z;
+                return x * x * a2 + 2.0 * x * y * ab + 2.0 * x * z * ac + 2.0 * x * ad +
+                       y * y * b2 + 2.0 * y * z * bc + 2.0 * y * bd +
+                       z * z * c2 + 2.0 * z * cd + d2;
+            }
+
+            // Squared error in mesh units
+            double Error(const glm::vec3& p) const {
+                return area > 0.0 ? std::max(0.0, Evaluate(p)) / area : 0.0;
+            }
+
+            // Minimizer of the quadric (Cramer's rule); false when near singular,
+            // e.g. all planes parallel on a flat patch
+            bool Optimal(glm::vec3& out) const {
+                const double det = a2 * (b2 * c2 - bc * bc) - ab * (ab * c2 - bc * ac) + ac * (ab * bc - b2 * ac);
+                const double scale = std::max({ a2, b2, c2 });
+                if (!(std::abs(det) > 1e-9 * scale * scale * scale)) return false;
+                const double r0 = -ad, r1 = -bd, r2 = -cd;
+                const double x = r0 * (b2 * c2 - bc * bc) - ab * (r1 * c2 - bc * r2) + ac * (r1 * bc - b2 * r2);
+                const double y = a2 * (r1 * c2 - bc * r2) - r0 * (ab * c2 - bc * ac) + ac * (ab * r2 - r1 * ac);
+                const double z = a2 * (b2 * r2 - r1 * bc) - ab * (ab * r2 - r1 * ac) + r0 * (ab * bc - b2 * ac);
+                out = glm::vec3(static_cast<float>(x / det), static_cast<float>(y / det), static_cast<float>(z / det));
+                return true;
+            }
+        };
+
+        // ============================================================================
+        // SHARED STATE
+        // ============================================================================
+
+        struct State {
+            std::vector<glm::vec3> positions;
+            std::vector<Quadric> quadrics;
+            std::vector<std::uint8_t> locked;   // Non-manifold vertices, never moved
+            std::vector<Tri> triangles;
+            double max_cost = 0.0;
+            std::size_t collapses = 0;
+            std::size_t passes = 0;
+            std::size_t cells = 0;
+        };
+
+        struct CellOutput {
+            std::vector<Tri> triangles;
+            // Quadrics absorbed by cell-border vertices; several cells may feed
+            // the same vertex, so these are summed after the phase
+            std::vector<std::pair<std::uint32_t, Quadric>> border_quadrics;
+            double max_cost = 0.0;
+            std::size_t collapses = 0;
+            std::size_t passes = 0;
+        };
+
+        struct Candidate {
+            float cost;
+            std::uint32_t keep;
+            std::uint32_t drop;
+            glm::vec3 position;
+        };
+
+        glm::vec3 FaceNormal(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c) {
+            return glm::cross(b - a, c - a);
+        }
+
+        // Plane quadrics of every face around each vertex, plus boundary planes.
+        // Vertices on non-manifold edges are locked.
+        State Prepare(const MeshView& mesh) {
+            GE_PROFILE_FUNCTION();
+            State state;
+            const std::size_t vertex_count = mesh.vertex_count;
+            state.positions.resize(vertex_count);
+            for (std::size_t v = 0; v < vertex_count; ++v) {
+                state.positions[v] = glm::vec3(mesh.x[v], mesh.y[v], mesh.z[v]);
+            }
+            state.triangles.reserve(mesh.triangle_count);
+            for (std::size_t t = 0; t < mesh.triangle_count; ++t) {
+                const Tri tri{ mesh.i0[t], mesh.i1[t], mesh.i2[t] };
+                if (tri[0] != tri[1] && tri[1] != tri[2] && tri[0] != tri[2]) state.triangles.push_back(tri);
+            }
+
+            // Vertex -> triangle adjacency (CSR)
+            std::vector<std::uint32_t> offsets(vertex_count + 1, 0);
+            for (const Tri& tri : state.triangles) {
+                for (std::uint32_t v : tri) offsets[v + 1] += 1;
+            }
+            for (std::size_t v = 0; v < vertex_count; ++v) offsets[v + 1] += offsets[v];
+            std::vector<std::uint32_t> adjacency(offsets[vertex_count]);
+            std::vector<std::uint32_t> fill(offsets.begin(), offsets.end() - 1);
+            for (std::uint32_t t = 0; t < state.triangles.size(); ++t) {
+                for (std::uint32_t v : state.triangles[t]) adjacency[fill[v]++] = t;
+            }
+
+            state.quadrics.assign(vertex_count, Quadric{});
+            state.locked.assign(vertex_count, 0);
+            Jobs::ParallelFor(0, vertex_count, 4096, [&](std::size_t lo, std::size_t hi) {
+                for (std::size_t v = lo; v < hi; ++v) {
+                    const std::uint32_t* first = adjacency.data() + offsets[v];
+                    const std::uint32_t* last = adjacency.data() + offsets[v + 1];
+                    Quadric q;
+                    for (const std::uint32_t* t = first; t != last; ++t) {
+                        const Tri& tri = state.triangles[*t];
+                        const glm::vec3& p0 = state.positions[tri[0]];
+                        glm::vec3 n = FaceNormal(p0, state.positions[tri[1]], state.positions[tri[2]]);
+                        const float length = glm::length(n);
+                        if (!(length > 0.0f)) continue;
+                        n /= length;
+                        const double area = 0.5 * length;
+                        q.AddPlane(n, -glm::dot(n, p0), area);
+                        q.area += area;
+
+                        // Edges v-w of this face: boundary if no other face has w
+                        for (std::uint32_t w : tri) {
+                            if (w == v) continue;
+                            int faces = 0;
+                            for (const std::uint32_t* u = first; u != last; ++u) {
+                                const Tri& other = state.triangles[*u];
+                                faces += other[0] == w || other[1] == w || other[2] == w;
+                            }
+                            if (faces > 2) {
+                                state.locked[v] = 1;
+                            } else if (faces == 1) {
+                                const glm::vec3& pv = state.positions[v];
+                                const glm::vec3 edge = state.positions[w] - pv;
+                                glm::vec3 side = glm::cross(edge, n);
+                                const float side_length = glm::length(side);
+                                if (side_length > 0.0f) {
+                                    side /= side_length;
+                                    q.AddPlane(side, -glm::dot(side, pv), kBoundaryWeight * glm::dot(edge, edge));
+                                }
+                            }
+                        }
+                    }
+                    state.quadrics[v] = q;
+                }
+            });
+            return state;
+        }
+
+        // ============================================================================
+        // CELL REDUCTION
+        // ============================================================================
+
+        // Collapses edges among `input` until `target` triangles remain or no
+        // collapse under `max_cost` is left. Vertices flagged in `border` (may
+        // be null) or locked stay where they are. Writes positions and quadrics
+        // of the cell's own vertices back into `state`, which is safe while
+        // other cells run because those vertices belong to this cell alone.
+        void ReduceCell(State& state, std::span<const Tri> input, const std::uint8_t* border, std::size_t target,
+                        double max_cost, CellOutput& out) {
+            // Every temporary lives in the worker's scratch arena, released on return
+            Memory::ArenaScope scope(Memory::ThreadArena(), kKeepScratchBytes);
+            std::pmr::memory_resource* scratch = Memory::ThreadArenaResource();
+
+            // Local vertex ids: sorted unique global ids
+            std::pmr::vector<std::uint32_t> ids(scratch);
+            ids.reserve(input.size() * 3);
+            for (const Tri& tri : input) ids.insert(ids.end(), tri.begin(), tri.end());
+            std::sort(ids.begin(), ids.end());
+            ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+            const auto local = [&ids](std::uint32_t global) {
+                return static_cast<std::uint32_t>(std::lower_bound(ids.begin(), ids.end(), global) - ids.begin());
+            };
+
+            const std::size_t n = ids.size();
+            std::pmr::vector<Tri> tris(input.size(), scratch);
+            for (std::size_t t = 0; t < input.size(); ++t) {
+                tris[t] = { local(input[t][0]), local(input[t][1]), local(input[t][2]) };
+            }
+            std::pmr::vector<glm::vec3> pos(n, scratch);
+            std::pmr::vector<Quadric> quad(n, scratch);
+            std::pmr::vector<std::uint8_t> lock(n, scratch);
+            std::pmr::vector<std::uint8_t> on_border(n, scratch);
+            for (std::size_t l = 0; l < n; ++l) {
+                pos[l] = state.positions[ids[l]];
+                quad[l] = state.quadrics[ids[l]];
+                on_border[l] = border && border[ids[l]];
+                lock[l] = state.locked[ids[l]] || on_border[l];
+            }
+
+            std::pmr::vector<std::uint32_t> remap(n, scratch);
+            std::pmr::vector<std::uint8_t> touched(n, scratch);
+            std::pmr::vector<std::uint8_t> boundary(n, scratch);
+            std::pmr::vector<std::uint32_t> offsets(n + 1, scratch);
+            std::pmr::vector<std::uint32_t> adjacency(scratch);
+            std::pmr::vector<std::uint32_t> fill(n, scratch);
+            std::pmr::vector<std::uint64_t> edges(scratch);
+            std::pmr::vector<Candidate> candidates(scratch);
+            std::pmr::vector<std::uint32_t> ring_keep(scratch);
+            std::pmr::vector<std::uint32_t> ring_drop(scratch);
+
+            while (tris.size() > target) {
+                out.passes += 1;
+                for (std::uint32_t l = 0; l < n; ++l) remap[l] = l;
+                std::fill(touched.begin(), touched.end(), 0);
+                std::fill(boundary.begin(), boundary.end(), 0);
+
+                // Adjacency for this pass
+                std::fill(offsets.begin(), offsets.end(), 0);
+                for (const Tri& tri : tris) {
+                    for (std::uint32_t v : tri) offsets[v + 1] += 1;
+                }
+                for (std::size_t l = 0; l < n; ++l) offsets[l + 1] += offsets[l];
+                adjacency.resize(offsets[n]);
+                {
+                    fill.assign(offsets.begin(), offsets.end() - 1);
+                    for (std::uint32_t t = 0; t < tris.size(); ++t) {
+                        for (std::uint32_t v : tris[t]) adjacency[fill[v]++] = t;
+                    }
+                }
+
+                // Unique edges; an edge seen once is on a boundary (open or cell border)
+                edges.clear();
+                for (const Tri& tri : tris) {
+                    for (int e = 0; e < 3; ++e) {
+                        const std::uint32_t a = tri[e], b = tri[(e + 1) % 3];
+                        edges.push_back((static_cast<std::uint64_t>(std::min(a, b)) << 32) | std::max(a, b));
+                    }
+                }
+                std::sort(edges.begin(), edges.end());
+                for (std::size_t i = 0; i < edges.size();) {
+                    std::size_t j = i + 1;
+                    while (j < edges.size() && edges[j] == edges[i]) ++j;
+                    if (j - i == 1) {
+                        boundary[edges[i] >> 32] = 1;
+                        boundary[edges[i] & 0xFFFFFFFFu] = 1;
+                    }
+                    i = j;
+                }
+
+                // Score every edge
+                candidates.clear();
+                for (std::size_t i = 0; i < edges.size();) {
+                    std::size_t j = i + 1;
+                    while (j < edges.size() && edges[j] == edges[i]) ++j;
+                    const bool boundary_edge = j - i == 1;
+                    const auto a = static_cast<std::uint32_t>(edges[i] >> 32);
+                    const auto b = static_cast<std::uint32_t>(edges[i] & 0xFFFFFFFFu);
+                    i = j;
+                    if (lock[a] && lock[b]) continue;
+                    // Joining two boundary points across the interior pinches the surface
+                    if (!boundary_edge && boundary[a] && boundary[b]) continue;
+
+                    Quadric q = quad[a];
+                    q += quad[b];
+                    Candidate c{ 0.0f, a, b, pos[a] };
+                    // Locked ends stay put; a boundary end stays on the boundary
+                    if (lock[a] || (!lock[b] && boundary[a] && !boundary[b])) {
+                        c = Candidate{ 0.0f, a, b, pos[a] };
+                    } else if (lock[b] || (boundary[b] && !boundary[a])) {
+                        c = Candidate{ 0.0f, b, a, pos[b] };
+                    } else {
+                        // Optimal point if well defined and near the edge, else the best of
+                        // the endpoints and the midpoint
+                        glm::vec3 best = pos[a];
+                        double best_cost = q.Evaluate(pos[a]);
+                        const glm::vec3 mid = (pos[a] + pos[b]) * 0.5f;
+                        glm::vec3 optimal;
+                        const float reach = glm::length(pos[b] - pos[a]);
+                        if (q.Optimal(optimal) && glm::length(optimal - mid) <= reach) {
+                            best = optimal;
+                            best_cost = q.Evaluate(optimal);
+                        }
+                        for (const glm::vec3& p : { pos[b], mid }) {
+                            const double cost = q.Evaluate(p);
+                            if (cost < best_cost) {
+                                best = p;
+                                best_cost = cost;
+                            }
+                        }
+                        c.position = best;
+                    }
+                    const double cost = q.Error(c.position);
+                    if (cost > max_cost) continue;
+                    c.cost = static_cast<float>(cost);
+                    candidates.push_back(c);
+                }
+                std::sort(candidates.begin(), candidates.end(),
+                          [](const Candidate& x, const Candidate& y) { return x.cost < y.cost; });
+
+                // Greedy: cheapest first, each vertex in at most one collapse per pass.
+                // Dropped vertices resolve through remap, one level deep.
+                const auto corners = [&](std::uint32_t t) {
+                    const Tri& tri = tris[t];
+                    return Tri{ remap[tri[0]], remap[tri[1]], remap[tri[2]] };
+                };
+                const auto degenerate = [](const Tri& c) { return c[0] == c[1] || c[1] == c[2] || c[0] == c[2]; };
+                const auto has = [](const Tri& c, std::uint32_t v) { return c[0] == v || c[1] == v || c[2] == v; };
+
+                std::size_t removed = 0;
+                std::size_t pass_collapses = 0;
+                const std::size_t excess = tris.size() - target;
+                for (const Candidate& c : candidates) {
+                    if (removed >= excess) break;
+                    const std::uint32_t keep = c.keep, drop = c.drop;
+                    if (touched[keep] || touched[drop]) continue;
+
+                    // Link condition: the rings of both ends may only share the
+                    // vertices opposite the collapsed edge
+                    std::size_t shared_faces = 0;
+                    bool ok = true;
+                    ring_keep.clear();
+                    ring_drop.clear();
+                    for (int side = 0; side < 2 && ok; ++side) {
+                        const std::uint32_t v = side == 0 ? drop : keep;
+                        std::pmr::vector<std::uint32_t>& ring = side == 0 ? ring_drop : ring_keep;
+                        for (std::uint32_t k = offsets[v]; k < offsets[v + 1]; ++k) {
+                            const Tri tri = corners(adjacency[k]);
+                            if (degenerate(tri)) continue;
+                            const bool spans = has(tri, keep) && has(tri, drop);
+                            if (spans) {
+                                if (side == 0) shared_faces += 1;
+                            } else {
+                                // Normal flip check with both ends moved to the new position
+                                const glm::vec3 before = FaceNormal(pos[tri[0]], pos[tri[1]], pos[tri[2]]);
+                                glm::vec3 p[3];
+                                for (int i = 0; i < 3; ++i) {
+                                    p[i] = tri[i] == keep || tri[i] == drop ? c.position : pos[tri[i]];
+                                }
+                                if (glm::dot(before, FaceNormal(p[0], p[1], p[2])) <= 0.0f) {
+                                    ok = false;
+                                    break;
+                                }
+                            }
+                            for (std::uint32_t w : tri) {
+                                if (w != keep && w != drop) ring.push_back(w);
+                            }
+                        }
+                    }
+                    if (!ok || shared_faces == 0 || shared_faces > 2) continue;
+                    std::sort(ring_keep.begin(), ring_keep.end());
+                    ring_keep.erase(std::unique(ring_keep.begin(), ring_keep.end()), ring_keep.end());
+                    std::sort(ring_drop.begin(), ring_drop.end());
+                    ring_drop.erase(std::unique(ring_drop.begin(), ring_drop.end()), ring_drop.end());
+                    std::size_t common = 0;
+                    for (auto i = ring_keep.begin(), j = ring_drop.begin(); i != ring_keep.end() && j != ring_drop.end();) {
+                        if (*i < *j) ++i;
+                        else if (*j < *i) ++j;
+                        else { ++common; ++i; ++j; }
+                    }
+                    if (common != shared_faces) continue;
+
+                    remap[drop] = keep;
+                    pos[keep] = c.position;
+                    if (on_border[keep]) {
+                        out.border_quadrics.emplace_back(ids[keep], quad[drop]);
+                    }
+                    quad[keep] += quad[drop];
+                    touched[keep] = 1;
+                    touched[drop] = 1;
+                    removed += shared_faces;
+                    pass_collapses += 1;
+                    out.max_cost = std::max(out.max_cost, static_cast<double>(c.cost));
+                }
+                if (pass_collapses == 0) break;
+                out.collapses += pass_collapses;
+
+                std::size_t kept = 0;
+                for (std::uint32_t t = 0; t < tris.size(); ++t) {
+                    const Tri tri = corners(t);
+                    if (!degenerate(tri)) tris[kept++] = tri;
+                }
+                tris.resize(kept);
+            }
+
+            // Write back vertices this cell owns; output with global ids
+            std::pmr::vector<std::uint8_t> used(n, 0, scratch);
+            out.triangles.resize(tris.size());
+            for (std::size_t t = 0; t < tris.size(); ++t) {
+                for (int i = 0; i < 3; ++i) {
+                    used[tris[t][i]] = 1;
+                    out.triangles[t][i] = ids[tris[t][i]];
+                }
+            }
+            for (std::size_t l = 0; l < n; ++l) {
+                if (used[l] && !lock[l]) {
+                    state.positions[ids[l]] = pos[l];
+                    state.quadrics[ids[l]] = quad[l];
+                }
+            }
+        }
+
+        // ============================================================================
+        // PARTITIONED PHASE
+        // ============================================================================
+
+        // Splits the triangles into a grid of cells (offset by `shift` cells)
+        // and reduces every cell in parallel towards the same ratio
+        void ReducePartitioned(State& state, std::size_t target, double max_cost, std::size_t cell_triangles, float shift) {
+            GE_PROFILE_FUNCTION();
+            const std::size_t count = state.triangles.size();
+            std::vector<glm::vec3> centroids(count);
+            Aabb bounds;
+            for (std::size_t t = 0; t < count; ++t) {
+                const Tri& tri = state.triangles[t];
+                centroids[t] = (state.positions[tri[0]] + state.positions[tri[1]] + state.positions[tri[2]]) * (1.0f / 3.0f);
+                bounds.Expand(centroids[t]);
+            }
+
+            // Roughly cubic cells; flat axes get a floor so the volume stays meaningful
+            const std::size_t wanted = std::max<std::size_t>(
+                std::max<std::size_t>(Jobs::ThreadCount(), 1) * 2, count / std::max<std::size_t>(cell_triangles, 1));
+            glm::vec3 extent = bounds.Extent();
+            const float largest = std::max({ extent.x, extent.y, extent.z, 1e-6f });
+            extent = glm::max(extent, glm::vec3(largest * 1e-3f));
+            const float cell = std::cbrt(extent.x * extent.y * extent.z / static_cast<float>(wanted));
+            std::uint32_t dims[3];
+            for (int axis = 0; axis < 3; ++axis) {
+                dims[axis] = std::clamp(static_cast<std::uint32_t>(std::ceil(extent[axis] / cell)) + 1, 1u, kMaxGridDim);
+            }
+            const glm::vec3 origin = bounds.min - glm::vec3(shift * cell);
+            const std::size_t cell_count = static_cast<std::size_t>(dims[0]) * dims[1] * dims[2];
+
+            std::vector<std::uint32_t> cell_of(count);
+            std::vector<std::uint32_t> offsets(cell_count + 1, 0);
+            for (std::size_t t = 0; t < count; ++t) {
+                std::uint32_t index[3];
+                for (int axis = 0; axis < 3; ++axis) {
+                    const float f = (centroids[t][axis] - origin[axis]) / cell;
+                    index[axis] = std::min(static_cast<std::uint32_t>(std::max(f, 0.0f)), dims[axis] - 1);
+                }
+                cell_of[t] = (index[2] * dims[1] + index[1]) * dims[0] + index[0];
+                offsets[cell_of[t] + 1] += 1;
+            }
+            for (std::size_t c = 0; c < cell_count; ++c) offsets[c + 1] += offsets[c];
+            std::vector<Tri> sorted(count);
+            {
+                std::vector<std::uint32_t> fill(offsets.begin(), offsets.end() - 1);
+                for (std::size_t t = 0; t < count; ++t) sorted[fill[cell_of[t]]++] = state.triangles[t];
+            }
+
+            // A vertex used by triangles of two cells is on a cell border
+            std::vector<std::uint32_t> owner(state.positions.size(), kNone);
+            std::vector<std::uint8_t> border(state.positions.size(), 0);
+            for (std::size_t c = 0; c < cell_count; ++c) {
+                for (std::uint32_t t = offsets[c]; t < offsets[c + 1]; ++t) {
+                    for (std::uint32_t v : sorted[t]) {
+                        if (owner[v] == kNone) owner[v] = static_cast<std::uint32_t>(c);
+                        else if (owner[v] != c) border[v] = 1;
+                    }
+                }
+            }
+
+            std::vector<std::uint32_t> cells;
+            for (std::size_t c = 0; c < cell_count; ++c) {
+                if (offsets[c + 1] > offsets[c]) cells.push_back(static_cast<std::uint32_t>(c));
+            }
+            std::vector<CellOutput> outputs(cells.size());
+            const double ratio = static_cast<double>(target) / static_cast<double>(count);
+            Jobs::ParallelFor(0, cells.size(), 1, [&](std::size_t lo, std::size_t hi) {
+                for (std::size_t i = lo; i < hi; ++i) {
+                    GE_PROFILE_ZONE("Simplify::Cell");
+                    const std::uint32_t c = cells[i];
+                    const std::span<const Tri> input(sorted.data() + offsets[c], offsets[c + 1] - offsets[c]);
+                    const auto cell_target = static_cast<std::size_t>(std::ceil(input.size() * ratio));
+                    ReduceCell(state, input, border.data(), cell_target, max_cost, outputs[i]);
+                }
+            });
+
+            // Concatenate in cell order, so the result does not depend on the worker count
+            state.triangles.clear();
+            for (CellOutput& output : outputs) {
+                state.triangles.insert(state.triangles.end(), output.triangles.begin(), output.triangles.end());
+                for (const auto& [vertex, quadric] : output.border_quadrics) state.quadrics[vertex] += quadric;
+                state.max_cost = std::max(state.max_cost, output.max_cost);
+                state.collapses += output.collapses;
+                state.passes = std::max(state.passes, output.passes);
+            }
+            state.cells += cells.size();
+        }
+
+        void Reduce(State& state, std::size_t target, double max_cost, std::size_t cell_triangles,
+                    std::size_t parallel_threshold) {
+            GE_PROFILE_FUNCTION();
+            const auto close_enough = [&] {
+                return static_cast<double>(state.triangles.size()) <= static_cast<double>(target) * (1.0 + kTargetSlack);
+            };
+            const bool partitioned = state.triangles.size() > parallel_threshold;
+            if (partitioned) {
+                for (int phase = 0; phase < kMaxParallelPhases && !close_enough(); ++phase) {
+                    const std::size_t before = state.triangles.size();
+                    ReducePartitioned(state, target, max_cost, cell_triangles, (phase & 1) ? 0.5f : 0.0f);
+                    // Little progress means the error limit is binding, not the cell borders
+                    if ((before - state.triangles.size()) * 8 < before - std::min(before, target)) break;
+                }
+            }
+            if (partitioned ? !close_enough() : state.triangles.size() > target) {
+                CellOutput output;
+                ReduceCell(state, state.triangles, nullptr, target, max_cost, output);
+                state.triangles = std::move(output.triangles);
+                state.max_cost = std::max(state.max_cost, output.max_cost);
+                state.collapses += output.collapses;
+                state.passes += output.passes;
+            }
+        }
+
+        // Current triangles with unreferenced vertices dropped, in original order
+        MeshSoA Snapshot(const State& state) {
+            std::vector<std::uint32_t> remap(state.positions.size(), kNone);
+            for (const Tri& tri : state.triangles) {
+                for (std::uint32_t v : tri) remap[v] = 0;
+            }
+            MeshSoA mesh;
+            mesh.Reserve(state.positions.size(), state.triangles.size());
+            for (std::size_t v = 0; v < remap.size(); ++v) {
+                if (remap[v] != kNone) remap[v] = mesh.AddVertex(state.positions[v]);
+            }
+            for (const Tri& tri : state.triangles) {
+                mesh.AddTriangle(remap[tri[0]], remap[tri[1]], remap[tri[2]]);
+            }
+            return mesh;
+        }
+
+        double MaxCost(float max_error) {
+            return std::isfinite(max_error) ? static_cast<double>(max_error) * max_error
+                                            : std::numeric_limits<double>::infinity();
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // PUBLIC API
+    // ============================================================================
+
+    MeshSoA Simplify(const MeshView& mesh, const SimplifyOptions& options, SimplifyStats* stats) {
+        GE_PROFILE_FUNCTION();
+        State state = Prepare(mesh);
+        const std::size_t target = options.target_triangles > 0
+                                 ? options.target_triangles
+                                 : static_cast<std::size_t>(static_cast<double>(state.triangles.size()) *
+                                                            std::clamp(options.target_ratio, 0.0f, 1.0f));
+        Reduce(state, target, MaxCost(options.max_error), options.cell_triangles, options.parallel_threshold);
+        MeshSoA result = Snapshot(state);
+
+        if (stats) {
+            stats->input_triangles = mesh.triangle_count;
+            stats->output_triangles = result.TriangleCount();
+            stats->output_vertices = result.VertexCount();
+            stats->collapses = state.collapses;
+            stats->passes = state.passes;
+            stats->cells = state.cells;
+            stats->error = static_cast<float>(std::sqrt(state.max_cost));
+        }
+        return result;
+    }
+
+    std::vector<MeshLod> BuildLodChain(const MeshView& mesh, const LodChainOptions& options) {
+        GE_PROFILE_FUNCTION();
+        std::vector<MeshLod> lods;
+        MeshLod& base = lods.emplace_back();
+        base.mesh.x.assign(mesh.x, mesh.x + mesh.vertex_count);
+        base.mesh.y.assign(mesh.y, mesh.y + mesh.vertex_count);
+        base.mesh.z.assign(mesh.z, mesh.z + mesh.vertex_count);
+        base.mesh.i0.assign(mesh.i0, mesh.i0 + mesh.triangle_count);
+        base.mesh.i1.assign(mesh.i1, mesh.i1 + mesh.triangle_count);
+        base.mesh.i2.assign(mesh.i2, mesh.i2 + mesh.triangle_count);
+
+        // One state for the whole chain: quadrics keep accumulating, so every
+        // level's error is measured against the source planes
+        State state = Prepare(mesh);
+        const double max_cost = MaxCost(options.max_error);
+        const float ratio = std::clamp(options.ratio, 0.05f, 0.95f);
+        while (lods.size() < options.max_levels) {
+            const std::size_t current = state.triangles.size();
+            const auto target = static_cast<std::size_t>(static_cast<double>(current) * ratio);
+            if (target < options.min_triangles) break;
+            Reduce(state, target, max_cost, options.cell_triangles, options.parallel_threshold);
+            // Error-limited: not worth another level
+            if ((current - state.triangles.size()) * 4 < current - target) break;
+            MeshLod& lod = lods.emplace_back();
+            lod.mesh = Snapshot(state);
+            lod.error = static_cast<float>(std::sqrt(state.max_cost));
+        }
+        return lods;
+    }
+
+    std::size_t SelectLod(std::span<const MeshLod> lods, float max_error) {
+        for (std::size_t i = lods.size(); i > 1; --i) {
+            if (lods[i - 1].error <= max_error) return i - 1;
+        }
+        return 0;
+    }
+
+} // namespace Backend::Geometry
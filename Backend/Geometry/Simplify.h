@@ -0,0 +1,84 @@
+#pragma once
+
+// Quadric error metric (Garland-Heckbert) mesh decimation and LOD chains.
+//
+// Every vertex carries the sum of the plane quadrics of its original faces,
+// so the cost of an edge collapse is the summed squared distance of the new
+// position to those planes; sqrt(cost) is reported as the error, in mesh
+// units. Open boundaries get extra perpendicular planes so silhouettes hold.
+//
+// Collapses run in passes: each pass scores every edge, sorts by cost and
+// greedily applies the cheapest ones whose vertices were not touched yet in
+// the pass (with link-condition and normal-flip checks). Large meshes are
+// split into a spatial grid of cells reduced in parallel on the job system
+// with cell-border vertices locked; the next phase shifts the grid by half a
+// cell so the old borders become interior. A final serial pass over the
+// whole mesh cleans up any excess.
+
+#include "BackendAPI.h"
+#include "Geometry/MeshSoA.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Backend::Geometry {
+
+    struct SimplifyOptions {
+        float target_ratio = 0.5f;              // Of the input triangle count
+        std::size_t target_triangles = 0;       // Overrides target_ratio when non-zero
+        float max_error = std::numeric_limits<float>::infinity();  // Stops early past this error
+        std::size_t cell_triangles = 1u << 14;  // Size of a parallel cell
+        std::size_t parallel_threshold = 1u << 15;  // Smaller meshes are reduced serially
+    };
+
+    struct SimplifyStats {
+        std::size_t input_triangles = 0;
+        std::size_t output_triangles = 0;
+        std::size_t output_vertices = 0;
+        std::size_t collapses = 0;
+        std::size_t passes = 0;
+        std::size_t cells = 0;      // Parallel cells over all phases
+        float error = 0.0f;
+    };
+
+    // Returns the reduced mesh with unreferenced vertices removed
+    BACKEND_API MeshSoA Simplify(const MeshView& mesh, const SimplifyOptions& options = {},
+                                 SimplifyStats* stats = nullptr);
+
+    // ============================================================================
+    // LOD CHAINS
+    // ============================================================================
+
+    struct MeshLod {
+        MeshSoA mesh;
+        float error = 0.0f;     // Bound on the distance to the original surface
+    };
+
+    struct LodChainOptions {
+        std::uint32_t max_levels = 6;           // Including the source level
+        float ratio = 0.5f;                     // Triangles kept from one level to the next
+        std::size_t min_triangles = 256;        // No level below this
+        float max_error = std::numeric_limits<float>::infinity();
+        std::size_t cell_triangles = 1u << 14;
+        std::size_t parallel_threshold = 1u << 15;
+    };
+
+    // Level 0 is a copy of `mesh` (error 0); every further level continues
+    // collapsing the previous one, so errors are measured against the source
+    // and increase monotonically. Stops early once a level would exceed
+    // max_error or barely shrinks.
+    BACKEND_API std::vector<MeshLod> BuildLodChain(const MeshView& mesh, const LodChainOptions& options = {});
+
+    // Coarsest level whose error is within `max_error` (0 if none is)
+    BACKEND_API std::size_t SelectLod(std::span<const MeshLod> lods, float max_error);
+
+    // Object-space error that projects to `pixels` on screen at `distance`
+    // with a vertical field of view (radians) over `viewport_height` pixels
+    inline float ErrorForPixels(float pixels, float distance, float fov_y, float viewport_height) {
+        return pixels * 2.0f * distance * std::tan(fov_y * 0.5f) / viewport_height;
+    }
+
+} // namespace Backend::Geometry
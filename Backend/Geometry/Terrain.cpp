@@ -0,0 +1,47 @@
+#include "Geometry/Terrain.h"
+
+#include <cmath>
+
+namespace Backend::Geometry {
+
+    namespace {
+
+        float Origin(const TerrainOptions& options) {
+            return options.centered ? -0.5f * options.cell_size * static_cast<float>(options.cells) : 0.0f;
+        }
+
+    } // namespace
+
+    float TerrainHeight(const TerrainOptions& options, float x, float z) {
+        const float origin = Origin(options);
+        const float u = (x - origin) / options.cell_size;
+        const float v = (z - origin) / options.cell_size;
+        const float p = options.phase;
+        return options.height * (std::sin(u * 0.02f + p) * std::cos(v * 0.015f) +
+                                 0.1875f * std::sin(u * 0.11f + v * 0.07f + p) +
+                                 0.025f * std::sin(u * 0.9f) * std::sin(v * 0.8f));
+    }
+
+    MeshSoA MakeTerrain(const TerrainOptions& options) {
+        const std::uint32_t n = options.cells;
+        MeshSoA mesh;
+        mesh.Reserve(static_cast<std::size_t>(n + 1) * (n + 1), static_cast<std::size_t>(n) * n * 2);
+        const float origin = Origin(options);
+        for (std::uint32_t y = 0; y <= n; ++y) {
+            for (std::uint32_t x = 0; x <= n; ++x) {
+                const float fx = origin + static_cast<float>(x) * options.cell_size;
+                const float fz = origin + static_cast<float>(y) * options.cell_size;
+                mesh.AddVertex(glm::vec3(fx, TerrainHeight(options, fx, fz), fz));
+            }
+        }
+        for (std::uint32_t y = 0; y < n; ++y) {
+            for (std::uint32_t x = 0; x < n; ++x) {
+                const std::uint32_t a = y * (n + 1) + x;
+                mesh.AddTriangle(a, a + n + 1, a + 1);
+                mesh.AddTriangle(a + 1, a + n + 1, a + n + 2);
+            }
+        }
+        return mesh;
+    }
+
+} // namespace Backend::Geometry
@@ -0,0 +1,37 @@
+#pragma once
+
+// Procedural heightfield used by the benchmarks, the tests and the BackendOps
+// module, so they all measure and exercise the same surface.
+//
+// The surface is a rolling base with detail at two higher frequencies, so
+// decimation costs differ across the mesh and coarse LODs stay meaningful.
+// Frequencies are in grid cells, not world units: the shape is the same at
+// any cell_size, only its extent changes.
+
+#include "BackendAPI.h"
+#include "Geometry/MeshSoA.h"
+#include <cstdint>
+
+namespace Backend::Geometry {
+
+    struct TerrainOptions {
+        std::uint32_t cells = 256;      // Quads per side: (cells + 1)^2 vertices, 2 cells^2 triangles
+        float cell_size = 1.0f;         // World units per cell
+        float height = 8.0f;            // Amplitude of the base wave
+        float phase = 0.0f;             // Shifts the waves, e.g. to animate a refit
+        bool centered = false;          // Grid around the origin instead of starting at it
+    };
+
+    // Height at world position (x, z) of the surface MakeTerrain samples
+    BACKEND_API float TerrainHeight(const TerrainOptions& options, float x, float z);
+
+    // Counter-clockwise (up-facing) grid in the XZ plane, rows along +Z
+    BACKEND_API MeshSoA MakeTerrain(const TerrainOptions& options = {});
+
+    inline MeshSoA MakeTerrain(std::uint32_t cells) {
+        TerrainOptions options;
+        options.cells = cells;
+        return MakeTerrain(options);
+    }
+
+} // namespace Backend::Geometry
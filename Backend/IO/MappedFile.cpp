@@ -0,0 +1,128 @@
+#include "IO/MappedFile.h"
+
+#include <utility>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Backend::IO {
+
+    namespace {
+
+        std::size_t PageSize() {
+#if defined(_WIN32)
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            return static_cast<std::size_t>(info.dwPageSize);
+#else
+            static const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+            return page;
+#endif
+        }
+
+    } // namespace
+
+    MappedFile::~MappedFile() {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Close();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+        }
+        return *this;
+    }
+
+    bool MappedFile::Open(const std::string& path) {
+        Close();
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+            CloseHandle(file);
+            return false;
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping) return false;
+        void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (!data) return false;
+        m_data = static_cast<std::byte*>(data);
+        m_size = static_cast<std::size_t>(size.QuadPart);
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return false;
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+            ::close(fd);
+            return false;
+        }
+        void* data = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) return false;
+        m_data = static_cast<std::byte*>(data);
+        m_size = static_cast<std::size_t>(st.st_size);
+#endif
+        return true;
+    }
+
+    void MappedFile::Close() {
+        if (!m_data) return;
+#if defined(_WIN32)
+        UnmapViewOfFile(m_data);
+#else
+        ::munmap(m_data, m_size);
+#endif
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    void MappedFile::WillNeed(std::uint64_t offset, std::uint64_t length) const {
+        if (!m_data || offset >= m_size) return;
+        const std::size_t page = PageSize();
+        const std::size_t begin = static_cast<std::size_t>(offset) & ~(page - 1);
+        const std::size_t end = static_cast<std::size_t>(offset + length < m_size ? offset + length : m_size);
+#if defined(_WIN32)
+        WIN32_MEMORY_RANGE_ENTRY range{ m_data + begin, end - begin };
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+        ::madvise(m_data + begin, end - begin, MADV_WILLNEED);
+#endif
+    }
+
+    void MappedFile::DontNeed(std::uint64_t offset, std::uint64_t length) const {
+        if (!m_data || offset >= m_size) return;
+        const std::size_t page = PageSize();
+        // Only whole pages inside the range, so neighbouring chunks keep theirs
+        const std::size_t begin = (static_cast<std::size_t>(offset) + page - 1) & ~(page - 1);
+        const std::size_t end = static_cast<std::size_t>(offset + length < m_size ? offset + length : m_size) & ~(page - 1);
+        if (end <= begin) return;
+#if defined(_WIN32)
+        // Read-only file pages: unlocking drops them from the working set
+        VirtualUnlock(m_data + begin, end - begin);
+#else
+        ::madvise(m_data + begin, end - begin, MADV_DONTNEED);
+#endif
+    }
+
+} // namespace Backend::IO
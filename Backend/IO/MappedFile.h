@@ -0,0 +1,42 @@
+#pragma once
+
+// Read-only memory-mapped file with residency hints.
+// The mapping is page-aligned, so any 64-byte aligned file offset is also
+// 64-byte aligned in memory.
+
+#include "BackendAPI.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Backend::IO {
+
+    class BACKEND_API MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool Open(const std::string& path);
+        void Close();
+
+        bool IsOpen() const { return m_data != nullptr; }
+        const std::byte* Data() const { return m_data; }
+        std::size_t Size() const { return m_size; }
+
+        // Residency hints for [offset, offset + length); ranges are widened to pages.
+        // WillNeed starts async read-ahead, DontNeed drops clean pages so a
+        // streaming pass keeps a flat resident set.
+        void WillNeed(std::uint64_t offset, std::uint64_t length) const;
+        void DontNeed(std::uint64_t offset, std::uint64_t length) const;
+
+    private:
+        std::byte* m_data = nullptr;
+        std::size_t m_size = 0;
+    };
+
+} // namespace Backend::IO
@@ -0,0 +1,168 @@
+#include "IO/MeshFile.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Backend::IO {
+
+    namespace {
+
+        // Largest index in one column; branch-free so it vectorizes
+        std::uint32_t MaxIndex(const std::uint32_t* indices, std::uint32_t count) {
+            std::uint32_t max = 0;
+            for (std::uint32_t i = 0; i < count; ++i) max = std::max(max, indices[i]);
+            return max;
+        }
+
+        bool IndicesInRange(const std::byte* chunk, const MeshChunkDesc& c) {
+            if (c.triangle_count == 0) return true;
+            if (c.vertex_count == 0) return false;
+            const MeshChunkLayout layout = ComputeChunkLayout(c.vertex_count, c.triangle_count);
+            for (const std::uint64_t column : { layout.i0, layout.i1, layout.i2 }) {
+                const auto* indices = reinterpret_cast<const std::uint32_t*>(chunk + column);
+                if (MaxIndex(indices, c.triangle_count) >= c.vertex_count) return false;
+            }
+            return true;
+        }
+
+    } // namespace
+
+    bool MeshFile::Fail(const char* message) {
+        Close();
+        m_error = message;
+        return false;
+    }
+
+    bool MeshFile::Open(const std::string& path) {
+        Close();
+        m_error.clear();
+        if (!m_file.Open(path)) return Fail("cannot map file");
+
+        const std::byte* base = m_file.Data();
+        const std::uint64_t size = m_file.Size();
+        if (size < sizeof(MeshFileHeader)) return Fail("file too small");
+
+        const auto* header = reinterpret_cast<const MeshFileHeader*>(base);
+        if (std::memcmp(header->magic, kMeshMagic, sizeof(kMeshMagic)) != 0) return Fail("not a gemesh file");
+        if (header->version != kMeshVersion) return Fail("unsupported gemesh version");
+        if (header->header_size != sizeof(MeshFileHeader)) return Fail("header size mismatch");
+        if (header->file_size != size) return Fail("file truncated or has trailing data");
+
+        // Tables must lie inside the file and be aligned for direct access
+        const std::uint64_t lod_bytes = std::uint64_t(header->lod_count) * sizeof(MeshLodDesc);
+        const std::uint64_t chunk_bytes = std::uint64_t(header->chunk_count) * sizeof(MeshChunkDesc);
+        if (header->lod_count == 0) return Fail("no LODs");
+        if (header->lod_table_offset % alignof(MeshLodDesc) != 0 ||
+            header->chunk_table_offset % alignof(MeshChunkDesc) != 0 ||
+            header->lod_table_offset < sizeof(MeshFileHeader) ||
+            header->chunk_table_offset < sizeof(MeshFileHeader) ||
+            header->lod_table_offset > size || lod_bytes > size - header->lod_table_offset ||
+            header->chunk_table_offset > size || chunk_bytes > size - header->chunk_table_offset) {
+            return Fail("corrupt table offsets");
+        }
+
+        const auto* lods = reinterpret_cast<const MeshLodDesc*>(base + header->lod_table_offset);
+        const auto* chunks = reinterpret_cast<const MeshChunkDesc*>(base + header->chunk_table_offset);
+
+        for (std::uint32_t i = 0; i < header->chunk_count; ++i) {
+            const MeshChunkDesc& c = chunks[i];
+            const MeshChunkLayout layout = ComputeChunkLayout(c.vertex_count, c.triangle_count);
+            if (c.offset % kMeshStreamAlignment != 0 || c.offset < sizeof(MeshFileHeader) ||
+                c.size != layout.size || c.offset > size || c.size > size - c.offset ||
+                c.lod >= header->lod_count) {
+                return Fail("corrupt chunk table");
+            }
+        }
+        for (std::uint32_t i = 0; i < header->lod_count; ++i) {
+            const MeshLodDesc& l = lods[i];
+            if (l.first_chunk > header->chunk_count || l.chunk_count > header->chunk_count - l.first_chunk) {
+                return Fail("corrupt LOD table");
+            }
+        }
+
+        // Views feed indices straight into the kernels' gathers, so every one
+        // must address its chunk's vertices. One sequential pass over the index
+        // columns, dropped behind itself so the resident set stays flat
+        for (std::uint32_t i = 0; i < header->chunk_count; ++i) {
+            const MeshChunkDesc& c = chunks[i];
+            const std::uint64_t index_offset = c.offset + ComputeChunkLayout(c.vertex_count, c.triangle_count).i0;
+            const bool in_range = IndicesInRange(base + c.offset, c);
+            m_file.DontNeed(index_offset, c.offset + c.size - index_offset);
+            if (!in_range) return Fail("index out of range");
+        }
+
+        m_header = header;
+        m_lods = std::span<const MeshLodDesc>(lods, header->lod_count);
+        m_chunks = std::span<const MeshChunkDesc>(chunks, header->chunk_count);
+        return true;
+    }
+
+    void MeshFile::Close() {
+        m_header = nullptr;
+        m_lods = {};
+        m_chunks = {};
+        m_file.Close();
+    }
+
+    Geometry::Aabb MeshFile::Bounds() const {
+        Geometry::Aabb bounds;
+        if (!m_header) return bounds;
+        std::memcpy(&bounds.min, m_header->bounds_min, sizeof(m_header->bounds_min));
+        std::memcpy(&bounds.max, m_header->bounds_max, sizeof(m_header->bounds_max));
+        return bounds;
+    }
+
+    std::span<const MeshChunkDesc> MeshFile::LodChunks(std::uint32_t lod) const {
+        if (lod >= m_lods.size()) return {};
+        return m_chunks.subspan(m_lods[lod].first_chunk, m_lods[lod].chunk_count);
+    }
+
+    Geometry::MeshView MeshFile::ChunkView(std::uint32_t chunk) const {
+        const MeshChunkDesc& c = m_chunks[chunk];
+        const MeshChunkLayout layout = ComputeChunkLayout(c.vertex_count, c.triangle_count);
+        const std::byte* base = m_file.Data() + c.offset;
+        return Geometry::MeshView{
+            reinterpret_cast<const float*>(base + layout.x),
+            reinterpret_cast<const float*>(base + layout.y),
+            reinterpret_cast<const float*>(base + layout.z),
+            c.vertex_count,
+            reinterpret_cast<const std::uint32_t*>(base + layout.i0),
+            reinterpret_cast<const std::uint32_t*>(base + layout.i1),
+            reinterpret_cast<const std::uint32_t*>(base + layout.i2),
+            c.triangle_count
+        };
+    }
+
+    void MeshFile::Prefetch(std::uint32_t chunk) const {
+        const MeshChunkDesc& c = m_chunks[chunk];
+        m_file.WillNeed(c.offset, c.size);
+    }
+
+    void MeshFile::Evict(std::uint32_t chunk) const {
+        const MeshChunkDesc& c = m_chunks[chunk];
+        m_file.DontNeed(c.offset, c.size);
+    }
+
+    bool MeshFile::VerifyChunk(std::uint32_t chunk) const {
+        const MeshChunkDesc& c = m_chunks[chunk];
+        return HashBytes(m_file.Data() + c.offset, c.size) == c.content_hash;
+    }
+
+    Geometry::MeshSoA MeshFile::LoadLod(std::uint32_t lod) const {
+        Geometry::MeshSoA mesh;
+        if (lod >= m_lods.size()) return mesh;
+        mesh.Reserve(m_lods[lod].vertex_count, m_lods[lod].triangle_count);
+
+        StreamLod(lod, [&mesh](std::uint32_t, const Geometry::MeshView& view) {
+            const auto base = static_cast<std::uint32_t>(mesh.VertexCount());
+            mesh.x.insert(mesh.x.end(), view.x, view.x + view.vertex_count);
+            mesh.y.insert(mesh.y.end(), view.y, view.y + view.vertex_count);
+            mesh.z.insert(mesh.z.end(), view.z, view.z + view.vertex_count);
+            for (std::size_t t = 0; t < view.triangle_count; ++t) {
+                mesh.AddTriangle(base + view.i0[t], base + view.i1[t], base + view.i2[t]);
+            }
+        });
+        return mesh;
+    }
+
+} // namespace Backend::IO
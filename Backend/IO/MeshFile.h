@@ -0,0 +1,80 @@
+#pragma once
+
+// Zero-copy reader for .gemesh files (see IO/MeshFormat.h).
+// Open() maps the file, validates the tables and checks every index against
+// its chunk's vertex count; vertex streams are not touched.
+// Chunk streams are used in place through Geometry::MeshView, and the OS
+// pages them in on first access. StreamLod() walks a LOD with read-ahead and
+// evicts chunks behind it, so memory stays flat regardless of file size.
+
+#include "BackendAPI.h"
+#include "IO/MappedFile.h"
+#include "IO/MeshFormat.h"
+#include "Geometry/MeshSoA.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace Backend::IO {
+
+    class BACKEND_API MeshFile {
+    public:
+        MeshFile() = default;
+        MeshFile(const MeshFile&) = delete;
+        MeshFile& operator=(const MeshFile&) = delete;
+
+        bool Open(const std::string& path);
+        void Close();
+        bool IsOpen() const { return m_header != nullptr; }
+        const std::string& Error() const { return m_error; }
+
+        const MeshFileHeader& Header() const { return *m_header; }
+        Geometry::Aabb Bounds() const;
+
+        std::span<const MeshLodDesc> Lods() const { return m_lods; }
+        std::span<const MeshChunkDesc> Chunks() const { return m_chunks; }
+        std::span<const MeshChunkDesc> LodChunks(std::uint32_t lod) const;
+
+        // Points straight into the mapping; valid until Close()
+        Geometry::MeshView ChunkView(std::uint32_t chunk) const;
+
+        // Residency control for streaming
+        void Prefetch(std::uint32_t chunk) const;
+        void Evict(std::uint32_t chunk) const;
+
+        // Rehashes the chunk bytes (touches every page of the chunk)
+        bool VerifyChunk(std::uint32_t chunk) const;
+
+        // Copies a whole LOD into one owning mesh (indices rebased)
+        Geometry::MeshSoA LoadLod(std::uint32_t lod) const;
+
+        // fn(chunk_index, const MeshView&) for every chunk of `lod`, in order.
+        // Keeps `read_ahead` chunks in flight; with `evict`, pages of finished
+        // chunks are released so the resident set does not grow.
+        template <typename Fn>
+        void StreamLod(std::uint32_t lod, Fn&& fn, std::uint32_t read_ahead = 4, bool evict = true) const {
+            if (lod >= m_lods.size()) return;
+            const std::uint32_t first = m_lods[lod].first_chunk;
+            const std::uint32_t end = first + m_lods[lod].chunk_count;
+            for (std::uint32_t c = first; c < end && c < first + read_ahead; ++c) {
+                Prefetch(c);
+            }
+            for (std::uint32_t c = first; c < end; ++c) {
+                if (c + read_ahead < end) Prefetch(c + read_ahead);
+                fn(c, ChunkView(c));
+                if (evict) Evict(c);
+            }
+        }
+
+    private:
+        bool Fail(const char* message);
+
+        MappedFile m_file;
+        const MeshFileHeader* m_header = nullptr;
+        std::span<const MeshLodDesc> m_lods;
+        std::span<const MeshChunkDesc> m_chunks;
+        std::string m_error;
+    };
+
+} // namespace Backend::IO
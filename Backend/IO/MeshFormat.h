@@ -0,0 +1,107 @@
+#pragma once
+
+// On-disk layout of the .gemesh container (little-endian, version 1).
+//
+//   [MeshFileHeader]                       offset 0, 256 bytes
+//   [chunk 0 streams] [chunk 1 streams]... each stream 64-byte aligned
+//   [MeshLodDesc  x lod_count]
+//   [MeshChunkDesc x chunk_count]
+//
+// A chunk is a self-contained SoA mesh: x, y, z float streams followed by
+// i0, i1, i2 index columns with chunk-local indices. Mapped into memory, a
+// chunk is a Geometry::MeshView with no parsing or copying. LOD l owns the
+// chunk range [first_chunk, first_chunk + chunk_count); LOD 0 is full detail.
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Backend::IO {
+
+    static_assert(std::endian::native == std::endian::little, "gemesh files are little-endian");
+
+    inline constexpr char kMeshMagic[8] = { 'G', 'E', 'M', 'E', 'S', 'H', '\0', '\0' };
+    inline constexpr std::uint32_t kMeshVersion = 1;
+    inline constexpr std::uint64_t kMeshStreamAlignment = 64;
+
+    struct MeshFileHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t header_size;          // sizeof(MeshFileHeader)
+        std::uint32_t lod_count;
+        std::uint32_t chunk_count;
+        std::uint64_t lod_table_offset;
+        std::uint64_t chunk_table_offset;
+        std::uint64_t file_size;            // Detects truncated files
+        std::uint64_t vertex_count;         // Sum over LOD 0
+        std::uint64_t triangle_count;       // Sum over LOD 0
+        float bounds_min[3];
+        float bounds_max[3];
+        std::uint8_t reserved[168];
+    };
+    static_assert(sizeof(MeshFileHeader) == 256);
+
+    struct MeshLodDesc {
+        std::uint32_t first_chunk;
+        std::uint32_t chunk_count;
+        float error;                        // Max geometric error vs LOD 0 (object units)
+        std::uint32_t reserved;
+        std::uint64_t vertex_count;
+        std::uint64_t triangle_count;
+    };
+    static_assert(sizeof(MeshLodDesc) == 32);
+
+    struct MeshChunkDesc {
+        std::uint64_t offset;               // Start of the x stream (aligned)
+        std::uint64_t size;                 // Bytes up to the end of the i2 stream
+        std::uint32_t vertex_count;
+        std::uint32_t triangle_count;
+        std::uint32_t lod;
+        std::uint32_t reserved;
+        float bounds_min[3];
+        float bounds_max[3];
+        std::uint64_t content_hash;         // HashBytes over the chunk bytes
+    };
+    static_assert(sizeof(MeshChunkDesc) == 64);
+
+    // Stream offsets inside a chunk, relative to MeshChunkDesc::offset
+    struct MeshChunkLayout {
+        std::uint64_t x, y, z, i0, i1, i2, size;
+    };
+
+    constexpr std::uint64_t AlignStream(std::uint64_t n) {
+        return (n + kMeshStreamAlignment - 1) & ~(kMeshStreamAlignment - 1);
+    }
+
+    constexpr MeshChunkLayout ComputeChunkLayout(std::uint32_t vertex_count, std::uint32_t triangle_count) {
+        const std::uint64_t v = AlignStream(std::uint64_t(vertex_count) * sizeof(float));
+        const std::uint64_t t = AlignStream(std::uint64_t(triangle_count) * sizeof(std::uint32_t));
+        MeshChunkLayout layout{};
+        layout.x = 0;
+        layout.y = layout.x + v;
+        layout.z = layout.y + v;
+        layout.i0 = layout.z + v;
+        layout.i1 = layout.i0 + t;
+        layout.i2 = layout.i1 + t;
+        layout.size = layout.i2 + t;
+        return layout;
+    }
+
+    // FNV-1a variant over 8-byte words (byte-wise FNV is too slow for GB-sized files)
+    inline std::uint64_t HashBytes(const void* data, std::size_t size, std::uint64_t hash = 0xcbf29ce484222325ull) {
+        const auto* bytes = static_cast<const std::uint8_t*>(data);
+        std::size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            std::uint64_t word;
+            std::memcpy(&word, bytes + i, 8);
+            hash = (hash ^ word) * 0x100000001b3ull;
+            hash ^= hash >> 29;
+        }
+        for (; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+} // namespace Backend::IO
@@ -0,0 +1,196 @@
+#include "IO/MeshWriter.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Backend::IO {
+
+    MeshWriter::~MeshWriter() {
+        // An unfinished file has a zeroed header and is rejected by MeshFile
+        if (m_file.is_open()) {
+            m_file.close();
+        }
+    }
+
+    bool MeshWriter::Fail(const char* message) {
+        m_error = message;
+        return false;
+    }
+
+    bool MeshWriter::Open(const std::string& path) {
+        m_file.open(path, std::ios::binary | std::ios::trunc);
+        if (!m_file) return Fail("cannot open file for writing");
+
+        m_path = path;
+        m_error.clear();
+        m_lods.clear();
+        m_chunks.clear();
+        m_bounds = Geometry::Aabb{};
+        m_finished = false;
+
+        // Placeholder header, patched in Finish()
+        const MeshFileHeader blank{};
+        m_file.write(reinterpret_cast<const char*>(&blank), sizeof(blank));
+        m_offset = sizeof(blank);
+        return static_cast<bool>(m_file);
+    }
+
+    void MeshWriter::BeginLod(float error) {
+        MeshLodDesc lod{};
+        lod.first_chunk = static_cast<std::uint32_t>(m_chunks.size());
+        lod.error = error;
+        m_lods.push_back(lod);
+    }
+
+    void MeshWriter::EnsureLod() {
+        if (m_lods.empty()) BeginLod(0.0f);
+    }
+
+    bool MeshWriter::WriteChunk(const Geometry::MeshView& chunk) {
+        if (!m_file.is_open() || m_finished) return Fail("writer is not open");
+        if (chunk.vertex_count > 0xffffffffull || chunk.triangle_count > 0xffffffffull) {
+            return Fail("chunk exceeds 2^32 vertices or triangles");
+        }
+        EnsureLod();
+
+        const auto vc = static_cast<std::uint32_t>(chunk.vertex_count);
+        const auto tc = static_cast<std::uint32_t>(chunk.triangle_count);
+        const MeshChunkLayout layout = ComputeChunkLayout(vc, tc);
+
+        // Stage the chunk (padding zeroed) so it is hashed and written in one go
+        m_staging.assign(layout.size, std::byte{ 0 });
+        auto put = [this](std::uint64_t at, const void* src, std::size_t bytes) {
+            if (bytes) std::memcpy(m_staging.data() + at, src, bytes);
+        };
+        put(layout.x, chunk.x, vc * sizeof(float));
+        put(layout.y, chunk.y, vc * sizeof(float));
+        put(layout.z, chunk.z, vc * sizeof(float));
+        put(layout.i0, chunk.i0, tc * sizeof(std::uint32_t));
+        put(layout.i1, chunk.i1, tc * sizeof(std::uint32_t));
+        put(layout.i2, chunk.i2, tc * sizeof(std::uint32_t));
+
+        // Align the chunk start; the header is 256 bytes so this is a no-op after it
+        const std::uint64_t start = AlignStream(m_offset);
+        if (start != m_offset) {
+            static const char zeros[kMeshStreamAlignment] = {};
+            m_file.write(zeros, static_cast<std::streamsize>(start - m_offset));
+        }
+        m_file.write(reinterpret_cast<const char*>(m_staging.data()), static_cast<std::streamsize>(layout.size));
+        if (!m_file) return Fail("write failed");
+
+        Geometry::Aabb bounds;
+        for (std::uint32_t i = 0; i < vc; ++i) {
+            bounds.Expand(glm::vec3(chunk.x[i], chunk.y[i], chunk.z[i]));
+        }
+
+        MeshChunkDesc desc{};
+        desc.offset = start;
+        desc.size = layout.size;
+        desc.vertex_count = vc;
+        desc.triangle_count = tc;
+        desc.lod = static_cast<std::uint32_t>(m_lods.size() - 1);
+        std::memcpy(desc.bounds_min, &bounds.min, sizeof(desc.bounds_min));
+        std::memcpy(desc.bounds_max, &bounds.max, sizeof(desc.bounds_max));
+        desc.content_hash = HashBytes(m_staging.data(), m_staging.size());
+        m_chunks.push_back(desc);
+
+        MeshLodDesc& lod = m_lods.back();
+        lod.chunk_count += 1;
+        lod.vertex_count += vc;
+        lod.triangle_count += tc;
+        if (desc.lod == 0 && bounds.IsValid()) {
+            m_bounds.Expand(bounds);
+        }
+
+        m_offset = start + layout.size;
+        return true;
+    }
+
+    bool MeshWriter::WriteChunked(const Geometry::MeshView& mesh, std::uint32_t max_triangles) {
+        if (max_triangles == 0) return Fail("max_triangles must be positive");
+
+        if (m_remap.size() < mesh.vertex_count) {
+            m_remap.resize(mesh.vertex_count);
+            m_remap_stamp.resize(mesh.vertex_count, 0);
+        }
+
+        Geometry::MeshSoA chunk;
+        chunk.Reserve(static_cast<std::size_t>(max_triangles) * 3, max_triangles);
+
+        for (std::size_t first = 0; first < mesh.triangle_count; first += max_triangles) {
+            const std::size_t last = std::min<std::size_t>(first + max_triangles, mesh.triangle_count);
+
+            if (++m_stamp == 0) {
+                // Stamp wrapped: reset so stale entries cannot match
+                std::fill(m_remap_stamp.begin(), m_remap_stamp.end(), 0u);
+                m_stamp = 1;
+            }
+            chunk.Clear();
+
+            auto local = [&](std::uint32_t global) {
+                if (m_remap_stamp[global] != m_stamp) {
+                    m_remap_stamp[global] = m_stamp;
+                    m_remap[global] = chunk.AddVertex(glm::vec3(mesh.x[global], mesh.y[global], mesh.z[global]));
+                }
+                return m_remap[global];
+            };
+
+            for (std::size_t t = first; t < last; ++t) {
+                const std::uint32_t a = local(mesh.i0[t]);
+                const std::uint32_t b = local(mesh.i1[t]);
+                const std::uint32_t c = local(mesh.i2[t]);
+                chunk.AddTriangle(a, b, c);
+            }
+
+            if (!WriteChunk(chunk.View())) return false;
+        }
+        return true;
+    }
+
+    bool MeshWriter::Finish() {
+        if (!m_file.is_open() || m_finished) return Fail("writer is not open");
+        EnsureLod();
+
+        MeshFileHeader header{};
+        std::memcpy(header.magic, kMeshMagic, sizeof(header.magic));
+        header.version = kMeshVersion;
+        header.header_size = sizeof(MeshFileHeader);
+        header.lod_count = static_cast<std::uint32_t>(m_lods.size());
+        header.chunk_count = static_cast<std::uint32_t>(m_chunks.size());
+        header.vertex_count = m_lods.front().vertex_count;
+        header.triangle_count = m_lods.front().triangle_count;
+        std::memcpy(header.bounds_min, &m_bounds.min, sizeof(header.bounds_min));
+        std::memcpy(header.bounds_max, &m_bounds.max, sizeof(header.bounds_max));
+
+        // Tables go after the last chunk, 64-byte aligned like everything else
+        header.lod_table_offset = AlignStream(m_offset);
+        header.chunk_table_offset = AlignStream(header.lod_table_offset + m_lods.size() * sizeof(MeshLodDesc));
+        header.file_size = header.chunk_table_offset + m_chunks.size() * sizeof(MeshChunkDesc);
+
+        static const char zeros[kMeshStreamAlignment] = {};
+        m_file.write(zeros, static_cast<std::streamsize>(header.lod_table_offset - m_offset));
+        m_file.write(reinterpret_cast<const char*>(m_lods.data()),
+                     static_cast<std::streamsize>(m_lods.size() * sizeof(MeshLodDesc)));
+        const std::uint64_t lod_end = header.lod_table_offset + m_lods.size() * sizeof(MeshLodDesc);
+        m_file.write(zeros, static_cast<std::streamsize>(header.chunk_table_offset - lod_end));
+        m_file.write(reinterpret_cast<const char*>(m_chunks.data()),
+                     static_cast<std::streamsize>(m_chunks.size() * sizeof(MeshChunkDesc)));
+
+        m_file.seekp(0);
+        m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        const bool written = static_cast<bool>(m_file);
+        m_file.close();
+        m_finished = true;
+        if (!written || m_file.fail()) return Fail("write failed");
+        return true;
+    }
+
+    bool WriteMeshFile(const std::string& path, const Geometry::MeshSoA& mesh,
+                       std::uint32_t max_chunk_triangles, std::string* error) {
+        MeshWriter writer;
+        const bool ok = writer.Open(path) && writer.WriteChunked(mesh.View(), max_chunk_triangles) && writer.Finish();
+        if (!ok && error) *error = writer.Error();
+        return ok;
+    }
+
+} // namespace Backend::IO
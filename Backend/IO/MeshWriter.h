@@ -0,0 +1,73 @@
+#pragma once
+
+// Streaming writer for the .gemesh container (see IO/MeshFormat.h).
+// Chunks are appended as they are produced, so a mesh never has to exist in
+// one piece; only the small LOD and chunk tables are kept until Finish().
+
+#include "BackendAPI.h"
+#include "IO/MeshFormat.h"
+#include "Geometry/MeshSoA.h"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace Backend::IO {
+
+    // 64k triangles keeps a chunk around 1-2 MB: small enough to stream and
+    // evict individually, large enough that per-chunk overhead disappears
+    inline constexpr std::uint32_t kDefaultChunkTriangles = 1u << 16;
+
+    class BACKEND_API MeshWriter {
+    public:
+        MeshWriter() = default;
+        ~MeshWriter();
+
+        MeshWriter(const MeshWriter&) = delete;
+        MeshWriter& operator=(const MeshWriter&) = delete;
+
+        bool Open(const std::string& path);
+
+        // Chunks written after this call belong to a new LOD. LODs are written
+        // coarsening in order; the first LOD is opened implicitly with error 0.
+        void BeginLod(float error);
+
+        // Appends one chunk; indices must be local to the chunk's vertices
+        bool WriteChunk(const Geometry::MeshView& chunk);
+
+        // Splits `mesh` into chunks of at most `max_triangles`, remapping
+        // vertices so every chunk is self-contained
+        bool WriteChunked(const Geometry::MeshView& mesh, std::uint32_t max_triangles = kDefaultChunkTriangles);
+
+        // Writes the tables and patches the header; the file is invalid until then
+        bool Finish();
+
+        const std::string& Error() const { return m_error; }
+
+    private:
+        bool Fail(const char* message);
+        void EnsureLod();
+
+        std::ofstream m_file;
+        std::string m_path;
+        std::string m_error;
+        std::uint64_t m_offset = 0;
+        std::vector<MeshLodDesc> m_lods;
+        std::vector<MeshChunkDesc> m_chunks;
+        std::vector<std::byte> m_staging;
+        Geometry::Aabb m_bounds;
+        bool m_finished = false;
+
+        // WriteChunked scratch (generation-stamped remap, never cleared)
+        std::vector<std::uint32_t> m_remap;
+        std::vector<std::uint32_t> m_remap_stamp;
+        std::uint32_t m_stamp = 0;
+    };
+
+    // Convenience: one LOD, chunked
+    BACKEND_API bool WriteMeshFile(const std::string& path, const Geometry::MeshSoA& mesh,
+                                   std::uint32_t max_chunk_triangles = kDefaultChunkTriangles,
+                                   std::string* error = nullptr);
+
+} // namespace Backend::IO
@@ -0,0 +1,498 @@
+#include "IO/SceneJournal.h"
+#include "IO/MeshFormat.h"
+#include "Engine.h"
+#include "Profiling/Profiler.h"
+
+#include <nlohmann/json.hpp>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <type_traits>
+#include <unordered_map>
+
+namespace Backend::IO {
+
+    // ============================================================================
+    // ENCODING
+    // ============================================================================
+
+    namespace {
+
+        constexpr std::uint32_t kBatchMagic = 0x424A4547;      // "GEJB"
+        constexpr std::uint32_t kSnapshotMagic = 0x4E534547;   // "GESN"
+        constexpr std::uint32_t kSnapshotVersion = 1;
+
+        constexpr std::uint8_t kRecordUpsert = 0;
+        constexpr std::uint8_t kRecordDestroy = 1;
+
+        struct BatchHeader {
+            std::uint32_t magic;
+            std::uint32_t record_count;
+            std::uint64_t seq;
+            std::uint64_t payload_bytes;
+            std::uint64_t checksum;
+        };
+
+        struct SnapshotHeader {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint64_t seq;
+            std::uint64_t record_count;
+            std::uint64_t payload_bytes;
+            std::uint64_t checksum;
+        };
+
+        // Followed by Transform (mask & kDirtyTransform), MeshRecord (mask &
+        // kDirtyMesh) and name_length bytes (mask & kDirtyName), in that order
+        struct RecordHeader {
+            std::uint32_t entity;
+            std::uint8_t kind;
+            std::uint8_t mask;
+            std::uint16_t name_length;
+        };
+
+        struct MeshRecord {
+            std::uint32_t id;
+            float local_min[3];
+            float local_max[3];
+        };
+
+        static_assert(std::is_trivially_copyable_v<Transform>);
+
+        template <typename T>
+        void Append(std::vector<std::byte>& out, const T& value) {
+            const std::size_t at = out.size();
+            out.resize(at + sizeof(T));
+            std::memcpy(out.data() + at, &value, sizeof(T));
+        }
+
+        void AppendBytes(std::vector<std::byte>& out, const void* data, std::size_t size) {
+            const std::size_t at = out.size();
+            out.resize(at + size);
+            if (size) std::memcpy(out.data() + at, data, size);
+        }
+
+        struct Reader {
+            const std::byte* data;
+            std::size_t size;
+            std::size_t at = 0;
+
+            template <typename T>
+            bool Read(T& value) {
+                if (size - at < sizeof(T)) return false;
+                std::memcpy(&value, data + at, sizeof(T));
+                at += sizeof(T);
+                return true;
+            }
+
+            bool ReadBytes(std::string& out, std::size_t n) {
+                if (size - at < n) return false;
+                out.assign(reinterpret_cast<const char*>(data + at), n);
+                at += n;
+                return true;
+            }
+        };
+
+    } // namespace
+
+    // ============================================================================
+    // MIRROR (persisted state, writer thread)
+    // ============================================================================
+
+    struct SceneJournal::Mirror {
+        struct EntityState {
+            std::uint8_t mask = 0;      // Components present
+            Transform transform;
+            MeshRecord mesh{};
+            std::string name;
+        };
+
+        std::unordered_map<std::uint32_t, EntityState> entities;
+        std::uint64_t seq = 0;
+
+        // Applies one encoded record stream; false if it is malformed
+        bool Apply(const std::byte* data, std::size_t size, std::uint32_t record_count) {
+            Reader reader{ data, size };
+            for (std::uint32_t i = 0; i < record_count; ++i) {
+                RecordHeader header;
+                if (!reader.Read(header)) return false;
+                if (header.kind == kRecordDestroy) {
+                    entities.erase(header.entity);
+                    continue;
+                }
+                EntityState& state = entities[header.entity];
+                state.mask |= header.mask;
+                if ((header.mask & kDirtyTransform) && !reader.Read(state.transform)) return false;
+                if ((header.mask & kDirtyMesh) && !reader.Read(state.mesh)) return false;
+                if ((header.mask & kDirtyName) && !reader.ReadBytes(state.name, header.name_length)) return false;
+            }
+            return reader.at == size;
+        }
+
+        void Encode(std::vector<std::byte>& out) const {
+            for (const auto& [id, state] : entities) {
+                const RecordHeader header{ id, kRecordUpsert, state.mask, static_cast<std::uint16_t>(state.name.size()) };
+                Append(out, header);
+                if (state.mask & kDirtyTransform) Append(out, state.transform);
+                if (state.mask & kDirtyMesh) Append(out, state.mesh);
+                if (state.mask & kDirtyName) AppendBytes(out, state.name.data(), state.name.size());
+            }
+        }
+
+        nlohmann::json ToJson() const {
+            nlohmann::json list = nlohmann::json::array();
+            for (const auto& [id, state] : entities) {
+                const Transform& t = state.transform;
+                nlohmann::json e = {
+                    { "id", id },
+                    { "name", state.name },
+                    { "position", { t.position.x, t.position.y, t.position.z } },
+                    { "rotation", { t.rotation.x, t.rotation.y, t.rotation.z } },
+                    { "scale", { t.scale.x, t.scale.y, t.scale.z } }
+                };
+                if (state.mask & kDirtyMesh) {
+                    e["mesh"] = {
+                        { "id", state.mesh.id },
+                        { "min", { state.mesh.local_min[0], state.mesh.local_min[1], state.mesh.local_min[2] } },
+                        { "max", { state.mesh.local_max[0], state.mesh.local_max[1], state.mesh.local_max[2] } }
+                    };
+                }
+                list.push_back(std::move(e));
+            }
+            return nlohmann::json{ { "seq", seq }, { "entities", std::move(list) } };
+        }
+    };
+
+    // ============================================================================
+    // FILE HELPERS
+    // ============================================================================
+
+    namespace {
+
+        std::vector<std::byte> ReadWholeFile(const std::string& path) {
+            std::vector<std::byte> bytes;
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file) return bytes;
+            const std::streamsize size = file.tellg();
+            if (size <= 0) return bytes;
+            bytes.resize(static_cast<std::size_t>(size));
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(bytes.data()), size);
+            if (!file) bytes.clear();
+            return bytes;
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // LIFECYCLE
+    // ============================================================================
+
+    SceneJournal::SceneJournal() = default;
+
+    SceneJournal::~SceneJournal() {
+        Close();
+    }
+
+    bool SceneJournal::Open(const std::string& base_path, const SceneJournalConfig& config) {
+        Close();
+        m_base_path = base_path;
+        m_config = config;
+        m_mirror = std::make_unique<Mirror>();
+        m_error.clear();
+        m_status = SceneJournalStatus{};
+        m_stop = false;
+        m_compact_requested = false;
+
+        // Snapshot: all or nothing
+        const std::vector<std::byte> snapshot = ReadWholeFile(base_path + ".snap");
+        if (!snapshot.empty()) {
+            SnapshotHeader header;
+            Reader reader{ snapshot.data(), snapshot.size() };
+            if (!reader.Read(header) || header.magic != kSnapshotMagic || header.version != kSnapshotVersion ||
+                header.payload_bytes != snapshot.size() - sizeof(SnapshotHeader) ||
+                HashBytes(snapshot.data() + sizeof(SnapshotHeader), header.payload_bytes) != header.checksum ||
+                !m_mirror->Apply(snapshot.data() + sizeof(SnapshotHeader), header.payload_bytes,
+                                 static_cast<std::uint32_t>(header.record_count))) {
+                m_error = "corrupt snapshot: " + base_path + ".snap";
+                m_mirror.reset();
+                return false;
+            }
+            m_mirror->seq = header.seq;
+            m_status.snapshot_bytes = snapshot.size();
+        }
+
+        // Journal: replay batches newer than the snapshot, stop at the first torn one
+        const std::vector<std::byte> journal = ReadWholeFile(base_path + ".journal");
+        std::size_t at = 0;
+        while (journal.size() - at >= sizeof(BatchHeader)) {
+            BatchHeader header;
+            std::memcpy(&header, journal.data() + at, sizeof(header));
+            const std::byte* payload = journal.data() + at + sizeof(header);
+            if (header.magic != kBatchMagic || header.payload_bytes > journal.size() - at - sizeof(header) ||
+                HashBytes(payload, header.payload_bytes) != header.checksum) {
+                break;
+            }
+            if (header.seq > m_mirror->seq) {
+                if (!m_mirror->Apply(payload, header.payload_bytes, header.record_count)) break;
+                m_mirror->seq = header.seq;
+            }
+            at += sizeof(header) + header.payload_bytes;
+        }
+        m_status.journal_bytes = at;
+        if (at != journal.size()) {
+            // Appending after garbage would make later batches unreachable
+            m_compact_requested = true;
+        }
+
+        m_status.submitted_seq = m_mirror->seq;
+        m_status.written_seq = m_mirror->seq;
+        m_status.persisted_entities = m_mirror->entities.size();
+
+        m_thread = std::thread(&SceneJournal::WriterLoop, this);
+        return true;
+    }
+
+    void SceneJournal::Close() {
+        if (!m_thread.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_one();
+        m_thread.join();
+        m_mirror.reset();
+    }
+
+    // ============================================================================
+    // UI THREAD
+    // ============================================================================
+
+    bool SceneJournal::Load(Scene& scene) {
+        if (!m_mirror) return false;
+        GE_PROFILE_FUNCTION();
+        std::lock_guard<std::mutex> lock(m_mirror_mutex);
+
+        scene.Clear();
+        scene.Reserve(m_mirror->entities.size());
+        for (const auto& [id, state] : m_mirror->entities) {
+            const Entity entity = scene.CreateEntityWithId(static_cast<Entity>(id), state.name, state.transform);
+            if (entity == NullEntity) continue;
+            if (state.mask & kDirtyMesh) {
+                Geometry::Aabb local;
+                std::memcpy(&local.min, state.mesh.local_min, sizeof(state.mesh.local_min));
+                std::memcpy(&local.max, state.mesh.local_max, sizeof(state.mesh.local_max));
+                scene.SetMesh(entity, MeshHandle{ state.mesh.id }, local);
+            }
+        }
+        scene.ClearDirty();
+        return true;
+    }
+
+    bool SceneJournal::Save(Scene& scene) {
+        if (!IsOpen() || !scene.HasUnsavedChanges()) return false;
+        GE_PROFILE_FUNCTION();
+
+        std::vector<std::byte> batch;
+        batch.reserve(4096);
+        batch.resize(sizeof(BatchHeader));
+        std::uint32_t records = 0;
+
+        for (const Entity entity : scene.DestroyedEntities()) {
+            Append(batch, RecordHeader{ static_cast<std::uint32_t>(entity), kRecordDestroy, 0, 0 });
+            ++records;
+        }
+
+        scene.ForEachDirty([&](Entity entity, std::uint8_t mask) {
+            const std::string_view name = scene.GetName(entity);
+            const std::size_t name_length = name.size() < 0xFFFF ? name.size() : 0xFFFF;
+            const MeshHandle mesh = scene.GetMesh(entity);
+            if (!mesh.IsValid()) mask &= static_cast<std::uint8_t>(~kDirtyMesh);
+
+            Append(batch, RecordHeader{ static_cast<std::uint32_t>(entity), kRecordUpsert, mask,
+                                        static_cast<std::uint16_t>(name_length) });
+            if (mask & kDirtyTransform) Append(batch, scene.GetTransform(entity));
+            if (mask & kDirtyMesh) {
+                const Geometry::Aabb& local = scene.GetBounds(entity).local;
+                MeshRecord record{ mesh.id, {}, {} };
+                std::memcpy(record.local_min, &local.min, sizeof(record.local_min));
+                std::memcpy(record.local_max, &local.max, sizeof(record.local_max));
+                Append(batch, record);
+            }
+            if (mask & kDirtyName) AppendBytes(batch, name.data(), name_length);
+            ++records;
+        });
+        scene.ClearDirty();
+
+        BatchHeader header{};
+        header.magic = kBatchMagic;
+        header.record_count = records;
+        header.payload_bytes = batch.size() - sizeof(BatchHeader);
+        header.checksum = HashBytes(batch.data() + sizeof(BatchHeader), header.payload_bytes);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            header.seq = ++m_status.submitted_seq;
+            m_status.last_batch_entities = records;
+            std::memcpy(batch.data(), &header, sizeof(header));
+            m_queue.push_back(std::move(batch));
+        }
+        m_wake.notify_one();
+        return true;
+    }
+
+    void SceneJournal::RequestCompaction() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_compact_requested = true;
+        }
+        m_wake.notify_one();
+    }
+
+    void SceneJournal::Flush() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_drained.wait(lock, [this] {
+            return !m_thread.joinable() || m_status.failed || m_status.written_seq == m_status.submitted_seq;
+        });
+    }
+
+    SceneJournalStatus SceneJournal::GetStatus() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_status;
+    }
+
+    std::string SceneJournal::LastError() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_error;
+    }
+
+    // ============================================================================
+    // WRITER THREAD
+    // ============================================================================
+
+    void SceneJournal::WriterLoop() {
+        Profiling::SetThreadName("Scene Journal");
+        const std::string journal_path = m_base_path + ".journal";
+        const std::string snapshot_path = m_base_path + ".snap";
+
+        std::ofstream journal(journal_path, std::ios::binary | std::ios::app);
+        std::vector<std::byte> encoded;
+
+        auto fail = [this](std::string message) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_error = std::move(message);
+            m_status.failed = true;
+            m_drained.notify_all();
+        };
+
+        // Full snapshot from the mirror, then start a fresh journal
+        auto compact = [&]() -> bool {
+            GE_PROFILE_ZONE("SceneJournal::Compact");
+            std::uint64_t seq = 0;
+            std::uint64_t records = 0;
+            nlohmann::json json;
+            encoded.assign(sizeof(SnapshotHeader), std::byte{ 0 });
+            {
+                std::lock_guard<std::mutex> lock(m_mirror_mutex);
+                m_mirror->Encode(encoded);
+                seq = m_mirror->seq;
+                records = m_mirror->entities.size();
+                if (m_config.format == SnapshotFormat::BinaryAndJson) json = m_mirror->ToJson();
+            }
+
+            SnapshotHeader header{ kSnapshotMagic, kSnapshotVersion, seq, records,
+                                   encoded.size() - sizeof(SnapshotHeader), 0 };
+            header.checksum = HashBytes(encoded.data() + sizeof(SnapshotHeader), header.payload_bytes);
+            std::memcpy(encoded.data(), &header, sizeof(header));
+
+            const std::string temp_path = snapshot_path + ".tmp";
+            {
+                std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+                file.write(reinterpret_cast<const char*>(encoded.data()), static_cast<std::streamsize>(encoded.size()));
+                if (!file) return false;
+            }
+            std::error_code ec;
+            std::filesystem::rename(temp_path, snapshot_path, ec);
+            if (ec) return false;
+
+            // Batches up to `seq` are in the snapshot; a crash before this point
+            // only leaves batches that Open() skips by sequence number
+            journal.close();
+            journal.open(journal_path, std::ios::binary | std::ios::trunc);
+            if (!journal) return false;
+
+            if (m_config.format == SnapshotFormat::BinaryAndJson) {
+                std::ofstream json_file(m_base_path + ".json", std::ios::trunc);
+                json_file << json.dump(2);
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_status.snapshot_bytes = encoded.size();
+            m_status.journal_bytes = 0;
+            m_status.compactions += 1;
+            return true;
+        };
+
+        for (;;) {
+            std::vector<std::byte> batch;
+            bool compact_now = false;
+            bool stopping = false;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [this] { return m_stop || m_compact_requested || !m_queue.empty(); });
+                if (!m_queue.empty()) {
+                    batch = std::move(m_queue.front());
+                    m_queue.pop_front();
+                } else {
+                    compact_now = m_compact_requested;
+                    m_compact_requested = false;
+                    stopping = m_stop;
+                }
+            }
+
+            if (!batch.empty()) {
+                GE_PROFILE_ZONE("SceneJournal::Write");
+                BatchHeader header;
+                std::memcpy(&header, batch.data(), sizeof(header));
+
+                journal.write(reinterpret_cast<const char*>(batch.data()), static_cast<std::streamsize>(batch.size()));
+                journal.flush();
+                if (!journal) {
+                    fail("journal write failed: " + journal_path);
+                    continue;
+                }
+
+                std::size_t persisted = 0;
+                {
+                    std::lock_guard<std::mutex> lock(m_mirror_mutex);
+                    m_mirror->Apply(batch.data() + sizeof(BatchHeader), header.payload_bytes, header.record_count);
+                    m_mirror->seq = header.seq;
+                    persisted = m_mirror->entities.size();
+                }
+
+                bool over_budget = false;
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_status.written_seq = header.seq;
+                    m_status.journal_bytes += batch.size();
+                    m_status.persisted_entities = persisted;
+                    const std::uint64_t budget = m_status.snapshot_bytes > m_config.min_compact_bytes
+                                               ? m_status.snapshot_bytes : m_config.min_compact_bytes;
+                    over_budget = m_status.journal_bytes > budget;
+                    if (m_status.written_seq == m_status.submitted_seq) m_drained.notify_all();
+                }
+                if (over_budget && !compact()) fail("snapshot compaction failed: " + snapshot_path);
+
+                // Let an idle UI pick up the new status
+                RequestRedraw();
+                continue;
+            }
+
+            if (compact_now && !compact()) fail("snapshot compaction failed: " + snapshot_path);
+            if (stopping) break;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_drained.notify_all();
+    }
+
+} // namespace Backend::IO
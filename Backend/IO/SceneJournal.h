@@ -0,0 +1,110 @@
+#pragma once
+
+// Incremental scene persistence.
+//
+// Save() runs on the UI thread and only encodes entities the Scene marked
+// dirty (plus deletions) into a batch, then hands it to a writer thread; its
+// cost is proportional to what changed, not to scene size. The writer appends
+// batches to <base>.journal and keeps an in-memory mirror of the persisted
+// state. When the journal grows past the snapshot size it writes a full
+// <base>.snap from the mirror (temp file + rename) and truncates the journal,
+// so compaction never touches the Scene either.
+//
+// Binary is the fast path. With SnapshotFormat::BinaryAndJson every compaction also
+// writes <base>.json (nlohmann) for inspection and diffing.
+//
+// Load() rebuilds a Scene from the snapshot and replays the journal; a torn
+// final batch from a crash is detected by its checksum and dropped.
+
+#include "BackendAPI.h"
+#include "Scene/Scene.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Backend::IO {
+
+    enum class SnapshotFormat {
+        Binary,
+        BinaryAndJson
+    };
+
+    struct SceneJournalConfig {
+        SnapshotFormat format = SnapshotFormat::Binary;
+        // Compact once the journal exceeds max(min_compact_bytes, snapshot size)
+        std::uint64_t min_compact_bytes = 1ull << 20;
+    };
+
+    struct SceneJournalStatus {
+        std::uint64_t submitted_seq = 0;    // Last batch handed to the writer
+        std::uint64_t written_seq = 0;      // Last batch durable in the journal
+        std::uint64_t journal_bytes = 0;
+        std::uint64_t snapshot_bytes = 0;
+        std::uint64_t compactions = 0;
+        std::size_t persisted_entities = 0;
+        std::size_t last_batch_entities = 0;
+        bool failed = false;
+    };
+
+    class BACKEND_API SceneJournal {
+    public:
+        SceneJournal();
+        ~SceneJournal();
+
+        SceneJournal(const SceneJournal&) = delete;
+        SceneJournal& operator=(const SceneJournal&) = delete;
+
+        // `base_path` without extension. Loads existing state into the writer's
+        // mirror (not into a Scene) and starts the writer thread.
+        bool Open(const std::string& base_path, const SceneJournalConfig& config = {});
+
+        // Flushes pending batches and stops the writer
+        void Close();
+        bool IsOpen() const { return m_thread.joinable(); }
+
+        // Replaces `scene` with the persisted state (call after Open, before editing)
+        bool Load(Scene& scene);
+
+        // Encodes the scene's dirty entities and deletions, clears them and
+        // queues the batch. Returns false if there was nothing to save.
+        bool Save(Scene& scene);
+
+        // Ask the writer to write a full snapshot after the pending batches
+        void RequestCompaction();
+
+        // Blocks until every submitted batch is written (shutdown, tests)
+        void Flush();
+
+        SceneJournalStatus GetStatus() const;
+        std::string LastError() const;
+
+    private:
+        void WriterLoop();
+
+        std::string m_base_path;
+        SceneJournalConfig m_config;
+        std::thread m_thread;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_drained;
+        std::deque<std::vector<std::byte>> m_queue;
+        bool m_stop = false;
+        bool m_compact_requested = false;
+        std::string m_error;
+        SceneJournalStatus m_status;
+
+        // Persisted state as the writer sees it; guarded by its own mutex so a
+        // large batch being applied never blocks Save() on the UI thread
+        struct Mirror;
+        std::unique_ptr<Mirror> m_mirror;
+        std::mutex m_mirror_mutex;
+    };
+
+} // namespace Backend::IO
@@ -0,0 +1,367 @@
+#include "Jobs/JobSystem.h"
+#include "Jobs/WorkStealingDeque.h"
+#include "Profiling/Profiler.h"
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #include <immintrin.h>
+    #define JOBS_CPU_PAUSE() _mm_pause()
+#else
+    #define JOBS_CPU_PAUSE() std::this_thread::yield()
+#endif
+
+namespace Backend::Jobs {
+
+    // ============================================================================
+    // STATE
+    // ============================================================================
+
+    namespace {
+
+        constexpr std::size_t kDequeCapacity = 4096;
+        constexpr std::size_t kJobRingSize = 4096;   // Per submitting thread
+
+        using Deque = WorkStealingDeque<Job, kDequeCapacity>;
+
+        struct alignas(64) Worker {
+            Deque deque;
+            std::thread thread;
+            // Written only by the owning thread, read by GetStats
+            std::atomic<std::uint64_t> executed{ 0 };
+            std::atomic<std::uint64_t> stolen{ 0 };
+        };
+
+        struct JobRing {
+            std::unique_ptr<Job[]> jobs = std::make_unique<Job[]>(kJobRingSize);
+            std::size_t next = 0;
+        };
+
+        std::vector<std::unique_ptr<Worker>> s_workers;   // [0] is the initializing thread
+        JobSystemConfig s_config;
+        std::atomic<bool> s_running{ false };
+        std::atomic<std::uint64_t> s_inlined{ 0 };
+
+        // Submitted jobs not yet finished: queued, parked on a counter or
+        // executing. A job's children are counted before it finishes, so this
+        // only reaches zero once the whole tree has run
+        std::atomic<std::int64_t> s_outstanding{ 0 };
+
+        // Sleep/wake: workers wait on the epoch, submitters bump it
+        std::atomic<std::uint32_t> s_epoch{ 0 };
+        std::atomic<int> s_sleeping{ 0 };
+
+        // Jobs submitted from threads that have no deque
+        std::mutex s_injection_mutex;
+        std::vector<Job*> s_injection;
+        std::atomic<bool> s_injection_nonempty{ false };
+
+        thread_local int t_index = -1;
+        thread_local JobRing* t_ring = nullptr;
+        thread_local std::minstd_rand t_rng{ std::random_device{}() };
+
+        Worker* CurrentWorker() {
+            if (t_index < 0 || static_cast<std::size_t>(t_index) >= s_workers.size()) return nullptr;
+            return s_workers[t_index].get();
+        }
+
+        void Execute(Job* job);
+
+        void Bump(std::atomic<std::uint64_t>& stat) {
+            stat.store(stat.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        void WakeWorkers() {
+            s_epoch.fetch_add(1, std::memory_order_seq_cst);
+            if (s_sleeping.load(std::memory_order_seq_cst) > 0) {
+                s_epoch.notify_one();
+            }
+        }
+
+    } // namespace
+
+    // Counter internals live here so JobCounter stays a plain public type
+    struct SchedulerAccess {
+        static void Lock(JobCounter& c) {
+            while (c.m_lock.test_and_set(std::memory_order_acquire)) {
+                JOBS_CPU_PAUSE();
+            }
+        }
+        static void Unlock(JobCounter& c) { c.m_lock.clear(std::memory_order_release); }
+        static void Increment(JobCounter& c) { c.m_pending.fetch_add(1, std::memory_order_relaxed); }
+        // Non-final decrements are lock-free. The final one happens under the
+        // lock so no thread touches the counter after a waiter can see it done.
+        static bool TryDecrementNonFinal(JobCounter& c) {
+            int pending = c.m_pending.load(std::memory_order_relaxed);
+            while (pending > 1) {
+                if (c.m_pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        static void DecrementLocked(JobCounter& c) { c.m_pending.fetch_sub(1, std::memory_order_acq_rel); }
+        static bool Pending(JobCounter& c) { return c.m_pending.load(std::memory_order_acquire) > 0; }
+        static Job*& Waiters(JobCounter& c) { return c.m_waiters; }
+    };
+
+    namespace {
+
+        void Schedule(Job* job) {
+            if (!s_running.load(std::memory_order_acquire)) {
+                s_inlined.fetch_add(1, std::memory_order_relaxed);
+                Execute(job);
+                return;
+            }
+
+            if (Worker* worker = CurrentWorker()) {
+                if (!worker->deque.Push(job)) {
+                    // Deque full: run inline rather than grow
+                    s_inlined.fetch_add(1, std::memory_order_relaxed);
+                    Execute(job);
+                    return;
+                }
+            } else {
+                std::lock_guard<std::mutex> lock(s_injection_mutex);
+                s_injection.push_back(job);
+                s_injection_nonempty.store(true, std::memory_order_release);
+            }
+            WakeWorkers();
+        }
+
+        void Complete(JobCounter* counter) {
+            if (!counter || SchedulerAccess::TryDecrementNonFinal(*counter)) return;
+
+            // Last job on this counter: release everything parked on it
+            SchedulerAccess::Lock(*counter);
+            SchedulerAccess::DecrementLocked(*counter);
+            Job* parked = SchedulerAccess::Waiters(*counter);
+            SchedulerAccess::Waiters(*counter) = nullptr;
+            SchedulerAccess::Unlock(*counter);
+
+            while (parked) {
+                Job* next = parked->next;
+                parked->next = nullptr;
+                Schedule(parked);
+                parked = next;
+            }
+        }
+
+        Job* PopInjected() {
+            if (!s_injection_nonempty.load(std::memory_order_acquire)) return nullptr;
+            std::lock_guard<std::mutex> lock(s_injection_mutex);
+            if (s_injection.empty()) return nullptr;
+            Job* job = s_injection.back();
+            s_injection.pop_back();
+            s_injection_nonempty.store(!s_injection.empty(), std::memory_order_release);
+            return job;
+        }
+
+        Job* FindJob() {
+            Worker* self = CurrentWorker();
+            if (self) {
+                if (Job* job = self->deque.Pop()) return job;
+            }
+            if (Job* job = PopInjected()) return job;
+
+            // Steal, starting from a random victim to spread contention
+            const std::size_t n = s_workers.size();
+            if (n == 0) return nullptr;
+            const std::size_t start = t_rng() % n;
+            for (std::size_t i = 0; i < n; ++i) {
+                Worker* victim = s_workers[(start + i) % n].get();
+                if (victim == self) continue;
+                if (Job* job = victim->deque.Steal()) {
+                    if (self) Bump(self->stolen);
+                    return job;
+                }
+            }
+            return nullptr;
+        }
+
+        void WorkerLoop(int index) {
+            t_index = index;
+            const std::string thread_name = "Job Worker " + std::to_string(index);
+            Profiling::SetThreadName(thread_name.c_str());
+            unsigned spins = 0;
+
+            while (s_running.load(std::memory_order_acquire)) {
+                if (Job* job = FindJob()) {
+                    Execute(job);
+                    spins = 0;
+                    continue;
+                }
+                if (++spins < s_config.spin_count) {
+                    JOBS_CPU_PAUSE();
+                    continue;
+                }
+
+                // Announce sleep, then re-check so a concurrent submit is never missed
+                const std::uint32_t epoch = s_epoch.load(std::memory_order_seq_cst);
+                s_sleeping.fetch_add(1, std::memory_order_seq_cst);
+                if (Job* job = FindJob()) {
+                    s_sleeping.fetch_sub(1, std::memory_order_seq_cst);
+                    Execute(job);
+                    spins = 0;
+                    continue;
+                }
+                if (s_running.load(std::memory_order_acquire)) {
+                    s_epoch.wait(epoch, std::memory_order_seq_cst);
+                }
+                s_sleeping.fetch_sub(1, std::memory_order_seq_cst);
+                spins = 0;
+            }
+        }
+
+        void Execute(Job* job) {
+            JobCounter* counter = job->counter;
+            {
+                GE_PROFILE_ZONE("Job");
+                job->invoke(*job);
+            }
+            job->in_use.store(0, std::memory_order_release);
+            if (Worker* self = CurrentWorker()) Bump(self->executed);
+            Complete(counter);
+            s_outstanding.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // INTERNAL ENTRY POINTS
+    // ============================================================================
+
+    Job* Internal::AllocateJob() {
+        if (!t_ring) {
+            // Leaked on purpose: jobs from this ring may still be running when the thread exits
+            t_ring = new JobRing();
+        }
+
+        Job* job = &t_ring->jobs[t_ring->next];
+        t_ring->next = (t_ring->next + 1) & (kJobRingSize - 1);
+
+        // Ring wrapped onto a job that is still queued: help drain until it frees up
+        while (job->in_use.load(std::memory_order_acquire) != 0) {
+            if (Job* other = FindJob()) {
+                Execute(other);
+            } else {
+                JOBS_CPU_PAUSE();
+            }
+        }
+        job->in_use.store(1, std::memory_order_relaxed);
+        job->next = nullptr;
+        job->counter = nullptr;
+        return job;
+    }
+
+    void Internal::Submit(Job* job, JobCounter* counter, JobCounter* depends_on) {
+        s_outstanding.fetch_add(1, std::memory_order_relaxed);
+        job->counter = counter;
+        if (counter) {
+            SchedulerAccess::Increment(*counter);
+        }
+
+        if (depends_on) {
+            SchedulerAccess::Lock(*depends_on);
+            if (SchedulerAccess::Pending(*depends_on)) {
+                job->next = SchedulerAccess::Waiters(*depends_on);
+                SchedulerAccess::Waiters(*depends_on) = job;
+                SchedulerAccess::Unlock(*depends_on);
+                return;
+            }
+            SchedulerAccess::Unlock(*depends_on);
+        }
+
+        Schedule(job);
+    }
+
+    // ============================================================================
+    // LIFECYCLE
+    // ============================================================================
+
+    void Initialize(const JobSystemConfig& config) {
+        if (s_running.load(std::memory_order_acquire)) return;
+
+        s_config = config;
+        unsigned workers = config.worker_count;
+        if (workers == 0) {
+            const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+            workers = hw > 1 ? hw - 1 : 0;
+        }
+
+        s_workers.clear();
+        for (unsigned i = 0; i <= workers; ++i) {
+            s_workers.push_back(std::make_unique<Worker>());
+        }
+        t_index = 0;
+        s_running.store(true, std::memory_order_release);
+
+        for (unsigned i = 1; i <= workers; ++i) {
+            s_workers[i]->thread = std::thread(WorkerLoop, static_cast<int>(i));
+        }
+    }
+
+    void Shutdown() {
+        if (!s_running.load(std::memory_order_acquire)) return;
+
+        // Help until every submitted job has run, including ones that running
+        // jobs submit later and ones parked on counters; workers only stop
+        // once nothing is left for them to drop
+        while (s_outstanding.load(std::memory_order_acquire) > 0) {
+            if (Job* job = FindJob()) {
+                Execute(job);
+            } else {
+                JOBS_CPU_PAUSE();
+            }
+        }
+
+        s_running.store(false, std::memory_order_release);
+        s_epoch.fetch_add(1, std::memory_order_seq_cst);
+        s_epoch.notify_all();
+
+        for (auto& worker : s_workers) {
+            if (worker->thread.joinable()) {
+                worker->thread.join();
+            }
+        }
+        assert(s_outstanding.load(std::memory_order_acquire) == 0 && !s_injection_nonempty.load());
+        s_workers.clear();
+        t_index = -1;
+    }
+
+    bool IsInitialized() { return s_running.load(std::memory_order_acquire); }
+
+    unsigned ThreadCount() {
+        return s_workers.empty() ? 1u : static_cast<unsigned>(s_workers.size());
+    }
+
+    int ThreadIndex() { return t_index; }
+
+    JobSystemStats GetStats() {
+        JobSystemStats stats;
+        for (const auto& worker : s_workers) {
+            stats.jobs_executed += worker->executed.load(std::memory_order_relaxed);
+            stats.jobs_stolen += worker->stolen.load(std::memory_order_relaxed);
+        }
+        stats.jobs_inlined = s_inlined.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void Wait(JobCounter& counter) {
+        while (!counter.IsDone()) {
+            if (Job* job = FindJob()) {
+                Execute(job);
+            } else {
+                JOBS_CPU_PAUSE();
+            }
+        }
+    }
+
+} // namespace Backend::Jobs
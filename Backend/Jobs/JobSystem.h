@@ -0,0 +1,153 @@
+#pragma once
+
+// Backend job scheduler.
+// One worker thread per core plus the thread that calls Initialize (worker 0).
+// Each worker owns a work-stealing deque; idle workers steal from the others.
+// Jobs are fixed-size (no heap allocation) and are tracked by JobCounters,
+// which double as dependencies: a job submitted with `depends_on` is parked
+// on that counter and only becomes runnable once it reaches zero.
+//
+// When the system is not initialized every Run executes inline, so callers
+// never need a separate single-threaded path.
+
+#include "BackendAPI.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Backend::Jobs {
+
+    class JobCounter;
+
+    // ============================================================================
+    // JOB
+    // ============================================================================
+
+    struct alignas(64) Job {
+        static constexpr std::size_t kStorageSize = 96;
+
+        void (*invoke)(Job&) = nullptr;
+        JobCounter* counter = nullptr;
+        Job* next = nullptr;                    // Intrusive list while parked on a dependency
+        std::atomic<std::uint32_t> in_use{ 0 }; // Guards ring-buffer reuse
+        alignas(16) unsigned char storage[kStorageSize];
+    };
+
+    // ============================================================================
+    // COUNTER
+    // ============================================================================
+
+    class BACKEND_API JobCounter {
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        // The lock check keeps a waiter from destroying the counter while the
+        // thread that released it is still draining parked jobs
+        bool IsDone() const {
+            return m_pending.load(std::memory_order_acquire) == 0 && !m_lock.test(std::memory_order_acquire);
+        }
+        int Pending() const { return m_pending.load(std::memory_order_acquire); }
+
+    private:
+        friend struct SchedulerAccess;
+
+        std::atomic<int> m_pending{ 0 };
+        std::atomic_flag m_lock = ATOMIC_FLAG_INIT;
+        Job* m_waiters = nullptr;
+    };
+
+    // ============================================================================
+    // LIFECYCLE
+    // ============================================================================
+
+    struct JobSystemConfig {
+        unsigned worker_count = 0;   // 0 = hardware_concurrency - 1 (the caller is worker 0)
+        unsigned spin_count = 256;   // Idle spins before a worker sleeps
+    };
+
+    struct JobSystemStats {
+        std::uint64_t jobs_executed = 0;
+        std::uint64_t jobs_stolen = 0;
+        std::uint64_t jobs_inlined = 0;   // Deque full or system not running
+    };
+
+    BACKEND_API void Initialize(const JobSystemConfig& config = {});
+    // Runs every submitted job, including those submitted meanwhile, then stops the workers
+    BACKEND_API void Shutdown();
+    BACKEND_API bool IsInitialized();
+
+    // Total threads able to run jobs, including worker 0
+    BACKEND_API unsigned ThreadCount();
+    // 0 for the initializing thread, 1..N for workers, -1 for foreign threads
+    BACKEND_API int ThreadIndex();
+    BACKEND_API JobSystemStats GetStats();
+
+    // Runs queued jobs on the calling thread until the counter drains
+    BACKEND_API void Wait(JobCounter& counter);
+
+    // ============================================================================
+    // INTERNAL ENTRY POINTS (used by the templates below)
+    // ============================================================================
+
+    namespace Internal {
+        BACKEND_API Job* AllocateJob();
+        BACKEND_API void Submit(Job* job, JobCounter* counter, JobCounter* depends_on);
+    }
+
+    // ============================================================================
+    // SUBMISSION
+    // ============================================================================
+
+    // fn() runs on any worker. Captures must fit Job::kStorageSize; capture
+    // large state by pointer.
+    template <typename Fn>
+    void Run(Fn&& fn, JobCounter* counter = nullptr, JobCounter* depends_on = nullptr) {
+        using Functor = std::decay_t<Fn>;
+        static_assert(sizeof(Functor) <= Job::kStorageSize, "Job capture too large, capture by pointer instead");
+        static_assert(alignof(Functor) <= 16, "Job capture over-aligned");
+
+        Job* job = Internal::AllocateJob();
+        ::new (static_cast<void*>(job->storage)) Functor(std::forward<Fn>(fn));
+        job->invoke = [](Job& self) {
+            Functor* f = std::launder(reinterpret_cast<Functor*>(self.storage));
+            (*f)();
+            f->~Functor();
+        };
+        Internal::Submit(job, counter, depends_on);
+    }
+
+    // Splits [begin, end) into chunks of at least `grain` indices and calls
+    // fn(chunk_begin, chunk_end) for each in parallel. Blocks until done; the
+    // calling thread participates.
+    template <typename Fn>
+    void ParallelFor(std::size_t begin, std::size_t end, std::size_t grain, Fn&& fn) {
+        if (end <= begin) return;
+        const std::size_t count = end - begin;
+        if (grain == 0) grain = 1;
+
+        // Cap the chunk count at a few per thread to keep scheduling overhead low
+        const std::size_t max_chunks = static_cast<std::size_t>(ThreadCount()) * 4;
+        std::size_t chunk = grain;
+        if (count / chunk > max_chunks) {
+            chunk = (count + max_chunks - 1) / max_chunks;
+        }
+        if (chunk >= count || !IsInitialized()) {
+            fn(begin, end);
+            return;
+        }
+
+        JobCounter counter;
+        auto* body = &fn;
+        for (std::size_t lo = begin; lo < end; lo += chunk) {
+            const std::size_t hi = lo + chunk < end ? lo + chunk : end;
+            Run([body, lo, hi]() { (*body)(lo, hi); }, &counter);
+        }
+        Wait(counter);
+    }
+
+} // namespace Backend::Jobs
@@ -0,0 +1,84 @@
+#pragma once
+
+// Fixed-capacity Chase-Lev work-stealing deque (Le et al., "Correct and
+// Efficient Work-Stealing for Weak Memory Models", PPoPP 2013).
+// The owning thread pushes and pops at the bottom; any thread may steal from
+// the top. Push fails instead of growing, the caller then runs the job inline.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Backend::Jobs {
+
+    template <typename T, std::size_t Capacity>
+    class WorkStealingDeque {
+        static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+        static constexpr std::int64_t kMask = static_cast<std::int64_t>(Capacity) - 1;
+
+    public:
+        // Owner thread only
+        bool Push(T* item) {
+            const std::int64_t b = m_bottom.load(std::memory_order_relaxed);
+            const std::int64_t t = m_top.load(std::memory_order_acquire);
+            if (b - t >= static_cast<std::int64_t>(Capacity)) {
+                return false;
+            }
+            m_buffer[b & kMask].store(item, std::memory_order_relaxed);
+            m_bottom.store(b + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Owner thread only
+        T* Pop() {
+            const std::int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+            m_bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = m_top.load(std::memory_order_relaxed);
+
+            if (t > b) {
+                // Empty
+                m_bottom.store(b + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            T* item = m_buffer[b & kMask].load(std::memory_order_relaxed);
+            if (t == b) {
+                // Last element: race against thieves
+                if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    item = nullptr;
+                }
+                m_bottom.store(b + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        // Any thread
+        T* Steal() {
+            std::int64_t t = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const std::int64_t b = m_bottom.load(std::memory_order_acquire);
+            if (t >= b) {
+                return nullptr;
+            }
+            T* item = m_buffer[t & kMask].load(std::memory_order_relaxed);
+            if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            return item;
+        }
+
+        std::size_t ApproxSize() const {
+            const std::int64_t b = m_bottom.load(std::memory_order_relaxed);
+            const std::int64_t t = m_top.load(std::memory_order_relaxed);
+            return b > t ? static_cast<std::size_t>(b - t) : 0;
+        }
+
+    private:
+        // Separate cache lines: thieves hammer m_top, the owner m_bottom
+        alignas(64) std::atomic<std::int64_t> m_top{ 0 };
+        alignas(64) std::atomic<std::int64_t> m_bottom{ 0 };
+        alignas(64) std::atomic<T*> m_buffer[Capacity] = {};
+    };
+
+} // namespace Backend::Jobs
@@ -0,0 +1,303 @@
+#include "Logging/Log.h"
+
+#include <spdlog/async.h>
+#include <spdlog/async_logger.h>
+#include <spdlog/details/null_mutex.h>
+#include <spdlog/sinks/base_sink.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+
+namespace Backend::Logging {
+
+    namespace {
+
+        constexpr std::array<const char*, kChannelCount> kChannelNames = {
+            "engine", "jobs", "render", "scene", "io", "bridge", "window", "ui", "modules"
+        };
+
+        Channel ChannelFromName(spdlog::string_view_t name) {
+            const std::string_view view(name.data(), name.size());
+            for (std::size_t i = 0; i < kChannelCount; ++i) {
+                if (view == kChannelNames[i]) return static_cast<Channel>(i);
+            }
+            return Channel::Engine;
+        }
+
+        std::int64_t TimeNs(const spdlog::details::log_msg& msg) {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(msg.time.time_since_epoch()).count();
+        }
+
+        // ============================================================================
+        // CONSOLE RING
+        // Written by the log worker, read by the UI thread. Outlives Shutdown so
+        // the console keeps the last messages.
+        // ============================================================================
+
+        class ConsoleRing {
+        public:
+            void SetCapacity(std::size_t capacity) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_entries.assign(std::max<std::size_t>(capacity, 1), ConsoleEntry{});
+                m_first = m_sequence + 1;
+            }
+
+            void Push(const spdlog::details::log_msg& msg) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_entries.empty()) return;
+                ConsoleEntry& entry = m_entries[m_sequence % m_entries.size()];
+                entry.sequence = ++m_sequence;
+                entry.time_ns = TimeNs(msg);
+                entry.thread = static_cast<std::uint32_t>(msg.thread_id);
+                entry.level = static_cast<Level>(msg.level);
+                entry.channel = ChannelFromName(msg.logger_name);
+                entry.text.assign(msg.payload.data(), msg.payload.size());   // Keeps its capacity
+            }
+
+            std::uint64_t Read(std::uint64_t after, std::vector<ConsoleEntry>& out) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_entries.empty() || after >= m_sequence) return m_sequence;
+                const std::uint64_t retained = std::min<std::uint64_t>(m_sequence, m_entries.size());
+                std::uint64_t next = std::max({ after + 1, m_sequence - retained + 1, m_first });
+                for (; next <= m_sequence; ++next) {
+                    out.push_back(m_entries[(next - 1) % m_entries.size()]);
+                }
+                return m_sequence;
+            }
+
+            void Clear() {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_first = m_sequence + 1;
+            }
+
+            std::uint64_t Written() {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_sequence;
+            }
+
+        private:
+            std::mutex m_mutex;
+            std::vector<ConsoleEntry> m_entries;
+            std::uint64_t m_sequence = 0;   // Newest entry; entry n lives in slot (n - 1) % size
+            std::uint64_t m_first = 1;      // Oldest sequence still readable (after Clear)
+        };
+
+        ConsoleRing s_console;
+
+        // Sinks are only ever called by the pool's single worker thread
+        class ConsoleSink final : public spdlog::sinks::base_sink<spdlog::details::null_mutex> {
+        protected:
+            void sink_it_(const spdlog::details::log_msg& msg) override { s_console.Push(msg); }
+            void flush_() override {}
+        };
+
+        class StructuredSink final : public spdlog::sinks::base_sink<spdlog::details::null_mutex> {
+        public:
+            ~StructuredSink() override {
+                if (m_file) std::fclose(m_file);
+            }
+
+            bool Open(const std::string& path) {
+                m_file = std::fopen(path.c_str(), "wb");
+                if (!m_file) return false;
+                std::setvbuf(m_file, nullptr, _IOFBF, 1 << 16);
+                const LogFileHeader header;
+                std::fwrite(&header, sizeof(header), 1, m_file);
+                return true;
+            }
+
+        protected:
+            void sink_it_(const spdlog::details::log_msg& msg) override {
+                LogRecord record;
+                record.time_ns = TimeNs(msg);
+                record.thread = static_cast<std::uint32_t>(msg.thread_id);
+                record.level = static_cast<std::uint8_t>(msg.level);
+                record.channel = static_cast<std::uint8_t>(ChannelFromName(msg.logger_name));
+                record.length = static_cast<std::uint32_t>(msg.payload.size());
+                std::fwrite(&record, sizeof(record), 1, m_file);
+                std::fwrite(msg.payload.data(), 1, msg.payload.size(), m_file);
+            }
+
+            void flush_() override { std::fflush(m_file); }
+
+        private:
+            std::FILE* m_file = nullptr;
+        };
+
+        // ============================================================================
+        // STATE
+        // ============================================================================
+
+        std::mutex s_mutex;     // Initialize / Shutdown
+        std::shared_ptr<spdlog::details::thread_pool> s_pool;
+        std::array<std::shared_ptr<spdlog::logger>, kChannelCount> s_owned;
+        std::array<std::atomic<spdlog::logger*>, kChannelCount> s_loggers{};
+        struct LevelSlot {
+            std::atomic<Level> value{ Level::Info };
+        };
+        std::array<LevelSlot, kChannelCount> s_levels;
+        std::uint64_t s_dropped_before = 0;     // Overruns of earlier pools
+
+        std::size_t Index(Channel channel) {
+            return std::min(static_cast<std::size_t>(channel), kChannelCount - 1);
+        }
+
+    } // namespace
+
+    const char* ChannelName(Channel channel) {
+        return kChannelNames[Index(channel)];
+    }
+
+    const char* LevelName(Level level) {
+        switch (level) {
+            case Level::Trace: return "trace";
+            case Level::Debug: return "debug";
+            case Level::Info: return "info";
+            case Level::Warn: return "warn";
+            case Level::Error: return "error";
+            case Level::Critical: return "critical";
+            case Level::Off: return "off";
+        }
+        return "unknown";
+    }
+
+    // ============================================================================
+    // LIFETIME
+    // ============================================================================
+
+    bool Initialize(const LogConfig& config) {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (s_pool) return true;
+
+        std::vector<spdlog::sink_ptr> sinks;
+        if (config.stdout_sink) {
+            auto out = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+            out->set_pattern("[%H:%M:%S.%e] [%n] [%^%l%$] %v");
+            sinks.push_back(std::move(out));
+        }
+        s_console.SetCapacity(config.console_capacity);
+        sinks.push_back(std::make_shared<ConsoleSink>());
+
+        bool structured = true;
+        if (!config.structured_path.empty()) {
+            auto file = std::make_shared<StructuredSink>();
+            structured = file->Open(config.structured_path);
+            if (structured) sinks.push_back(std::move(file));
+        }
+
+        s_pool = std::make_shared<spdlog::details::thread_pool>(std::max<std::size_t>(config.queue_size, 16), 1);
+        for (std::size_t i = 0; i < kChannelCount; ++i) {
+            auto logger = std::make_shared<spdlog::async_logger>(kChannelNames[i], sinks.begin(), sinks.end(), s_pool,
+                                                                 spdlog::async_overflow_policy::overrun_oldest);
+            s_levels[i].value.store(config.level, std::memory_order_relaxed);
+            logger->set_level(static_cast<spdlog::level::level_enum>(config.level));
+            logger->flush_on(spdlog::level::err);
+            s_loggers[i].store(logger.get(), std::memory_order_release);
+            s_owned[i] = std::move(logger);
+        }
+
+        if (!structured) {
+            s_owned[0]->warn("Structured log unavailable: {}", config.structured_path);
+        }
+        return structured;
+    }
+
+    void Shutdown() {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (!s_pool) return;
+        for (std::size_t i = 0; i < kChannelCount; ++i) {
+            s_loggers[i].store(nullptr, std::memory_order_release);
+            s_owned[i]->flush();
+            s_owned[i].reset();     // Queued messages keep their logger alive
+        }
+        s_dropped_before += s_pool->overrun_counter();
+        s_pool.reset();             // Drains the queue, then joins the worker
+    }
+
+    bool IsInitialized() {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        return s_pool != nullptr;
+    }
+
+    // ============================================================================
+    // CHANNELS
+    // ============================================================================
+
+    void SetLevel(Channel channel, Level level) {
+        const std::size_t i = Index(channel);
+        s_levels[i].value.store(level, std::memory_order_relaxed);
+        if (spdlog::logger* logger = s_loggers[i].load(std::memory_order_acquire)) {
+            logger->set_level(static_cast<spdlog::level::level_enum>(level));
+        }
+    }
+
+    Level GetLevel(Channel channel) {
+        return s_levels[Index(channel)].value.load(std::memory_order_relaxed);
+    }
+
+    spdlog::logger* GetLogger(Channel channel) {
+        spdlog::logger* logger = s_loggers[Index(channel)].load(std::memory_order_acquire);
+        return logger ? logger : spdlog::default_logger_raw();
+    }
+
+    LogStats GetStats() {
+        LogStats stats;
+        stats.written = s_console.Written();
+        std::lock_guard<std::mutex> lock(s_mutex);
+        stats.dropped = s_dropped_before + (s_pool ? s_pool->overrun_counter() : 0);
+        return stats;
+    }
+
+    // ============================================================================
+    // CONSOLE AND FILE
+    // ============================================================================
+
+    std::uint64_t ReadConsole(std::uint64_t after, std::vector<ConsoleEntry>& out) {
+        return s_console.Read(after, out);
+    }
+
+    void ClearConsole() {
+        s_console.Clear();
+    }
+
+    bool ReadLogFile(const std::string& path, std::vector<ConsoleEntry>& out) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) return false;
+        const std::vector<char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        LogFileHeader header;
+        if (bytes.size() < sizeof(header)) return false;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        if (header.magic != kLogFileMagic || header.version != kLogFileVersion) return false;
+
+        std::size_t at = sizeof(header);
+        std::uint64_t sequence = 0;
+        while (bytes.size() - at >= sizeof(LogRecord)) {
+            LogRecord record;
+            std::memcpy(&record, bytes.data() + at, sizeof(record));
+            at += sizeof(record);
+            if (bytes.size() - at < record.length) break;
+
+            ConsoleEntry entry;
+            entry.sequence = ++sequence;
+            entry.time_ns = record.time_ns;
+            entry.thread = record.thread;
+            entry.level = static_cast<Level>(std::min<std::uint8_t>(record.level, static_cast<std::uint8_t>(Level::Off)));
+            entry.channel = static_cast<Channel>(std::min<std::size_t>(record.channel, kChannelCount - 1));
+            entry.text.assign(bytes.data() + at, record.length);
+            out.push_back(std::move(entry));
+            at += record.length;
+        }
+        return true;
+    }
+
+} // namespace Backend::Logging
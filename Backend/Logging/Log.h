@@ -0,0 +1,164 @@
+#pragma once
+
+// Asynchronous, per-channel logging on top of spdlog.
+//
+// Every channel (one per engine module) is an spdlog async_logger; all of
+// them share one thread pool whose single worker owns the sinks. A log call
+// checks the channel level (one atomic load), formats into a stack buffer
+// and enqueues the message. With the overrun_oldest policy a full queue
+// drops its oldest message instead of waiting, so no caller ever blocks on
+// the sink thread, the terminal or the disk.
+//
+// Sinks, all fed by the worker: colored stdout, an optional binary file of
+// LogRecords (read back with ReadLogFile) and an in-memory ring that the
+// editor's log console polls with ReadConsole().
+//
+// Before Initialize() and after Shutdown() messages go to spdlog's default
+// (synchronous) logger, so early startup and late shutdown still print.
+
+#include "BackendAPI.h"
+#include <spdlog/spdlog.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Backend::Logging {
+
+    enum class Channel : std::uint8_t {
+        Engine,
+        Jobs,
+        Render,
+        Scene,
+        IO,
+        Bridge,
+        Window,
+        UI,
+        Modules,
+        Count
+    };
+
+    inline constexpr std::size_t kChannelCount = static_cast<std::size_t>(Channel::Count);
+
+    // Same values as spdlog::level::level_enum
+    enum class Level : std::uint8_t {
+        Trace,
+        Debug,
+        Info,
+        Warn,
+        Error,
+        Critical,
+        Off
+    };
+
+    BACKEND_API const char* ChannelName(Channel channel);
+    BACKEND_API const char* LevelName(Level level);
+
+    struct LogConfig {
+        std::size_t queue_size = 8192;          // Messages waiting for the worker; oldest dropped beyond
+        std::size_t console_capacity = 4096;    // Messages kept for ReadConsole
+        bool stdout_sink = true;
+        std::string structured_path;            // Binary LogRecord file; empty = none
+        Level level = Level::Info;              // Initial level of every channel
+    };
+
+    // Call once, before other threads log; Shutdown once they have stopped.
+    // Initialize resets every channel to config.level. It returns false if
+    // the structured file could not be opened; logging runs without it.
+    // Shutdown drains the queue.
+    BACKEND_API bool Initialize(const LogConfig& config = {});
+    BACKEND_API void Shutdown();
+    BACKEND_API bool IsInitialized();
+
+    // Thread-safe; takes effect for the next message
+    BACKEND_API void SetLevel(Channel channel, Level level);
+    BACKEND_API Level GetLevel(Channel channel);
+
+    // Never null. Valid until Shutdown
+    BACKEND_API spdlog::logger* GetLogger(Channel channel);
+
+    struct LogStats {
+        std::uint64_t written = 0;      // Reached the sinks
+        std::uint64_t dropped = 0;      // Overwritten in a full queue
+    };
+
+    BACKEND_API LogStats GetStats();
+
+    template <typename... Args>
+    void Write(Channel channel, Level level, spdlog::format_string_t<Args...> format, Args&&... args) {
+        spdlog::logger* logger = GetLogger(channel);
+        const auto spd_level = static_cast<spdlog::level::level_enum>(level);
+        if (logger->should_log(spd_level)) {
+            logger->log(spd_level, format, std::forward<Args>(args)...);
+        }
+    }
+
+    // ============================================================================
+    // CONSOLE RING
+    // ============================================================================
+
+    struct ConsoleEntry {
+        std::uint64_t sequence = 0;     // 1-based, increasing
+        std::int64_t time_ns = 0;       // System clock, since the epoch
+        std::uint32_t thread = 0;
+        Level level = Level::Info;
+        Channel channel = Channel::Engine;
+        std::string text;
+    };
+
+    // Appends the retained entries newer than `after` to `out`, oldest first,
+    // and returns the newest sequence seen (pass it back next time). Entries
+    // that were overwritten before being read are skipped.
+    BACKEND_API std::uint64_t ReadConsole(std::uint64_t after, std::vector<ConsoleEntry>& out);
+    BACKEND_API void ClearConsole();
+
+    // ============================================================================
+    // STRUCTURED FILE
+    // A LogFileHeader, then per message a LogRecord followed by `length`
+    // bytes of UTF-8 text. Fixed-size little-endian PODs, like the Bridge
+    // protocol, so tools read them with memcpy.
+    // ============================================================================
+
+    inline constexpr std::uint32_t kLogFileMagic = 0x474C4547;   // "GELG"
+    inline constexpr std::uint16_t kLogFileVersion = 1;
+
+    struct LogFileHeader {
+        std::uint32_t magic = kLogFileMagic;
+        std::uint16_t version = kLogFileVersion;
+        std::uint16_t reserved = 0;
+    };
+
+    struct LogRecord {
+        std::int64_t time_ns = 0;
+        std::uint32_t thread = 0;
+        std::uint8_t level = 0;
+        std::uint8_t channel = 0;
+        std::uint16_t reserved = 0;
+        std::uint32_t length = 0;
+        std::uint32_t padding = 0;
+    };
+
+    static_assert(sizeof(LogFileHeader) == 8 && sizeof(LogRecord) == 24);
+
+    // Decodes a whole file written by the structured sink. False if it is
+    // missing or not a log file; a truncated tail is ignored
+    BACKEND_API bool ReadLogFile(const std::string& path, std::vector<ConsoleEntry>& out);
+
+} // namespace Backend::Logging
+
+// ============================================================================
+// MACROS
+// GE_LOG_INFO(Window, "Resized to {}x{}", width, height)
+// ============================================================================
+
+#define GE_LOG(channel, level, ...) \
+    ::Backend::Logging::Write(::Backend::Logging::Channel::channel, ::Backend::Logging::Level::level, __VA_ARGS__)
+
+#define GE_LOG_TRACE(channel, ...) GE_LOG(channel, Trace, __VA_ARGS__)
+#define GE_LOG_DEBUG(channel, ...) GE_LOG(channel, Debug, __VA_ARGS__)
+#define GE_LOG_INFO(channel, ...) GE_LOG(channel, Info, __VA_ARGS__)
+#define GE_LOG_WARN(channel, ...) GE_LOG(channel, Warn, __VA_ARGS__)
+#define GE_LOG_ERROR(channel, ...) GE_LOG(channel, Error, __VA_ARGS__)
+#define GE_LOG_CRITICAL(channel, ...) GE_LOG(channel, Critical, __VA_ARGS__)
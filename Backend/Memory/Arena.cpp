@@ -0,0 +1,157 @@
+#include "Memory/Arena.h"
+
+#include <algorithm>
+#include <new>
+
+namespace Backend::Memory {
+
+    struct LinearArena::Block {
+        Block* next = nullptr;
+        std::size_t size = 0;
+        std::size_t used = 0;
+
+        std::byte* Data() { return reinterpret_cast<std::byte*>(this + 1); }
+    };
+
+    namespace {
+
+        std::uintptr_t AlignUp(std::uintptr_t value, std::size_t align) {
+            return (value + align - 1) & ~static_cast<std::uintptr_t>(align - 1);
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // LINEAR ARENA
+    // ============================================================================
+
+    LinearArena::LinearArena(std::size_t block_size)
+        : m_block_size(std::max<std::size_t>(block_size, 256)) {
+        m_first = m_current = NewBlock(m_block_size);
+        m_span = m_cycle_span = m_first->size;
+    }
+
+    LinearArena::~LinearArena() {
+        FreeBlocks();
+    }
+
+    LinearArena::Block* LinearArena::NewBlock(std::size_t size) {
+        void* memory = ::operator new(sizeof(Block) + size, std::align_val_t{ alignof(std::max_align_t) });
+        Block* block = new (memory) Block();
+        block->size = size;
+        m_capacity += size;
+        ++m_block_allocations;
+        return block;
+    }
+
+    void LinearArena::FreeBlocks() {
+        for (Block* block = m_first; block;) {
+            Block* next = block->next;
+            ::operator delete(block, std::align_val_t{ alignof(std::max_align_t) });
+            block = next;
+        }
+        m_first = m_current = nullptr;
+        m_capacity = 0;
+    }
+
+    void* LinearArena::Allocate(std::size_t size, std::size_t align) {
+        if (size == 0) size = 1;
+        for (;;) {
+            Block* block = m_current;
+            const auto base = reinterpret_cast<std::uintptr_t>(block->Data());
+            const std::uintptr_t at = AlignUp(base + block->used, align);
+            if (at + size <= base + block->size) {
+                const std::size_t consumed = at + size - (base + block->used);
+                block->used += consumed;
+                m_used += consumed;
+                m_peak = std::max(m_peak, m_used);
+                return reinterpret_cast<void*>(at);
+            }
+
+            // Continue in the next kept block, or chain a new one in front of it
+            Block* next = block->next;
+            if (!next || next->size < size + align) {
+                Block* fresh = NewBlock(std::max(m_block_size, size + align));
+                fresh->next = next;
+                block->next = fresh;
+                next = fresh;
+            }
+            next->used = 0;
+            m_current = next;
+            m_span += next->size;
+            m_cycle_span = std::max(m_cycle_span, m_span);
+        }
+    }
+
+    void LinearArena::Reset() {
+        if (m_cycle_span > m_first->size) {
+            FreeBlocks();
+            m_first = NewBlock(m_cycle_span);
+        }
+        m_current = m_first;
+        m_first->used = 0;
+        m_used = 0;
+        m_span = m_cycle_span = m_first->size;
+    }
+
+    LinearArena::Marker LinearArena::Mark() const {
+        return { m_current, m_current->used, m_used, m_span };
+    }
+
+    void LinearArena::Rewind(const Marker& marker) {
+        m_current = static_cast<Block*>(marker.block);
+        m_current->used = marker.block_used;
+        m_used = marker.used;
+        m_span = marker.span;
+    }
+
+    void LinearArena::Trim(std::size_t max_capacity) {
+        while (m_capacity > max_capacity && m_current->next) {
+            Block* unused = m_current->next;
+            m_current->next = unused->next;
+            m_capacity -= unused->size;
+            ::operator delete(unused, std::align_val_t{ alignof(std::max_align_t) });
+        }
+    }
+
+    // ============================================================================
+    // PMR ADAPTER
+    // ============================================================================
+
+    void* ArenaResource::do_allocate(std::size_t bytes, std::size_t align) {
+        return m_arena.Allocate(bytes, align);
+    }
+
+    void ArenaResource::do_deallocate(void*, std::size_t, std::size_t) {}
+
+    bool ArenaResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+        return this == &other;
+    }
+
+    // ============================================================================
+    // THREAD SCRATCH
+    // ============================================================================
+
+    namespace {
+
+        struct ThreadScratch {
+            LinearArena arena{ 256 * 1024 };
+            ArenaResource resource{ arena };
+        };
+
+        ThreadScratch& CurrentScratch() {
+            thread_local ThreadScratch scratch;
+            return scratch;
+        }
+
+    } // namespace
+
+    LinearArena& ThreadArena() {
+        return CurrentScratch().arena;
+    }
+
+    std::pmr::memory_resource* ThreadArenaResource() {
+        return &CurrentScratch().resource;
+    }
+
+} // namespace Backend::Memory
@@ -0,0 +1,121 @@
+#pragma once
+
+// Linear (bump) arenas.
+//
+// Allocation is a pointer bump inside the current block; nothing is freed
+// individually. Reset() releases everything at once, Mark()/Rewind() release
+// everything allocated after a point (see ArenaScope). Blocks are kept for
+// reuse, and when a cycle spilled over several blocks Reset() merges them into
+// one block of the peak size, so a steady workload stops touching the heap
+// after its first cycle.
+//
+// ArenaResource adapts an arena to std::pmr so containers can use it; their
+// deallocations are no-ops until the arena is reset or rewound.
+
+#include "BackendAPI.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace Backend::Memory {
+
+    class BACKEND_API LinearArena {
+    public:
+        explicit LinearArena(std::size_t block_size = 64 * 1024);
+        ~LinearArena();
+
+        LinearArena(const LinearArena&) = delete;
+        LinearArena& operator=(const LinearArena&) = delete;
+
+        void* Allocate(std::size_t size, std::size_t align = alignof(std::max_align_t));
+
+        template <typename T>
+        T* AllocateArray(std::size_t count) {
+            return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void Reset();
+
+        // Opaque position for Rewind
+        struct Marker {
+            void* block = nullptr;
+            std::size_t block_used = 0;
+            std::size_t used = 0;
+            std::size_t span = 0;
+        };
+
+        Marker Mark() const;
+        void Rewind(const Marker& marker);
+
+        // Frees kept blocks past the current one until Capacity() <= max_capacity
+        void Trim(std::size_t max_capacity);
+
+        std::size_t Used() const { return m_used; }           // Bytes handed out since Reset
+        std::size_t Capacity() const { return m_capacity; }   // Bytes held in blocks
+        std::size_t Peak() const { return m_peak; }           // Largest Used() so far
+        std::uint64_t BlockAllocations() const { return m_block_allocations; }
+
+    private:
+        struct Block;
+
+        Block* NewBlock(std::size_t size);
+        void FreeBlocks();
+
+        std::size_t m_block_size;
+        Block* m_first = nullptr;
+        Block* m_current = nullptr;
+        std::size_t m_used = 0;
+        std::size_t m_capacity = 0;
+        std::size_t m_peak = 0;
+        // Bytes of the blocks up to the current one, and its largest value
+        // since Reset: the single block that would have held the whole cycle
+        std::size_t m_span = 0;
+        std::size_t m_cycle_span = 0;
+        std::uint64_t m_block_allocations = 0;
+    };
+
+    // Rewinds `arena` to where it was when the scope opened, then trims it to
+    // `keep_capacity` so one oversized use does not pin its blocks for good
+    class ArenaScope {
+    public:
+        explicit ArenaScope(LinearArena& arena, std::size_t keep_capacity = SIZE_MAX)
+            : m_arena(arena), m_marker(arena.Mark()), m_keep_capacity(keep_capacity) {}
+
+        ~ArenaScope() {
+            m_arena.Rewind(m_marker);
+            if (m_arena.Capacity() > m_keep_capacity) m_arena.Trim(m_keep_capacity);
+        }
+
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+
+    private:
+        LinearArena& m_arena;
+        LinearArena::Marker m_marker;
+        std::size_t m_keep_capacity;
+    };
+
+    class BACKEND_API ArenaResource : public std::pmr::memory_resource {
+    public:
+        explicit ArenaResource(LinearArena& arena) : m_arena(arena) {}
+
+        LinearArena& Arena() const { return m_arena; }
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t align) override;
+        void do_deallocate(void* p, std::size_t bytes, std::size_t align) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+        LinearArena& m_arena;
+    };
+
+    // ============================================================================
+    // THREAD SCRATCH
+    // ============================================================================
+
+    // The calling thread's scratch arena for job temporaries. Open an
+    // ArenaScope around each use; nothing in it may outlive the scope.
+    BACKEND_API LinearArena& ThreadArena();
+    BACKEND_API std::pmr::memory_resource* ThreadArenaResource();
+
+} // namespace Backend::Memory
@@ -0,0 +1,131 @@
+#pragma once
+
+// Replacement global operator new/delete that feed the heap counters of
+// Memory/Memory.h, so the DebugPanel can show allocations per frame.
+//
+// Include in exactly ONE translation unit of an executable (next to main()).
+// Replacements apply to the whole program on ELF/Mach-O platforms, shared
+// libraries included; on Windows each DLL keeps its own CRT operators, so
+// only allocations made by the executable's own code are counted there.
+
+#include "Memory/Memory.h"
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+    #include <malloc.h>
+#endif
+
+namespace Backend::Memory::HeapHooks {
+
+    // Null on failure; only successful allocations are counted
+    inline void* Allocate(std::size_t size) {
+        void* p = std::malloc(size ? size : 1);
+        if (p) Detail::RecordHeapAllocation(size);
+        return p;
+    }
+
+    inline void* AllocateAligned(std::size_t size, std::size_t align) {
+        // Rounding up below must not wrap into a tiny block
+        if (size > SIZE_MAX - align) return nullptr;
+#if defined(_WIN32)
+        void* p = _aligned_malloc(size ? size : 1, align);
+#else
+        // aligned_alloc wants a non-zero multiple of the alignment; new(0, align)
+        // must still return a unique pointer
+        void* p = std::aligned_alloc(align, size ? (size + align - 1) / align * align : align);
+#endif
+        if (p) Detail::RecordHeapAllocation(size);
+        return p;
+    }
+
+    // What a replacement operator new owes the standard: on failure, call the
+    // installed new-handler and retry, and throw only once there is none
+    template <typename Alloc>
+    void* AllocateOrThrow(Alloc&& allocate) {
+        for (;;) {
+            if (void* p = allocate()) return p;
+            const std::new_handler handler = std::get_new_handler();
+            if (!handler) throw std::bad_alloc();
+            handler();
+        }
+    }
+
+    // The nothrow forms behave like the throwing ones with the exception caught
+    template <typename Alloc>
+    void* AllocateOrNull(Alloc&& allocate) noexcept {
+        try {
+            return AllocateOrThrow(allocate);
+        } catch (...) {
+            return nullptr;
+        }
+    }
+
+    inline void Free(void* p) noexcept {
+        if (!p) return;
+        Detail::RecordHeapFree();
+        std::free(p);
+    }
+
+    inline void FreeAligned(void* p) noexcept {
+        if (!p) return;
+        Detail::RecordHeapFree();
+#if defined(_WIN32)
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+
+} // namespace Backend::Memory::HeapHooks
+
+void* operator new(std::size_t size) {
+    return Backend::Memory::HeapHooks::AllocateOrThrow([=] { return Backend::Memory::HeapHooks::Allocate(size); });
+}
+
+void* operator new[](std::size_t size) {
+    return Backend::Memory::HeapHooks::AllocateOrThrow([=] { return Backend::Memory::HeapHooks::Allocate(size); });
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return Backend::Memory::HeapHooks::AllocateOrNull([=] { return Backend::Memory::HeapHooks::Allocate(size); });
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return Backend::Memory::HeapHooks::AllocateOrNull([=] { return Backend::Memory::HeapHooks::Allocate(size); });
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    return Backend::Memory::HeapHooks::AllocateOrThrow(
+        [=] { return Backend::Memory::HeapHooks::AllocateAligned(size, static_cast<std::size_t>(align)); });
+}
+
+void* operator new[](std::size_t size, std::align_val_t align) {
+    return Backend::Memory::HeapHooks::AllocateOrThrow(
+        [=] { return Backend::Memory::HeapHooks::AllocateAligned(size, static_cast<std::size_t>(align)); });
+}
+
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return Backend::Memory::HeapHooks::AllocateOrNull(
+        [=] { return Backend::Memory::HeapHooks::AllocateAligned(size, static_cast<std::size_t>(align)); });
+}
+
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return Backend::Memory::HeapHooks::AllocateOrNull(
+        [=] { return Backend::Memory::HeapHooks::AllocateAligned(size, static_cast<std::size_t>(align)); });
+}
+
+void operator delete(void* p) noexcept { Backend::Memory::HeapHooks::Free(p); }
+void operator delete[](void* p) noexcept { Backend::Memory::HeapHooks::Free(p); }
+void operator delete(void* p, std::size_t) noexcept { Backend::Memory::HeapHooks::Free(p); }
+void operator delete[](void* p, std::size_t) noexcept { Backend::Memory::HeapHooks::Free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { Backend::Memory::HeapHooks::Free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { Backend::Memory::HeapHooks::Free(p); }
+
+void operator delete(void* p, std::align_val_t) noexcept { Backend::Memory::HeapHooks::FreeAligned(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { Backend::Memory::HeapHooks::FreeAligned(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { Backend::Memory::HeapHooks::FreeAligned(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { Backend::Memory::HeapHooks::FreeAligned(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { Backend::Memory::HeapHooks::FreeAligned(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { Backend::Memory::HeapHooks::FreeAligned(p); }
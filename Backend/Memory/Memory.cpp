@@ -0,0 +1,83 @@
+#include "Memory/Memory.h"
+
+#include <atomic>
+
+namespace Backend::Memory {
+
+    namespace {
+
+        // Relaxed: the counters are statistics, read once per frame
+        std::atomic<std::uint64_t> s_heap_allocations{ 0 };
+        std::atomic<std::uint64_t> s_heap_frees{ 0 };
+        std::atomic<std::uint64_t> s_heap_bytes{ 0 };
+        std::atomic<bool> s_heap_tracking{ false };
+
+        struct FrameState {
+            LinearArena arena{ 1024 * 1024 };
+            ArenaResource resource{ arena };
+            MemoryStats stats;
+            std::uint64_t allocations_at_begin = 0;
+            std::uint64_t frees_at_begin = 0;
+            std::uint64_t bytes_at_begin = 0;
+        };
+
+        FrameState& Frame() {
+            static FrameState state;
+            return state;
+        }
+
+    } // namespace
+
+    void Detail::RecordHeapAllocation(std::size_t bytes) noexcept {
+        s_heap_allocations.fetch_add(1, std::memory_order_relaxed);
+        s_heap_bytes.fetch_add(bytes, std::memory_order_relaxed);
+        if (!s_heap_tracking.load(std::memory_order_relaxed)) s_heap_tracking.store(true, std::memory_order_relaxed);
+    }
+
+    void Detail::RecordHeapFree() noexcept {
+        s_heap_frees.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void BeginFrame() {
+        FrameState& frame = Frame();
+        MemoryStats& stats = frame.stats;
+
+        // Close the previous frame before anything of this one runs
+        const std::uint64_t allocations = s_heap_allocations.load(std::memory_order_relaxed);
+        const std::uint64_t frees = s_heap_frees.load(std::memory_order_relaxed);
+        const std::uint64_t bytes = s_heap_bytes.load(std::memory_order_relaxed);
+        stats.heap_tracking = s_heap_tracking.load(std::memory_order_relaxed);
+        stats.heap_allocations = allocations - frame.allocations_at_begin;
+        stats.heap_frees = frees - frame.frees_at_begin;
+        stats.heap_bytes = bytes - frame.bytes_at_begin;
+        stats.total_heap_allocations = allocations;
+        stats.total_heap_bytes = bytes;
+
+        stats.frame_arena_used = frame.arena.Used();
+        stats.frame_arena_peak = frame.arena.Peak();
+        stats.ui_pools = ThreadPoolResource().GetStats();
+        ++stats.frame;
+
+        // Resetting may merge spilled blocks into one, which allocates; count
+        // that in the new frame
+        frame.arena.Reset();
+        stats.frame_arena_capacity = frame.arena.Capacity();
+
+        frame.allocations_at_begin = allocations;
+        frame.frees_at_begin = frees;
+        frame.bytes_at_begin = bytes;
+    }
+
+    MemoryStats GetStats() {
+        return Frame().stats;
+    }
+
+    LinearArena& FrameArena() {
+        return Frame().arena;
+    }
+
+    std::pmr::memory_resource* FrameResource() {
+        return &Frame().resource;
+    }
+
+} // namespace Backend::Memory
@@ -0,0 +1,53 @@
+#pragma once
+
+// Per-frame memory and allocation accounting.
+//
+// The UI thread calls BeginFrame() once per frame: it resets the frame arena
+// (per-frame scratch that lives until the next BeginFrame) and closes the
+// heap counters of the previous frame. Heap counters are fed by the global
+// operator new/delete replacements in Memory/HeapHooks.h; without them
+// heap_tracking stays false and the heap fields read zero.
+
+#include "BackendAPI.h"
+#include "Memory/Arena.h"
+#include "Memory/Pool.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace Backend::Memory {
+
+    struct MemoryStats {
+        std::uint64_t frame = 0;
+
+        // Global operator new/delete, last completed frame (all threads)
+        bool heap_tracking = false;
+        std::uint64_t heap_allocations = 0;
+        std::uint64_t heap_frees = 0;
+        std::uint64_t heap_bytes = 0;
+        std::uint64_t total_heap_allocations = 0;
+        std::uint64_t total_heap_bytes = 0;
+
+        // Frame arena at the end of the last frame
+        std::size_t frame_arena_used = 0;
+        std::size_t frame_arena_capacity = 0;
+        std::size_t frame_arena_peak = 0;
+
+        // The UI thread's pool resource
+        PoolResource::Stats ui_pools;
+    };
+
+    BACKEND_API void BeginFrame();
+    BACKEND_API MemoryStats GetStats();
+
+    // UI thread only; reset by every BeginFrame
+    BACKEND_API LinearArena& FrameArena();
+    BACKEND_API std::pmr::memory_resource* FrameResource();
+
+    namespace Detail {
+        // Called by the HeapHooks.h replacements; must not allocate
+        BACKEND_API void RecordHeapAllocation(std::size_t bytes) noexcept;
+        BACKEND_API void RecordHeapFree() noexcept;
+    }
+
+} // namespace Backend::Memory
@@ -0,0 +1,120 @@
+#include "Memory/Pool.h"
+
+#include <algorithm>
+#include <bit>
+#include <new>
+
+namespace Backend::Memory {
+
+    // ============================================================================
+    // FIXED POOL
+    // ============================================================================
+
+    FixedPool::FixedPool(std::size_t block_size, std::size_t block_align, std::size_t slab_bytes)
+        : m_block_align(std::max(block_align, alignof(FreeBlock))) {
+        m_block_size = std::max(block_size, sizeof(FreeBlock));
+        m_block_size = (m_block_size + m_block_align - 1) / m_block_align * m_block_align;
+        // The first block of every slab links the slab list, so one extra
+        m_blocks_per_slab = std::max<std::size_t>(slab_bytes / m_block_size, 2);
+    }
+
+    FixedPool::~FixedPool() {
+        while (m_slabs) {
+            void* next = *static_cast<void**>(m_slabs);
+            ::operator delete(m_slabs, std::align_val_t{ m_block_align });
+            m_slabs = next;
+        }
+    }
+
+    void FixedPool::Grow() {
+        auto* slab = static_cast<std::byte*>(
+            ::operator new(m_blocks_per_slab * m_block_size, std::align_val_t{ m_block_align }));
+        *reinterpret_cast<void**>(slab) = m_slabs;
+        m_slabs = slab;
+        ++m_slab_count;
+
+        // Thread the remaining blocks onto the free list in address order
+        for (std::size_t i = m_blocks_per_slab - 1; i >= 1; --i) {
+            auto* block = reinterpret_cast<FreeBlock*>(slab + i * m_block_size);
+            block->next = m_free;
+            m_free = block;
+        }
+    }
+
+    void* FixedPool::Allocate() {
+        if (!m_free) Grow();
+        FreeBlock* block = m_free;
+        m_free = block->next;
+        ++m_live;
+        return block;
+    }
+
+    void FixedPool::Free(void* block) {
+        if (!block) return;
+        auto* node = static_cast<FreeBlock*>(block);
+        node->next = m_free;
+        m_free = node;
+        --m_live;
+    }
+
+    // ============================================================================
+    // POOL RESOURCE
+    // ============================================================================
+
+    PoolResource::PoolResource(std::pmr::memory_resource* upstream) : m_upstream(upstream) {}
+
+    PoolResource::~PoolResource() = default;
+
+    std::size_t PoolResource::ClassOf(std::size_t bytes) {
+        const std::size_t size = std::bit_ceil(std::max(bytes, kMinBlock));
+        return static_cast<std::size_t>(std::countr_zero(size) - std::countr_zero(kMinBlock));
+    }
+
+    void* PoolResource::do_allocate(std::size_t bytes, std::size_t align) {
+        // Blocks of a class are aligned to their size, so alignment picks the class too
+        const std::size_t size = std::max(bytes, align);
+        if (size > kMaxBlock) {
+            ++m_upstream_count;
+            return m_upstream->allocate(bytes, align);
+        }
+        const std::size_t cls = ClassOf(size);
+        if (!m_pools[cls]) {
+            const std::size_t block = kMinBlock << cls;
+            m_pools[cls] = std::make_unique<FixedPool>(block, block);
+        }
+        ++m_pooled;
+        return m_pools[cls]->Allocate();
+    }
+
+    void PoolResource::do_deallocate(void* p, std::size_t bytes, std::size_t align) {
+        const std::size_t size = std::max(bytes, align);
+        if (size > kMaxBlock) {
+            m_upstream->deallocate(p, bytes, align);
+            return;
+        }
+        m_pools[ClassOf(size)]->Free(p);
+    }
+
+    bool PoolResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+        return this == &other;
+    }
+
+    PoolResource::Stats PoolResource::GetStats() const {
+        Stats stats;
+        for (const auto& pool : m_pools) {
+            if (!pool) continue;
+            stats.live_blocks += pool->Live();
+            stats.capacity += pool->Capacity();
+            stats.slabs += pool->Slabs();
+        }
+        stats.pooled = m_pooled;
+        stats.upstream = m_upstream_count;
+        return stats;
+    }
+
+    PoolResource& ThreadPoolResource() {
+        thread_local PoolResource resource;
+        return resource;
+    }
+
+} // namespace Backend::Memory
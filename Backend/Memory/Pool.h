@@ -0,0 +1,94 @@
+#pragma once
+
+// Fixed-size block pools.
+//
+// FixedPool hands out equally sized blocks from slabs through an intrusive
+// free list: allocation and free are a pointer pop/push, and slabs are only
+// returned on destruction, so a pool that reached its working set never
+// allocates again. Pools are single-threaded.
+//
+// PoolResource groups pools into power-of-two size classes (16 B - 1 KB)
+// behind std::pmr; larger requests go to its upstream resource. Each thread
+// gets its own through ThreadPoolResource(); memory from it must be freed on
+// the same thread, before the thread exits (per-job and per-frame data).
+
+#include "BackendAPI.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+
+namespace Backend::Memory {
+
+    class BACKEND_API FixedPool {
+    public:
+        // `block_size` is rounded up to a multiple of `block_align` (and to
+        // hold a pointer); each slab carries `slab_bytes` worth of blocks
+        explicit FixedPool(std::size_t block_size, std::size_t block_align = alignof(std::max_align_t),
+                           std::size_t slab_bytes = 64 * 1024);
+        ~FixedPool();
+
+        FixedPool(const FixedPool&) = delete;
+        FixedPool& operator=(const FixedPool&) = delete;
+
+        void* Allocate();
+        void Free(void* block);
+
+        std::size_t BlockSize() const { return m_block_size; }
+        std::size_t Live() const { return m_live; }
+        std::size_t Slabs() const { return m_slab_count; }
+        std::size_t Capacity() const { return m_slab_count * m_blocks_per_slab * m_block_size; }
+
+    private:
+        struct FreeBlock {
+            FreeBlock* next;
+        };
+
+        void Grow();
+
+        std::size_t m_block_size;
+        std::size_t m_block_align;
+        std::size_t m_blocks_per_slab;
+        FreeBlock* m_free = nullptr;
+        void* m_slabs = nullptr;    // Intrusive list through each slab's first word
+        std::size_t m_slab_count = 0;
+        std::size_t m_live = 0;
+    };
+
+    class BACKEND_API PoolResource : public std::pmr::memory_resource {
+    public:
+        static constexpr std::size_t kMinBlock = 16;
+        static constexpr std::size_t kMaxBlock = 1024;
+        static constexpr std::size_t kClassCount = 7;   // 16, 32, ... 1024
+
+        explicit PoolResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+        ~PoolResource() override;
+
+        struct Stats {
+            std::size_t live_blocks = 0;
+            std::size_t capacity = 0;       // Bytes held in slabs
+            std::size_t slabs = 0;
+            std::uint64_t pooled = 0;       // Allocations served by a pool
+            std::uint64_t upstream = 0;     // Allocations passed to the upstream resource
+        };
+
+        Stats GetStats() const;
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t align) override;
+        void do_deallocate(void* p, std::size_t bytes, std::size_t align) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+        static std::size_t ClassOf(std::size_t bytes);
+
+        std::pmr::memory_resource* m_upstream;
+        std::array<std::unique_ptr<FixedPool>, kClassCount> m_pools;
+        std::uint64_t m_pooled = 0;
+        std::uint64_t m_upstream_count = 0;
+    };
+
+    // The calling thread's pool resource (created on first use)
+    BACKEND_API PoolResource& ThreadPoolResource();
+
+} // namespace Backend::Memory
@@ -0,0 +1,106 @@
+#pragma once
+
+// Contract between the Editor's module host (Frontend/ModuleHost.h) and
+// hot-reloadable Backend modules.
+//
+// A module is a shared library that links Backend and exports one C entry
+// point returning a static ModuleAPI. The host loads a private copy of the
+// library, so the original can be rebuilt while the Editor runs, and swaps
+// modules between frames. Everything that must survive a reload lives on the
+// host side: the Scene and LodLibrary the module edits, and the module's own
+// state block, which the host allocates (state_size bytes) in an arena it
+// owns. The block is zeroed whenever state_size or state_version change, so
+// bump the version when the layout changes.
+//
+// The Editor's Backend module (Modules/BackendOps) serves the Backend entry
+// points the Editor would otherwise link: its first load runs Backend::Init,
+// its final unload Backend::Shutdown, and the panels' geometry and scene
+// operations go through its BackendOps table. State-owning Backend code
+// (Scene storage, jobs, renderer, IO) stays in the linked Backend library,
+// since host objects built by it outlive any one module image.
+//
+// Modules must not keep pointers into their own image (strings, function
+// pointers, vtables) in host-owned memory: the image is unmapped on reload.
+
+#include <entt/entity/fwd.hpp>
+#include <cstdint>
+#include <string>
+
+namespace Backend {
+    class Scene;
+}
+
+namespace Backend::Geometry {
+    class LodLibrary;
+}
+
+#if defined(_WIN32)
+    #define GE_MODULE_EXPORT extern "C" __declspec(dllexport)
+#else
+    #define GE_MODULE_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+namespace Backend::Module {
+
+    inline constexpr std::uint32_t kModuleApiVersion = 2;
+    inline constexpr const char* kModuleEntryPoint = "GeometryEngineModule";
+
+    struct ModuleContext {
+        Scene* scene = nullptr;
+        Geometry::LodLibrary* library = nullptr;    // May be null
+
+        // Host-owned, survives reloads; zeroed when the layout changed
+        void* state = nullptr;
+        std::uint32_t state_size = 0;
+        std::uint32_t state_version = 0;
+
+        // Images of this module loaded before the current one; 0 on the first
+        // load and on the first after a failed one
+        std::uint32_t reloads = 0;
+    };
+
+    // Geometry and scene operations the Editor's panels call through the host
+    // (ModuleHost::Host::Ops) instead of linking them. Null entries are not
+    // served; the panels disable what they cannot call.
+    struct BackendOps {
+        // --- Geometry ---
+        // Reads a .gemesh, adds its LOD 0 to the library and puts it on `entity`
+        bool (*import_mesh)(ModuleContext& context, entt::entity entity, const char* path,
+                            std::string& message) = nullptr;
+        // Writes every built level of `mesh`, coarsening, into one .gemesh
+        bool (*export_lods)(ModuleContext& context, std::uint32_t mesh, const char* path,
+                            std::string& message) = nullptr;
+
+        // --- Scene ---
+        // Puts a new terrain entity into the scene and selects it
+        bool (*add_terrain)(ModuleContext& context) = nullptr;
+        // A grid of placeholder cubes next to the previous one
+        bool (*scatter)(ModuleContext& context) = nullptr;
+    };
+
+    struct ModuleAPI {
+        std::uint32_t api_version = kModuleApiVersion;
+        const char* name = "";
+        std::uint32_t state_size = 0;
+        std::uint32_t state_version = 0;
+
+        // `reloaded`: the state block holds what the previous image left there.
+        // False ends the image: the host calls unload(context, false) and closes it
+        bool (*load)(ModuleContext& context, bool reloaded) = nullptr;
+        // `reloading`: a new image follows and keeps the state block
+        void (*unload)(ModuleContext& context, bool reloading) = nullptr;
+        // Once per frame on the UI thread, before the panels
+        void (*update)(ModuleContext& context, double dt) = nullptr;
+
+        // Editor commands, shown as buttons; names point into the module
+        std::uint32_t command_count = 0;
+        const char* const* commands = nullptr;
+        bool (*run_command)(ModuleContext& context, std::uint32_t index) = nullptr;
+
+        // Null unless the module serves the Backend entry points
+        const BackendOps* ops = nullptr;
+    };
+
+    using ModuleEntryPoint = const ModuleAPI* (*)();
+
+} // namespace Backend::Module
@@ -0,0 +1,204 @@
+#include "Profiling/Profiler.h"
+
+#include <nlohmann/json.hpp>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+namespace Backend::Profiling {
+
+    // ============================================================================
+    // STATE
+    // ============================================================================
+
+    namespace {
+
+        constexpr std::size_t kHistoryFrames = 240;
+
+        // Buffers are never freed: a thread may exit while its events are still queued
+        std::mutex s_registry_mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> s_buffers;
+        std::vector<ThreadInfo> s_thread_infos;
+        std::atomic<std::size_t> s_buffer_count{ 0 };
+
+        // Tick calibration
+        const std::uint64_t s_tick_origin = Now();
+        const auto s_clock_origin = std::chrono::steady_clock::now();
+        std::atomic<double> s_us_per_tick{ 0.0 };
+
+        // Frame history (UI thread only)
+        std::vector<FrameCapture> s_history(kHistoryFrames);
+        std::size_t s_history_head = 0;    // Slot of the frame being recorded
+        std::size_t s_history_count = 0;
+        std::uint64_t s_frame_index = 0;
+        std::uint64_t s_frame_start = 0;
+        bool s_paused = false;
+        std::uint64_t s_dropped_total = 0;
+
+        void Recalibrate() {
+            const std::uint64_t ticks = Now() - s_tick_origin;
+            const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - s_clock_origin).count();
+            if (ticks > 0 && us > 1000.0) {
+                s_us_per_tick.store(us / static_cast<double>(ticks), std::memory_order_relaxed);
+            }
+        }
+
+    } // namespace
+
+    double TicksToMicroseconds(std::uint64_t ticks) {
+        double scale = s_us_per_tick.load(std::memory_order_relaxed);
+        if (scale == 0.0) {
+            Recalibrate();
+            scale = s_us_per_tick.load(std::memory_order_relaxed);
+            if (scale == 0.0) {
+                // Too early to calibrate; assume a ~3 GHz TSC until the first frame
+                scale = 1.0 / 3000.0;
+            }
+        }
+        return static_cast<double>(ticks) * scale;
+    }
+
+    // ============================================================================
+    // THREAD REGISTRATION
+    // ============================================================================
+
+    ThreadBuffer& RegisterThread() {
+        static thread_local ThreadBuffer* t_buffer = nullptr;
+        if (t_buffer) return *t_buffer;
+
+        std::lock_guard<std::mutex> lock(s_registry_mutex);
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->thread_id = static_cast<std::uint32_t>(s_buffers.size());
+        s_thread_infos.push_back(ThreadInfo{ buffer->thread_id, "Thread " + std::to_string(buffer->thread_id) });
+        t_buffer = buffer.get();
+        s_buffers.push_back(std::move(buffer));
+        s_buffer_count.store(s_buffers.size(), std::memory_order_release);
+        return *t_buffer;
+    }
+
+    void SetThreadName(const char* name) {
+        ThreadBuffer& buffer = RegisterThread();
+        std::lock_guard<std::mutex> lock(s_registry_mutex);
+        s_thread_infos[buffer.thread_id].name = name;
+    }
+
+    // ============================================================================
+    // FRAMES
+    // ============================================================================
+
+    void BeginFrame() {
+        s_frame_start = Now();
+    }
+
+    void EndFrame() {
+        const std::uint64_t frame_end = Now();
+
+        FrameCapture& capture = s_history[s_history_head];
+        capture.zones.clear();
+        capture.index = s_frame_index++;
+        capture.start = s_frame_start;
+        capture.end = frame_end;
+
+        // Buffers only ever get appended, so the pointers below stay valid without the lock
+        const std::size_t count = s_buffer_count.load(std::memory_order_acquire);
+        ThreadBuffer* buffers[256];
+        std::size_t n = 0;
+        {
+            std::lock_guard<std::mutex> lock(s_registry_mutex);
+            for (; n < count && n < 256; ++n) buffers[n] = s_buffers[n].get();
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            ThreadBuffer& buffer = *buffers[i];
+            const std::uint64_t head = buffer.head.load(std::memory_order_acquire);
+            std::uint64_t tail = buffer.tail.load(std::memory_order_relaxed);
+            if (!s_paused) {
+                for (; tail < head; ++tail) {
+                    const ZoneEvent& e = buffer.events[tail & (ThreadBuffer::kCapacity - 1)];
+                    capture.zones.push_back(ZoneRecord{ e.name, e.start, e.end, e.depth, buffer.thread_id });
+                }
+            }
+            buffer.tail.store(head, std::memory_order_release);
+            s_dropped_total += buffer.dropped.exchange(0, std::memory_order_relaxed);
+        }
+
+        if (!s_paused) {
+            s_history_head = (s_history_head + 1) % kHistoryFrames;
+            s_history_count = s_history_count < kHistoryFrames ? s_history_count + 1 : kHistoryFrames;
+        }
+
+        if ((s_frame_index & 63) == 0) {
+            Recalibrate();
+        }
+    }
+
+    void SetPaused(bool paused) { s_paused = paused; }
+    bool IsPaused() { return s_paused; }
+
+    std::size_t HistorySize() { return s_history_count; }
+
+    const FrameCapture* GetFrame(std::size_t frames_ago) {
+        if (frames_ago >= s_history_count) return nullptr;
+        const std::size_t slot = (s_history_head + kHistoryFrames - 1 - frames_ago) % kHistoryFrames;
+        return &s_history[slot];
+    }
+
+    std::vector<ThreadInfo> GetThreads() {
+        std::lock_guard<std::mutex> lock(s_registry_mutex);
+        return s_thread_infos;
+    }
+
+    ProfilerStats GetStats() {
+        ProfilerStats stats;
+        stats.frames = s_frame_index;
+        stats.dropped_events = s_dropped_total;
+        const FrameCapture* last = GetFrame(0);
+        stats.last_frame_zones = last ? last->zones.size() : 0;
+        stats.thread_count = s_buffer_count.load(std::memory_order_acquire);
+        return stats;
+    }
+
+    // ============================================================================
+    // CHROME TRACE EXPORT
+    // ============================================================================
+
+    bool ExportChromeTrace(const std::string& path, std::size_t frame_count) {
+        frame_count = frame_count < s_history_count ? frame_count : s_history_count;
+        if (frame_count == 0) return false;
+
+        const FrameCapture* oldest = GetFrame(frame_count - 1);
+        const std::uint64_t origin = oldest->start;
+        auto to_us = [origin](std::uint64_t t) { return TicksToMicroseconds(t > origin ? t - origin : 0); };
+
+        nlohmann::json events = nlohmann::json::array();
+        for (const ThreadInfo& thread : GetThreads()) {
+            events.push_back({
+                { "name", "thread_name" }, { "ph", "M" }, { "pid", 1 }, { "tid", thread.id },
+                { "args", { { "name", thread.name } } }
+            });
+        }
+
+        for (std::size_t ago = frame_count; ago-- > 0;) {
+            const FrameCapture* frame = GetFrame(ago);
+            events.push_back({
+                { "name", "Frame " + std::to_string(frame->index) }, { "cat", "frame" }, { "ph", "X" },
+                { "ts", to_us(frame->start) }, { "dur", TicksToMicroseconds(frame->end - frame->start) },
+                { "pid", 1 }, { "tid", 0 }
+            });
+            for (const ZoneRecord& zone : frame->zones) {
+                events.push_back({
+                    { "name", zone.name }, { "cat", "zone" }, { "ph", "X" },
+                    { "ts", to_us(zone.start) }, { "dur", TicksToMicroseconds(zone.end - zone.start) },
+                    { "pid", 1 }, { "tid", zone.thread_id }
+                });
+            }
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) return false;
+        file << nlohmann::json{ { "traceEvents", std::move(events) }, { "displayTimeUnit", "ms" } }.dump();
+        return static_cast<bool>(file);
+    }
+
+} // namespace Backend::Profiling
@@ -0,0 +1,184 @@
+#pragma once
+
+// Low-overhead hierarchical zone profiler.
+//
+// A zone records two timestamps (rdtsc on x86) and pushes one 32-byte event
+// into a per-thread single-producer ring buffer; no locks, no allocation, no
+// I/O on the hot path. The UI thread drains every ring once per frame in
+// EndFrame() and keeps a short history of frames for the timeline view and
+// the Chrome trace export.
+//
+// Zone names must be string literals (or otherwise outlive the profiler).
+
+#include "BackendAPI.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#else
+    #include <chrono>
+#endif
+
+#ifndef GE_ENABLE_PROFILER
+    #define GE_ENABLE_PROFILER 1
+#endif
+
+namespace Backend::Profiling {
+
+    // ============================================================================
+    // TIMESTAMPS
+    // ============================================================================
+
+    inline std::uint64_t Now() {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    // Calibrated against steady_clock; precision improves the longer the process runs
+    BACKEND_API double TicksToMicroseconds(std::uint64_t ticks);
+
+    // ============================================================================
+    // PER-THREAD RING
+    // ============================================================================
+
+    struct ZoneEvent {
+        const char* name;
+        std::uint64_t start;
+        std::uint64_t end;
+        std::uint32_t depth;
+        std::uint32_t padding;
+    };
+
+    struct ThreadBuffer {
+        static constexpr std::size_t kCapacity = 1 << 14;
+
+        alignas(64) std::atomic<std::uint64_t> head{ 0 };   // Written by the owning thread
+        alignas(64) std::atomic<std::uint64_t> tail{ 0 };   // Written by the drain thread
+        std::atomic<std::uint64_t> dropped{ 0 };
+        std::uint32_t depth = 0;
+        std::uint32_t thread_id = 0;
+        ZoneEvent events[kCapacity];
+
+        void Push(const ZoneEvent& event) {
+            const std::uint64_t h = head.load(std::memory_order_relaxed);
+            if (h - tail.load(std::memory_order_acquire) >= kCapacity) {
+                dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return;
+            }
+            events[h & (kCapacity - 1)] = event;
+            head.store(h + 1, std::memory_order_release);
+        }
+    };
+
+    // Returns the calling thread's buffer, registering it on first use
+    BACKEND_API ThreadBuffer& RegisterThread();
+
+    inline ThreadBuffer& CurrentBuffer() {
+        // Cached per module; RegisterThread hands every module the same buffer
+        static thread_local ThreadBuffer* t_buffer = nullptr;
+        if (!t_buffer) t_buffer = &RegisterThread();
+        return *t_buffer;
+    }
+
+    BACKEND_API void SetThreadName(const char* name);
+
+    // ============================================================================
+    // ZONES
+    // ============================================================================
+
+    class Zone {
+    public:
+        explicit Zone(const char* name) : m_buffer(CurrentBuffer()), m_name(name) {
+            m_depth = m_buffer.depth++;
+            m_start = Now();
+        }
+
+        ~Zone() {
+            const std::uint64_t end = Now();
+            --m_buffer.depth;
+            m_buffer.Push(ZoneEvent{ m_name, m_start, end, m_depth, 0 });
+        }
+
+        Zone(const Zone&) = delete;
+        Zone& operator=(const Zone&) = delete;
+
+    private:
+        ThreadBuffer& m_buffer;
+        const char* m_name;
+        std::uint64_t m_start = 0;
+        std::uint32_t m_depth = 0;
+    };
+
+    // ============================================================================
+    // FRAME AGGREGATION (UI thread)
+    // ============================================================================
+
+    struct ZoneRecord {
+        const char* name;
+        std::uint64_t start;
+        std::uint64_t end;
+        std::uint32_t depth;
+        std::uint32_t thread_id;
+    };
+
+    struct FrameCapture {
+        std::uint64_t index = 0;
+        std::uint64_t start = 0;
+        std::uint64_t end = 0;
+        std::vector<ZoneRecord> zones;   // Capacity is reused across frames
+    };
+
+    struct ThreadInfo {
+        std::uint32_t id = 0;
+        std::string name;
+    };
+
+    struct ProfilerStats {
+        std::uint64_t frames = 0;
+        std::uint64_t dropped_events = 0;
+        std::size_t last_frame_zones = 0;
+        std::size_t thread_count = 0;
+    };
+
+    BACKEND_API void BeginFrame();
+    BACKEND_API void EndFrame();
+
+    // While paused, frames are still drained but the history is frozen
+    BACKEND_API void SetPaused(bool paused);
+    BACKEND_API bool IsPaused();
+
+    BACKEND_API std::size_t HistorySize();
+    // 0 = most recent completed frame; nullptr if not captured yet
+    BACKEND_API const FrameCapture* GetFrame(std::size_t frames_ago);
+    BACKEND_API std::vector<ThreadInfo> GetThreads();
+    BACKEND_API ProfilerStats GetStats();
+
+    // Writes the last `frame_count` frames as Chrome trace-event JSON
+    // (load in chrome://tracing or https://ui.perfetto.dev)
+    BACKEND_API bool ExportChromeTrace(const std::string& path, std::size_t frame_count);
+
+} // namespace Backend::Profiling
+
+// ============================================================================
+// MACROS
+// ============================================================================
+
+#define GE_PROFILE_CONCAT_INNER(a, b) a##b
+#define GE_PROFILE_CONCAT(a, b) GE_PROFILE_CONCAT_INNER(a, b)
+
+#if GE_ENABLE_PROFILER
+    #define GE_PROFILE_ZONE(name) ::Backend::Profiling::Zone GE_PROFILE_CONCAT(ge_profile_zone_, __LINE__)(name)
+    #define GE_PROFILE_FUNCTION() GE_PROFILE_ZONE(__func__)
+#else
+    #define GE_PROFILE_ZONE(name) ((void)0)
+    #define GE_PROFILE_FUNCTION() ((void)0)
+#endif
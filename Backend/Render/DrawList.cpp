@@ -0,0 +1,127 @@
+#include "Render/DrawList.h"
+#include "Profiling/Profiler.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstring>
+
+namespace Backend::Render {
+
+    // ============================================================================
+    // KEYS
+    // ============================================================================
+
+    std::uint64_t DrawKey::Encode(std::uint32_t view, std::uint32_t layer, std::uint32_t material,
+                                  std::uint32_t mesh, float depth) {
+        // Positive floats order like their bit patterns; keep the top 22 bits
+        // (sign is always 0, so the exponent and 14 mantissa bits)
+        const std::uint32_t depth_bits = std::bit_cast<std::uint32_t>(std::max(depth, 0.0f)) >> (31 - kDepthBits);
+        return (static_cast<std::uint64_t>(view & ((1u << kViewBits) - 1)) << kViewShift) |
+               (static_cast<std::uint64_t>(layer & ((1u << kLayerBits) - 1)) << kLayerShift) |
+               (static_cast<std::uint64_t>(material & kMaxMaterial) << kMaterialShift) |
+               (static_cast<std::uint64_t>(mesh & kMaxMesh) << kMeshShift) |
+               static_cast<std::uint64_t>(depth_bits & ((1u << kDepthBits) - 1));
+    }
+
+    void RadixSort(std::span<SortEntry> entries, std::span<SortEntry> scratch) {
+        const std::size_t n = entries.size();
+        if (n < 2) return;
+        assert(scratch.size() >= n);
+
+        std::uint32_t histogram[8][256] = {};
+        for (const SortEntry& entry : entries) {
+            for (int digit = 0; digit < 8; ++digit) {
+                histogram[digit][(entry.key >> (digit * 8)) & 0xFF] += 1;
+            }
+        }
+
+        SortEntry* src = entries.data();
+        SortEntry* dst = scratch.data();
+        for (int digit = 0; digit < 8; ++digit) {
+            const int shift = digit * 8;
+            std::uint32_t* counts = histogram[digit];
+            if (counts[(src[0].key >> shift) & 0xFF] == n) continue;   // Every key shares this digit
+
+            std::uint32_t offset = 0;
+            for (int bucket = 0; bucket < 256; ++bucket) {
+                const std::uint32_t count = counts[bucket];
+                counts[bucket] = offset;
+                offset += count;
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                dst[counts[(src[i].key >> shift) & 0xFF]++] = src[i];
+            }
+            std::swap(src, dst);
+        }
+        if (src != entries.data()) {
+            std::memcpy(entries.data(), src, n * sizeof(SortEntry));
+        }
+    }
+
+    // ============================================================================
+    // DRAW LIST
+    // ============================================================================
+
+    void DrawList::Clear() {
+        m_keys.clear();
+        m_instances.clear();
+        m_batches.clear();
+        m_sorted_instances.clear();
+    }
+
+    void DrawList::Reserve(std::size_t items) {
+        m_keys.reserve(items);
+        m_instances.reserve(items);
+    }
+
+    void DrawList::Resize(std::size_t items) {
+        m_keys.resize(items);
+        m_instances.resize(items);
+    }
+
+    void DrawList::Add(std::uint32_t mesh, std::uint32_t material, const glm::mat4& model, std::uint32_t view) {
+        if (mesh > DrawKey::kMaxMesh || material > DrawKey::kMaxMaterial) return;
+        m_keys.emplace_back();
+        m_instances.emplace_back();
+        Set(m_keys.size() - 1, mesh, material, model, view);
+    }
+
+    void DrawList::Set(std::size_t index, std::uint32_t mesh, std::uint32_t material, const glm::mat4& model,
+                       std::uint32_t view) {
+        assert(index < m_keys.size() && mesh <= DrawKey::kMaxMesh && material <= DrawKey::kMaxMaterial);
+        const glm::vec3 position(model[3].x, model[3].y, model[3].z);
+        const float depth = glm::length(position - m_camera.eye);
+        m_keys[index] = DrawKey::Encode(view, 0, material, mesh, depth);
+        std::memcpy(m_instances[index].model, &model[0][0], sizeof(InstanceData::model));
+    }
+
+    void DrawList::Sort() {
+        GE_PROFILE_FUNCTION();
+        const std::size_t n = m_keys.size();
+        m_entries.resize(n);
+        m_scratch.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            m_entries[i] = SortEntry{ m_keys[i], static_cast<std::uint32_t>(i) };
+        }
+        RadixSort(m_entries, m_scratch);
+
+        // Gather instances in key order so every batch is one contiguous upload
+        m_sorted_instances.resize(n);
+        m_batches.clear();
+        for (std::size_t i = 0; i < n; ++i) {
+            const SortEntry& entry = m_entries[i];
+            m_sorted_instances[i] = m_instances[entry.index];
+            if (i == 0 || DrawKey::BatchBits(entry.key) != DrawKey::BatchBits(m_entries[i - 1].key)) {
+                DrawBatch batch;
+                batch.view = DrawKey::View(entry.key);
+                batch.material = DrawKey::Material(entry.key);
+                batch.mesh = DrawKey::Mesh(entry.key);
+                batch.first = static_cast<std::uint32_t>(i);
+                m_batches.push_back(batch);
+            }
+            m_batches.back().count += 1;
+        }
+    }
+
+} // namespace Backend::Render
@@ -0,0 +1,130 @@
+#pragma once
+
+// CPU side of scene rendering: a flat list of draw items with 64-bit sort keys.
+//
+// Items are appended in any order (one per entity), radix sorted by key and
+// grouped into batches of identical (view, layer, material, mesh). Each batch
+// becomes one instanced draw, so submission cost scales with the number of
+// distinct mesh/material pairs, not with the entity count. Nothing here
+// touches bgfx; the Renderer consumes a sorted list on its own thread.
+
+#include "BackendAPI.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Backend::Render {
+
+    // ============================================================================
+    // SORT KEYS
+    // ============================================================================
+
+    // Most significant first:
+    //   view (4) | layer (2) | material (16) | mesh (20) | depth (22)
+    // Opaque layers group by material (state/uniform changes), then mesh
+    // (buffer bindings), then front to back. Keys compare as plain integers.
+    struct DrawKey {
+        static constexpr int kDepthBits = 22;
+        static constexpr int kMeshBits = 20;
+        static constexpr int kMaterialBits = 16;
+        static constexpr int kLayerBits = 2;
+        static constexpr int kViewBits = 4;
+
+        static constexpr int kMeshShift = kDepthBits;
+        static constexpr int kMaterialShift = kMeshShift + kMeshBits;
+        static constexpr int kLayerShift = kMaterialShift + kMaterialBits;
+        static constexpr int kViewShift = kLayerShift + kLayerBits;
+
+        static constexpr std::uint32_t kMaxMesh = (1u << kMeshBits) - 1;
+        static constexpr std::uint32_t kMaxMaterial = (1u << kMaterialBits) - 1;
+
+        // `depth` is a non-negative view distance; its float bits are monotonic
+        BACKEND_API static std::uint64_t Encode(std::uint32_t view, std::uint32_t layer, std::uint32_t material,
+                                                std::uint32_t mesh, float depth);
+
+        static std::uint32_t Mesh(std::uint64_t key) { return static_cast<std::uint32_t>(key >> kMeshShift) & kMaxMesh; }
+        static std::uint32_t Material(std::uint64_t key) { return static_cast<std::uint32_t>(key >> kMaterialShift) & kMaxMaterial; }
+        static std::uint32_t View(std::uint64_t key) { return static_cast<std::uint32_t>(key >> kViewShift); }
+        // Everything that must match for two items to share a draw call
+        static std::uint64_t BatchBits(std::uint64_t key) { return key >> kDepthBits; }
+    };
+
+    struct SortEntry {
+        std::uint64_t key;
+        std::uint32_t index;
+    };
+
+    // LSD radix sort, 8 bits per pass. All eight histograms come from one read
+    // of the input and passes whose digit is the same for every key are
+    // skipped, so keys that differ only in a few fields cost a few passes.
+    // `scratch` must be at least as large as `entries`. Stable.
+    BACKEND_API void RadixSort(std::span<SortEntry> entries, std::span<SortEntry> scratch);
+
+    // ============================================================================
+    // DRAW LIST
+    // ============================================================================
+
+    struct Camera {
+        glm::vec3 eye = glm::vec3(0.0f, 5.0f, 10.0f);
+        glm::vec3 target = glm::vec3(0.0f);
+        glm::vec3 up = glm::vec3(0.0f, 1.0f, 0.0f);
+        float fov_y = 60.0f;    // Degrees
+        float near_plane = 0.1f;
+        float far_plane = 1000.0f;
+    };
+
+    // Per-instance data as uploaded to the GPU: column-major model matrix
+    struct InstanceData {
+        float model[16];
+    };
+    static_assert(sizeof(InstanceData) == 64);
+
+    struct DrawBatch {
+        std::uint32_t view = 0;
+        std::uint32_t material = 0;
+        std::uint32_t mesh = 0;
+        std::uint32_t first = 0;    // Into SortedInstances()
+        std::uint32_t count = 0;
+    };
+
+    class BACKEND_API DrawList {
+    public:
+        void Clear();
+        void Reserve(std::size_t items);
+
+        // Set before adding items: depth keys are distances from the eye
+        void SetCamera(const Camera& camera) { m_camera = camera; }
+        const Camera& GetCamera() const { return m_camera; }
+
+        // `model` is column-major (m[0..3] = basis x, y, z, translation)
+        void Add(std::uint32_t mesh, std::uint32_t material, const glm::mat4& model, std::uint32_t view = 0);
+
+        // Parallel fill: Resize once, then Set disjoint indices from any thread.
+        // Unlike Add, ids must already be in range
+        void Resize(std::size_t items);
+        void Set(std::size_t index, std::uint32_t mesh, std::uint32_t material, const glm::mat4& model,
+                 std::uint32_t view = 0);
+
+        // Sorts by key and builds batches; call once after the last Add
+        void Sort();
+
+        std::size_t Size() const { return m_instances.size(); }
+        std::span<const DrawBatch> Batches() const { return m_batches; }
+        std::span<const InstanceData> SortedInstances() const { return m_sorted_instances; }
+
+    private:
+        Camera m_camera;
+        std::vector<std::uint64_t> m_keys;
+        std::vector<InstanceData> m_instances;
+        std::vector<SortEntry> m_entries;
+        std::vector<SortEntry> m_scratch;
+        std::vector<InstanceData> m_sorted_instances;
+        std::vector<DrawBatch> m_batches;
+    };
+
+    // Mesh used for entities without a MeshHandle (the Renderer provides a cube)
+    inline constexpr std::uint32_t kPlaceholderMesh = DrawKey::kMaxMesh;
+
+} // namespace Backend::Render
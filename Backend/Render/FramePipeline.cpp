@@ -0,0 +1,131 @@
+#include "Render/FramePipeline.h"
+#include "Render/Renderer.h"
+#include "Profiling/Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Backend::Render {
+
+    namespace {
+
+        using Clock = std::chrono::steady_clock;
+
+        float MillisecondsSince(Clock::time_point start) {
+            return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+        }
+
+    } // namespace
+
+    FramePipeline::FramePipeline(Renderer* renderer, const FramePipelineConfig& config)
+        : m_renderer(renderer), m_config(config) {
+        m_config.frames_in_flight = std::clamp<std::uint32_t>(m_config.frames_in_flight, 1, kMaxFramesInFlight);
+        m_config.grain = std::max<std::size_t>(m_config.grain, 1);
+        m_stats.frames_in_flight = m_config.frames_in_flight;
+    }
+
+    FramePipeline::~FramePipeline() {
+        Flush();
+    }
+
+    // ============================================================================
+    // UI THREAD
+    // ============================================================================
+
+    void FramePipeline::Submit(Scene& scene, const Camera& camera) {
+        GE_PROFILE_FUNCTION();
+        // Updates complete in order, so once the one submitted `frames_in_flight`
+        // frames ago is done, so are all older ones, this slot's included
+        const auto wait_start = Clock::now();
+        Jobs::Wait(m_slots[(m_next + kSlots - m_config.frames_in_flight) % kSlots].done);
+        const float wait_ms = MillisecondsSince(wait_start);
+
+        Slot* previous = m_frame > 0 ? &m_slots[(m_next + kSlots - 1) % kSlots] : nullptr;
+        const auto capture_start = Clock::now();
+        Slot& slot = m_slots[m_next];
+        Capture(scene, camera, slot.snapshot);
+        const float capture_ms = MillisecondsSince(capture_start);
+
+        Jobs::Run([this, &slot]() { Update(slot); }, &slot.done, previous ? &previous->done : nullptr);
+        m_next = (m_next + 1) % kSlots;
+
+        std::lock_guard<std::mutex> lock(m_stats_mutex);
+        m_stats.submitted += 1;
+        m_stats.capture_ms = capture_ms;
+        m_stats.wait_ms = wait_ms;
+    }
+
+    void FramePipeline::Capture(Scene& scene, const Camera& camera, SceneSnapshot& snapshot) {
+        GE_PROFILE_FUNCTION();
+        snapshot.frame = ++m_frame;
+        snapshot.camera = camera;
+        snapshot.entities.clear();
+        snapshot.transforms.clear();
+        snapshot.meshes.clear();
+        snapshot.materials.clear();
+
+        // Component lookups stay here: the registry is only safe to read on
+        // the UI thread. Vectors keep their capacity, so steady state is allocation free
+        const entt::registry& registry = scene.Registry();
+        scene.ForEachTransformBounds([&](Entity entity, const Transform& transform, const Bounds&) {
+            const MeshHandle* mesh = registry.try_get<MeshHandle>(entity);
+            const MaterialHandle* material = registry.try_get<MaterialHandle>(entity);
+            const std::uint32_t mesh_id = mesh && mesh->IsValid() ? mesh->id : kPlaceholderMesh;
+            const std::uint32_t material_id = material ? material->id : 0;
+            if (mesh_id > DrawKey::kMaxMesh || material_id > DrawKey::kMaxMaterial) return;
+
+            snapshot.entities.push_back(entity);
+            snapshot.transforms.push_back(transform);
+            snapshot.meshes.push_back(mesh_id);
+            snapshot.materials.push_back(material_id);
+        });
+    }
+
+    void FramePipeline::Flush() {
+        // The newest update completes last
+        Jobs::Wait(m_slots[(m_next + kSlots - 1) % kSlots].done);
+    }
+
+    void FramePipeline::SetFramesInFlight(std::uint32_t frames) {
+        Flush();
+        m_config.frames_in_flight = std::clamp<std::uint32_t>(frames, 1, kMaxFramesInFlight);
+        std::lock_guard<std::mutex> lock(m_stats_mutex);
+        m_stats.frames_in_flight = m_config.frames_in_flight;
+    }
+
+    FramePipelineStats FramePipeline::GetStats() const {
+        std::lock_guard<std::mutex> lock(m_stats_mutex);
+        return m_stats;
+    }
+
+    // ============================================================================
+    // WORKERS
+    // ============================================================================
+
+    void FramePipeline::Update(Slot& slot) {
+        GE_PROFILE_FUNCTION();
+        const auto start = Clock::now();
+        SceneSnapshot& snapshot = slot.snapshot;
+        const std::size_t count = snapshot.Size();
+
+        // Updates are serialized, so this is the Renderer's only producer
+        DrawList* list = m_renderer && m_renderer->IsRunning() ? &m_renderer->BeginFrame() : nullptr;
+        if (list) {
+            list->SetCamera(snapshot.camera);
+            list->Resize(count);
+            Jobs::ParallelFor(0, count, m_config.grain, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    list->Set(i, snapshot.meshes[i], snapshot.materials[i], snapshot.transforms[i].Matrix());
+                }
+            });
+            m_renderer->EndFrame();
+        }
+
+        const float update_ms = MillisecondsSince(start);
+        std::lock_guard<std::mutex> lock(m_stats_mutex);
+        m_stats.completed += 1;
+        m_stats.entities = static_cast<std::uint32_t>(count);
+        m_stats.update_ms = update_ms;
+    }
+
+} // namespace Backend::Render
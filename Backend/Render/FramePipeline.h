@@ -0,0 +1,109 @@
+#pragma once
+
+// Pipelined scene update between the UI thread and the Renderer.
+//
+// Submit() runs on the UI thread once the frame's edits are done and only
+// copies the packed scene data (transforms, mesh and material ids) into a
+// free SceneSnapshot. Everything derived from it (model matrices, draw keys)
+// is computed by jobs on the worker threads, which then publish the draw
+// list to the Renderer. Meanwhile the UI thread goes on to present frame N
+// and build frame N+1. Nothing is written back to the Scene: Bounds::world
+// stays as the last Scene::UpdateWorldBounds left it.
+//
+// Snapshots are immutable once captured. Updates run one after another in
+// submission order, so the Renderer sees lists in order. `frames_in_flight`
+// is the latency/throughput trade-off: with 1, Submit waits for the previous
+// update (the viewport lags its edits by at most one frame); with 2, the UI
+// thread may run a whole frame ahead of a slow update, at two frames of lag.
+
+#include "BackendAPI.h"
+#include "Jobs/JobSystem.h"
+#include "Render/DrawList.h"
+#include "Scene/Components.h"
+#include "Scene/Scene.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Backend::Render {
+
+    class Renderer;
+
+    // Scene state for one frame, in owning-group order
+    struct SceneSnapshot {
+        std::uint64_t frame = 0;
+        Camera camera;
+
+        std::vector<Entity> entities;
+        std::vector<Transform> transforms;
+        std::vector<std::uint32_t> meshes;      // kPlaceholderMesh if none
+        std::vector<std::uint32_t> materials;
+
+        std::size_t Size() const { return entities.size(); }
+    };
+
+    struct FramePipelineConfig {
+        std::uint32_t frames_in_flight = 1;     // 1 or 2
+        std::size_t grain = 2048;               // Entities per update job
+    };
+
+    struct FramePipelineStats {
+        std::uint64_t submitted = 0;
+        std::uint64_t completed = 0;
+        std::uint32_t frames_in_flight = 1;
+        std::uint32_t entities = 0;     // Last completed snapshot
+        float capture_ms = 0.0f;        // UI thread: copying the scene
+        float wait_ms = 0.0f;           // UI thread: blocked on an earlier update
+        float update_ms = 0.0f;         // Workers: matrices and draw list
+    };
+
+    class BACKEND_API FramePipeline {
+    public:
+        static constexpr std::uint32_t kMaxFramesInFlight = 2;
+
+        // `renderer` may be null (updates then only capture, e.g. to time it)
+        explicit FramePipeline(Renderer* renderer, const FramePipelineConfig& config = {});
+        ~FramePipeline();
+
+        FramePipeline(const FramePipeline&) = delete;
+        FramePipeline& operator=(const FramePipeline&) = delete;
+
+        // UI thread. Captures `scene` and queues its update; may block until an
+        // earlier update finishes (see frames_in_flight)
+        void Submit(Scene& scene, const Camera& camera);
+
+        // Waits for every queued update
+        void Flush();
+
+        // Flushes, then applies; clamped to [1, kMaxFramesInFlight]
+        void SetFramesInFlight(std::uint32_t frames);
+        std::uint32_t FramesInFlight() const { return m_config.frames_in_flight; }
+
+        FramePipelineStats GetStats() const;
+
+    private:
+        struct Slot {
+            SceneSnapshot snapshot;
+            Jobs::JobCounter done;
+        };
+
+        // One slot per frame in flight plus the one being captured
+        static constexpr std::uint32_t kSlots = kMaxFramesInFlight + 1;
+
+        void Capture(Scene& scene, const Camera& camera, SceneSnapshot& snapshot);
+        void Update(Slot& slot);
+
+        Renderer* m_renderer = nullptr;
+        FramePipelineConfig m_config;
+
+        std::array<Slot, kSlots> m_slots;
+        std::uint32_t m_next = 0;           // Slot the next Submit captures into
+        std::uint64_t m_frame = 0;
+
+        mutable std::mutex m_stats_mutex;
+        FramePipelineStats m_stats;
+    };
+
+} // namespace Backend::Render
@@ -0,0 +1,627 @@
+#include "Render/Renderer.h"
+#include "Engine.h"
+#include "Profiling/Profiler.h"
+
+#include <bgfx/bgfx.h>
+#include <bx/math.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace Backend::Render {
+
+    namespace {
+
+        using Clock = std::chrono::steady_clock;
+
+        constexpr bgfx::ViewId kSceneView = 0;
+        constexpr bgfx::ViewId kReadbackView = 255;    // Views run in id order: after the scene
+        constexpr std::uint64_t kDrawState = BGFX_STATE_WRITE_RGB | BGFX_STATE_WRITE_A | BGFX_STATE_WRITE_Z |
+                                             BGFX_STATE_DEPTH_TEST_LESS | BGFX_STATE_MSAA;
+        const glm::vec4 kDefaultColor(0.75f, 0.76f, 0.80f, 1.0f);
+
+        // Minimal shader binaries the Noop renderer accepts (format version 5:
+        // magic, input hash, zero uniforms); nothing is ever compiled or run
+        constexpr std::uint8_t kNoopVertexShader[] = { 'V', 'S', 'H', 5, 0, 0, 0, 0, 0, 0 };
+        constexpr std::uint8_t kNoopFragmentShader[] = { 'F', 'S', 'H', 5, 0, 0, 0, 0, 0, 0 };
+
+        float MillisecondsSince(Clock::time_point start) {
+            return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+        }
+
+        bgfx::RendererType::Enum ToBgfx(RendererBackend backend) {
+            switch (backend) {
+                case RendererBackend::Noop: return bgfx::RendererType::Noop;
+                case RendererBackend::OpenGL: return bgfx::RendererType::OpenGL;
+                case RendererBackend::Vulkan: return bgfx::RendererType::Vulkan;
+                case RendererBackend::Direct3D11: return bgfx::RendererType::Direct3D11;
+                case RendererBackend::Direct3D12: return bgfx::RendererType::Direct3D12;
+                case RendererBackend::Metal: return bgfx::RendererType::Metal;
+                default: return bgfx::RendererType::Count;
+            }
+        }
+
+        // Output folders of bgfx's shaderc helper (bgfx_compile_shaders)
+        const char* ShaderFolder(bgfx::RendererType::Enum type) {
+            switch (type) {
+                case bgfx::RendererType::OpenGL: return "glsl";
+                case bgfx::RendererType::OpenGLES: return "essl";
+                case bgfx::RendererType::Vulkan: return "spirv";
+                case bgfx::RendererType::Direct3D11:
+                case bgfx::RendererType::Direct3D12: return "dx11";
+                case bgfx::RendererType::Metal: return "metal";
+                default: return nullptr;
+            }
+        }
+
+        struct GpuMesh {
+            bgfx::VertexBufferHandle vertices = BGFX_INVALID_HANDLE;
+            bgfx::IndexBufferHandle indices = BGFX_INVALID_HANDLE;
+        };
+
+        // Resource changes recorded on the UI thread
+        struct Command {
+            enum class Type : std::uint8_t { UploadMesh, DropMesh, SetMaterial, Resize };
+
+            Type type = Type::UploadMesh;
+            std::uint32_t id = 0;
+            std::vector<float> positions;           // x, y, z interleaved
+            std::vector<std::uint32_t> indices;
+            glm::vec4 color = kDefaultColor;
+            std::uint32_t width = 0;
+            std::uint32_t height = 0;
+        };
+
+        // Unit cube centred on the origin for entities without a mesh
+        Command PlaceholderCube() {
+            Command command;
+            command.id = kPlaceholderMesh;
+            command.positions = {
+                -0.5f, -0.5f, -0.5f,   0.5f, -0.5f, -0.5f,   0.5f,  0.5f, -0.5f,  -0.5f,  0.5f, -0.5f,
+                -0.5f, -0.5f,  0.5f,   0.5f, -0.5f,  0.5f,   0.5f,  0.5f,  0.5f,  -0.5f,  0.5f,  0.5f
+            };
+            command.indices = {
+                0, 2, 1, 0, 3, 2,   4, 5, 6, 4, 6, 7,   0, 1, 5, 0, 5, 4,
+                3, 6, 2, 3, 7, 6,   0, 4, 7, 0, 7, 3,   1, 2, 6, 1, 6, 5
+            };
+            return command;
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // IMPLEMENTATION
+    // ============================================================================
+
+    struct Renderer::Impl {
+        RendererConfig config;
+        std::thread thread;
+
+        // --- Shared with the UI thread (mutex) ---
+        mutable std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable idle;
+        bool stop = false;
+        bool busy = false;
+        bool init_done = false;
+        bool init_ok = false;
+        std::string error;
+
+        // Triple buffer: the UI fills `writing`, publishes into `ready`; the
+        // thread swaps `ready` into `submitting`
+        DrawList lists[3];
+        int writing = 0;
+        int ready = 1;
+        int submitting = 2;
+        bool has_ready = false;
+        std::vector<Command> commands;
+        RendererStats stats;
+
+        mutable std::mutex image_mutex;
+        ViewportImage latest;
+
+        // --- Submission thread only ---
+        bgfx::RendererType::Enum type = bgfx::RendererType::Noop;
+        bgfx::VertexLayout layout;
+        bgfx::ProgramHandle instanced_program = BGFX_INVALID_HANDLE;
+        bgfx::ProgramHandle single_program = BGFX_INVALID_HANDLE;
+        bgfx::UniformHandle u_color = BGFX_INVALID_HANDLE;
+        bgfx::TextureHandle color_target = BGFX_INVALID_HANDLE;
+        bgfx::FrameBufferHandle framebuffer = BGFX_INVALID_HANDLE;
+        bgfx::TextureHandle readback_texture = BGFX_INVALID_HANDLE;
+        std::unordered_map<std::uint32_t, GpuMesh> meshes;
+        std::vector<glm::vec4> materials;
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+        bool instancing = false;
+        bool readback = false;
+        bool read_pending = false;
+        std::uint32_t read_frame = 0;
+        std::uint32_t max_draw_calls = 0;
+        std::vector<std::uint8_t> staging;
+
+        // ============================================================================
+        // SETUP
+        // ============================================================================
+
+        bgfx::ShaderHandle LoadShader(const char* name, bool vertex) {
+            if (type == bgfx::RendererType::Noop) {
+                return vertex ? bgfx::createShader(bgfx::copy(kNoopVertexShader, sizeof(kNoopVertexShader)))
+                              : bgfx::createShader(bgfx::copy(kNoopFragmentShader, sizeof(kNoopFragmentShader)));
+            }
+            const char* folder = ShaderFolder(type);
+            if (!folder) return BGFX_INVALID_HANDLE;
+            const std::string path = config.shader_dir + "/" + folder + "/" + name + ".bin";
+            std::ifstream file(path, std::ios::binary);
+            if (!file) return BGFX_INVALID_HANDLE;
+            const std::vector<char> bytes{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+            const bgfx::Memory* memory = bgfx::alloc(static_cast<std::uint32_t>(bytes.size() + 1));
+            std::memcpy(memory->data, bytes.data(), bytes.size());
+            memory->data[bytes.size()] = 0;
+            return bgfx::createShader(memory);
+        }
+
+        bgfx::ProgramHandle LoadProgram(const char* vs_name, const char* fs_name) {
+            const bgfx::ShaderHandle vs = LoadShader(vs_name, true);
+            const bgfx::ShaderHandle fs = LoadShader(fs_name, false);
+            if (!bgfx::isValid(vs) || !bgfx::isValid(fs)) {
+                if (bgfx::isValid(vs)) bgfx::destroy(vs);
+                if (bgfx::isValid(fs)) bgfx::destroy(fs);
+                return BGFX_INVALID_HANDLE;
+            }
+            return bgfx::createProgram(vs, fs, true);
+        }
+
+        void CreateTargets() {
+            const bgfx::TextureHandle attachments[] = {
+                bgfx::createTexture2D(static_cast<std::uint16_t>(width), static_cast<std::uint16_t>(height), false, 1,
+                                      bgfx::TextureFormat::RGBA8, BGFX_TEXTURE_RT),
+                bgfx::createTexture2D(static_cast<std::uint16_t>(width), static_cast<std::uint16_t>(height), false, 1,
+                                      bgfx::TextureFormat::D24S8, BGFX_TEXTURE_RT_WRITE_ONLY)
+            };
+            color_target = attachments[0];
+            framebuffer = bgfx::createFrameBuffer(2, attachments, true);
+            bgfx::setViewFrameBuffer(kSceneView, framebuffer);
+            bgfx::setViewClear(kSceneView, BGFX_CLEAR_COLOR | BGFX_CLEAR_DEPTH, 0x1e1e24ff, 1.0f, 0);
+            bgfx::setViewRect(kSceneView, 0, 0, static_cast<std::uint16_t>(width), static_cast<std::uint16_t>(height));
+
+            if (readback) {
+                readback_texture = bgfx::createTexture2D(static_cast<std::uint16_t>(width), static_cast<std::uint16_t>(height),
+                                                         false, 1, bgfx::TextureFormat::RGBA8,
+                                                         BGFX_TEXTURE_BLIT_DST | BGFX_TEXTURE_READ_BACK);
+                staging.assign(static_cast<std::size_t>(width) * height * 4, 0);
+            }
+        }
+
+        void DestroyTargets() {
+            // The staging buffer is being written by bgfx until the read lands
+            while (read_pending) PumpFrame();
+            if (bgfx::isValid(readback_texture)) bgfx::destroy(readback_texture);
+            if (bgfx::isValid(framebuffer)) bgfx::destroy(framebuffer);
+            readback_texture = BGFX_INVALID_HANDLE;
+            framebuffer = BGFX_INVALID_HANDLE;
+            color_target = BGFX_INVALID_HANDLE;
+        }
+
+        bool InitBgfx(RendererBackend backend) {
+            bgfx::Init init;
+            init.type = ToBgfx(backend);
+            init.resolution.width = width;
+            init.resolution.height = height;
+            init.resolution.reset = BGFX_RESET_NONE;
+            init.platformData.nwh = nullptr;    // Offscreen only; the Frontend presents the read-back image
+            init.limits.transientVbSize = std::max<std::uint32_t>(init.limits.transientVbSize,
+                                                                   config.max_instances * sizeof(InstanceData));
+            if (!bgfx::init(init)) {
+                error = std::string("bgfx failed to initialize ") +
+                        (backend == RendererBackend::Auto ? "the default renderer" : bgfx::getRendererName(init.type));
+                return false;
+            }
+            type = bgfx::getRendererType();
+
+            const bgfx::Caps* caps = bgfx::getCaps();
+            instancing = config.instancing && (caps->supported & BGFX_CAPS_INSTANCING) != 0;
+            max_draw_calls = caps->limits.maxDrawCalls;
+            readback = config.readback && type != bgfx::RendererType::Noop &&
+                       (caps->supported & BGFX_CAPS_TEXTURE_BLIT) && (caps->supported & BGFX_CAPS_TEXTURE_READ_BACK);
+
+            instanced_program = LoadProgram("vs_scene_instanced", "fs_scene");
+            single_program = LoadProgram("vs_scene", "fs_scene");
+            if (!bgfx::isValid(instanced_program) || !bgfx::isValid(single_program)) {
+                error = std::string("scene shaders for ") + bgfx::getRendererName(type) + " not found in " + config.shader_dir;
+                DestroyResources();
+                bgfx::shutdown();
+                return false;
+            }
+
+            layout.begin().add(bgfx::Attrib::Position, 3, bgfx::AttribType::Float).end();
+            u_color = bgfx::createUniform("u_color", bgfx::UniformType::Vec4);
+            CreateTargets();
+            ApplyCommand(PlaceholderCube());
+            return true;
+        }
+
+        void DestroyResources() {
+            DestroyTargets();
+            for (auto& [id, mesh] : meshes) {
+                bgfx::destroy(mesh.vertices);
+                bgfx::destroy(mesh.indices);
+            }
+            meshes.clear();
+            if (bgfx::isValid(u_color)) bgfx::destroy(u_color);
+            if (bgfx::isValid(instanced_program)) bgfx::destroy(instanced_program);
+            if (bgfx::isValid(single_program)) bgfx::destroy(single_program);
+            u_color = BGFX_INVALID_HANDLE;
+            instanced_program = BGFX_INVALID_HANDLE;
+            single_program = BGFX_INVALID_HANDLE;
+        }
+
+        // ============================================================================
+        // COMMANDS
+        // ============================================================================
+
+        void ApplyCommand(const Command& command) {
+            switch (command.type) {
+                case Command::Type::UploadMesh: {
+                    ApplyCommand(Command{ Command::Type::DropMesh, command.id });
+                    if (command.indices.empty()) return;
+                    GpuMesh mesh;
+                    mesh.vertices = bgfx::createVertexBuffer(
+                        bgfx::copy(command.positions.data(), static_cast<std::uint32_t>(command.positions.size() * sizeof(float))), layout);
+                    mesh.indices = bgfx::createIndexBuffer(
+                        bgfx::copy(command.indices.data(), static_cast<std::uint32_t>(command.indices.size() * sizeof(std::uint32_t))),
+                        BGFX_BUFFER_INDEX32);
+                    meshes[command.id] = mesh;
+                    return;
+                }
+                case Command::Type::DropMesh: {
+                    const auto it = meshes.find(command.id);
+                    if (it == meshes.end()) return;
+                    bgfx::destroy(it->second.vertices);
+                    bgfx::destroy(it->second.indices);
+                    meshes.erase(it);
+                    return;
+                }
+                case Command::Type::SetMaterial:
+                    if (command.id >= materials.size()) materials.resize(command.id + 1, kDefaultColor);
+                    materials[command.id] = command.color;
+                    return;
+                case Command::Type::Resize:
+                    if (command.width == width && command.height == height) return;
+                    DestroyTargets();
+                    width = command.width;
+                    height = command.height;
+                    CreateTargets();
+                    return;
+            }
+        }
+
+        // ============================================================================
+        // SUBMISSION
+        // ============================================================================
+
+        void SubmitList(const DrawList& list, RendererStats& frame_stats) {
+            GE_PROFILE_FUNCTION();
+            const Camera& camera = list.GetCamera();
+            float view[16];
+            float projection[16];
+            bx::mtxLookAt(view, bx::Vec3(camera.eye.x, camera.eye.y, camera.eye.z),
+                          bx::Vec3(camera.target.x, camera.target.y, camera.target.z),
+                          bx::Vec3(camera.up.x, camera.up.y, camera.up.z), bx::Handedness::Right);
+            bx::mtxProj(projection, camera.fov_y, static_cast<float>(width) / static_cast<float>(std::max(height, 1u)),
+                        camera.near_plane, camera.far_plane, bgfx::getCaps()->homogeneousDepth, bx::Handedness::Right);
+            bgfx::setViewTransform(kSceneView, view, projection);
+            bgfx::touch(kSceneView);
+
+            const std::span<const InstanceData> instances = list.SortedInstances();
+            const std::uint16_t stride = sizeof(InstanceData);
+            for (const DrawBatch& batch : list.Batches()) {
+                const auto mesh = meshes.find(batch.mesh);
+                if (mesh == meshes.end()) {
+                    frame_stats.skipped_items += batch.count;
+                    continue;
+                }
+                const glm::vec4& color = batch.material < materials.size() ? materials[batch.material] : kDefaultColor;
+                const auto view_id = static_cast<bgfx::ViewId>(batch.view);
+
+                if (instancing) {
+                    std::uint32_t done = 0;
+                    while (done < batch.count) {
+                        const std::uint32_t n = bgfx::getAvailInstanceDataBuffer(batch.count - done, stride);
+                        if (n == 0 || frame_stats.draw_calls >= max_draw_calls) {
+                            frame_stats.skipped_items += batch.count - done;
+                            break;
+                        }
+                        bgfx::InstanceDataBuffer idb;
+                        bgfx::allocInstanceDataBuffer(&idb, n, stride);
+                        std::memcpy(idb.data, instances.data() + batch.first + done, static_cast<std::size_t>(n) * stride);
+                        bgfx::setVertexBuffer(0, mesh->second.vertices);
+                        bgfx::setIndexBuffer(mesh->second.indices);
+                        bgfx::setInstanceDataBuffer(&idb);
+                        bgfx::setUniform(u_color, &color.x);
+                        bgfx::setState(kDrawState);
+                        bgfx::submit(view_id, instanced_program);
+                        frame_stats.draw_calls += 1;
+                        done += n;
+                    }
+                } else {
+                    for (std::uint32_t i = 0; i < batch.count; ++i) {
+                        if (frame_stats.draw_calls >= max_draw_calls) {
+                            frame_stats.skipped_items += batch.count - i;
+                            break;
+                        }
+                        bgfx::setTransform(instances[batch.first + i].model);
+                        bgfx::setVertexBuffer(0, mesh->second.vertices);
+                        bgfx::setIndexBuffer(mesh->second.indices);
+                        bgfx::setUniform(u_color, &color.x);
+                        bgfx::setState(kDrawState);
+                        bgfx::submit(view_id, single_program);
+                        frame_stats.draw_calls += 1;
+                    }
+                }
+            }
+
+            if (readback && !read_pending) {
+                bgfx::blit(kReadbackView, readback_texture, 0, 0, color_target);
+                read_frame = bgfx::readTexture(readback_texture, staging.data());
+                read_pending = true;
+            }
+        }
+
+        // Advances bgfx one frame and publishes a completed read-back
+        void PumpFrame() {
+            const std::uint32_t frame = bgfx::frame();
+            if (read_pending && frame >= read_frame) {
+                read_pending = false;
+                {
+                    std::lock_guard<std::mutex> lock(image_mutex);
+                    latest.width = width;
+                    latest.height = height;
+                    latest.frame = frame;
+                    latest.origin_bottom_left = bgfx::getCaps()->originBottomLeft;
+                    latest.rgba.assign(staging.begin(), staging.end());
+                }
+                RequestRedraw();
+            }
+        }
+
+        void Run() {
+            Profiling::SetThreadName("Render Submit");
+            width = std::max(config.width, 1u);
+            height = std::max(config.height, 1u);
+
+            bool ok = InitBgfx(config.backend);
+            if (!ok && config.backend != RendererBackend::Noop) {
+                const std::string reason = error;
+                ok = InitBgfx(RendererBackend::Noop);
+                error = reason + ", using Noop";
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                init_done = true;
+                init_ok = ok;
+            }
+            idle.notify_all();
+            if (!ok) return;
+
+            std::vector<Command> pending_commands;
+            for (;;) {
+                bool have_list = false;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    // Keep frames flowing while a read-back is in flight so the
+                    // viewport image lands even when the UI is idle
+                    const auto has_work = [&] { return stop || has_ready || !commands.empty(); };
+                    if (read_pending) {
+                        wake.wait_for(lock, std::chrono::milliseconds(4), has_work);
+                    } else {
+                        wake.wait(lock, has_work);
+                    }
+                    if (stop) break;
+                    if (has_ready) {
+                        std::swap(ready, submitting);
+                        has_ready = false;
+                        have_list = true;
+                    }
+                    pending_commands.swap(commands);
+                    busy = true;
+                }
+
+                for (const Command& command : pending_commands) {
+                    ApplyCommand(command);
+                }
+                pending_commands.clear();
+
+                if (have_list) {
+                    GE_PROFILE_ZONE("Render::Frame");
+                    DrawList& list = lists[submitting];
+                    RendererStats frame_stats;
+
+                    auto start = Clock::now();
+                    list.Sort();
+                    frame_stats.sort_ms = MillisecondsSince(start);
+
+                    start = Clock::now();
+                    SubmitList(list, frame_stats);
+                    frame_stats.submit_ms = MillisecondsSince(start);
+
+                    start = Clock::now();
+                    PumpFrame();
+                    frame_stats.frame_ms = MillisecondsSince(start);
+
+                    std::lock_guard<std::mutex> lock(mutex);
+                    stats.frames += 1;
+                    stats.draw_items = static_cast<std::uint32_t>(list.Size());
+                    stats.batches = static_cast<std::uint32_t>(list.Batches().size());
+                    stats.draw_calls = frame_stats.draw_calls;
+                    stats.skipped_items = frame_stats.skipped_items;
+                    stats.sort_ms = frame_stats.sort_ms;
+                    stats.submit_ms = frame_stats.submit_ms;
+                    stats.frame_ms = frame_stats.frame_ms;
+                } else if (read_pending) {
+                    PumpFrame();
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    busy = false;
+                }
+                idle.notify_all();
+            }
+
+            DestroyResources();
+            bgfx::shutdown();
+        }
+
+        void Push(Command&& command) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                commands.push_back(std::move(command));
+            }
+            wake.notify_one();
+        }
+    };
+
+    // ============================================================================
+    // RENDERER
+    // ============================================================================
+
+    Renderer::Renderer() : m_impl(std::make_unique<Impl>()) {}
+
+    Renderer::~Renderer() {
+        Stop();
+    }
+
+    bool Renderer::Start(const RendererConfig& config) {
+        if (IsRunning()) return true;
+        Impl& impl = *m_impl;
+        impl.config = config;
+        impl.stop = false;
+        impl.init_done = false;
+        impl.error.clear();
+        impl.thread = std::thread([&impl] { impl.Run(); });
+
+        std::unique_lock<std::mutex> lock(impl.mutex);
+        impl.idle.wait(lock, [&] { return impl.init_done; });
+        m_error = impl.error;
+        if (!impl.init_ok) {
+            lock.unlock();
+            impl.thread.join();
+            return false;
+        }
+        return true;
+    }
+
+    void Renderer::Stop() {
+        Impl& impl = *m_impl;
+        if (!impl.thread.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(impl.mutex);
+            impl.stop = true;
+        }
+        impl.wake.notify_one();
+        impl.thread.join();
+    }
+
+    bool Renderer::IsRunning() const {
+        return m_impl->thread.joinable();
+    }
+
+    const char* Renderer::BackendName() const {
+        return IsRunning() ? bgfx::getRendererName(m_impl->type) : "None";
+    }
+
+    void Renderer::UploadMesh(std::uint32_t id, const Geometry::MeshView& mesh) {
+        if (id >= kPlaceholderMesh) return;
+        Command command;
+        command.type = Command::Type::UploadMesh;
+        command.id = id;
+        command.positions.resize(mesh.vertex_count * 3);
+        for (std::size_t v = 0; v < mesh.vertex_count; ++v) {
+            command.positions[v * 3 + 0] = mesh.x[v];
+            command.positions[v * 3 + 1] = mesh.y[v];
+            command.positions[v * 3 + 2] = mesh.z[v];
+        }
+        command.indices.resize(mesh.triangle_count * 3);
+        for (std::size_t t = 0; t < mesh.triangle_count; ++t) {
+            command.indices[t * 3 + 0] = mesh.i0[t];
+            command.indices[t * 3 + 1] = mesh.i1[t];
+            command.indices[t * 3 + 2] = mesh.i2[t];
+        }
+        m_impl->Push(std::move(command));
+    }
+
+    void Renderer::DropMesh(std::uint32_t id) {
+        Command command;
+        command.type = Command::Type::DropMesh;
+        command.id = id;
+        m_impl->Push(std::move(command));
+    }
+
+    void Renderer::SetMaterial(std::uint32_t id, const glm::vec4& color) {
+        if (id > DrawKey::kMaxMaterial) return;
+        Command command;
+        command.type = Command::Type::SetMaterial;
+        command.id = id;
+        command.color = color;
+        m_impl->Push(std::move(command));
+    }
+
+    void Renderer::Resize(std::uint32_t width, std::uint32_t height) {
+        Command command;
+        command.type = Command::Type::Resize;
+        command.width = std::clamp(width, 1u, 8192u);
+        command.height = std::clamp(height, 1u, 8192u);
+        m_impl->Push(std::move(command));
+    }
+
+    DrawList& Renderer::BeginFrame() {
+        DrawList& list = m_impl->lists[m_impl->writing];
+        list.Clear();
+        return list;
+    }
+
+    void Renderer::EndFrame() {
+        Impl& impl = *m_impl;
+        {
+            std::lock_guard<std::mutex> lock(impl.mutex);
+            if (impl.has_ready) {
+                impl.stats.dropped_lists += 1;
+            }
+            std::swap(impl.writing, impl.ready);
+            impl.has_ready = true;
+        }
+        impl.wake.notify_one();
+    }
+
+    void Renderer::Flush() {
+        Impl& impl = *m_impl;
+        if (!IsRunning()) return;
+        std::unique_lock<std::mutex> lock(impl.mutex);
+        impl.idle.wait(lock, [&] { return !impl.has_ready && !impl.busy && impl.commands.empty(); });
+    }
+
+    RendererStats Renderer::GetStats() const {
+        std::lock_guard<std::mutex> lock(m_impl->mutex);
+        return m_impl->stats;
+    }
+
+    bool Renderer::CopyLatestImage(ViewportImage& out) const {
+        std::lock_guard<std::mutex> lock(m_impl->image_mutex);
+        const ViewportImage& latest = m_impl->latest;
+        if (latest.frame == 0 || latest.frame <= out.frame) return false;
+        out.width = latest.width;
+        out.height = latest.height;
+        out.frame = latest.frame;
+        out.origin_bottom_left = latest.origin_bottom_left;
+        out.rgba = latest.rgba;
+        return true;
+    }
+
+} // namespace Backend::Render
@@ -0,0 +1,114 @@
+#pragma once
+
+// bgfx scene renderer.
+//
+// All bgfx calls happen on one submission thread owned by the Renderer (the
+// bgfx API thread; bgfx's own render thread sits behind it). A single
+// producer (the UI thread, or the FramePipeline's update jobs) fills a
+// DrawList and publishes it; lists are triple buffered, so publishing never
+// blocks: if the submission thread is still busy, the previous unsubmitted
+// list is replaced. The thread radix-sorts the list and
+// issues one instanced draw per (material, mesh) batch into an offscreen
+// framebuffer, which is read back for the viewport panel.
+//
+// With RendererBackend::Noop nothing reaches a GPU but the full submission
+// path runs, so headless machines can measure it (see RenderBench). A
+// backend whose shaders are missing falls back to Noop with an Error().
+
+#include "BackendAPI.h"
+#include "Geometry/MeshSoA.h"
+#include "Render/DrawList.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Backend::Render {
+
+    enum class RendererBackend : std::uint8_t {
+        Auto,       // bgfx picks the platform default
+        Noop,
+        OpenGL,
+        Vulkan,
+        Direct3D11,
+        Direct3D12,
+        Metal
+    };
+
+    struct RendererConfig {
+        RendererBackend backend = RendererBackend::Auto;
+        std::uint32_t width = 1280;
+        std::uint32_t height = 720;
+        bool instancing = true;             // Off: one draw call per item (for comparison)
+        bool readback = true;               // Copy finished frames to the CPU (ignored by Noop)
+        std::uint32_t max_instances = 1u << 20;     // Per frame; sizes bgfx's transient buffer
+        std::string shader_dir = "Assets/Shaders";  // Compiled shaders in <dir>/<glsl|spirv|dx11|metal>/
+    };
+
+    struct RendererStats {
+        std::uint64_t frames = 0;
+        std::uint64_t dropped_lists = 0;    // Replaced before the submission thread took them
+        std::uint32_t draw_items = 0;       // Last frame
+        std::uint32_t batches = 0;
+        std::uint32_t draw_calls = 0;
+        std::uint32_t skipped_items = 0;    // Unknown mesh or transient memory exhausted
+        float sort_ms = 0.0f;
+        float submit_ms = 0.0f;             // Batching and bgfx submission
+        float frame_ms = 0.0f;              // bgfx::frame(), including waiting on the render thread
+    };
+
+    // Read-back colour target, RGBA8, `origin_bottom_left` for GL-style backends
+    struct ViewportImage {
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+        std::uint64_t frame = 0;
+        bool origin_bottom_left = false;
+        std::vector<std::uint8_t> rgba;
+    };
+
+    class BACKEND_API Renderer {
+    public:
+        Renderer();
+        ~Renderer();
+
+        Renderer(const Renderer&) = delete;
+        Renderer& operator=(const Renderer&) = delete;
+
+        // Starts the submission thread and initializes bgfx on it; blocks until
+        // bgfx is up (or failed)
+        bool Start(const RendererConfig& config = {});
+        void Stop();
+        bool IsRunning() const;
+
+        // Active bgfx renderer name ("Noop", "OpenGL", ...), valid after Start
+        const char* BackendName() const;
+        const std::string& Error() const { return m_error; }
+
+        // --- Resources (queued, applied before the next submitted frame) ---
+        // Ids must be below kPlaceholderMesh; uploading an id again replaces it
+        void UploadMesh(std::uint32_t id, const Geometry::MeshView& mesh);
+        void DropMesh(std::uint32_t id);
+        void SetMaterial(std::uint32_t id, const glm::vec4& color);
+        void Resize(std::uint32_t width, std::uint32_t height);
+
+        // --- Frames ---
+        // Fill the returned list on the calling thread, then publish it
+        DrawList& BeginFrame();
+        void EndFrame();
+
+        // Blocks until every published list has been submitted
+        void Flush();
+
+        RendererStats GetStats() const;
+
+        // Copies the newest read-back image if it is newer than `out.frame`
+        bool CopyLatestImage(ViewportImage& out) const;
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
+        std::string m_error;
+    };
+
+} // namespace Backend::Render
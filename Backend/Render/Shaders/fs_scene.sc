@@ -0,0 +1,16 @@
+$input v_world
+
+// Flat shading without vertex normals: the face normal comes from screen-space
+// derivatives of the world position. abs() keeps both winding orders lit.
+
+#include <bgfx_shader.sh>
+
+uniform vec4 u_color;
+
+void main()
+{
+    vec3 normal = normalize(cross(dFdx(v_world), dFdy(v_world)));
+    vec3 light = normalize(vec3(0.4, 1.0, 0.6));
+    float diffuse = 0.35 + 0.65 * abs(dot(normal, light));
+    gl_FragColor = vec4(u_color.rgb * diffuse, u_color.a);
+}
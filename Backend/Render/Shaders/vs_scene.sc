@@ -0,0 +1,13 @@
+$input a_position
+$output v_world
+
+// One draw per item: the model matrix comes from bgfx::setTransform.
+
+#include <bgfx_shader.sh>
+
+void main()
+{
+    vec4 world = mul(u_model[0], vec4(a_position, 1.0));
+    v_world = world.xyz;
+    gl_Position = mul(u_viewProj, world);
+}
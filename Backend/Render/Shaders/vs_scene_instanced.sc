@@ -0,0 +1,15 @@
+$input a_position, i_data0, i_data1, i_data2, i_data3
+$output v_world
+
+// Instanced draw: the model matrix arrives as four per-instance columns
+// (Render::InstanceData).
+
+#include <bgfx_shader.sh>
+
+void main()
+{
+    mat4 model = mtxFromCols(i_data0, i_data1, i_data2, i_data3);
+    vec4 world = mul(model, vec4(a_position, 1.0));
+    v_world = world.xyz;
+    gl_Position = mul(u_viewProj, world);
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+// Scene components. All of them are trivially copyable PODs so EnTT can keep
+// them in dense pools with no per-entity heap allocations.
+
+#include "Geometry/MeshSoA.h"
+#include <glm/glm.hpp>
+#include <cmath>
+#include <cstdint>
+
+namespace Backend {
+
+    struct Transform {
+        glm::vec3 position = glm::vec3(0.0f);
+        glm::vec3 rotation = glm::vec3(0.0f);   // Euler XYZ, degrees
+        glm::vec3 scale = glm::vec3(1.0f);
+
+        // Column-major 3x3 (rotation * scale), applied as m[0]*x + m[1]*y + m[2]*z
+        void Basis(glm::vec3 out[3]) const {
+            const float rx = glm::radians(rotation.x), ry = glm::radians(rotation.y), rz = glm::radians(rotation.z);
+            const float cx = std::cos(rx), sx = std::sin(rx);
+            const float cy = std::cos(ry), sy = std::sin(ry);
+            const float cz = std::cos(rz), sz = std::sin(rz);
+            // R = Rz * Ry * Rx
+            out[0] = glm::vec3(cy * cz, cy * sz, -sy) * scale.x;
+            out[1] = glm::vec3(sx * sy * cz - cx * sz, sx * sy * sz + cx * cz, sx * cy) * scale.y;
+            out[2] = glm::vec3(cx * sy * cz + sx * sz, cx * sy * sz - sx * cz, cx * cy) * scale.z;
+        }
+
+        // Column-major model matrix (Basis plus translation)
+        glm::mat4 Matrix() const {
+            glm::vec3 basis[3];
+            Basis(basis);
+            glm::mat4 model(1.0f);
+            model[0] = glm::vec4(basis[0], 0.0f);
+            model[1] = glm::vec4(basis[1], 0.0f);
+            model[2] = glm::vec4(basis[2], 0.0f);
+            model[3] = glm::vec4(position, 1.0f);
+            return model;
+        }
+    };
+
+    struct Bounds {
+        Geometry::Aabb local;   // Object space, set from the mesh
+        Geometry::Aabb world;   // Only as fresh as the last Scene::UpdateWorldBounds
+    };
+
+    // World-space box around `local` under `transform`; a point at the
+    // position when `local` is empty. Arvo: transform the center, project the
+    // extent onto |basis|
+    inline Geometry::Aabb WorldBounds(const Transform& transform, const Geometry::Aabb& local) {
+        Geometry::Aabb world;
+        if (!local.IsValid()) {
+            world.min = transform.position;
+            world.max = transform.position;
+            return world;
+        }
+
+        glm::vec3 basis[3];
+        transform.Basis(basis);
+        const glm::vec3 c = local.Center();
+        const glm::vec3 e = local.Extent() * 0.5f;
+
+        const glm::vec3 center = transform.position + basis[0] * c.x + basis[1] * c.y + basis[2] * c.z;
+        const glm::vec3 extent = glm::abs(basis[0]) * e.x + glm::abs(basis[1]) * e.y + glm::abs(basis[2]) * e.z;
+
+        world.min = center - extent;
+        world.max = center + extent;
+        return world;
+    }
+
+    // Index into a mesh library owned outside the scene
+    struct MeshHandle {
+        static constexpr std::uint32_t kInvalid = 0xFFFFFFFFu;
+        std::uint32_t id = kInvalid;
+
+        bool IsValid() const { return id != kInvalid; }
+    };
+
+    // Index into the renderer's material table (Render::Renderer::SetMaterial).
+    // Entities without one draw with material 0. Not journaled yet.
+    struct MaterialHandle {
+        std::uint32_t id = 0;
+    };
+
+    // Names are interned in the scene's string table; the component only stores a range
+    struct Name {
+        std::uint32_t offset = 0;
+        std::uint32_t length = 0;
+    };
+
+    // Persistent state that changed since the last save (see IO::SceneJournal).
+    // Only entities with a Dirty component are visited when saving.
+    inline constexpr std::uint8_t kDirtyName = 1 << 0;
+    inline constexpr std::uint8_t kDirtyTransform = 1 << 1;
+    inline constexpr std::uint8_t kDirtyMesh = 1 << 2;
+    inline constexpr std::uint8_t kDirtyAll = kDirtyName | kDirtyTransform | kDirtyMesh;
+
+    struct Dirty {
+        std::uint8_t mask = 0;
+    };
+
+} // namespace Backend
@@ -0,0 +1,266 @@
+#include "Scene/Scene.h"
+#include "Profiling/Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace Backend {
+
+    Scene::Scene() {
+        // Create the owning group up front so Transform/Bounds are packed from the first entity
+        m_registry.group<Transform, Bounds>();
+        m_registry.storage<Dirty>();
+    }
+
+    // ============================================================================
+    // ENTITIES
+    // ============================================================================
+
+    Entity Scene::CreateEntity(std::string_view name, const Transform& transform) {
+        const Entity entity = m_registry.create();
+        m_registry.emplace<Name>(entity, InternName(name));
+        m_registry.emplace<Transform>(entity, transform);
+        m_registry.emplace<Bounds>(entity);
+        m_registry.emplace<Dirty>(entity, kDirtyAll);
+        ++m_revision;
+        return entity;
+    }
+
+    Entity Scene::CreateEntityWithId(Entity id, std::string_view name, const Transform& transform) {
+        if (m_registry.valid(id)) return NullEntity;
+        const Entity entity = m_registry.create(id);
+        if (entity != id) {
+            m_registry.destroy(entity);
+            return NullEntity;
+        }
+        m_registry.emplace<Name>(entity, InternName(name));
+        m_registry.emplace<Transform>(entity, transform);
+        m_registry.emplace<Bounds>(entity);
+        ++m_revision;
+        return entity;
+    }
+
+    void Scene::DestroyEntity(Entity entity) {
+        if (!IsValid(entity)) return;
+        if (m_selected == entity) {
+            m_selected = NullEntity;
+        }
+        m_destroyed.push_back(entity);
+        ReleaseName(entity);
+        m_registry.destroy(entity);
+        CompactNamesIfSparse();
+        ++m_revision;
+    }
+
+    bool Scene::IsValid(Entity entity) const {
+        return entity != NullEntity && m_registry.valid(entity);
+    }
+
+    std::size_t Scene::EntityCount() const {
+        return m_registry.view<const Transform>().size();
+    }
+
+    void Scene::Reserve(std::size_t entity_count) {
+        m_registry.storage<Name>().reserve(entity_count);
+        m_registry.storage<Transform>().reserve(entity_count);
+        m_registry.storage<Bounds>().reserve(entity_count);
+        MutableNameTable().reserve(entity_count * 16);
+    }
+
+    // Not journaled: used to reset before loading
+    void Scene::Clear() {
+        m_registry.clear();
+        m_name_table = std::make_shared<std::vector<char>>();
+        m_name_live_bytes = 0;
+        m_destroyed.clear();
+        m_selected = NullEntity;
+        m_spatial.Clear();
+        m_spatial_entities.clear();
+        m_spatial_bounds.clear();
+        ++m_revision;
+    }
+
+    // ============================================================================
+    // COMPONENTS
+    // ============================================================================
+
+    std::string_view Scene::GetName(Entity entity) const {
+        const Name* name = IsValid(entity) ? m_registry.try_get<Name>(entity) : nullptr;
+        if (!name || name->length == 0) return {};
+        return std::string_view(m_name_table->data() + name->offset, name->length);
+    }
+
+    void Scene::SetName(Entity entity, std::string_view name) {
+        if (!IsValid(entity) || GetName(entity) == name) return;
+        ReleaseName(entity);
+        m_registry.replace<Name>(entity, InternName(name));
+        CompactNamesIfSparse();
+        MarkDirty(entity, kDirtyName);
+        ++m_revision;
+    }
+
+    void Scene::SetMesh(Entity entity, MeshHandle mesh, const Geometry::Aabb& local_bounds) {
+        if (!IsValid(entity)) return;
+        m_registry.emplace_or_replace<MeshHandle>(entity, mesh);
+        m_registry.get<Bounds>(entity).local = local_bounds;
+        MarkDirty(entity, kDirtyMesh);
+    }
+
+    MeshHandle Scene::GetMesh(Entity entity) const {
+        const MeshHandle* mesh = m_registry.try_get<MeshHandle>(entity);
+        return mesh ? *mesh : MeshHandle{};
+    }
+
+    void Scene::SetMaterial(Entity entity, MaterialHandle material) {
+        if (!IsValid(entity)) return;
+        m_registry.emplace_or_replace<MaterialHandle>(entity, material);
+    }
+
+    MaterialHandle Scene::GetMaterial(Entity entity) const {
+        const MaterialHandle* material = m_registry.try_get<MaterialHandle>(entity);
+        return material ? *material : MaterialHandle{};
+    }
+
+    Name Scene::InternName(std::string_view name) {
+        Name interned;
+        std::vector<char>& table = MutableNameTable();
+        interned.offset = static_cast<std::uint32_t>(table.size());
+        interned.length = static_cast<std::uint32_t>(name.size());
+        table.insert(table.end(), name.begin(), name.end());
+        m_name_live_bytes += name.size();
+        return interned;
+    }
+
+    // The entity's current name becomes garbage in the table
+    void Scene::ReleaseName(Entity entity) {
+        if (const Name* name = m_registry.try_get<Name>(entity)) {
+            m_name_live_bytes -= name->length;
+        }
+    }
+
+    // After a rename or destroy: compact once garbage outweighs live names
+    void Scene::CompactNamesIfSparse() {
+        constexpr std::size_t kMinCompactBytes = 64 * 1024;
+        const std::size_t size = m_name_table->size();
+        const std::size_t dead = size - m_name_live_bytes;
+        if (size >= kMinCompactBytes && dead > m_name_live_bytes) {
+            CompactNames();
+        }
+    }
+
+    // Writes a new table, so a NameTable() reader keeps the old one
+    void Scene::CompactNames() {
+        const std::vector<char>& table = *m_name_table;
+        auto compacted = std::make_shared<std::vector<char>>();
+        compacted->reserve(table.size());
+        for (auto [entity, name] : m_registry.view<Name>().each()) {
+            const std::uint32_t offset = static_cast<std::uint32_t>(compacted->size());
+            compacted->insert(compacted->end(), table.begin() + name.offset, table.begin() + name.offset + name.length);
+            name.offset = offset;
+        }
+        m_name_table = std::move(compacted);
+        m_name_live_bytes = m_name_table->size();
+    }
+
+    // Copies the table while a NameTable() reference is out. A count of one
+    // means the last reader already let go; the fence orders its reads before
+    // our writes
+    std::vector<char>& Scene::MutableNameTable() {
+        if (m_name_table.use_count() > 1) {
+            auto copy = std::make_shared<std::vector<char>>();
+            copy->reserve(m_name_table->capacity());
+            copy->assign(m_name_table->begin(), m_name_table->end());
+            m_name_table = std::move(copy);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return *m_name_table;
+    }
+
+    // ============================================================================
+    // CHANGE TRACKING
+    // ============================================================================
+
+    void Scene::MarkDirty(Entity entity, std::uint8_t mask) {
+        if (!IsValid(entity)) return;
+        m_registry.get_or_emplace<Dirty>(entity).mask |= mask;
+    }
+
+    bool Scene::HasUnsavedChanges() const {
+        return !m_destroyed.empty() || m_registry.view<const Dirty>().size() > 0;
+    }
+
+    void Scene::ClearDirty() {
+        m_registry.clear<Dirty>();
+        m_destroyed.clear();
+    }
+
+    // ============================================================================
+    // HOT PATHS
+    // ============================================================================
+
+    void Scene::UpdateWorldBounds() {
+        GE_PROFILE_FUNCTION();
+        ForEachTransformBounds([](Entity, const Transform& transform, Bounds& bounds) {
+            bounds.world = WorldBounds(transform, bounds.local);
+        });
+    }
+
+    // ============================================================================
+    // SPATIAL INDEX
+    // ============================================================================
+
+    void Scene::UpdateSpatialIndex() {
+        GE_PROFILE_FUNCTION();
+        // The owning group only reorders on insert/remove, so an identical
+        // entity sequence means the existing topology is still valid
+        auto group = m_registry.group<Transform, Bounds>();
+        const std::size_t count = group.size();
+        bool same_entities = count == m_spatial_entities.size() && !m_spatial.IsEmpty();
+
+        m_spatial_entities.resize(count);
+        m_spatial_bounds.resize(count);
+        std::size_t i = 0;
+        for (auto [entity, transform, bounds] : group.each()) {
+            same_entities = same_entities && m_spatial_entities[i] == entity;
+            m_spatial_entities[i] = entity;
+            m_spatial_bounds[i] = bounds.world;
+            ++i;
+        }
+
+        if (same_entities) {
+            m_spatial.Refit(m_spatial_bounds);
+        } else {
+            m_spatial.Build(m_spatial_bounds);
+        }
+    }
+
+    Entity Scene::Raycast(const Geometry::Ray& ray, float* out_t) const {
+        Entity nearest = NullEntity;
+        float nearest_t = ray.t_max;
+        m_spatial.Raycast(ray, [&](std::uint32_t i, float& t_max) {
+            // Slab test against the entity box itself; leaves hold several
+            const Geometry::Aabb& box = m_spatial_bounds[i];
+            float enter = ray.t_min, exit = t_max;
+            for (int axis = 0; axis < 3; ++axis) {
+                const float inv = 1.0f / ray.direction[axis];
+                float t0 = (box.min[axis] - ray.origin[axis]) * inv;
+                float t1 = (box.max[axis] - ray.origin[axis]) * inv;
+                if (t0 > t1) std::swap(t0, t1);
+                enter = std::max(enter, t0);
+                exit = std::min(exit, t1);
+            }
+            if (box.IsValid() && enter <= exit && enter < t_max) {
+                t_max = enter;
+                nearest_t = enter;
+                nearest = m_spatial_entities[i];
+            }
+            return false;
+        });
+        if (out_t && nearest != NullEntity) {
+            *out_t = nearest_t;
+        }
+        return nearest;
+    }
+
+} // namespace Backend
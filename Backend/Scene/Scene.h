@@ -0,0 +1,152 @@
+#pragma once
+
+// EnTT-backed scene registry.
+// Transform and Bounds are owned by a single group so both pools stay packed
+// in the same order; hot loops (bounds update, culling, snapshotting) walk
+// them linearly. Entity names live in one interned character table instead
+// of a std::string per entity.
+
+#include "BackendAPI.h"
+#include "Scene/Components.h"
+#include "Geometry/Bvh.h"
+#include <entt/entt.hpp>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Backend {
+
+    using Entity = entt::entity;
+    inline constexpr Entity NullEntity = entt::null;
+
+    class BACKEND_API Scene {
+    public:
+        Scene();
+        Scene(const Scene&) = delete;
+        Scene& operator=(const Scene&) = delete;
+
+        // --- Entities ---
+        Entity CreateEntity(std::string_view name, const Transform& transform = {});
+        // Recreates a persisted entity under its saved id (not marked dirty);
+        // returns NullEntity if the id is taken
+        Entity CreateEntityWithId(Entity id, std::string_view name, const Transform& transform = {});
+        void DestroyEntity(Entity entity);
+        bool IsValid(Entity entity) const;
+        std::size_t EntityCount() const;
+        void Reserve(std::size_t entity_count);
+        void Clear();
+
+        // Bumped by create, destroy, rename and Clear (not by component edits),
+        // so panels can keep per-entity indices until the entity set changes
+        std::uint64_t Revision() const { return m_revision; }
+
+        // --- Components ---
+        std::string_view GetName(Entity entity) const;
+        void SetName(Entity entity, std::string_view name);
+
+        // The interned bytes behind every Name component, for readers on other
+        // threads: copy the Name ranges on the owning thread, then read them
+        // from this. The table is copy-on-write, so the bytes stay unchanged
+        // while the reference is held; drop it soon, the next rename, create
+        // or destroy pays for a full copy until then
+        std::shared_ptr<const std::vector<char>> NameTable() const { return m_name_table; }
+
+        Transform& GetTransform(Entity entity) { return m_registry.get<Transform>(entity); }
+        const Transform& GetTransform(Entity entity) const { return m_registry.get<Transform>(entity); }
+        Bounds& GetBounds(Entity entity) { return m_registry.get<Bounds>(entity); }
+        const Bounds& GetBounds(Entity entity) const { return m_registry.get<Bounds>(entity); }
+
+        void SetMesh(Entity entity, MeshHandle mesh, const Geometry::Aabb& local_bounds);
+        MeshHandle GetMesh(Entity entity) const;
+
+        void SetMaterial(Entity entity, MaterialHandle material);
+        MaterialHandle GetMaterial(Entity entity) const;
+
+        // --- Change tracking ---
+        // SetName/SetMesh/CreateEntity mark themselves; code that writes through
+        // GetTransform() must call MarkDirty(entity, kDirtyTransform).
+        void MarkDirty(Entity entity, std::uint8_t mask);
+        bool HasUnsavedChanges() const;
+        // Entities destroyed since the last ClearDirty()
+        std::span<const Entity> DestroyedEntities() const { return m_destroyed; }
+        void ClearDirty();
+
+        // fn(Entity, std::uint8_t mask) over entities changed since the last save
+        template <typename Fn>
+        void ForEachDirty(Fn&& fn) const {
+            for (auto [entity, dirty] : m_registry.view<const Dirty>().each()) {
+                fn(entity, dirty.mask);
+            }
+        }
+
+        // --- Selection ---
+        Entity GetSelected() const { return IsValid(m_selected) ? m_selected : NullEntity; }
+        void SetSelected(Entity entity) { m_selected = entity; }
+
+        // --- Hot iteration ---
+        // fn(Entity, Transform&, Bounds&) over the packed owning group
+        template <typename Fn>
+        void ForEachTransformBounds(Fn&& fn) {
+            m_registry.group<Transform, Bounds>().each(std::forward<Fn>(fn));
+        }
+
+        // fn(Entity, const Transform&, const MeshHandle&) over renderable entities
+        template <typename Fn>
+        void ForEachMesh(Fn&& fn) {
+            m_registry.view<const Transform, const MeshHandle>().each(std::forward<Fn>(fn));
+        }
+
+        // Recomputes Bounds::world from Bounds::local and the transform
+        void UpdateWorldBounds();
+
+        // --- Spatial index ---
+        // BVH over Bounds::world in owning-group order. Call after
+        // UpdateWorldBounds; refits in place while the entity set is unchanged
+        // and rebuilds after creates/destroys. Queries see the state of the
+        // last update.
+        void UpdateSpatialIndex();
+
+        // fn(Entity) for entities whose world bounds overlap `box`
+        template <typename Fn>
+        void QueryBounds(const Geometry::Aabb& box, Fn&& fn) const {
+            m_spatial.QueryAabb(box, [&](std::uint32_t i) { fn(m_spatial_entities[i]); });
+        }
+
+        // fn(Entity) for entities whose world bounds intersect `frustum`
+        template <typename Fn>
+        void QueryFrustum(const Geometry::Frustum& frustum, Fn&& fn) const {
+            m_spatial.QueryFrustum(frustum, [&](std::uint32_t i) { fn(m_spatial_entities[i]); });
+        }
+
+        // Nearest entity whose world bounds the ray enters (picking); NullEntity if none
+        Entity Raycast(const Geometry::Ray& ray, float* out_t = nullptr) const;
+
+        // Names are appended, never overwritten. SetName and DestroyEntity
+        // compact automatically once dead bytes outnumber live ones
+        void CompactNames();
+
+        entt::registry& Registry() { return m_registry; }
+        const entt::registry& Registry() const { return m_registry; }
+
+    private:
+        Name InternName(std::string_view name);
+        void ReleaseName(Entity entity);
+        void CompactNamesIfSparse();
+        std::vector<char>& MutableNameTable();
+
+        entt::registry m_registry;
+        std::shared_ptr<std::vector<char>> m_name_table = std::make_shared<std::vector<char>>();
+        std::size_t m_name_live_bytes = 0;      // Bytes still referenced by a Name
+        std::vector<Entity> m_destroyed;
+        Entity m_selected = NullEntity;
+        std::uint64_t m_revision = 0;
+
+        Geometry::Bvh m_spatial;
+        std::vector<Entity> m_spatial_entities;     // BVH primitive id -> entity
+        std::vector<Geometry::Aabb> m_spatial_bounds;
+    };
+
+} // namespace Backend
@@ -0,0 +1,136 @@
+// Compares two GeometryEngineBench JSON results and fails on regressions.
+// Usage: BenchCompare <baseline.json> <current.json> [--threshold=10]
+//                     [--metric=median_ms] [--min-ms=0.05]
+//
+// A benchmark regresses when `metric` moved the wrong way by more than
+// `threshold` percent over the baseline. Times (*_ms) are lower-is-better,
+// rates (*_per_second) higher-is-better. Benchmarks whose baseline median is
+// below --min-ms are reported but never fail the run: their noise exceeds
+// any sensible threshold. Benchmarks missing from either side are listed,
+// not failed.
+//
+// Exit codes: 0 = no regression, 1 = regression, 2 = unreadable input.
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+
+namespace {
+
+    constexpr int kSchemaVersion = 1;
+
+    struct Options {
+        std::string baseline;
+        std::string current;
+        double threshold_percent = 10.0;
+        double min_ms = 0.05;
+        std::string metric = "median_ms";
+    };
+
+    bool ParseArgs(int argc, char** argv, Options& options) {
+        auto value_of = [](const char* arg, const char* flag) -> const char* {
+            const std::size_t n = std::strlen(flag);
+            return std::strncmp(arg, flag, n) == 0 ? arg + n : nullptr;
+        };
+        int positional = 0;
+        for (int i = 1; i < argc; ++i) {
+            const char* arg = argv[i];
+            const char* v = nullptr;
+            if ((v = value_of(arg, "--threshold="))) options.threshold_percent = std::max(0.0, std::atof(v));
+            else if ((v = value_of(arg, "--min-ms="))) options.min_ms = std::max(0.0, std::atof(v));
+            else if ((v = value_of(arg, "--metric="))) options.metric = v;
+            else if (arg[0] == '-' && arg[1] == '-') return false;
+            else if (positional == 0) { options.baseline = arg; ++positional; }
+            else if (positional == 1) { options.current = arg; ++positional; }
+            else return false;
+        }
+        return positional == 2;
+    }
+
+    struct Entry {
+        double value = 0.0;         // The compared metric
+        double median_ms = 0.0;     // For the --min-ms noise floor
+    };
+
+    bool HigherIsBetter(const std::string& metric) {
+        return metric.ends_with("_per_second");
+    }
+
+    bool Load(const std::string& path, const std::string& metric, std::map<std::string, Entry>& out) {
+        std::ifstream file(path);
+        if (!file) {
+            std::fprintf(stderr, "Cannot open %s\n", path.c_str());
+            return false;
+        }
+        const nlohmann::json doc = nlohmann::json::parse(file, nullptr, false);
+        if (doc.is_discarded() || !doc.is_object() || doc.value("schema", 0) != kSchemaVersion ||
+            !doc.contains("benchmarks") || !doc["benchmarks"].is_array()) {
+            std::fprintf(stderr, "%s is not a schema %d benchmark result\n", path.c_str(), kSchemaVersion);
+            return false;
+        }
+        for (const nlohmann::json& entry : doc["benchmarks"]) {
+            if (!entry.is_object() || !entry.contains("name") || !entry.contains(metric)) continue;
+            if (!entry["name"].is_string() || !entry[metric].is_number()) continue;
+            const nlohmann::json& median = entry.contains("median_ms") ? entry["median_ms"] : nlohmann::json();
+            out[entry["name"].get<std::string>()] =
+                Entry{ entry[metric].get<double>(), median.is_number() ? median.get<double>() : 0.0 };
+        }
+        return true;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseArgs(argc, argv, options)) {
+        std::fprintf(stderr, "Usage: BenchCompare <baseline.json> <current.json> [--threshold=10] "
+                             "[--metric=median_ms] [--min-ms=0.05]\n");
+        return 2;
+    }
+
+    std::map<std::string, Entry> baseline;
+    std::map<std::string, Entry> current;
+    if (!Load(options.baseline, options.metric, baseline) || !Load(options.current, options.metric, current)) return 2;
+
+    std::printf("%-36s %12s %12s %9s\n", "benchmark", "baseline", "current", "change");
+    const bool higher_is_better = HigherIsBetter(options.metric);
+    int regressions = 0;
+    int improvements = 0;
+    for (const auto& [name, entry] : current) {
+        const double now = entry.value;
+        const auto it = baseline.find(name);
+        if (it == baseline.end()) {
+            std::printf("%-36s %12s %12.3f %9s  new\n", name.c_str(), "-", now, "");
+            continue;
+        }
+        const double before = it->second.value;
+        const double change = before > 0.0 ? (now - before) / before * 100.0 : 0.0;
+        const double worse = higher_is_better ? -change : change;
+        const char* verdict = "";
+        if (worse > options.threshold_percent) {
+            if (it->second.median_ms >= options.min_ms) {
+                verdict = "REGRESSION";
+                ++regressions;
+            } else {
+                verdict = "slower (below --min-ms)";
+            }
+        } else if (worse < -options.threshold_percent) {
+            verdict = "faster";
+            ++improvements;
+        }
+        std::printf("%-36s %12.3f %12.3f %+8.1f%%  %s\n", name.c_str(), before, now, change, verdict);
+    }
+    for (const auto& [name, entry] : baseline) {
+        if (!current.contains(name)) std::printf("%-36s %12.3f %12s %9s  missing\n", name.c_str(), entry.value, "-", "");
+    }
+
+    std::printf("\n%s, threshold %.1f%%: %d regression(s), %d improvement(s)\n", options.metric.c_str(),
+                options.threshold_percent, regressions, improvements);
+    return regressions > 0 ? 1 : 0;
+}
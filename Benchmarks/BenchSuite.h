@@ -0,0 +1,191 @@
+#pragma once
+
+// Benchmark suite for GeometryEngineBench, on top of BenchSupport.h.
+//
+// A benchmark is a named callable run `warmup` times unmeasured, then
+// `iterations` times under steady_clock. Each measured call is one sample;
+// the report keeps min/median/mean/p90/max/stddev in milliseconds and, when
+// the benchmark declares how many items one call processes, throughput.
+// Results are written as JSON (schema 1) that BenchCompare diffs against a
+// stored baseline.
+
+#include "BenchSupport.h"
+
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Bench {
+
+    inline constexpr int kSchemaVersion = 1;
+
+    struct Options {
+        int warmup = 3;
+        int iterations = 15;
+        std::string filter;         // Substring of "group/name"; empty = all
+        std::string json_path;      // Empty = no JSON
+        bool list = false;
+        bool frame = true;          // Headless frame-loop group (needs a GL context)
+    };
+
+    inline Options ParseArgs(int argc, char** argv) {
+        Options options;
+        auto value_of = [](const char* arg, const char* flag) -> const char* {
+            const std::size_t n = std::strlen(flag);
+            return std::strncmp(arg, flag, n) == 0 ? arg + n : nullptr;
+        };
+        for (int i = 1; i < argc; ++i) {
+            const char* arg = argv[i];
+            const char* v = nullptr;
+            if (std::strcmp(arg, "--list") == 0) options.list = true;
+            else if (std::strcmp(arg, "--no-frame") == 0) options.frame = false;
+            else if (std::strcmp(arg, "--quick") == 0) { options.warmup = 1; options.iterations = 5; }
+            else if ((v = value_of(arg, "--warmup="))) options.warmup = std::max(0, std::atoi(v));
+            else if ((v = value_of(arg, "--iterations="))) options.iterations = std::max(1, std::atoi(v));
+            else if ((v = value_of(arg, "--filter="))) options.filter = v;
+            else if ((v = value_of(arg, "--json="))) options.json_path = v;
+        }
+        return options;
+    }
+
+    struct Result {
+        std::string name;           // "group/name"
+        int warmup = 0;
+        int iterations = 0;
+        double items = 0.0;         // Per call; 0 = no throughput
+        double min_ms = 0.0;
+        double median_ms = 0.0;
+        double mean_ms = 0.0;
+        double p90_ms = 0.0;
+        double max_ms = 0.0;
+        double stddev_ms = 0.0;
+        double items_per_second = 0.0;
+    };
+
+    inline Result Summarize(std::string name, std::vector<double> samples, int warmup, double items) {
+        Result r;
+        r.name = std::move(name);
+        r.warmup = warmup;
+        r.iterations = static_cast<int>(samples.size());
+        r.items = items;
+        if (samples.empty()) return r;
+        std::sort(samples.begin(), samples.end());
+        const std::size_t n = samples.size();
+        auto pct = [&](double p) { return samples[static_cast<std::size_t>(p * static_cast<double>(n - 1) + 0.5)]; };
+        double sum = 0.0;
+        for (const double s : samples) sum += s;
+        r.mean_ms = sum / static_cast<double>(n);
+        double var = 0.0;
+        for (const double s : samples) var += (s - r.mean_ms) * (s - r.mean_ms);
+        r.stddev_ms = n > 1 ? std::sqrt(var / static_cast<double>(n - 1)) : 0.0;
+        r.min_ms = samples.front();
+        r.max_ms = samples.back();
+        r.median_ms = pct(0.5);
+        r.p90_ms = pct(0.9);
+        if (items > 0.0 && r.median_ms > 0.0) r.items_per_second = items / (r.median_ms * 1e-3);
+        return r;
+    }
+
+    // ============================================================================
+    // SUITE
+    // ============================================================================
+
+    class Suite {
+    public:
+        explicit Suite(Options options) : m_options(std::move(options)) {}
+
+        const Options& GetOptions() const { return m_options; }
+
+        bool Selected(const std::string& name) const {
+            return m_options.filter.empty() || name.find(m_options.filter) != std::string::npos;
+        }
+
+        // Runs `fn` warmup + iterations times; `items` is the work per call
+        template <typename Fn>
+        void Run(const std::string& name, double items, Fn&& fn) {
+            if (!Selected(name)) return;
+            if (m_options.list) {
+                std::printf("%s\n", name.c_str());
+                return;
+            }
+            for (int i = 0; i < m_options.warmup; ++i) fn();
+            std::vector<double> samples;
+            samples.reserve(static_cast<std::size_t>(m_options.iterations));
+            for (int i = 0; i < m_options.iterations; ++i) {
+                const auto start = Clock::now();
+                fn();
+                samples.push_back(SecondsSince(start) * 1e3);
+            }
+            Add(Summarize(name, std::move(samples), m_options.warmup, items));
+        }
+
+        // For loops that time themselves (e.g. per-frame samples)
+        void Add(Result result) {
+            Print(result);
+            m_results.push_back(std::move(result));
+        }
+
+        void Skip(const std::string& name, const std::string& reason) {
+            if (!Selected(name) || m_options.list) return;
+            std::printf("%-36s skipped: %s\n", name.c_str(), reason.c_str());
+            m_skipped.emplace_back(name, reason);
+        }
+
+        void SetInfo(const std::string& key, nlohmann::json value) { m_info[key] = std::move(value); }
+
+        const std::vector<Result>& Results() const { return m_results; }
+
+        bool WriteJson(const std::string& path) const {
+            nlohmann::json doc;
+            doc["schema"] = kSchemaVersion;
+            doc["suite"] = "GeometryEngineBench";
+            doc["timestamp"] = static_cast<std::int64_t>(std::time(nullptr));
+            doc["info"] = m_info;
+            nlohmann::json list = nlohmann::json::array();
+            for (const Result& r : m_results) {
+                list.push_back({
+                    { "name", r.name }, { "warmup", r.warmup }, { "iterations", r.iterations }, { "items", r.items },
+                    { "min_ms", r.min_ms }, { "median_ms", r.median_ms }, { "mean_ms", r.mean_ms },
+                    { "p90_ms", r.p90_ms }, { "max_ms", r.max_ms }, { "stddev_ms", r.stddev_ms },
+                    { "items_per_second", r.items_per_second }
+                });
+            }
+            doc["benchmarks"] = std::move(list);
+            nlohmann::json skipped = nlohmann::json::array();
+            for (const auto& [name, reason] : m_skipped) skipped.push_back({ { "name", name }, { "reason", reason } });
+            doc["skipped"] = std::move(skipped);
+
+            std::ofstream file(path, std::ios::trunc);
+            file << doc.dump(2) << '\n';
+            return static_cast<bool>(file);
+        }
+
+    private:
+        static void Print(const Result& r) {
+            char throughput[48] = "";
+            if (r.items_per_second > 0.0) {
+                const double v = r.items_per_second;
+                if (v >= 1e9) std::snprintf(throughput, sizeof(throughput), "%8.2f G/s", v * 1e-9);
+                else if (v >= 1e6) std::snprintf(throughput, sizeof(throughput), "%8.2f M/s", v * 1e-6);
+                else std::snprintf(throughput, sizeof(throughput), "%8.2f K/s", v * 1e-3);
+            }
+            std::printf("%-36s median %9.3f  min %9.3f  p90 %9.3f  sd %7.3f ms  %s\n", r.name.c_str(), r.median_ms,
+                        r.min_ms, r.p90_ms, r.stddev_ms, throughput);
+        }
+
+        Options m_options;
+        std::vector<Result> m_results;
+        std::vector<std::pair<std::string, std::string>> m_skipped;
+        nlohmann::json m_info = nlohmann::json::object();
+    };
+
+} // namespace Bench
@@ -0,0 +1,38 @@
+#pragma once
+
+// Helpers shared by the benchmark executables: timing, percentiles and an
+// optimizer barrier. BenchSuite.h builds the JSON-reporting suite on top.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace Bench {
+
+    using Clock = std::chrono::steady_clock;
+
+    inline double SecondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    // Nearest-rank percentile; reorders `samples`
+    inline double Percentile(std::vector<double>& samples, double p) {
+        if (samples.empty()) return 0.0;
+        const std::size_t idx = std::min(samples.size() - 1, static_cast<std::size_t>(p * (samples.size() - 1) + 0.5));
+        std::nth_element(samples.begin(), samples.begin() + idx, samples.end());
+        return samples[idx];
+    }
+
+    // Keeps a computed value alive without the optimizer seeing through it
+    template <typename T>
+    inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const T* s_sink;
+        s_sink = &value;
+#endif
+    }
+
+} // namespace Bench
@@ -0,0 +1,235 @@
+// Load generator for the Bridge batch endpoint.
+// Usage: BridgeBench [connections] [seconds_per_scenario] [--batch=N] [--host=H] [--port=P]
+//
+// Without --port an in-process server is started on a free localhost port.
+// Each connection is a keep-alive client with one batch in flight, so
+// `connections` is the pipelining depth. Scenarios:
+//
+//  - ping: N no-op ops per batch (HTTP + framing overhead)
+//  - metrics: N mesh metrics queries per batch (parallel query path)
+//  - edits: N transform edits + one bounds query per batch (serial edit path)
+
+#include "BenchSupport.h"
+#include "Server.h"
+#include "Protocol.h"
+#include "Jobs/JobSystem.h"
+#include "Geometry/Terrain.h"
+
+#include <httplib.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Bench::Clock;
+using Bench::Percentile;
+namespace Proto = Bridge::Protocol;
+namespace Geo = Backend::Geometry;
+
+namespace {
+
+    struct Options {
+        unsigned connections = 0;
+        double seconds = 3.0;
+        std::uint32_t batch_ops = 64;
+        std::string host = "127.0.0.1";
+        int port = 0;
+    };
+
+    constexpr std::uint32_t kBenchMesh = 1;
+    constexpr std::uint32_t kEntityCount = 4096;
+
+    bool Send(httplib::Client& client, std::span<const std::byte> body, std::string& response) {
+        auto res = client.Post(Proto::kBatchPath, reinterpret_cast<const char*>(body.data()), body.size(), Proto::kContentType);
+        if (!res || res->status != 200) return false;
+        response = std::move(res->body);
+        return true;
+    }
+
+    // One-off setup batches: mesh upload and the entities the edit scenario moves
+    bool Populate(const Options& options, std::vector<std::uint32_t>& entities) {
+        httplib::Client client(options.host, options.port);
+        const Geo::MeshSoA grid = Geo::MakeTerrain(128);   // ~33k triangles
+
+        Proto::BatchWriter writer;
+        writer.UploadMesh(kBenchMesh, grid.x, grid.y, grid.z, grid.i0, grid.i1, grid.i2);
+        for (std::uint32_t i = 0; i < kEntityCount; ++i) {
+            Proto::TransformData transform;
+            transform.position[0] = static_cast<float>(i % 64) * 200.0f;
+            transform.position[1] = static_cast<float>(i / 64) * 200.0f;
+            writer.CreateEntity("bench_" + std::to_string(i), transform, kBenchMesh);
+        }
+
+        std::string response;
+        if (!Send(client, writer.Bytes(), response)) return false;
+
+        Proto::ResultReader reader(response);
+        Proto::ResultReader::Result result;
+        while (reader.Next(result)) {
+            if (result.GetStatus() != Proto::Status::Ok) return false;
+            Proto::EntityRef ref;
+            if (static_cast<Proto::Op>(result.header.op) == Proto::Op::CreateEntity && result.Read(ref)) {
+                entities.push_back(ref.entity);
+            }
+        }
+        return entities.size() == kEntityCount;
+    }
+
+    // fn(connection, iteration, writer) fills one batch
+    using BatchBuilder = std::function<void(unsigned, std::uint64_t, Proto::BatchWriter&)>;
+
+    void RunScenario(const char* name, const Options& options, const BatchBuilder& build) {
+        std::atomic<bool> failed{ false };
+        std::vector<std::vector<double>> latencies(options.connections);
+        std::vector<std::uint64_t> ops(options.connections, 0);
+        std::vector<std::uint64_t> bytes(options.connections, 0);
+
+        const auto start = Clock::now();
+        const auto deadline = start + std::chrono::duration<double>(options.seconds);
+
+        std::vector<std::thread> threads;
+        for (unsigned c = 0; c < options.connections; ++c) {
+            threads.emplace_back([&, c] {
+                httplib::Client client(options.host, options.port);
+                client.set_keep_alive(true);
+                client.set_tcp_nodelay(true);
+                Proto::BatchWriter writer;
+                std::string response;
+
+                for (std::uint64_t i = 0; Clock::now() < deadline && !failed.load(std::memory_order_relaxed); ++i) {
+                    writer.Clear();
+                    build(c, i, writer);
+                    const std::span<const std::byte> body = writer.Bytes();
+
+                    const auto sent = Clock::now();
+                    if (!Send(client, body, response)) {
+                        failed = true;
+                        break;
+                    }
+                    latencies[c].push_back(std::chrono::duration<double, std::micro>(Clock::now() - sent).count());
+
+                    Proto::ResultReader reader(response);
+                    if (!reader.IsValid() || reader.Count() != writer.OpCount()) {
+                        failed = true;
+                        break;
+                    }
+                    ops[c] += writer.OpCount();
+                    bytes[c] += body.size() + response.size();
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::vector<double> all;
+        std::uint64_t total_ops = 0;
+        std::uint64_t total_bytes = 0;
+        for (unsigned c = 0; c < options.connections; ++c) {
+            all.insert(all.end(), latencies[c].begin(), latencies[c].end());
+            total_ops += ops[c];
+            total_bytes += bytes[c];
+        }
+        if (failed) {
+            std::printf("[%-8s] FAILED (connection error or malformed response)\n", name);
+            return;
+        }
+
+        const std::size_t requests = all.size();
+        const double p50 = Percentile(all, 0.50);
+        const double p99 = Percentile(all, 0.99);
+        const double p999 = Percentile(all, 0.999);
+        const double max = all.empty() ? 0.0 : *std::max_element(all.begin(), all.end());
+        std::printf("[%-8s] %8.0f req/s  %10.0f ops/s  %7.1f MB/s  latency p50 %.0f us  p99 %.0f us  p99.9 %.0f us  max %.0f us\n",
+                    name, requests / seconds, total_ops / seconds, total_bytes / seconds / 1e6, p50, p99, p999, max);
+    }
+
+    Options ParseArgs(int argc, char** argv) {
+        Options options;
+        int positional = 0;
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg.rfind("--batch=", 0) == 0) {
+                options.batch_ops = static_cast<std::uint32_t>(std::strtoul(arg.c_str() + 8, nullptr, 10));
+            } else if (arg.rfind("--host=", 0) == 0) {
+                options.host = arg.substr(7);
+            } else if (arg.rfind("--port=", 0) == 0) {
+                options.port = std::atoi(arg.c_str() + 7);
+            } else if (positional == 0) {
+                options.connections = static_cast<unsigned>(std::strtoul(arg.c_str(), nullptr, 10));
+                ++positional;
+            } else if (positional == 1) {
+                options.seconds = std::strtod(arg.c_str(), nullptr);
+                ++positional;
+            }
+        }
+        if (options.connections == 0) options.connections = std::max(1u, std::thread::hardware_concurrency());
+        if (options.batch_ops == 0) options.batch_ops = 1;
+        return options;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options = ParseArgs(argc, argv);
+
+    // In-process server unless pointed at a running instance
+    Bridge::Server server;
+    if (options.port == 0) {
+        Backend::Jobs::Initialize();
+        Bridge::ServerConfig config;
+        config.host = options.host;
+        if (!server.Start(config)) {
+            std::fprintf(stderr, "BridgeBench: %s\n", server.Error().c_str());
+            return 1;
+        }
+        options.port = server.Port();
+    }
+    std::printf("BridgeBench: %s:%d  %u connections  %u ops/batch  %.1f s/scenario\n",
+                options.host.c_str(), options.port, options.connections, options.batch_ops, options.seconds);
+
+    std::vector<std::uint32_t> entities;
+    if (!Populate(options, entities)) {
+        std::fprintf(stderr, "BridgeBench: setup batch failed\n");
+        return 1;
+    }
+
+    const std::uint32_t n = options.batch_ops;
+
+    RunScenario("ping", options, [n](unsigned, std::uint64_t, Proto::BatchWriter& writer) {
+        for (std::uint32_t i = 0; i < n; ++i) writer.Ping(i);
+    });
+
+    RunScenario("metrics", options, [n](unsigned, std::uint64_t, Proto::BatchWriter& writer) {
+        for (std::uint32_t i = 0; i < n; ++i) writer.MeshQuery(Proto::Op::MeshMetrics, kBenchMesh, i);
+    });
+
+    RunScenario("edits", options, [n, &entities](unsigned connection, std::uint64_t iteration, Proto::BatchWriter& writer) {
+        Proto::TransformData transform;
+        for (std::uint32_t i = 0; i < n; ++i) {
+            const std::size_t index = (iteration * n + i + connection * 997) % entities.size();
+            transform.position[0] = static_cast<float>(index % 64) * 200.0f;
+            transform.position[1] = static_cast<float>(index / 64) * 200.0f;
+            transform.position[2] = static_cast<float>(iteration % 100);
+            writer.SetTransform(entities[index], transform, i);
+        }
+        writer.QueryBounds(Proto::BoundsResult{ { 0.0f, 0.0f, -1.0f }, { 1000.0f, 1000.0f, 200.0f } }, n);
+    });
+
+    if (server.IsRunning()) {
+        const Bridge::ServerStats stats = server.GetStats();
+        std::printf("[server  ] batches %llu  ops %llu  rejected %llu  in %.1f MB  out %.1f MB\n",
+                    static_cast<unsigned long long>(stats.batches), static_cast<unsigned long long>(stats.ops),
+                    static_cast<unsigned long long>(stats.rejected), stats.bytes_in / 1e6, stats.bytes_out / 1e6);
+        server.Stop();
+        Backend::Jobs::Shutdown();
+    }
+    return 0;
+}
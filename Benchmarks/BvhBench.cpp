@@ -0,0 +1,261 @@
+// Headless benchmark for Backend::Geometry::Bvh.
+// Usage: BvhBench [--grid=N] [--entities=N] [--workers=N]
+//
+//  - triangle BVH build over a noisy N x N terrain (2 N^2 triangles), serial
+//    vs on the job system, plus refit after the terrain moved
+//  - closest-hit Mrays/s for coherent (pinhole camera) and incoherent
+//    (random) rays, single thread and ParallelFor, checked against brute force
+//  - entity-bounds BVH: build, refit, frustum and box queries vs a linear scan
+
+#include "BenchSupport.h"
+#include "Geometry/Bvh.h"
+#include "Geometry/Terrain.h"
+#include "Jobs/JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using Bench::Clock;
+using Bench::SecondsSince;
+namespace Jobs = Backend::Jobs;
+namespace Geo = Backend::Geometry;
+
+namespace {
+
+    // Reference closest hit for validation (same Moller-Trumbore as the BVH)
+    float BruteForce(const Geo::MeshView& mesh, const Geo::Ray& ray) {
+        float best = ray.t_max;
+        for (std::size_t t = 0; t < mesh.triangle_count; ++t) {
+            const glm::vec3 a(mesh.x[mesh.i0[t]], mesh.y[mesh.i0[t]], mesh.z[mesh.i0[t]]);
+            const glm::vec3 e1 = glm::vec3(mesh.x[mesh.i1[t]], mesh.y[mesh.i1[t]], mesh.z[mesh.i1[t]]) - a;
+            const glm::vec3 e2 = glm::vec3(mesh.x[mesh.i2[t]], mesh.y[mesh.i2[t]], mesh.z[mesh.i2[t]]) - a;
+            const glm::vec3 p = glm::cross(ray.direction, e2);
+            const float det = glm::dot(e1, p);
+            if (std::abs(det) < 1e-20f) continue;
+            const glm::vec3 s = ray.origin - a;
+            const float u = glm::dot(s, p) / det;
+            const glm::vec3 q = glm::cross(s, e1);
+            const float v = glm::dot(ray.direction, q) / det;
+            const float hit = glm::dot(e2, q) / det;
+            if (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && hit >= ray.t_min && hit < best) best = hit;
+        }
+        return best;
+    }
+
+    std::vector<Geo::Ray> CameraRays(int n, int width, int height) {
+        std::vector<Geo::Ray> rays;
+        rays.reserve(static_cast<std::size_t>(width) * height);
+        const glm::vec3 eye(n * 0.5f, n * 0.35f, -n * 0.25f);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                const float u = (x + 0.5f) / width * 2.0f - 1.0f;
+                const float v = (y + 0.5f) / height * 2.0f - 1.0f;
+                Geo::Ray ray;
+                ray.origin = eye;
+                ray.direction = glm::vec3(u, -0.6f + 0.4f * v, 1.0f);
+                rays.push_back(ray);
+            }
+        }
+        return rays;
+    }
+
+    std::vector<Geo::Ray> RandomRays(int n, std::size_t count, std::mt19937& rng) {
+        std::uniform_real_distribution<float> pos(0.0f, static_cast<float>(n));
+        std::uniform_real_distribution<float> dir(-1.0f, 1.0f);
+        std::vector<Geo::Ray> rays(count);
+        for (Geo::Ray& ray : rays) {
+            ray.origin = glm::vec3(pos(rng), 20.0f, pos(rng));
+            ray.direction = glm::vec3(dir(rng), -0.2f - std::abs(dir(rng)), dir(rng));
+        }
+        return rays;
+    }
+
+    void BenchBuild(const char* label, const Geo::MeshView& mesh, Geo::TriangleBvh& bvh) {
+        const auto start = Clock::now();
+        bvh.Build(mesh);
+        const double seconds = SecondsSince(start);
+        const Geo::BvhStats stats = bvh.Hierarchy().ComputeStats();
+        std::printf("[build]    %-9s %zu tris in %8.1f ms (%6.2f Mtris/s)  nodes %zu  leaves %zu  depth %u  SAH %.1f\n",
+                    label, mesh.triangle_count, seconds * 1e3, mesh.triangle_count / seconds / 1e6,
+                    stats.node_count, stats.leaf_count, stats.max_depth, stats.sah_cost);
+    }
+
+    void BenchRays(const char* label, const Geo::TriangleBvh& bvh, const std::vector<Geo::Ray>& rays) {
+        std::size_t hits = 0;
+        auto start = Clock::now();
+        for (const Geo::Ray& ray : rays) {
+            Geo::RayHit hit;
+            hits += bvh.Raycast(ray, hit) ? 1 : 0;
+        }
+        const double single = SecondsSince(start);
+
+        std::atomic<std::size_t> parallel_hits{ 0 };
+        start = Clock::now();
+        Jobs::ParallelFor(0, rays.size(), 4096, [&](std::size_t lo, std::size_t hi) {
+            std::size_t local = 0;
+            for (std::size_t i = lo; i < hi; ++i) {
+                Geo::RayHit hit;
+                local += bvh.Raycast(rays[i], hit) ? 1 : 0;
+            }
+            parallel_hits.fetch_add(local, std::memory_order_relaxed);
+        });
+        const double parallel = SecondsSince(start);
+
+        std::printf("[rays]     %-11s %zu rays, %5.1f%% hit  1 thread %7.2f Mrays/s  %u threads %7.2f Mrays/s\n",
+                    label, rays.size(), 100.0 * hits / rays.size(), rays.size() / single / 1e6,
+                    Jobs::ThreadCount(), rays.size() / parallel / 1e6);
+        if (parallel_hits.load() != hits) {
+            std::printf("[rays]     MISMATCH: parallel pass hit %zu rays, serial %zu\n", parallel_hits.load(), hits);
+        }
+    }
+
+    void Validate(const Geo::TriangleBvh& bvh, const std::vector<Geo::Ray>& rays) {
+        int mismatches = 0;
+        for (const Geo::Ray& ray : rays) {
+            Geo::RayHit hit;
+            const float got = bvh.Raycast(ray, hit) ? hit.t : ray.t_max;
+            const float expected = BruteForce(bvh.Mesh(), ray);
+            if (std::abs(got - expected) > 1e-4f * std::max(1.0f, expected)) ++mismatches;
+        }
+        std::printf("[validate] %zu rays vs brute force: %s (%d mismatches)\n",
+                    rays.size(), mismatches ? "FAILED" : "ok", mismatches);
+    }
+
+    // ============================================================================
+    // ENTITY BOUNDS
+    // ============================================================================
+
+    // Pyramid looking down +z from `eye`, 90 degree opening, far plane at `range`
+    Geo::Frustum MakeFrustum(const glm::vec3& eye, float range) {
+        const float k = 0.70710678f;
+        Geo::Frustum frustum;
+        frustum.planes[0] = glm::vec4(k, 0.0f, k, -(k * eye.x + k * eye.z));
+        frustum.planes[1] = glm::vec4(-k, 0.0f, k, -(-k * eye.x + k * eye.z));
+        frustum.planes[2] = glm::vec4(0.0f, k, k, -(k * eye.y + k * eye.z));
+        frustum.planes[3] = glm::vec4(0.0f, -k, k, -(-k * eye.y + k * eye.z));
+        frustum.planes[4] = glm::vec4(0.0f, 0.0f, 1.0f, -(eye.z + 0.1f));
+        frustum.planes[5] = glm::vec4(0.0f, 0.0f, -1.0f, eye.z + range);
+        return frustum;
+    }
+
+    bool BoxInFrustum(const Geo::Frustum& frustum, const Geo::Aabb& box) {
+        for (const glm::vec4& plane : frustum.planes) {
+            const glm::vec3 p(plane.x >= 0.0f ? box.max.x : box.min.x,
+                              plane.y >= 0.0f ? box.max.y : box.min.y,
+                              plane.z >= 0.0f ? box.max.z : box.min.z);
+            if (plane.x * p.x + plane.y * p.y + plane.z * p.z + plane.w < 0.0f) return false;
+        }
+        return true;
+    }
+
+    void BenchEntities(std::size_t count, std::mt19937& rng) {
+        std::uniform_real_distribution<float> pos(-1000.0f, 1000.0f);
+        std::uniform_real_distribution<float> size(0.5f, 4.0f);
+        std::vector<Geo::Aabb> boxes(count);
+        for (Geo::Aabb& box : boxes) {
+            const glm::vec3 c(pos(rng), pos(rng) * 0.1f, pos(rng));
+            const glm::vec3 e(size(rng), size(rng), size(rng));
+            box.min = c - e;
+            box.max = c + e;
+        }
+
+        Geo::Bvh bvh;
+        auto start = Clock::now();
+        bvh.Build(boxes);
+        const double build = SecondsSince(start);
+
+        // Every entity moves a little: refit keeps the topology
+        std::uniform_real_distribution<float> step(-2.0f, 2.0f);
+        for (Geo::Aabb& box : boxes) {
+            const glm::vec3 d(step(rng), step(rng), step(rng));
+            box.min = box.min + d;
+            box.max = box.max + d;
+        }
+        start = Clock::now();
+        bvh.Refit(boxes);
+        const double refit = SecondsSince(start);
+        std::printf("[entities] %zu boxes  build %.1f ms  refit %.1f ms\n", count, build * 1e3, refit * 1e3);
+
+        const Geo::Frustum frustum = MakeFrustum(glm::vec3(0.0f, 0.0f, -1000.0f), 600.0f);
+        std::size_t visible = 0;
+        start = Clock::now();
+        bvh.QueryFrustum(frustum, [&](std::uint32_t) { ++visible; });
+        const double culled = SecondsSince(start);
+        std::size_t expected = 0;
+        start = Clock::now();
+        for (const Geo::Aabb& box : boxes) {
+            expected += BoxInFrustum(frustum, box) ? 1 : 0;
+        }
+        const double linear = SecondsSince(start);
+        std::printf("[frustum]  %zu visible (linear %zu)  bvh %.3f ms  linear %.3f ms\n",
+                    visible, expected, culled * 1e3, linear * 1e3);
+
+        Geo::Aabb query;
+        query.min = glm::vec3(-50.0f, -50.0f, -50.0f);
+        query.max = glm::vec3(50.0f, 50.0f, 50.0f);
+        constexpr int kQueries = 1000;
+        std::size_t found = 0;
+        start = Clock::now();
+        for (int i = 0; i < kQueries; ++i) {
+            bvh.QueryAabb(query, [&](std::uint32_t) { ++found; });
+        }
+        const double box_query = SecondsSince(start) / kQueries;
+        std::printf("[aabb]     %zu overlaps per query  %.2f us/query\n", found / kQueries, box_query * 1e6);
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int grid = 1024;
+    std::size_t entities = 1u << 20;
+    unsigned workers = 0;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg.rfind("--grid=", 0) == 0) grid = std::max(1, std::atoi(arg.c_str() + 7));
+        if (arg.rfind("--entities=", 0) == 0) entities = std::strtoull(arg.c_str() + 11, nullptr, 10);
+        if (arg.rfind("--workers=", 0) == 0) workers = static_cast<unsigned>(std::atoi(arg.c_str() + 10));
+    }
+
+    Geo::TerrainOptions shape;
+    shape.cells = static_cast<std::uint32_t>(grid);
+    Geo::MeshSoA terrain = Geo::MakeTerrain(shape);
+    const Geo::MeshView view = terrain.View();
+
+    // Before Initialize every job runs inline, which gives the serial baseline
+    Geo::TriangleBvh bvh;
+    BenchBuild("serial", view, bvh);
+
+    Jobs::JobSystemConfig config;
+    config.worker_count = workers;
+    Jobs::Initialize(config);
+    BenchBuild("parallel", view, bvh);
+
+    std::mt19937 rng(1234);
+    BenchRays("coherent", bvh, CameraRays(grid, 1024, 1024));
+    const std::vector<Geo::Ray> random_rays = RandomRays(grid, 1u << 20, rng);
+    BenchRays("incoherent", bvh, random_rays);
+    Validate(bvh, std::vector<Geo::Ray>(random_rays.begin(), random_rays.begin() + 32));
+
+    // Deform the terrain in place and refit instead of rebuilding
+    shape.phase = 0.7f;
+    for (std::size_t v = 0; v < terrain.VertexCount(); ++v) {
+        terrain.y[v] = Geo::TerrainHeight(shape, terrain.x[v], terrain.z[v]);
+    }
+    auto start = Clock::now();
+    bvh.Refit();
+    std::printf("[refit]    %zu tris in %.1f ms\n", view.triangle_count, SecondsSince(start) * 1e3);
+    BenchRays("refitted", bvh, random_rays);
+    Validate(bvh, std::vector<Geo::Ray>(random_rays.begin(), random_rays.begin() + 32));
+
+    if (entities > 0) BenchEntities(entities, rng);
+
+    Jobs::Shutdown();
+    return 0;
+}
@@ -0,0 +1,314 @@
+// Engine benchmark suite with machine-readable results.
+// Usage: GeometryEngineBench [--json=results.json] [--warmup=N] [--iterations=N]
+//                            [--filter=geometry/] [--quick] [--no-frame] [--list]
+//
+//  - geometry: mesh kernels per dispatch level, parallel metrics, normals,
+//    bounds, BVH builds, simplification and the shared primitive batches
+//  - serialization: JSON documents, SceneJournal saves, mesh files and the
+//    Bridge batch protocol
+//  - frame: WindowSetup's headless frame loop (BeginFrame .. Render) around
+//    a fixed ImGui workload; skipped when no offscreen context is available
+//
+// Every benchmark reports min/median/p90/stddev over the measured
+// iterations. Compare two --json outputs with BenchCompare.
+
+#include "Geometry/Bvh.h"
+#include "Geometry/MeshKernels.h"
+#include "Geometry/Primitives.h"
+#include "Geometry/Simplify.h"
+#include "Geometry/Terrain.h"
+#include "IO/MeshFile.h"
+#include "IO/MeshWriter.h"
+#include "IO/SceneJournal.h"
+#include "Jobs/JobSystem.h"
+#include "Scene/Scene.h"
+#include "BatchProcessor.h"
+#include "WindowSetup.h"
+
+#include "BenchSuite.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Geo = Backend::Geometry;
+namespace IO = Backend::IO;
+namespace Jobs = Backend::Jobs;
+namespace Prim = Shared::Geometry;
+namespace Proto = Bridge::Protocol;
+
+namespace {
+
+    constexpr std::uint32_t kTerrainCells = 512;        // 524k triangles
+    constexpr std::uint32_t kSimplifyCells = 128;       // 32k triangles
+    constexpr std::size_t kShapeCount = 1u << 20;
+    constexpr std::size_t kSceneEntities = 10000;
+    constexpr int kFramesPerIteration = 30;
+
+    // Emptied first so no journal or mesh file of an earlier run is reused
+    std::filesystem::path ScratchDir() {
+        const std::filesystem::path dir = std::filesystem::temp_directory_path() / "GeometryEngineBench";
+        std::error_code ignored;
+        std::filesystem::remove_all(dir, ignored);
+        std::filesystem::create_directories(dir);
+        return dir;
+    }
+
+    // ============================================================================
+    // GEOMETRY
+    // ============================================================================
+
+    void BenchGeometry(Bench::Suite& suite) {
+        const Geo::MeshSoA terrain = Geo::MakeTerrain(kTerrainCells);
+        const Geo::MeshView view = terrain.View();
+        const auto tris = static_cast<double>(view.triangle_count);
+
+        // Every level up to the best one this CPU supports, then back to it
+        const Geo::KernelLevel best = Geo::GetSupportedKernelLevel();
+        for (int level = 0; level <= static_cast<int>(best); ++level) {
+            const auto kernel = static_cast<Geo::KernelLevel>(level);
+            Geo::SetKernelLevel(kernel);
+            suite.Run(std::string("geometry/metrics_") + Geo::KernelLevelName(kernel), tris, [&] {
+                Bench::DoNotOptimize(Geo::ComputeMetrics(view));
+            });
+        }
+        Geo::SetKernelLevel(best);
+
+        suite.Run("geometry/metrics_parallel", tris, [&] {
+            Bench::DoNotOptimize(Geo::ComputeMetricsParallel(view));
+        });
+
+        std::vector<float> areas(view.triangle_count);
+        suite.Run("geometry/triangle_areas", tris, [&] {
+            Geo::ComputeTriangleAreas(view, 0, view.triangle_count, areas);
+            Bench::DoNotOptimize(areas.data());
+        });
+
+        std::vector<float> nx(view.vertex_count), ny(view.vertex_count), nz(view.vertex_count);
+        suite.Run("geometry/vertex_normals", static_cast<double>(view.vertex_count), [&] {
+            Geo::ComputeVertexNormals(view, nx, ny, nz);
+            Bench::DoNotOptimize(nx.data());
+        });
+
+        suite.Run("geometry/bounds", static_cast<double>(view.vertex_count), [&] {
+            Bench::DoNotOptimize(Geo::ComputeBounds(view));
+        });
+
+        suite.Run("geometry/triangle_bvh_build", tris, [&] {
+            Geo::TriangleBvh bvh;
+            bvh.Build(view);
+            Bench::DoNotOptimize(bvh);
+        });
+
+        // One box per 4x4 cell block, like scene objects over a terrain
+        std::vector<Geo::Aabb> boxes;
+        for (std::uint32_t y = 0; y < kTerrainCells; y += 4) {
+            for (std::uint32_t x = 0; x < kTerrainCells; x += 4) {
+                Geo::Aabb box;
+                box.Expand(glm::vec3(static_cast<float>(x), -8.0f, static_cast<float>(y)));
+                box.Expand(glm::vec3(static_cast<float>(x + 4), 8.0f, static_cast<float>(y + 4)));
+                boxes.push_back(box);
+            }
+        }
+        suite.Run("geometry/bvh_build", static_cast<double>(boxes.size()), [&] {
+            Geo::Bvh bvh;
+            bvh.Build(boxes);
+            Bench::DoNotOptimize(bvh);
+        });
+
+        const Geo::MeshSoA small = Geo::MakeTerrain(kSimplifyCells);
+        Geo::SimplifyOptions simplify;
+        simplify.target_ratio = 0.1f;
+        suite.Run("geometry/simplify_10pct", static_cast<double>(small.TriangleCount()), [&] {
+            Bench::DoNotOptimize(Geo::Simplify(small.View(), simplify));
+        });
+
+        // Shared primitives: Triangle batches over SoA fields
+        std::vector<double> fields[5];
+        for (std::size_t k = 0; k < 5; ++k) {
+            fields[k].resize(kShapeCount);
+            for (std::size_t i = 0; i < kShapeCount; ++i) fields[k][i] = 1.0 + static_cast<double>((i * (k + 3)) % 97);
+        }
+        const Prim::FieldSpans<Prim::Triangle<>> spans = { fields[0], fields[1], fields[2], fields[3], fields[4] };
+        std::vector<double> out_areas(kShapeCount), out_perimeters(kShapeCount);
+        suite.Run("geometry/shape_metrics_triangle", static_cast<double>(kShapeCount), [&] {
+            Prim::ComputeMetrics<Prim::Triangle<>>(spans, out_areas, out_perimeters);
+            Bench::DoNotOptimize(out_areas.data());
+        });
+    }
+
+    // ============================================================================
+    // SERIALIZATION
+    // ============================================================================
+
+    nlohmann::json MakeDocument(std::size_t entities) {
+        nlohmann::json doc;
+        doc["version"] = 1;
+        nlohmann::json& list = doc["entities"] = nlohmann::json::array();
+        for (std::size_t i = 0; i < entities; ++i) {
+            const float f = static_cast<float>(i);
+            list.push_back({
+                { "id", i },
+                { "name", "Entity_" + std::to_string(i) },
+                { "position", { f * 0.5f, f * 0.25f, -f } },
+                { "rotation", { 0.0f, f * 3.0f, 0.0f } },
+                { "scale", { 1.0f, 1.0f, 1.0f } },
+                { "mesh", static_cast<int>(i % 64) }
+            });
+        }
+        return doc;
+    }
+
+    void BenchSerialization(Bench::Suite& suite) {
+        const auto entities = static_cast<double>(kSceneEntities);
+        const nlohmann::json doc = MakeDocument(kSceneEntities);
+        const std::string text = doc.dump();
+
+        suite.Run("serialization/json_dump", entities, [&] {
+            Bench::DoNotOptimize(doc.dump());
+        });
+        suite.Run("serialization/json_parse", entities, [&] {
+            Bench::DoNotOptimize(nlohmann::json::parse(text));
+        });
+
+        const std::filesystem::path dir = ScratchDir();
+
+        // Incremental save: every entity moved since the last one
+        {
+            Backend::Scene scene;
+            scene.Reserve(kSceneEntities);
+            std::vector<Backend::Entity> handles;
+            handles.reserve(kSceneEntities);
+            for (std::size_t i = 0; i < kSceneEntities; ++i) {
+                Backend::Transform transform;
+                transform.position = glm::vec3(static_cast<float>(i), 0.0f, 0.0f);
+                handles.push_back(scene.CreateEntity("Entity_" + std::to_string(i), transform));
+            }
+            IO::SceneJournal journal;
+            if (journal.Open((dir / "journal").string())) {
+                journal.Save(scene);
+                journal.Flush();
+                suite.Run("serialization/journal_save", entities, [&] {
+                    for (const Backend::Entity entity : handles) {
+                        scene.GetTransform(entity).position.y += 1.0f;
+                        scene.MarkDirty(entity, Backend::kDirtyTransform);
+                    }
+                    journal.Save(scene);
+                    journal.Flush();
+                });
+                journal.Close();
+            } else {
+                suite.Skip("serialization/journal_save", journal.LastError());
+            }
+        }
+
+        const Geo::MeshSoA mesh = Geo::MakeTerrain(kTerrainCells / 2);
+        const std::string mesh_path = (dir / "terrain.gemesh").string();
+        const auto tris = static_cast<double>(mesh.TriangleCount());
+        suite.Run("serialization/mesh_write", tris, [&] {
+            Bench::DoNotOptimize(IO::WriteMeshFile(mesh_path, mesh));
+        });
+        suite.Run("serialization/mesh_load", tris, [&] {
+            IO::MeshFile file;
+            if (file.Open(mesh_path)) Bench::DoNotOptimize(file.LoadLod(0));
+        });
+
+        // Encode, execute and decode one Bridge batch of shape queries
+        constexpr std::uint32_t kShapes = 1u << 16;
+        std::vector<double> radii(kShapes);
+        for (std::uint32_t i = 0; i < kShapes; ++i) radii[i] = 0.5 + static_cast<double>(i % 113);
+        Bridge::BatchProcessor processor;
+        Proto::BatchWriter writer;
+        suite.Run("serialization/bridge_shape_batch", static_cast<double>(kShapes), [&] {
+            writer.Clear();
+            writer.ShapeMetrics(Proto::ShapeKind::Circle, kShapes, radii);
+            Bridge::BatchCursor cursor;
+            if (!processor.Parse(writer.Bytes(), cursor)) return;
+            while (!cursor.Done()) {
+                Proto::ResultReader reader(processor.Step(cursor));
+                Proto::ResultReader::Result result;
+                while (reader.Next(result)) Bench::DoNotOptimize(result.payload.data());
+            }
+        });
+
+        std::error_code ignored;
+        std::filesystem::remove_all(dir, ignored);
+    }
+
+    // ============================================================================
+    // FRAME LOOP
+    // ============================================================================
+
+    // One sample is kFramesPerIteration frames of the demo window, so the
+    // numbers are the per-iteration cost of the loop plus a fixed UI load
+    void BenchFrame(Bench::Suite& suite) {
+        const char* name = "frame/headless_demo_window";
+        if (!suite.Selected(name)) return;
+        if (!suite.GetOptions().frame) {
+            suite.Skip(name, "--no-frame");
+            return;
+        }
+        if (suite.GetOptions().list) {
+            std::printf("%s\n", name);
+            return;
+        }
+
+        WindowSetup::WindowConfig config;
+        config.title = "GeometryEngineBench";
+        config.width = 1280;
+        config.height = 720;
+        config.headless = true;
+        config.vsync = WindowSetup::VSyncMode::Disabled;
+        config.log_initialization = false;
+        config.assert_on_error = false;
+        if (!WindowSetup::Initialize(config)) {
+            suite.Skip(name, "no headless GL context");
+            return;
+        }
+
+        auto frames = [](int count) {
+            for (int i = 0; i < count; ++i) {
+                WindowSetup::BeginFrame();
+                ImGui::ShowDemoWindow();
+                WindowSetup::EndFrame();
+                WindowSetup::Render();
+            }
+        };
+        suite.Run(name, kFramesPerIteration, [&] { frames(kFramesPerIteration); });
+        WindowSetup::Shutdown();
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const Bench::Options options = Bench::ParseArgs(argc, argv);
+    Bench::Suite suite(options);
+    suite.SetInfo("threads", std::thread::hardware_concurrency());
+    suite.SetInfo("kernel_level", Geo::KernelLevelName(Geo::GetSupportedKernelLevel()));
+    suite.SetInfo("warmup", options.warmup);
+    suite.SetInfo("iterations", options.iterations);
+
+    if (!options.list) {
+        std::printf("GeometryEngineBench: %d warm-up + %d measured iterations, kernels up to %s\n\n", options.warmup,
+                    options.iterations, Geo::KernelLevelName(Geo::GetSupportedKernelLevel()));
+    }
+
+    // Before the job system starts so the frame group sees a quiet machine
+    BenchFrame(suite);
+
+    Jobs::Initialize();
+    BenchGeometry(suite);
+    BenchSerialization(suite);
+    Jobs::Shutdown();
+
+    if (!options.json_path.empty()) {
+        if (!suite.WriteJson(options.json_path)) {
+            std::fprintf(stderr, "Cannot write %s\n", options.json_path.c_str());
+            return 1;
+        }
+        std::printf("\nWrote %zu results to %s\n", suite.Results().size(), options.json_path.c_str());
+    }
+    return 0;
+}
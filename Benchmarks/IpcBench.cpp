@@ -0,0 +1,257 @@
+// Same-host transport comparison: Bridge shared-memory channel vs localhost TCP.
+// Usage: IpcBench [--ring=MB] [--max=MB]
+//
+// A forked child echoes every message back; the parent measures round trips
+// for payloads from 1 KB to 256 MB over both transports. TCP frames each
+// message with an 8-byte length, the shared-memory channel needs no framing.
+// POSIX only (fork, sockets, shm_open).
+
+#include "BenchSupport.h"
+#include "ShmChannel.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+
+int main() {
+    std::printf("IpcBench: not supported on Windows\n");
+    return 0;
+}
+
+#else
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using Bench::Clock;
+using Bench::Percentile;
+
+namespace {
+
+    struct Result {
+        double p50_us = 0.0;
+        double p99_us = 0.0;
+        double gbps = 0.0;      // Payload bytes moved per second, both directions
+    };
+
+    int IterationsFor(std::size_t bytes) {
+        // ~1 GB per size, at least a handful of samples for the big ones
+        return static_cast<int>(std::clamp<std::size_t>((1ull << 30) / bytes, 5, 20000));
+    }
+
+    template <typename RoundTrip>
+    Result Measure(std::size_t bytes, RoundTrip&& round_trip) {
+        const int iterations = IterationsFor(bytes);
+        std::vector<double> samples;
+        samples.reserve(iterations);
+        round_trip();   // Warm up: page in buffers and ring
+        const auto start = Clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            const auto t0 = Clock::now();
+            if (!round_trip()) {
+                std::fprintf(stderr, "IpcBench: transport failed at %zu bytes\n", bytes);
+                std::exit(1);
+            }
+            samples.push_back(std::chrono::duration<double, std::micro>(Clock::now() - t0).count());
+        }
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        Result result;
+        result.p50_us = Percentile(samples, 0.50);
+        result.p99_us = Percentile(samples, 0.99);
+        result.gbps = 2.0 * static_cast<double>(bytes) * iterations / seconds / 1e9;
+        return result;
+    }
+
+    // ============================================================================
+    // TCP
+    // ============================================================================
+
+    bool SendAll(int fd, const void* data, std::size_t size) {
+        const char* p = static_cast<const char*>(data);
+        while (size) {
+            const ssize_t n = ::send(fd, p, size, MSG_NOSIGNAL);
+            if (n <= 0) return false;
+            p += n;
+            size -= static_cast<std::size_t>(n);
+        }
+        return true;
+    }
+
+    bool RecvAll(int fd, void* data, std::size_t size) {
+        char* p = static_cast<char*>(data);
+        while (size) {
+            const ssize_t n = ::recv(fd, p, size, 0);
+            if (n <= 0) return false;
+            p += n;
+            size -= static_cast<std::size_t>(n);
+        }
+        return true;
+    }
+
+    void TuneSocket(int fd) {
+        const int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        const int buffer = 4 << 20;
+        setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &buffer, sizeof(buffer));
+        setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &buffer, sizeof(buffer));
+    }
+
+    void TcpEchoServer(int listener) {
+        const int fd = ::accept(listener, nullptr, nullptr);
+        if (fd < 0) return;
+        TuneSocket(fd);
+        std::vector<char> buffer;
+        std::uint64_t size = 0;
+        while (RecvAll(fd, &size, sizeof(size))) {
+            buffer.resize(size);
+            if (!RecvAll(fd, buffer.data(), size)) break;
+            if (!SendAll(fd, &size, sizeof(size)) || !SendAll(fd, buffer.data(), size)) break;
+        }
+        ::close(fd);
+    }
+
+    // ============================================================================
+    // SHARED MEMORY
+    // ============================================================================
+
+    void ShmEchoServer(Bridge::ShmChannel& channel) {
+        channel.WaitForClient();
+        std::span<const std::byte> message;
+        while (channel.Receive(message)) {
+            if (!channel.Send(message)) break;
+            channel.Consume();
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t ring_bytes = Bridge::ShmChannel::kDefaultRingBytes;
+    std::size_t max_bytes = 256ull << 20;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg.rfind("--ring=", 0) == 0) ring_bytes = std::strtoull(arg.c_str() + 7, nullptr, 10) << 20;
+        if (arg.rfind("--max=", 0) == 0) max_bytes = std::strtoull(arg.c_str() + 6, nullptr, 10) << 20;
+    }
+    const std::string shm_name = "ge_ipcbench_" + std::to_string(getpid());
+
+    // Listening socket before fork so the port is known to both sides
+    const int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addr_len = sizeof(addr);
+    if (listener < 0 || ::bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(listener, 1) != 0 || ::getsockname(listener, reinterpret_cast<sockaddr*>(&addr), &addr_len) != 0) {
+        std::perror("IpcBench: socket setup");
+        return 1;
+    }
+
+    int ready[2];
+    if (::pipe(ready) != 0) return 1;
+
+    const pid_t child = ::fork();
+    if (child == 0) {
+        // Echo process: shared memory first, then TCP
+        ::close(ready[0]);
+        Bridge::ShmChannel host;
+        const char ok = host.Create(shm_name, ring_bytes) ? 1 : 0;
+        (void)!::write(ready[1], &ok, 1);
+        ::close(ready[1]);
+        if (ok) ShmEchoServer(host);
+        host.Close();
+        TcpEchoServer(listener);
+        ::close(listener);
+        std::_Exit(0);
+    }
+    ::close(ready[1]);
+
+    char ok = 0;
+    if (::read(ready[0], &ok, 1) != 1 || !ok) {
+        std::fprintf(stderr, "IpcBench: shared-memory host failed to start\n");
+        return 1;
+    }
+    ::close(ready[0]);
+
+    std::vector<std::size_t> sizes;
+    for (std::size_t size = 1024; size <= max_bytes; size *= 4) {
+        sizes.push_back(size);
+    }
+
+    // Payload with a pattern so the echo is checked, not just timed
+    std::vector<std::byte> payload(sizes.back());
+    for (std::size_t i = 0; i < payload.size(); ++i) {
+        payload[i] = static_cast<std::byte>(i * 131 + 7);
+    }
+
+    std::vector<Result> shm_results;
+    {
+        Bridge::ShmChannel client;
+        if (!client.Connect(shm_name)) {
+            std::fprintf(stderr, "IpcBench: %s\n", client.Error().c_str());
+            return 1;
+        }
+        for (const std::size_t size : sizes) {
+            const std::span<const std::byte> message(payload.data(), size);
+            shm_results.push_back(Measure(size, [&] {
+                std::span<const std::byte> echo;
+                const bool good = client.Send(message) && client.Receive(echo) &&
+                                  echo.size() == size && echo.back() == message.back();
+                client.Consume();
+                return good;
+            }));
+        }
+        client.Close();
+    }
+
+    std::vector<Result> tcp_results;
+    {
+        const int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0 || ::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+            std::perror("IpcBench: connect");
+            return 1;
+        }
+        TuneSocket(fd);
+        std::vector<std::byte> echo(sizes.back());
+        for (const std::size_t size : sizes) {
+            tcp_results.push_back(Measure(size, [&] {
+                std::uint64_t length = size;
+                return SendAll(fd, &length, sizeof(length)) && SendAll(fd, payload.data(), size) &&
+                       RecvAll(fd, &length, sizeof(length)) && length == size &&
+                       RecvAll(fd, echo.data(), size) && echo[size - 1] == payload[size - 1];
+            }));
+        }
+        ::close(fd);
+    }
+    ::close(listener);
+    ::waitpid(child, nullptr, 0);
+
+    std::printf("IpcBench: echo round trips, shm ring %zu MB per direction\n", ring_bytes >> 20);
+    std::printf("%10s  %12s %12s %9s   %12s %12s %9s   %7s\n",
+                "payload", "shm p50 us", "shm p99 us", "shm GB/s", "tcp p50 us", "tcp p99 us", "tcp GB/s", "speedup");
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        const Result& s = shm_results[i];
+        const Result& t = tcp_results[i];
+        char label[32];
+        if (sizes[i] >= (1u << 20)) {
+            std::snprintf(label, sizeof(label), "%zu MB", sizes[i] >> 20);
+        } else {
+            std::snprintf(label, sizeof(label), "%zu KB", sizes[i] >> 10);
+        }
+        std::printf("%10s  %12.1f %12.1f %9.2f   %12.1f %12.1f %9.2f   %6.2fx\n",
+                    label, s.p50_us, s.p99_us, s.gbps, t.p50_us, t.p99_us, t.gbps, t.p50_us / s.p50_us);
+    }
+    return 0;
+}
+
+#endif
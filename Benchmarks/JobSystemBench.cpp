@@ -0,0 +1,134 @@
+// Headless micro-benchmark for Backend::Jobs.
+// Usage: JobSystemBench [worker_count]
+//
+//  - spawn throughput: empty jobs submitted from worker 0
+//  - wake latency: Run() to job start on an idle pool
+//  - ParallelFor bandwidth over a large float array
+//  - mesh metrics over a synthetic grid, serial vs parallel
+
+#include "BenchSupport.h"
+#include "Jobs/JobSystem.h"
+#include "Geometry/MeshKernels.h"
+#include "Geometry/Terrain.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using Bench::Clock;
+using Bench::SecondsSince;
+using Bench::Percentile;
+namespace Jobs = Backend::Jobs;
+namespace Geo = Backend::Geometry;
+
+namespace {
+
+    void BenchSpawnThroughput() {
+        constexpr int kJobs = 1 << 20;
+        std::atomic<int> ran{ 0 };
+        Jobs::JobCounter counter;
+
+        const auto start = Clock::now();
+        for (int i = 0; i < kJobs; ++i) {
+            Jobs::Run([&ran]() { ran.fetch_add(1, std::memory_order_relaxed); }, &counter);
+        }
+        Jobs::Wait(counter);
+        const double seconds = SecondsSince(start);
+
+        std::printf("[spawn]       %d jobs in %.3f ms  -> %.2f Mjobs/s (%.1f ns/job)\n",
+                    kJobs, seconds * 1e3, kJobs / seconds / 1e6, seconds * 1e9 / kJobs);
+    }
+
+    void BenchWakeLatency() {
+        constexpr int kSamples = 2000;
+        std::vector<double> samples;
+        samples.reserve(kSamples);
+
+        for (int i = 0; i < kSamples; ++i) {
+            // Let workers go idle so we measure the sleep -> wake path too
+            if (i % 64 == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+            std::atomic<long long> started_ns{ 0 };
+            Jobs::JobCounter counter;
+            const auto submit = Clock::now();
+            Jobs::Run([&started_ns, submit]() {
+                started_ns.store(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - submit).count(),
+                                 std::memory_order_relaxed);
+            }, &counter);
+            Jobs::Wait(counter);
+            samples.push_back(static_cast<double>(started_ns.load()) / 1000.0);
+        }
+
+        const double p50 = Percentile(samples, 0.50);
+        const double p99 = Percentile(samples, 0.99);
+        const double max = *std::max_element(samples.begin(), samples.end());
+        std::printf("[latency]     run->start  p50 %.2f us  p99 %.2f us  max %.2f us\n", p50, p99, max);
+    }
+
+    void BenchParallelFor() {
+        constexpr std::size_t kCount = 64u << 20;   // 256 MB of floats
+        std::vector<float> data(kCount, 1.0f);
+
+        auto scale = [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) data[i] = data[i] * 1.0001f + 0.5f;
+        };
+
+        auto start = Clock::now();
+        scale(0, kCount);
+        const double serial = SecondsSince(start);
+
+        start = Clock::now();
+        Jobs::ParallelFor(0, kCount, 1 << 16, scale);
+        const double parallel = SecondsSince(start);
+
+        const double bytes = static_cast<double>(kCount) * sizeof(float) * 2.0;   // read + write
+        std::printf("[parallelfor] serial %.1f GB/s  parallel %.1f GB/s  speedup %.2fx\n",
+                    bytes / serial / 1e9, bytes / parallel / 1e9, serial / parallel);
+    }
+
+    void BenchMeshMetrics() {
+        const Geo::MeshSoA mesh = Geo::MakeTerrain(2048);   // ~8.4M triangles
+        const Geo::MeshView view = mesh.View();
+
+        auto start = Clock::now();
+        const Geo::MeshMetrics serial = Geo::ComputeMetrics(view);
+        const double serial_s = SecondsSince(start);
+
+        start = Clock::now();
+        const Geo::MeshMetrics parallel = Geo::ComputeMetricsParallel(view);
+        const double parallel_s = SecondsSince(start);
+
+        std::printf("[mesh]        %zu tris (%s)  serial %.1f Mtri/s  parallel %.1f Mtri/s  area %.1f / %.1f\n",
+                    view.triangle_count, Geo::KernelLevelName(Geo::GetKernelLevel()),
+                    view.triangle_count / serial_s / 1e6, view.triangle_count / parallel_s / 1e6,
+                    serial.surface_area, parallel.surface_area);
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Jobs::JobSystemConfig config;
+    if (argc > 1) {
+        config.worker_count = static_cast<unsigned>(std::strtoul(argv[1], nullptr, 10));
+    }
+    Jobs::Initialize(config);
+    std::printf("JobSystemBench: %u threads\n", Jobs::ThreadCount());
+
+    BenchSpawnThroughput();
+    BenchWakeLatency();
+    BenchParallelFor();
+    BenchMeshMetrics();
+
+    const Jobs::JobSystemStats stats = Jobs::GetStats();
+    std::printf("[stats]       executed %llu  stolen %llu  inlined %llu\n",
+                static_cast<unsigned long long>(stats.jobs_executed),
+                static_cast<unsigned long long>(stats.jobs_stolen),
+                static_cast<unsigned long long>(stats.jobs_inlined));
+
+    Jobs::Shutdown();
+    return 0;
+}
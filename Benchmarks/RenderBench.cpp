@@ -0,0 +1,161 @@
+// Headless benchmark for the Render submission path.
+// Usage: RenderBench [--items=N] [--meshes=N] [--materials=N] [--frames=N]
+//
+//  - sort: DrawKey radix sort vs std::sort over the same random draw list
+//  - submit: full frames through the Renderer on bgfx's Noop backend
+//    (no GPU), instanced batches vs one draw call per item
+
+#include "BenchSupport.h"
+#include "Render/Renderer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using Bench::Clock;
+using Bench::SecondsSince;
+namespace Render = Backend::Render;
+namespace Geo = Backend::Geometry;
+
+namespace {
+
+    struct Item {
+        std::uint32_t mesh;
+        std::uint32_t material;
+        glm::mat4 model;
+    };
+
+    std::vector<Item> MakeItems(std::size_t count, std::uint32_t meshes, std::uint32_t materials, std::mt19937& rng) {
+        std::uniform_int_distribution<std::uint32_t> mesh_dist(0, meshes - 1);
+        std::uniform_int_distribution<std::uint32_t> material_dist(0, materials - 1);
+        std::uniform_real_distribution<float> pos(-500.0f, 500.0f);
+        std::vector<Item> items(count);
+        for (Item& item : items) {
+            item.mesh = mesh_dist(rng);
+            item.material = material_dist(rng);
+            item.model = glm::mat4(1.0f);
+            item.model[3] = glm::vec4(pos(rng), pos(rng) * 0.1f, pos(rng), 1.0f);
+        }
+        return items;
+    }
+
+    void BenchSort(const std::vector<Item>& items, const Render::Camera& camera) {
+        std::vector<Render::SortEntry> entries(items.size());
+        for (std::size_t i = 0; i < items.size(); ++i) {
+            const glm::vec3 p(items[i].model[3].x, items[i].model[3].y, items[i].model[3].z);
+            entries[i] = { Render::DrawKey::Encode(0, 0, items[i].material, items[i].mesh, glm::length(p - camera.eye)),
+                           static_cast<std::uint32_t>(i) };
+        }
+
+        std::vector<Render::SortEntry> radix = entries;
+        std::vector<Render::SortEntry> scratch(entries.size());
+        auto start = Clock::now();
+        Render::RadixSort(radix, scratch);
+        const double radix_s = SecondsSince(start);
+
+        std::vector<Render::SortEntry> reference = entries;
+        start = Clock::now();
+        std::stable_sort(reference.begin(), reference.end(),
+                         [](const Render::SortEntry& a, const Render::SortEntry& b) { return a.key < b.key; });
+        const double std_s = SecondsSince(start);
+
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            mismatches += radix[i].index != reference[i].index;
+        }
+        std::printf("[sort]     %zu keys  radix %7.2f ms (%6.1f Mkeys/s)  std::stable_sort %7.2f ms  %s\n",
+                    entries.size(), radix_s * 1e3, entries.size() / radix_s * 1e-6, std_s * 1e3,
+                    mismatches == 0 ? "same order" : "MISMATCH");
+    }
+
+    void BenchSubmit(const char* label, bool instancing, const std::vector<Item>& items, std::uint32_t meshes,
+                     std::uint32_t materials, int frames, const Render::Camera& camera) {
+        Render::RendererConfig config;
+        config.backend = Render::RendererBackend::Noop;
+        config.instancing = instancing;
+        config.max_instances = static_cast<std::uint32_t>(items.size());
+
+        Render::Renderer renderer;
+        if (!renderer.Start(config)) {
+            std::printf("[submit]   %s: renderer failed to start: %s\n", label, renderer.Error().c_str());
+            return;
+        }
+
+        // Small box meshes; contents do not matter to Noop, only the handles
+        Geo::MeshSoA box;
+        for (int i = 0; i < 8; ++i) {
+            box.AddVertex(glm::vec3(float(i & 1), float((i >> 1) & 1), float((i >> 2) & 1)));
+        }
+        const std::uint32_t faces[12][3] = { {0,2,1},{1,2,3},{4,5,6},{5,7,6},{0,1,4},{1,5,4},
+                                             {2,6,3},{3,6,7},{0,4,2},{2,4,6},{1,3,5},{3,7,5} };
+        for (const auto& f : faces) box.AddTriangle(f[0], f[1], f[2]);
+        for (std::uint32_t m = 0; m < meshes; ++m) renderer.UploadMesh(m, box.View());
+        for (std::uint32_t m = 0; m < materials; ++m) {
+            renderer.SetMaterial(m, glm::vec4(float(m) / float(materials), 0.5f, 0.5f, 1.0f));
+        }
+        renderer.Flush();
+
+        double build_s = 0.0;
+        double sort_ms = 0.0;
+        double submit_ms = 0.0;
+        double frame_ms = 0.0;
+        Render::RendererStats stats;
+        const auto start = Clock::now();
+        for (int frame = 0; frame < frames; ++frame) {
+            const auto build_start = Clock::now();
+            Render::DrawList& list = renderer.BeginFrame();
+            list.SetCamera(camera);
+            list.Reserve(items.size());
+            for (const Item& item : items) list.Add(item.mesh, item.material, item.model);
+            build_s += SecondsSince(build_start);
+            renderer.EndFrame();
+
+            // One frame in flight at a time so every list is measured
+            renderer.Flush();
+            stats = renderer.GetStats();
+            sort_ms += stats.sort_ms;
+            submit_ms += stats.submit_ms;
+            frame_ms += stats.frame_ms;
+        }
+        const double total_s = SecondsSince(start);
+
+        std::printf("[submit]   %-9s %u batches  %u draw calls  %u skipped | per frame: build %.2f  sort %.2f  "
+                    "submit %.2f  bgfx::frame %.2f ms | %.1f Mitems/s\n",
+                    label, stats.batches, stats.draw_calls, stats.skipped_items, build_s * 1e3 / frames,
+                    sort_ms / frames, submit_ms / frames, frame_ms / frames,
+                    items.size() * static_cast<double>(frames) / total_s * 1e-6);
+        renderer.Stop();
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t item_count = 1u << 18;
+    std::uint32_t meshes = 64;
+    std::uint32_t materials = 16;
+    int frames = 30;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg.rfind("--items=", 0) == 0) item_count = std::strtoull(arg.c_str() + 8, nullptr, 10);
+        if (arg.rfind("--meshes=", 0) == 0) meshes = static_cast<std::uint32_t>(std::max(1, std::atoi(arg.c_str() + 9)));
+        if (arg.rfind("--materials=", 0) == 0) materials = static_cast<std::uint32_t>(std::max(1, std::atoi(arg.c_str() + 12)));
+        if (arg.rfind("--frames=", 0) == 0) frames = std::max(1, std::atoi(arg.c_str() + 9));
+    }
+    meshes = std::min(meshes, Render::kPlaceholderMesh);
+    materials = std::min(materials, Render::DrawKey::kMaxMaterial + 1);
+
+    std::mt19937 rng(1234);
+    const std::vector<Item> items = MakeItems(item_count, meshes, materials, rng);
+    Render::Camera camera;
+    camera.eye = glm::vec3(0.0f, 200.0f, 800.0f);
+
+    std::printf("%zu items, %u meshes x %u materials, %d frames\n", item_count, meshes, materials, frames);
+    BenchSort(items, camera);
+    BenchSubmit("instanced", true, items, meshes, materials, frames, camera);
+    BenchSubmit("single", false, items, meshes, materials, frames, camera);
+    return 0;
+}
@@ -0,0 +1,94 @@
+// Headless benchmark for Geometry::Simplify and LOD chain generation.
+// Usage: SimplifyBench [--grid=N] [--workers=N]
+//
+//  - simplify: one decimation per target ratio over an N x N terrain, serial
+//    (before the job system starts) vs parallel cells; reports triangles
+//    removed per second and the resulting error
+//  - chain: a full LOD chain on the job system, per level
+
+#include "BenchSupport.h"
+#include "Geometry/Simplify.h"
+#include "Geometry/Terrain.h"
+#include "Jobs/JobSystem.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using Bench::Clock;
+using Bench::SecondsSince;
+namespace Jobs = Backend::Jobs;
+namespace Geo = Backend::Geometry;
+
+namespace {
+
+    constexpr float kRatios[] = { 0.5f, 0.1f, 0.01f };
+
+    struct Run {
+        double seconds = 0.0;
+        Geo::SimplifyStats stats;
+    };
+
+    Run Simplify(const Geo::MeshView& view, float ratio) {
+        Geo::SimplifyOptions options;
+        options.target_ratio = ratio;
+        Run run;
+        const auto start = Clock::now();
+        const Geo::MeshSoA reduced = Geo::Simplify(view, options, &run.stats);
+        run.seconds = SecondsSince(start);
+        return run;
+    }
+
+    double RemovedPerSecond(const Run& run) {
+        return static_cast<double>(run.stats.input_triangles - run.stats.output_triangles) / run.seconds;
+    }
+
+    void BenchChain(const Geo::MeshView& view) {
+        const auto start = Clock::now();
+        const std::vector<Geo::MeshLod> lods = Geo::BuildLodChain(view);
+        const double seconds = SecondsSince(start);
+        std::printf("[chain]    %zu levels in %.1f ms  (%.2f Mtris/s removed)\n", lods.size(), seconds * 1e3,
+                    static_cast<double>(view.triangle_count - lods.back().mesh.TriangleCount()) / seconds * 1e-6);
+        for (std::size_t level = 0; level < lods.size(); ++level) {
+            std::printf("           level %zu: %9zu tris  error %.4f\n", level, lods[level].mesh.TriangleCount(),
+                        lods[level].error);
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::uint32_t grid = 1024;
+    Jobs::JobSystemConfig config;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg.rfind("--grid=", 0) == 0) grid = static_cast<std::uint32_t>(std::max(2, std::atoi(arg.c_str() + 7)));
+        if (arg.rfind("--workers=", 0) == 0) config.worker_count = static_cast<unsigned>(std::strtoul(arg.c_str() + 10, nullptr, 10));
+    }
+
+    const Geo::MeshSoA terrain = Geo::MakeTerrain(grid);
+    const Geo::MeshView view = terrain.View();
+
+    // Serial first: ParallelFor runs inline until the job system is up
+    Run serial[std::size(kRatios)];
+    for (std::size_t i = 0; i < std::size(kRatios); ++i) serial[i] = Simplify(view, kRatios[i]);
+
+    Jobs::Initialize(config);
+    std::printf("SimplifyBench: %zu triangles, %u threads\n", view.triangle_count, Jobs::ThreadCount());
+    for (std::size_t i = 0; i < std::size(kRatios); ++i) {
+        const Run parallel = Simplify(view, kRatios[i]);
+        std::printf("[simplify] %5.1f%%  -> %8zu tris  serial %7.1f ms (%5.2f Mtris/s)  parallel %7.1f ms "
+                    "(%5.2f Mtris/s, %zu cells)  speedup %.2fx  error %.4f / %.4f\n",
+                    kRatios[i] * 100.0f, parallel.stats.output_triangles, serial[i].seconds * 1e3,
+                    RemovedPerSecond(serial[i]) * 1e-6, parallel.seconds * 1e3, RemovedPerSecond(parallel) * 1e-6,
+                    parallel.stats.cells, serial[i].seconds / parallel.seconds, serial[i].stats.error,
+                    parallel.stats.error);
+    }
+    BenchChain(view);
+
+    Jobs::Shutdown();
+    return 0;
+}
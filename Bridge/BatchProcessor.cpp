@@ -0,0 +1,489 @@
+#include "BatchProcessor.h"
+#include "Geometry/MeshKernels.h"
+#include "Geometry/Primitives.h"
+#include "Geometry/Simplify.h"
+#include "Jobs/JobSystem.h"
+#include "Profiling/Profiler.h"
+#include "Scene/Scene.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace Bridge {
+
+    namespace Geo = Backend::Geometry;
+    namespace Prim = Shared::Geometry;
+    using namespace Protocol;
+
+    namespace {
+
+        // Batches are streamed back in runs of at most this many ops
+        constexpr std::size_t kMaxRunOps = 1024;
+        // Below this a metrics query runs inside its own job, above it is split
+        constexpr std::size_t kParallelMetricsTriangles = 1u << 16;
+        // Keeps a shape batch's result within a 32-bit payload size
+        constexpr std::uint32_t kMaxShapeBatch = 1u << 24;
+
+        struct StoredMesh {
+            Geo::MeshSoA mesh;
+            Geo::Aabb bounds;
+        };
+
+        // Levels 1.. of a mesh's LOD chain; level 0 is the StoredMesh itself
+        struct StoredLods {
+            std::vector<Geo::MeshLod> levels;
+        };
+
+        Op GetOp(const OpHeader& header) {
+            return static_cast<Op>(header.op);
+        }
+
+        template <typename T>
+        bool ReadPayload(const OpHeader& header, const std::byte* payload, T& out) {
+            if (header.payload_bytes < sizeof(T)) return false;
+            std::memcpy(&out, payload, sizeof(T));
+            return true;
+        }
+
+        void AppendBytes(std::vector<std::byte>& out, const void* data, std::size_t size) {
+            const std::size_t at = out.size();
+            out.resize(at + size);
+            if (size) std::memcpy(out.data() + at, data, size);
+        }
+
+        void AppendResult(std::vector<std::byte>& out, const OpHeader& op, Status status,
+                          const void* data = nullptr, std::size_t size = 0) {
+            ResultHeader header;
+            header.tag = op.tag;
+            header.op = op.op;
+            header.status = static_cast<std::uint16_t>(status);
+            header.payload_bytes = static_cast<std::uint32_t>(PadPayload(size));
+            AppendBytes(out, &header, sizeof(header));
+            AppendBytes(out, data, size);
+            out.resize(out.size() + (header.payload_bytes - size), std::byte{ 0 });
+        }
+
+        // The wire layout is the primitives' field order
+        static_assert(Prim::ShapeTraits<Prim::Circle<double>>::kFields == ShapeFieldCount(ShapeKind::Circle));
+        static_assert(Prim::ShapeTraits<Prim::Rectangle<double>>::kFields == ShapeFieldCount(ShapeKind::Rectangle));
+        static_assert(Prim::ShapeTraits<Prim::Triangle<double>>::kFields == ShapeFieldCount(ShapeKind::Triangle));
+
+        BoundsResult ToBoundsResult(const Geo::Aabb& bounds) {
+            BoundsResult result;
+            std::memcpy(result.min, &bounds.min, sizeof(result.min));
+            std::memcpy(result.max, &bounds.max, sizeof(result.max));
+            return result;
+        }
+
+        Backend::Transform ToTransform(const TransformData& data) {
+            Backend::Transform transform;
+            transform.position = glm::vec3(data.position[0], data.position[1], data.position[2]);
+            transform.rotation = glm::vec3(data.rotation[0], data.rotation[1], data.rotation[2]);
+            transform.scale = glm::vec3(data.scale[0], data.scale[1], data.scale[2]);
+            return transform;
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // SHARED STATE
+    // ============================================================================
+
+    struct BatchProcessor::State {
+        // Mesh library: queries copy the shared_ptr and compute without the lock
+        std::shared_mutex meshes_mutex;
+        std::unordered_map<std::uint32_t, std::shared_ptr<const StoredMesh>> meshes;
+        std::unordered_map<std::uint32_t, std::shared_ptr<const StoredLods>> lods;
+
+        // Scene edits are serialized; world bounds are refreshed lazily for queries
+        std::mutex scene_mutex;
+        Backend::Scene scene;
+        bool world_bounds_dirty = false;
+        std::vector<std::uint32_t> query_scratch;
+
+        std::shared_ptr<const StoredMesh> FindMesh(std::uint32_t id) {
+            std::shared_lock<std::shared_mutex> lock(meshes_mutex);
+            const auto it = meshes.find(id);
+            return it != meshes.end() ? it->second : nullptr;
+        }
+
+        std::shared_ptr<const StoredLods> FindLods(std::uint32_t id) {
+            std::shared_lock<std::shared_mutex> lock(meshes_mutex);
+            const auto it = lods.find(id);
+            return it != lods.end() ? it->second : nullptr;
+        }
+
+        static void WriteMetrics(const Geo::MeshView& view, BatchCursor::Slot& slot) {
+            const Geo::MeshMetrics metrics = view.triangle_count >= kParallelMetricsTriangles
+                                           ? Geo::ComputeMetricsParallel(view)
+                                           : Geo::ComputeMetrics(view);
+            MetricsResult result;
+            result.surface_area = metrics.surface_area;
+            result.perimeter_sum = metrics.perimeter_sum;
+            result.triangle_count = metrics.triangle_count;
+            result.bounds = ToBoundsResult(metrics.bounds);
+            std::memcpy(slot.data, &result, sizeof(result));
+            slot.size = sizeof(result);
+        }
+
+        // ============================================================================
+        // READ-ONLY OPS (parallel)
+        // ============================================================================
+
+        void RunQuery(const BatchCursor::OpRef& op, BatchCursor::Slot& slot) {
+            if (GetOp(op.header) == Op::Ping) return;
+            if (GetOp(op.header) == Op::LodMetrics) {
+                RunLodQuery(op, slot);
+                return;
+            }
+            if (GetOp(op.header) == Op::ShapeMetrics) {
+                RunShapeQuery(op, slot);
+                return;
+            }
+
+            MeshRef ref;
+            if (!ReadPayload(op.header, op.payload, ref)) {
+                slot.status = Status::BadRequest;
+                return;
+            }
+            const std::shared_ptr<const StoredMesh> stored = FindMesh(ref.mesh_id);
+            if (!stored) {
+                slot.status = Status::NotFound;
+                return;
+            }
+
+            if (GetOp(op.header) == Op::MeshBounds) {
+                const BoundsResult result = ToBoundsResult(stored->bounds);
+                std::memcpy(slot.data, &result, sizeof(result));
+                slot.size = sizeof(result);
+                return;
+            }
+
+            WriteMetrics(stored->mesh.View(), slot);
+        }
+
+        // Coarse geometry for clients under load: metrics of the coarsest
+        // level whose error stays within the request's bound
+        void RunLodQuery(const BatchCursor::OpRef& op, BatchCursor::Slot& slot) {
+            LodQuery query;
+            if (!ReadPayload(op.header, op.payload, query)) {
+                slot.status = Status::BadRequest;
+                return;
+            }
+            const std::shared_ptr<const StoredMesh> stored = FindMesh(query.mesh_id);
+            if (!stored) {
+                slot.status = Status::NotFound;
+                return;
+            }
+            const std::shared_ptr<const StoredLods> chain = FindLods(query.mesh_id);
+            if (chain) {
+                for (auto it = chain->levels.rbegin(); it != chain->levels.rend(); ++it) {
+                    if (it->error <= query.max_error) {
+                        WriteMetrics(it->mesh.View(), slot);
+                        return;
+                    }
+                }
+            }
+            WriteMetrics(stored->mesh.View(), slot);
+        }
+
+        // Areas and perimeters of one shape type. The payload is only 4-byte
+        // aligned, so the fields are copied out before the batched kernel runs
+        template <typename S>
+        static Status RunShapeBatch(const ShapeBatchDesc& desc, const std::byte* fields, BatchCursor::Slot& slot) {
+            constexpr std::size_t kFields = Prim::ShapeTraits<S>::kFields;
+            const std::size_t count = desc.count;
+            std::vector<double> input(kFields * count);
+            if (!input.empty()) std::memcpy(input.data(), fields, input.size() * sizeof(double));
+
+            Prim::FieldSpans<S> spans;
+            for (std::size_t k = 0; k < kFields; ++k) {
+                spans[k] = std::span<const double>(input).subspan(k * count, count);
+            }
+            if (!Prim::AllValid<S>(spans, count)) return Status::BadRequest;
+
+            // Header first: the metrics start 8 bytes in and stay 8-byte aligned
+            const ShapeBatchResult header{ desc.count, 0 };
+            slot.large.resize(sizeof(header) + 2 * count * sizeof(double));
+            std::memcpy(slot.large.data(), &header, sizeof(header));
+            double* metrics = reinterpret_cast<double*>(slot.large.data() + sizeof(header));
+            Prim::ComputeMetrics<S>(spans, std::span<double>(metrics, count), std::span<double>(metrics + count, count));
+            slot.size = static_cast<std::uint32_t>(slot.large.size());
+            return Status::Ok;
+        }
+
+        // Shape kind picks the kernel once per op, never per shape
+        void RunShapeQuery(const BatchCursor::OpRef& op, BatchCursor::Slot& slot) {
+            ShapeBatchDesc desc;
+            if (!ReadPayload(op.header, op.payload, desc)) {
+                slot.status = Status::BadRequest;
+                return;
+            }
+            const auto shape = static_cast<ShapeKind>(desc.shape);
+            const std::uint64_t need = sizeof(desc) + std::uint64_t(ShapeFieldCount(shape)) * desc.count * sizeof(double);
+            if (ShapeFieldCount(shape) == 0 || desc.count > kMaxShapeBatch || op.header.payload_bytes < need) {
+                slot.status = Status::BadRequest;
+                return;
+            }
+            const std::byte* fields = op.payload + sizeof(desc);
+            switch (shape) {
+                case ShapeKind::Circle: slot.status = RunShapeBatch<Prim::Circle<double>>(desc, fields, slot); break;
+                case ShapeKind::Rectangle: slot.status = RunShapeBatch<Prim::Rectangle<double>>(desc, fields, slot); break;
+                case ShapeKind::Triangle: slot.status = RunShapeBatch<Prim::Triangle<double>>(desc, fields, slot); break;
+            }
+        }
+
+        // ============================================================================
+        // EDITS (serial, request order, scene_mutex held)
+        // ============================================================================
+
+        void RunEdit(const BatchCursor::OpRef& op, std::vector<std::byte>& out) {
+            const OpHeader& header = op.header;
+            switch (GetOp(header)) {
+                case Op::UploadMesh:
+                    AppendResult(out, header, UploadMesh(op));
+                    return;
+
+                case Op::DropMesh: {
+                    MeshRef ref;
+                    if (!ReadPayload(header, op.payload, ref)) break;
+                    std::unique_lock<std::shared_mutex> lock(meshes_mutex);
+                    lods.erase(ref.mesh_id);
+                    AppendResult(out, header, meshes.erase(ref.mesh_id) ? Status::Ok : Status::NotFound);
+                    return;
+                }
+
+                case Op::BuildLods: {
+                    BuildLodsDesc desc;
+                    if (!ReadPayload(header, op.payload, desc) || desc.max_levels == 0 ||
+                        !(desc.ratio > 0.0f && desc.ratio < 1.0f) || !(desc.max_error >= 0.0f)) {
+                        break;
+                    }
+                    BuildLods(desc, header, out);
+                    return;
+                }
+
+                case Op::CreateEntity: {
+                    CreateEntityDesc desc;
+                    if (!ReadPayload(header, op.payload, desc) || header.payload_bytes - sizeof(desc) < desc.name_length) break;
+                    std::shared_ptr<const StoredMesh> mesh;
+                    if (desc.mesh_id != kInvalidId) {
+                        mesh = FindMesh(desc.mesh_id);
+                        if (!mesh) {
+                            AppendResult(out, header, Status::NotFound);
+                            return;
+                        }
+                    }
+                    const std::string_view name(reinterpret_cast<const char*>(op.payload + sizeof(desc)), desc.name_length);
+                    const Backend::Entity entity = scene.CreateEntity(name, ToTransform(desc.transform));
+                    if (mesh) {
+                        scene.SetMesh(entity, Backend::MeshHandle{ desc.mesh_id }, mesh->bounds);
+                    }
+                    world_bounds_dirty = true;
+                    const EntityRef result{ static_cast<std::uint32_t>(entity) };
+                    AppendResult(out, header, Status::Ok, &result, sizeof(result));
+                    return;
+                }
+
+                case Op::SetTransform: {
+                    SetTransformDesc desc;
+                    if (!ReadPayload(header, op.payload, desc)) break;
+                    const auto entity = static_cast<Backend::Entity>(desc.entity);
+                    if (!scene.IsValid(entity)) {
+                        AppendResult(out, header, Status::NotFound);
+                        return;
+                    }
+                    scene.GetTransform(entity) = ToTransform(desc.transform);
+                    world_bounds_dirty = true;
+                    AppendResult(out, header, Status::Ok);
+                    return;
+                }
+
+                case Op::DestroyEntity: {
+                    EntityRef ref;
+                    if (!ReadPayload(header, op.payload, ref)) break;
+                    const auto entity = static_cast<Backend::Entity>(ref.entity);
+                    if (!scene.IsValid(entity)) {
+                        AppendResult(out, header, Status::NotFound);
+                        return;
+                    }
+                    scene.DestroyEntity(entity);
+                    world_bounds_dirty = true;
+                    AppendResult(out, header, Status::Ok);
+                    return;
+                }
+
+                case Op::QueryBounds: {
+                    BoundsResult box;
+                    if (!ReadPayload(header, op.payload, box)) break;
+                    if (world_bounds_dirty) {
+                        scene.UpdateWorldBounds();
+                        scene.UpdateSpatialIndex();
+                        world_bounds_dirty = false;
+                    }
+                    Geo::Aabb query;
+                    query.min = glm::vec3(box.min[0], box.min[1], box.min[2]);
+                    query.max = glm::vec3(box.max[0], box.max[1], box.max[2]);
+                    query_scratch.assign(1, 0u);
+                    scene.QueryBounds(query, [&](Backend::Entity entity) {
+                        query_scratch.push_back(static_cast<std::uint32_t>(entity));
+                    });
+                    query_scratch[0] = static_cast<std::uint32_t>(query_scratch.size() - 1);
+                    AppendResult(out, header, Status::Ok, query_scratch.data(), query_scratch.size() * sizeof(std::uint32_t));
+                    return;
+                }
+
+                default:
+                    AppendResult(out, header, Status::Unsupported);
+                    return;
+            }
+            AppendResult(out, header, Status::BadRequest);
+        }
+
+        void BuildLods(const BuildLodsDesc& desc, const OpHeader& header, std::vector<std::byte>& out) {
+            const std::shared_ptr<const StoredMesh> stored = FindMesh(desc.mesh_id);
+            if (!stored) {
+                AppendResult(out, header, Status::NotFound);
+                return;
+            }
+
+            Geo::LodChainOptions options;
+            options.max_levels = std::min(desc.max_levels, kMaxLodLevels);
+            options.ratio = desc.ratio;
+            if (desc.max_error > 0.0f) options.max_error = desc.max_error;
+            std::vector<Geo::MeshLod> levels = Geo::BuildLodChain(stored->mesh.View(), options);
+
+            LodChainResult result;
+            result.level_count = static_cast<std::uint32_t>(levels.size());
+            for (std::size_t i = 0; i < levels.size(); ++i) {
+                result.triangles[i] = static_cast<std::uint32_t>(levels[i].mesh.TriangleCount());
+                result.error[i] = levels[i].error;
+            }
+
+            // Level 0 duplicates the stored mesh, keep only the reduced ones
+            auto chain = std::make_shared<StoredLods>();
+            if (!levels.empty()) {
+                chain->levels.assign(std::make_move_iterator(levels.begin() + 1), std::make_move_iterator(levels.end()));
+            }
+            {
+                // Uploads and drops are edits too, so the mesh cannot have changed meanwhile
+                std::unique_lock<std::shared_mutex> lock(meshes_mutex);
+                lods[desc.mesh_id] = std::move(chain);
+            }
+            AppendResult(out, header, Status::Ok, &result, sizeof(result));
+        }
+
+        Status UploadMesh(const BatchCursor::OpRef& op) {
+            UploadMeshDesc desc;
+            if (!ReadPayload(op.header, op.payload, desc)) return Status::BadRequest;
+            const std::uint64_t vc = desc.vertex_count;
+            const std::uint64_t tc = desc.triangle_count;
+            const std::uint64_t need = sizeof(desc) + vc * 3 * sizeof(float) + tc * 3 * sizeof(std::uint32_t);
+            if (op.header.payload_bytes < need) return Status::BadRequest;
+
+            auto stored = std::make_shared<StoredMesh>();
+            Geo::MeshSoA& mesh = stored->mesh;
+            const std::byte* src = op.payload + sizeof(desc);
+            auto take = [&src](auto& stream, std::uint64_t count) {
+                stream.resize(count);
+                const std::size_t bytes = count * sizeof(stream[0]);
+                if (bytes) std::memcpy(stream.data(), src, bytes);
+                src += bytes;
+            };
+            take(mesh.x, vc); take(mesh.y, vc); take(mesh.z, vc);
+            take(mesh.i0, tc); take(mesh.i1, tc); take(mesh.i2, tc);
+
+            // Kernels index without checks, so reject out-of-range indices here
+            for (std::uint64_t t = 0; t < tc; ++t) {
+                if (mesh.i0[t] >= vc || mesh.i1[t] >= vc || mesh.i2[t] >= vc) return Status::BadRequest;
+            }
+            stored->bounds = Geo::ComputeBounds(mesh.View());
+
+            std::unique_lock<std::shared_mutex> lock(meshes_mutex);
+            meshes[desc.mesh_id] = std::move(stored);
+            lods.erase(desc.mesh_id);
+            return Status::Ok;
+        }
+    };
+
+    // ============================================================================
+    // PROCESSOR
+    // ============================================================================
+
+    BatchProcessor::BatchProcessor() : m_state(std::make_unique<State>()) {}
+
+    BatchProcessor::~BatchProcessor() = default;
+
+    bool BatchProcessor::Parse(std::span<const std::byte> body, BatchCursor& cursor) const {
+        cursor = BatchCursor{};
+        BatchHeader header;
+        if (body.size() < sizeof(header)) return false;
+        std::memcpy(&header, body.data(), sizeof(header));
+        if (header.magic != kBatchMagic || header.version != kVersion) return false;
+
+        std::size_t at = sizeof(header);
+        cursor.m_ops.reserve(std::min<std::size_t>(header.op_count, (body.size() - at) / sizeof(OpHeader)));
+        for (std::uint32_t i = 0; i < header.op_count; ++i) {
+            BatchCursor::OpRef op;
+            if (body.size() - at < sizeof(OpHeader)) return false;
+            std::memcpy(&op.header, body.data() + at, sizeof(OpHeader));
+            at += sizeof(OpHeader);
+            if (body.size() - at < op.header.payload_bytes) return false;
+            op.payload = body.data() + at;
+            at += op.header.payload_bytes;
+            cursor.m_ops.push_back(op);
+        }
+        return at == body.size();
+    }
+
+    std::span<const std::byte> BatchProcessor::Step(BatchCursor& cursor) {
+        std::vector<std::byte>& out = cursor.m_out;
+        out.clear();
+        if (!cursor.m_header_sent) {
+            ResultStreamHeader header;
+            header.result_count = static_cast<std::uint32_t>(cursor.m_ops.size());
+            AppendBytes(out, &header, sizeof(header));
+            cursor.m_header_sent = true;
+        }
+        if (cursor.m_next == cursor.m_ops.size()) return out;
+
+        const std::size_t first = cursor.m_next;
+        const bool read_only = IsReadOnly(GetOp(cursor.m_ops[first].header));
+        std::size_t end = first + 1;
+        while (end < cursor.m_ops.size() && end - first < kMaxRunOps &&
+               IsReadOnly(GetOp(cursor.m_ops[end].header)) == read_only) {
+            ++end;
+        }
+
+        State& state = *m_state;
+        if (read_only) {
+            GE_PROFILE_ZONE("Bridge::RunQueries");
+            cursor.m_slots.assign(end - first, BatchCursor::Slot{});
+            Backend::Jobs::ParallelFor(first, end, 1, [&](std::size_t lo, std::size_t hi) {
+                for (std::size_t i = lo; i < hi; ++i) {
+                    state.RunQuery(cursor.m_ops[i], cursor.m_slots[i - first]);
+                }
+            });
+            for (std::size_t i = first; i < end; ++i) {
+                const BatchCursor::Slot& slot = cursor.m_slots[i - first];
+                AppendResult(out, cursor.m_ops[i].header, slot.status, slot.Bytes(), slot.size);
+            }
+        } else {
+            GE_PROFILE_ZONE("Bridge::RunEdits");
+            std::lock_guard<std::mutex> lock(state.scene_mutex);
+            for (std::size_t i = first; i < end; ++i) {
+                state.RunEdit(cursor.m_ops[i], out);
+            }
+            // The Bridge scene is not journaled; drop change tracking so it cannot grow
+            state.scene.ClearDirty();
+        }
+
+        cursor.m_next = end;
+        return out;
+    }
+
+} // namespace Bridge
@@ -0,0 +1,76 @@
+#pragma once
+
+// Executes Protocol batches against the Bridge's mesh library and scene.
+// Transport-agnostic: the HTTP server and the shared-memory host both parse a
+// request body into a BatchCursor and pull results run by run with Step(),
+// forwarding each chunk as soon as it is ready.
+//
+// Consecutive read-only queries run in parallel on the Backend job system;
+// edits run serially under the scene lock, in request order. Several
+// transports and connections may drive one processor concurrently.
+
+#include "BridgeAPI.h"
+#include "Protocol.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Bridge {
+
+    // Per-batch state. Op payloads point into the request body, which must
+    // stay alive until Done().
+    class BatchCursor {
+    public:
+        bool Done() const { return m_header_sent && m_next == m_ops.size(); }
+        std::size_t OpCount() const { return m_ops.size(); }
+
+    private:
+        friend class BatchProcessor;
+
+        struct OpRef {
+            Protocol::OpHeader header;
+            const std::byte* payload = nullptr;
+        };
+
+        // Result of a read-only op; fixed-size ones fit inline, shape batches
+        // use `large`
+        struct Slot {
+            Protocol::Status status = Protocol::Status::Ok;
+            std::uint32_t size = 0;
+            alignas(8) std::byte data[sizeof(Protocol::MetricsResult)];
+            std::vector<std::byte> large;
+
+            const std::byte* Bytes() const { return large.empty() ? data : large.data(); }
+        };
+
+        std::vector<OpRef> m_ops;
+        std::vector<Slot> m_slots;
+        std::vector<std::byte> m_out;
+        std::size_t m_next = 0;
+        bool m_header_sent = false;
+    };
+
+    class BRIDGE_API BatchProcessor {
+    public:
+        BatchProcessor();
+        ~BatchProcessor();
+
+        BatchProcessor(const BatchProcessor&) = delete;
+        BatchProcessor& operator=(const BatchProcessor&) = delete;
+
+        // Validates framing only (payloads are checked per op). False if the
+        // body is not a well-formed batch.
+        bool Parse(std::span<const std::byte> body, BatchCursor& cursor) const;
+
+        // Runs the next run of ops and returns its encoded results (the stream
+        // header is prepended on the first call). Valid until the next Step().
+        std::span<const std::byte> Step(BatchCursor& cursor);
+
+    private:
+        struct State;
+        std::unique_ptr<State> m_state;
+    };
+
+} // namespace Bridge
@@ -1,7 +1,4 @@
-﻿#include <iostream>
-#if defined(_WIN32)
-    #define BRIDGE_API __declspec(dllexport)
-#else
-    #define BRIDGE_API
-#endif
-namespace Bridge { BRIDGE_API void Init() { std::cout << "Bridge Init"; } }
+﻿#include "Bridge.h"
+#include "Logging/Log.h"
+
+namespace Bridge { BRIDGE_API void Init() { GE_LOG_INFO(Bridge, "Bridge Init"); } }
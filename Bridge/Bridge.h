@@ -0,0 +1,12 @@
+#pragma once
+
+// Bridge entry points. The remote-control service itself is Bridge::Server.
+
+#include "BridgeAPI.h"
+#include "Server.h"
+
+namespace Bridge {
+
+    BRIDGE_API void Init();
+
+}
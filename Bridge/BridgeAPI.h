@@ -0,0 +1,13 @@
+#pragma once
+
+// Export macro for the Bridge shared library.
+// BRIDGE_EXPORTS is defined by Bridge/CMakeLists.txt when building the DLL.
+#if defined(_WIN32)
+    #if defined(BRIDGE_EXPORTS)
+        #define BRIDGE_API __declspec(dllexport)
+    #else
+        #define BRIDGE_API __declspec(dllimport)
+    #endif
+#else
+    #define BRIDGE_API
+#endif
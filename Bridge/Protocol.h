@@ -0,0 +1,409 @@
+#pragma once
+
+// Binary wire format for Bridge batches, shared by the HTTP endpoint
+// (POST /batch) and the shared-memory channel (ShmChannel.h).
+//
+// A request body is one BatchHeader followed by `op_count` ops, each an
+// OpHeader plus `payload_bytes` of op-specific payload. The response body is
+// a ResultStreamHeader followed by one ResultHeader + payload per op, in
+// request order; it is sent chunked so early results arrive while later ops
+// are still running. `tag` is echoed back untouched for client bookkeeping.
+//
+// All integers are little-endian and every struct is a fixed-size POD, so
+// both sides read and write them with memcpy. Payloads are padded to 4 bytes.
+// Header-only: pipeline tools and the load generator build batches with
+// BatchWriter and decode responses with ResultReader.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Bridge::Protocol {
+
+    inline constexpr std::uint32_t kBatchMagic = 0x51424547;    // "GEBQ"
+    inline constexpr std::uint32_t kResultMagic = 0x52424547;   // "GEBR"
+    inline constexpr std::uint16_t kVersion = 1;
+    inline constexpr const char* kBatchPath = "/batch";
+    inline constexpr const char* kContentType = "application/octet-stream";
+    inline constexpr std::uint32_t kInvalidId = 0xFFFFFFFFu;
+
+    // ResultStreamHeader::flags: the batch was malformed and nothing ran. HTTP
+    // reports this as status 400 instead; the shared-memory transport has no
+    // status line.
+    inline constexpr std::uint16_t kResultRejected = 1;
+
+    // ============================================================================
+    // OPS
+    // ============================================================================
+
+    enum class Op : std::uint16_t {
+        Ping = 0,
+
+        // Geometry (mesh library). Queries run in parallel on the job system.
+        UploadMesh = 1,     // UploadMeshDesc + x,y,z floats + i0,i1,i2 uint32s -> (empty)
+        DropMesh = 2,       // MeshRef -> (empty)
+        MeshMetrics = 3,    // MeshRef -> MetricsResult
+        MeshBounds = 4,     // MeshRef -> BoundsResult
+        BuildLods = 5,      // BuildLodsDesc -> LodChainResult (runs with the edits)
+        LodMetrics = 6,     // LodQuery -> MetricsResult of the coarsest LOD within max_error
+        ShapeMetrics = 7,   // ShapeBatchDesc + fields as doubles -> ShapeBatchResult + areas + perimeters
+
+        // Scene edits. Applied serially, in request order.
+        CreateEntity = 16,  // CreateEntityDesc + name bytes -> EntityRef
+        SetTransform = 17,  // SetTransformDesc -> (empty)
+        DestroyEntity = 18, // EntityRef -> (empty)
+        QueryBounds = 19,   // BoundsResult (query box) -> uint32 count + count entity ids
+    };
+
+    enum class Status : std::uint16_t {
+        Ok = 0,
+        BadRequest = 1,
+        NotFound = 2,
+        Unsupported = 3
+    };
+
+    // Ops that only read shared state may run concurrently with each other
+    inline constexpr bool IsReadOnly(Op op) {
+        return op == Op::Ping || op == Op::MeshMetrics || op == Op::MeshBounds || op == Op::LodMetrics ||
+               op == Op::ShapeMetrics;
+    }
+
+    // ============================================================================
+    // FRAMING
+    // ============================================================================
+
+    struct BatchHeader {
+        std::uint32_t magic = kBatchMagic;
+        std::uint16_t version = kVersion;
+        std::uint16_t flags = 0;
+        std::uint32_t op_count = 0;
+        std::uint32_t reserved = 0;
+    };
+
+    struct OpHeader {
+        std::uint16_t op = 0;
+        std::uint16_t reserved = 0;
+        std::uint32_t payload_bytes = 0;
+        std::uint64_t tag = 0;
+    };
+
+    struct ResultStreamHeader {
+        std::uint32_t magic = kResultMagic;
+        std::uint16_t version = kVersion;
+        std::uint16_t flags = 0;
+        std::uint32_t result_count = 0;
+        std::uint32_t reserved = 0;
+    };
+
+    struct ResultHeader {
+        std::uint64_t tag = 0;
+        std::uint16_t op = 0;
+        std::uint16_t status = 0;
+        std::uint32_t payload_bytes = 0;
+    };
+
+    static_assert(sizeof(BatchHeader) == 16 && sizeof(OpHeader) == 16);
+    static_assert(sizeof(ResultStreamHeader) == 16 && sizeof(ResultHeader) == 16);
+
+    // ============================================================================
+    // PAYLOADS
+    // ============================================================================
+
+    struct MeshRef {
+        std::uint32_t mesh_id = 0;
+    };
+
+    struct EntityRef {
+        std::uint32_t entity = kInvalidId;
+    };
+
+    struct UploadMeshDesc {
+        std::uint32_t mesh_id = 0;
+        std::uint32_t vertex_count = 0;
+        std::uint32_t triangle_count = 0;
+        std::uint32_t reserved = 0;
+    };
+
+    // position, rotation (Euler XYZ degrees), scale
+    struct TransformData {
+        float position[3] = { 0.0f, 0.0f, 0.0f };
+        float rotation[3] = { 0.0f, 0.0f, 0.0f };
+        float scale[3] = { 1.0f, 1.0f, 1.0f };
+    };
+
+    struct CreateEntityDesc {
+        TransformData transform;
+        std::uint32_t mesh_id = kInvalidId;   // Optional; local bounds come from the mesh
+        std::uint32_t name_length = 0;
+    };
+
+    struct SetTransformDesc {
+        std::uint32_t entity = kInvalidId;
+        TransformData transform;
+    };
+
+    struct BoundsResult {
+        float min[3] = { 0.0f, 0.0f, 0.0f };
+        float max[3] = { 0.0f, 0.0f, 0.0f };
+    };
+
+    struct MetricsResult {
+        double surface_area = 0.0;
+        double perimeter_sum = 0.0;
+        std::uint64_t triangle_count = 0;
+        BoundsResult bounds;
+    };
+
+    inline constexpr std::uint32_t kMaxLodLevels = 8;
+
+    struct BuildLodsDesc {
+        std::uint32_t mesh_id = 0;
+        std::uint32_t max_levels = 6;   // Including the source, at most kMaxLodLevels
+        float ratio = 0.5f;             // Triangles kept per level
+        float max_error = 0.0f;         // Mesh units; 0 = unlimited
+    };
+
+    // Level 0 is the uploaded mesh (error 0)
+    struct LodChainResult {
+        std::uint32_t level_count = 0;
+        std::uint32_t reserved = 0;
+        std::uint32_t triangles[kMaxLodLevels] = {};
+        float error[kMaxLodLevels] = {};
+    };
+
+    // Meshes without a chain answer with the source mesh
+    struct LodQuery {
+        std::uint32_t mesh_id = 0;
+        float max_error = 0.0f;
+    };
+
+    enum class ShapeKind : std::uint16_t {
+        Circle = 0,     // radius
+        Rectangle = 1,  // width, height
+        Triangle = 2    // base, height, side_a, side_b, side_c (sides all 0 if unknown)
+    };
+
+    // Fields per shape, in the order listed above; 0 for unknown kinds
+    inline constexpr std::uint32_t ShapeFieldCount(ShapeKind kind) {
+        switch (kind) {
+            case ShapeKind::Circle: return 1;
+            case ShapeKind::Rectangle: return 2;
+            case ShapeKind::Triangle: return 5;
+        }
+        return 0;
+    }
+
+    // Followed by ShapeFieldCount(shape) arrays of `count` doubles, one per
+    // field. Every shape must be valid (positive dimensions) or the op fails
+    struct ShapeBatchDesc {
+        std::uint16_t shape = 0;
+        std::uint16_t reserved = 0;
+        std::uint32_t count = 0;
+    };
+
+    // Followed by `count` areas, then `count` perimeters (0 for triangles
+    // without sides), as doubles
+    struct ShapeBatchResult {
+        std::uint32_t count = 0;
+        std::uint32_t reserved = 0;
+    };
+
+    inline constexpr std::size_t PadPayload(std::size_t bytes) {
+        return (bytes + 3) & ~std::size_t(3);
+    }
+
+    // ============================================================================
+    // BATCH WRITER
+    // ============================================================================
+
+    class BatchWriter {
+    public:
+        BatchWriter() { Clear(); }
+
+        void Clear() {
+            m_bytes.assign(sizeof(BatchHeader), std::byte{ 0 });
+            m_op_start = kNoOp;
+            m_count = 0;
+            PatchHeader();
+        }
+
+        // Starts an op; append its payload with Write/WriteBytes before the next Begin
+        void Begin(Op op, std::uint64_t tag = 0) {
+            Finish();
+            m_op_start = m_bytes.size();
+            OpHeader header;
+            header.op = static_cast<std::uint16_t>(op);
+            header.tag = tag;
+            Write(header);
+            m_count += 1;
+            PatchHeader();
+        }
+
+        template <typename T>
+        void Write(const T& value) { WriteBytes(&value, sizeof(T)); }
+
+        void WriteBytes(const void* data, std::size_t size) {
+            const std::size_t at = m_bytes.size();
+            m_bytes.resize(at + size);
+            if (size) std::memcpy(m_bytes.data() + at, data, size);
+        }
+
+        // Convenience builders for the common ops
+        void Ping(std::uint64_t tag = 0) { Begin(Op::Ping, tag); }
+
+        void UploadMesh(std::uint32_t mesh_id, std::span<const float> x, std::span<const float> y,
+                        std::span<const float> z, std::span<const std::uint32_t> i0,
+                        std::span<const std::uint32_t> i1, std::span<const std::uint32_t> i2,
+                        std::uint64_t tag = 0) {
+            Begin(Op::UploadMesh, tag);
+            Write(UploadMeshDesc{ mesh_id, static_cast<std::uint32_t>(x.size()), static_cast<std::uint32_t>(i0.size()), 0 });
+            WriteBytes(x.data(), x.size_bytes());
+            WriteBytes(y.data(), y.size_bytes());
+            WriteBytes(z.data(), z.size_bytes());
+            WriteBytes(i0.data(), i0.size_bytes());
+            WriteBytes(i1.data(), i1.size_bytes());
+            WriteBytes(i2.data(), i2.size_bytes());
+        }
+
+        void MeshQuery(Op op, std::uint32_t mesh_id, std::uint64_t tag = 0) {
+            Begin(op, tag);
+            Write(MeshRef{ mesh_id });
+        }
+
+        void BuildLods(std::uint32_t mesh_id, std::uint32_t max_levels = 6, float ratio = 0.5f,
+                       float max_error = 0.0f, std::uint64_t tag = 0) {
+            Begin(Op::BuildLods, tag);
+            Write(BuildLodsDesc{ mesh_id, max_levels, ratio, max_error });
+        }
+
+        void LodMetrics(std::uint32_t mesh_id, float max_error, std::uint64_t tag = 0) {
+            Begin(Op::LodMetrics, tag);
+            Write(LodQuery{ mesh_id, max_error });
+        }
+
+        // `fields` holds ShapeFieldCount(shape) arrays of `count` values, back to back
+        void ShapeMetrics(ShapeKind shape, std::uint32_t count, std::span<const double> fields, std::uint64_t tag = 0) {
+            Begin(Op::ShapeMetrics, tag);
+            Write(ShapeBatchDesc{ static_cast<std::uint16_t>(shape), 0, count });
+            WriteBytes(fields.data(), fields.size_bytes());
+        }
+
+        void CreateEntity(std::string_view name, const TransformData& transform,
+                          std::uint32_t mesh_id = kInvalidId, std::uint64_t tag = 0) {
+            Begin(Op::CreateEntity, tag);
+            Write(CreateEntityDesc{ transform, mesh_id, static_cast<std::uint32_t>(name.size()) });
+            WriteBytes(name.data(), name.size());
+        }
+
+        void SetTransform(std::uint32_t entity, const TransformData& transform, std::uint64_t tag = 0) {
+            Begin(Op::SetTransform, tag);
+            Write(SetTransformDesc{ entity, transform });
+        }
+
+        void DestroyEntity(std::uint32_t entity, std::uint64_t tag = 0) {
+            Begin(Op::DestroyEntity, tag);
+            Write(EntityRef{ entity });
+        }
+
+        void QueryBounds(const BoundsResult& box, std::uint64_t tag = 0) {
+            Begin(Op::QueryBounds, tag);
+            Write(box);
+        }
+
+        std::uint32_t OpCount() const { return m_count; }
+
+        // Finalized request body
+        std::span<const std::byte> Bytes() {
+            Finish();
+            return m_bytes;
+        }
+
+    private:
+        void PatchHeader() {
+            BatchHeader header;
+            header.op_count = m_count;
+            std::memcpy(m_bytes.data(), &header, sizeof(header));
+        }
+
+        // Pads and records the size of the op in progress
+        void Finish() {
+            if (m_op_start == kNoOp) return;
+            const std::size_t payload = m_bytes.size() - m_op_start - sizeof(OpHeader);
+            m_bytes.resize(m_op_start + sizeof(OpHeader) + PadPayload(payload), std::byte{ 0 });
+            const auto payload_bytes = static_cast<std::uint32_t>(PadPayload(payload));
+            std::memcpy(m_bytes.data() + m_op_start + offsetof(OpHeader, payload_bytes), &payload_bytes, sizeof(payload_bytes));
+            m_op_start = kNoOp;
+        }
+
+        static constexpr std::size_t kNoOp = ~std::size_t(0);
+
+        std::vector<std::byte> m_bytes;
+        std::size_t m_op_start = kNoOp;
+        std::uint32_t m_count = 0;
+    };
+
+    // ============================================================================
+    // RESULT READER
+    // ============================================================================
+
+    // Walks a complete response body; payload spans point into `body`
+    class ResultReader {
+    public:
+        struct Result {
+            ResultHeader header;
+            std::span<const std::byte> payload;
+
+            Status GetStatus() const { return static_cast<Status>(header.status); }
+
+            template <typename T>
+            bool Read(T& out, std::size_t offset = 0) const {
+                if (payload.size() < offset + sizeof(T)) return false;
+                std::memcpy(&out, payload.data() + offset, sizeof(T));
+                return true;
+            }
+        };
+
+        explicit ResultReader(std::span<const std::byte> body) : m_body(body) {
+            ResultStreamHeader header;
+            if (m_body.size() < sizeof(header)) return;
+            std::memcpy(&header, m_body.data(), sizeof(header));
+            if (header.magic != kResultMagic || header.version != kVersion) return;
+            m_count = header.result_count;
+            m_offset = sizeof(header);
+            m_rejected = (header.flags & kResultRejected) != 0;
+            m_valid = true;
+        }
+
+        explicit ResultReader(std::string_view body)
+            : ResultReader(std::span<const std::byte>(reinterpret_cast<const std::byte*>(body.data()), body.size())) {}
+
+        bool IsValid() const { return m_valid; }
+        bool IsRejected() const { return m_rejected; }
+        std::uint32_t Count() const { return m_count; }
+
+        // False at the end of the stream or on a truncated body
+        bool Next(Result& out) {
+            if (!m_valid || m_read == m_count || m_body.size() - m_offset < sizeof(ResultHeader)) return false;
+            std::memcpy(&out.header, m_body.data() + m_offset, sizeof(ResultHeader));
+            const std::size_t start = m_offset + sizeof(ResultHeader);
+            if (m_body.size() - start < out.header.payload_bytes) return false;
+            out.payload = m_body.subspan(start, out.header.payload_bytes);
+            m_offset = start + out.header.payload_bytes;
+            m_read += 1;
+            return true;
+        }
+
+    private:
+        std::span<const std::byte> m_body;
+        std::size_t m_offset = 0;
+        std::uint32_t m_count = 0;
+        std::uint32_t m_read = 0;
+        bool m_valid = false;
+        bool m_rejected = false;
+    };
+
+} // namespace Bridge::Protocol
@@ -0,0 +1,191 @@
+#include "Server.h"
+#include "BatchProcessor.h"
+#include "Protocol.h"
+#include "ShmChannel.h"
+#include "Profiling/Profiler.h"
+
+#include <httplib.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace Bridge {
+
+    using namespace Protocol;
+
+    // ============================================================================
+    // IMPLEMENTATION
+    // ============================================================================
+
+    struct Server::Impl {
+        BatchProcessor processor;
+
+        httplib::Server http;
+        std::thread listener;
+        int port = -1;
+
+        ShmChannel shm;
+        std::thread shm_thread;
+        std::atomic<bool> shm_stop{ false };
+
+        std::atomic<std::uint64_t> batches{ 0 };
+        std::atomic<std::uint64_t> ops{ 0 };
+        std::atomic<std::uint64_t> rejected{ 0 };
+        std::atomic<std::uint64_t> bytes_in{ 0 };
+        std::atomic<std::uint64_t> bytes_out{ 0 };
+        std::atomic<std::uint64_t> shm_batches{ 0 };
+
+        void HandleBatch(const httplib::Request& req, httplib::Response& res) {
+            GE_PROFILE_FUNCTION();
+            bytes_in.fetch_add(req.body.size(), std::memory_order_relaxed);
+
+            auto cursor = std::make_shared<BatchCursor>();
+            const std::span<const std::byte> body(reinterpret_cast<const std::byte*>(req.body.data()), req.body.size());
+            if (!processor.Parse(body, *cursor)) {
+                rejected.fetch_add(1, std::memory_order_relaxed);
+                res.status = 400;
+                res.set_content("malformed batch", "text/plain");
+                return;
+            }
+            batches.fetch_add(1, std::memory_order_relaxed);
+            ops.fetch_add(cursor->OpCount(), std::memory_order_relaxed);
+
+            // Op payloads point into req.body, which httplib keeps alive until
+            // the response (including this provider) has been written
+            res.set_chunked_content_provider(kContentType, [this, cursor](std::size_t, httplib::DataSink& sink) {
+                const std::span<const std::byte> chunk = processor.Step(*cursor);
+                if (!chunk.empty()) {
+                    if (!sink.write(reinterpret_cast<const char*>(chunk.data()), chunk.size())) return false;
+                    bytes_out.fetch_add(chunk.size(), std::memory_order_relaxed);
+                }
+                if (cursor->Done()) {
+                    sink.done();
+                }
+                return true;
+            });
+        }
+
+        // One client at a time; requests are parsed in place in the ring and
+        // results are streamed into the response ring run by run
+        void ShmLoop() {
+            Backend::Profiling::SetThreadName("Bridge Shm Host");
+            BatchCursor cursor;
+            while (!shm_stop.load(std::memory_order_acquire)) {
+                if (!shm.WaitForClient(100)) continue;
+
+                std::span<const std::byte> request;
+                if (!shm.Receive(request, 100)) continue;
+                GE_PROFILE_ZONE("Bridge::ShmBatch");
+                bytes_in.fetch_add(request.size(), std::memory_order_relaxed);
+
+                shm.BeginMessage();
+                if (!processor.Parse(request, cursor)) {
+                    rejected.fetch_add(1, std::memory_order_relaxed);
+                    ResultStreamHeader header;
+                    header.flags = kResultRejected;
+                    shm.Write(std::as_bytes(std::span(&header, 1)));
+                } else {
+                    batches.fetch_add(1, std::memory_order_relaxed);
+                    shm_batches.fetch_add(1, std::memory_order_relaxed);
+                    ops.fetch_add(cursor.OpCount(), std::memory_order_relaxed);
+                    bool connected = true;
+                    while (connected && !cursor.Done()) {
+                        const std::span<const std::byte> chunk = processor.Step(cursor);
+                        connected = shm.Write(chunk);
+                        bytes_out.fetch_add(chunk.size(), std::memory_order_relaxed);
+                    }
+                }
+                shm.EndMessage();
+                shm.Consume();
+            }
+        }
+    };
+
+    // ============================================================================
+    // SERVER
+    // ============================================================================
+
+    Server::Server() : m_impl(std::make_unique<Impl>()) {}
+
+    Server::~Server() {
+        Stop();
+    }
+
+    bool Server::Start(const ServerConfig& config) {
+        if (IsRunning()) return true;
+        m_error.clear();
+        Impl& impl = *m_impl;
+
+        const unsigned threads = config.connection_threads ? config.connection_threads
+                                                           : std::max(2u, std::thread::hardware_concurrency());
+        impl.http.new_task_queue = [threads] { return new httplib::ThreadPool(threads); };
+        impl.http.set_payload_max_length(config.max_batch_bytes);
+        impl.http.set_tcp_nodelay(true);
+        // Load generators and pipeline tools reuse connections indefinitely
+        impl.http.set_keep_alive_max_count(1u << 20);
+        impl.http.set_keep_alive_timeout(30);
+
+        impl.http.Post(kBatchPath, [&impl](const httplib::Request& req, httplib::Response& res) {
+            impl.HandleBatch(req, res);
+        });
+
+        impl.port = config.port == 0 ? impl.http.bind_to_any_port(config.host)
+                                     : (impl.http.bind_to_port(config.host, config.port) ? config.port : -1);
+        if (impl.port < 0) {
+            m_error = "cannot bind " + config.host + ":" + std::to_string(config.port);
+            return false;
+        }
+
+        if (!config.shm_name.empty()) {
+            if (!impl.shm.Create(config.shm_name, config.shm_ring_bytes)) {
+                m_error = impl.shm.Error();
+                impl.http.stop();
+                impl.port = -1;
+                return false;
+            }
+            impl.shm_stop = false;
+            impl.shm_thread = std::thread([&impl] { impl.ShmLoop(); });
+        }
+
+        impl.listener = std::thread([&impl] {
+            Backend::Profiling::SetThreadName("Bridge Listener");
+            impl.http.listen_after_bind();
+        });
+        impl.http.wait_until_ready();
+        return true;
+    }
+
+    void Server::Stop() {
+        Impl& impl = *m_impl;
+        if (impl.shm_thread.joinable()) {
+            impl.shm_stop = true;
+            impl.shm.Interrupt();
+            impl.shm_thread.join();
+            impl.shm.Close();
+        }
+        if (!impl.listener.joinable()) return;
+        impl.http.stop();
+        impl.listener.join();
+        impl.port = -1;
+    }
+
+    bool Server::IsRunning() const {
+        return m_impl->listener.joinable() && m_impl->http.is_running();
+    }
+
+    int Server::Port() const {
+        return m_impl->port;
+    }
+
+    ServerStats Server::GetStats() const {
+        ServerStats stats;
+        stats.batches = m_impl->batches.load(std::memory_order_relaxed);
+        stats.ops = m_impl->ops.load(std::memory_order_relaxed);
+        stats.rejected = m_impl->rejected.load(std::memory_order_relaxed);
+        stats.bytes_in = m_impl->bytes_in.load(std::memory_order_relaxed);
+        stats.bytes_out = m_impl->bytes_out.load(std::memory_order_relaxed);
+        stats.shm_batches = m_impl->shm_batches.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+} // namespace Bridge
@@ -0,0 +1,70 @@
+#pragma once
+
+// Local HTTP service that lets pipeline tools drive the Backend remotely.
+//
+// Everything goes through one endpoint, POST /batch, with binary bodies (see
+// Protocol.h) so a single round trip carries many operations. HTTP requests
+// are accepted on a connection thread pool; inside a batch, consecutive
+// read-only geometry queries are fanned out over the Backend job system (run
+// inline if the host never called Backend::Init) and scene edits are applied
+// serially in request order. Results are streamed back per run of ops, so
+// clients start decoding before the batch finishes. Keep-alive connections
+// are reused; clients pipeline by keeping several batches in flight on
+// separate connections.
+//
+// With `shm_name` set the same batches are also served over a shared-memory
+// channel (ShmChannel.h) for same-host tools that move large meshes. Both
+// transports drive one BatchProcessor, so they see the same meshes and scene.
+
+#include "BridgeAPI.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace Bridge {
+
+    struct ServerConfig {
+        std::string host = "127.0.0.1";
+        int port = 0;                               // 0 = any free port, see Server::Port()
+        unsigned connection_threads = 0;            // 0 = hardware_concurrency
+        std::size_t max_batch_bytes = 512ull << 20;
+
+        std::string shm_name;                       // Empty = no shared-memory transport
+        std::size_t shm_ring_bytes = 64ull << 20;   // Per direction
+    };
+
+    struct ServerStats {
+        std::uint64_t batches = 0;
+        std::uint64_t ops = 0;
+        std::uint64_t rejected = 0;     // Malformed batches
+        std::uint64_t bytes_in = 0;
+        std::uint64_t bytes_out = 0;
+        std::uint64_t shm_batches = 0;  // Subset of `batches` served over shared memory
+    };
+
+    class BRIDGE_API Server {
+    public:
+        Server();
+        ~Server();
+
+        Server(const Server&) = delete;
+        Server& operator=(const Server&) = delete;
+
+        // Binds and starts listening on a background thread
+        bool Start(const ServerConfig& config = {});
+        void Stop();
+        bool IsRunning() const;
+
+        // Bound port (useful with config.port = 0)
+        int Port() const;
+        ServerStats GetStats() const;
+        const std::string& Error() const { return m_error; }
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
+        std::string m_error;
+    };
+
+} // namespace Bridge
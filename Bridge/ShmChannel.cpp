@@ -0,0 +1,533 @@
+#include "ShmChannel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#if defined(_WIN32)
+    #define GE_SHM_SUPPORTED 0
+#else
+    #define GE_SHM_SUPPORTED 1
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <signal.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #if defined(__linux__)
+        #include <linux/futex.h>
+        #include <sys/syscall.h>
+    #endif
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+    #include <immintrin.h>
+    #define SHM_CPU_PAUSE() _mm_pause()
+#else
+    #define SHM_CPU_PAUSE() std::this_thread::yield()
+#endif
+
+namespace Bridge {
+
+    // ============================================================================
+    // SHARED LAYOUT
+    // ============================================================================
+
+    namespace {
+
+        constexpr std::uint32_t kRegionMagic = 0x4D534547;   // "GESM"
+        constexpr std::uint32_t kRegionVersion = 1;
+        constexpr std::size_t kHeaderBytes = 4096;           // Rings start page aligned
+        constexpr std::size_t kMinRingBytes = 64 * 1024;
+
+        // Smallest fragment worth writing before wrapping to the ring start
+        constexpr std::size_t kMinFragment = 4096;
+        constexpr std::uint64_t kMaxFragment = 1ull << 30;   // Fragment::size is 32-bit
+        constexpr int kSpinCount = 2048;
+        constexpr int kSleepSliceMs = 50;                    // Bounds how long peer death goes unnoticed
+
+        enum ClientState : std::uint32_t {
+            kListening = 0,     // Rings clean, a client may attach
+            kAttached = 1,
+            kDetached = 2       // Client left; host resets before the next one
+        };
+
+        enum FragmentFlags : std::uint32_t {
+            kFirst = 1,
+            kLast = 2,
+            kPad = 4            // Skip to the ring start
+        };
+
+        struct Fragment {
+            std::uint32_t size;
+            std::uint32_t flags;
+            std::uint64_t reserved;
+        };
+        static_assert(sizeof(Fragment) == 16);
+
+        constexpr std::uint64_t Align16(std::uint64_t n) { return (n + 15) & ~std::uint64_t(15); }
+        constexpr std::uint64_t AlignDown16(std::uint64_t n) { return n & ~std::uint64_t(15); }
+
+    } // namespace
+
+    // SPSC byte ring. head/tail are monotonically increasing byte counts.
+    struct ShmChannel::Ring {
+        alignas(64) std::atomic<std::uint64_t> head{ 0 };
+        alignas(64) std::atomic<std::uint64_t> tail{ 0 };
+        alignas(64) std::atomic<std::uint32_t> data_seq{ 0 };     // Futex word, bumped when head moves
+        std::atomic<std::uint32_t> reader_waiting{ 0 };
+        alignas(64) std::atomic<std::uint32_t> space_seq{ 0 };    // Futex word, bumped when tail moves
+        std::atomic<std::uint32_t> writer_waiting{ 0 };
+    };
+
+    struct ShmChannel::Region {
+        std::uint32_t magic = kRegionMagic;
+        std::uint32_t version = kRegionVersion;
+        std::uint64_t ring_bytes = 0;
+        std::atomic<std::uint32_t> host_open{ 0 };
+        std::atomic<std::uint32_t> client_state{ kListening };
+        std::atomic<std::int32_t> host_pid{ 0 };
+        std::atomic<std::int32_t> client_pid{ 0 };
+        std::atomic<std::uint32_t> state_seq{ 0 };    // Futex word for attach/detach
+        std::atomic<std::uint32_t> state_waiting{ 0 };
+
+        Ring request;     // Client -> host
+        Ring response;    // Host -> client
+    };
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free && std::atomic<std::uint32_t>::is_always_lock_free,
+                  "shared-memory atomics must be lock-free to work across processes");
+
+    // ============================================================================
+    // WAIT / WAKE
+    // ============================================================================
+
+    namespace {
+
+        void FutexWait(std::atomic<std::uint32_t>& word, std::uint32_t expected, int timeout_ms) {
+#if defined(__linux__)
+            // Not FUTEX_PRIVATE: the waker lives in another process
+            timespec ts{ timeout_ms / 1000, static_cast<long>(timeout_ms % 1000) * 1000000L };
+            syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT, expected, &ts, nullptr, 0);
+#else
+            (void)expected;
+            if (word.load(std::memory_order_acquire) == expected) {
+                std::this_thread::sleep_for(std::chrono::microseconds(timeout_ms > 0 ? 200 : 0));
+            }
+#endif
+        }
+
+        void FutexWake(std::atomic<std::uint32_t>& word) {
+#if defined(__linux__)
+            syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+#else
+            (void)word;
+#endif
+        }
+
+        // Bump the sequence and wake a sleeper if one announced itself
+        void Notify(std::atomic<std::uint32_t>& seq, std::atomic<std::uint32_t>& waiting) {
+            seq.fetch_add(1, std::memory_order_seq_cst);
+            if (waiting.load(std::memory_order_seq_cst) != 0) {
+                FutexWake(seq);
+            }
+        }
+
+        void NotifyAll(std::atomic<std::uint32_t>& seq) {
+            seq.fetch_add(1, std::memory_order_seq_cst);
+#if defined(__linux__)
+            syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&seq), FUTEX_WAKE, 0x7fffffff, nullptr, nullptr, 0);
+#endif
+        }
+
+        bool ProcessAlive(std::int32_t pid) {
+#if GE_SHM_SUPPORTED
+            return pid > 0 && (kill(pid, 0) == 0 || errno == EPERM);
+#else
+            return pid > 0;
+#endif
+        }
+
+        // Spin, then sleep on `seq` until ready() or alive() turns false or the
+        // deadline passes. The waiting flag + seq_cst ordering pairs with Notify.
+        template <typename Ready, typename Alive>
+        bool WaitFor(Ready&& ready, Alive&& alive, std::atomic<std::uint32_t>& seq,
+                     std::atomic<std::uint32_t>& waiting, int timeout_ms) {
+            // Spinning only pays off when the peer can run at the same time
+            static const int spin_count = std::thread::hardware_concurrency() > 1 ? kSpinCount : 0;
+            for (int i = 0; i < spin_count; ++i) {
+                if (ready()) return true;
+                SHM_CPU_PAUSE();
+            }
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms < 0 ? 0 : timeout_ms);
+            for (;;) {
+                const std::uint32_t observed = seq.load(std::memory_order_acquire);
+                waiting.store(1, std::memory_order_seq_cst);
+                if (ready()) {
+                    waiting.store(0, std::memory_order_relaxed);
+                    return true;
+                }
+                if (!alive()) {
+                    waiting.store(0, std::memory_order_relaxed);
+                    return false;
+                }
+                int slice = kSleepSliceMs;
+                if (timeout_ms >= 0) {
+                    const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+                    if (left <= 0) {
+                        waiting.store(0, std::memory_order_relaxed);
+                        return ready();
+                    }
+                    slice = static_cast<int>(std::min<long long>(left, kSleepSliceMs));
+                }
+                FutexWait(seq, observed, slice);
+                waiting.store(0, std::memory_order_relaxed);
+            }
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // LIFECYCLE
+    // ============================================================================
+
+    ShmChannel::~ShmChannel() {
+        Close();
+    }
+
+    bool ShmChannel::Fail(std::string message) {
+        m_error = std::move(message);
+        return false;
+    }
+
+    bool ShmChannel::Map(int fd, std::size_t size) {
+#if GE_SHM_SUPPORTED
+        void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) return false;
+        m_base = static_cast<Region*>(base);
+        m_map_size = size;
+        return true;
+#else
+        (void)fd;
+        (void)size;
+        return false;
+#endif
+    }
+
+    bool ShmChannel::Create(const std::string& name, std::size_t ring_bytes) {
+        Close();
+#if GE_SHM_SUPPORTED
+        ring_bytes = std::max(kMinRingBytes, (ring_bytes + kHeaderBytes - 1) / kHeaderBytes * kHeaderBytes);
+        m_name = name.starts_with('/') ? name : "/" + name;
+
+        // Replace a region left behind by a crashed host
+        shm_unlink(m_name.c_str());
+        const int fd = shm_open(m_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) return Fail("shm_open failed for " + m_name + ": " + std::strerror(errno));
+        const std::size_t size = kHeaderBytes + 2 * ring_bytes;
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            shm_unlink(m_name.c_str());
+            return Fail("cannot size shared region: " + std::string(std::strerror(errno)));
+        }
+        if (!Map(fd, size)) {
+            shm_unlink(m_name.c_str());
+            return Fail("mmap failed: " + std::string(std::strerror(errno)));
+        }
+
+        static_assert(sizeof(Region) <= kHeaderBytes);
+        ::new (static_cast<void*>(m_base)) Region();
+        m_base->ring_bytes = ring_bytes;
+        m_base->host_pid.store(static_cast<std::int32_t>(getpid()), std::memory_order_relaxed);
+        m_base->host_open.store(1, std::memory_order_release);
+
+        m_is_host = true;
+        std::byte* rings = reinterpret_cast<std::byte*>(m_base) + kHeaderBytes;
+        m_rx = &m_base->request;
+        m_tx = &m_base->response;
+        m_rx_data = rings;
+        m_tx_data = rings + ring_bytes;
+        m_first_fragment = true;
+        m_pending_consume = 0;
+        return true;
+#else
+        (void)name;
+        (void)ring_bytes;
+        return Fail("shared-memory transport is not supported on this platform");
+#endif
+    }
+
+    bool ShmChannel::Connect(const std::string& name) {
+        Close();
+#if GE_SHM_SUPPORTED
+        m_name = name.starts_with('/') ? name : "/" + name;
+        const int fd = shm_open(m_name.c_str(), O_RDWR, 0);
+        if (fd < 0) return Fail("no Bridge host at " + m_name);
+        struct stat info {};
+        if (fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < kHeaderBytes) {
+            ::close(fd);
+            return Fail("shared region too small");
+        }
+        if (!Map(fd, static_cast<std::size_t>(info.st_size))) return Fail("mmap failed");
+
+        if (m_base->magic != kRegionMagic || m_base->version != kRegionVersion ||
+            kHeaderBytes + 2 * m_base->ring_bytes != m_map_size) {
+            Close();
+            return Fail("not a Bridge shared region");
+        }
+        if (!m_base->host_open.load(std::memory_order_acquire)) {
+            Close();
+            return Fail("Bridge host is shutting down");
+        }
+
+        // The host may still be resetting after the previous client
+        std::uint32_t expected = kListening;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (!m_base->client_state.compare_exchange_strong(expected, kAttached, std::memory_order_acq_rel)) {
+            if (expected == kAttached || std::chrono::steady_clock::now() > deadline) {
+                Close();
+                return Fail("Bridge host already has a client");
+            }
+            expected = kListening;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        m_base->client_pid.store(static_cast<std::int32_t>(getpid()), std::memory_order_release);
+        Notify(m_base->state_seq, m_base->state_waiting);
+
+        std::byte* rings = reinterpret_cast<std::byte*>(m_base) + kHeaderBytes;
+        m_tx = &m_base->request;
+        m_rx = &m_base->response;
+        m_tx_data = rings;
+        m_rx_data = rings + m_base->ring_bytes;
+        m_first_fragment = true;
+        m_pending_consume = 0;
+        return true;
+#else
+        (void)name;
+        return Fail("shared-memory transport is not supported on this platform");
+#endif
+    }
+
+    void ShmChannel::Interrupt() {
+        if (!m_base) return;
+#if GE_SHM_SUPPORTED
+        if (m_is_host) {
+            m_base->host_open.store(0, std::memory_order_seq_cst);
+        } else {
+            m_base->client_pid.store(0, std::memory_order_relaxed);
+            m_base->client_state.store(kDetached, std::memory_order_seq_cst);
+        }
+        // Wake anyone blocked on either ring so they observe the close
+        NotifyAll(m_base->request.data_seq);
+        NotifyAll(m_base->request.space_seq);
+        NotifyAll(m_base->response.data_seq);
+        NotifyAll(m_base->response.space_seq);
+        NotifyAll(m_base->state_seq);
+#endif
+    }
+
+    void ShmChannel::Close() {
+        if (!m_base) return;
+        Interrupt();
+#if GE_SHM_SUPPORTED
+        munmap(m_base, m_map_size);
+        if (m_is_host) shm_unlink(m_name.c_str());
+#endif
+        m_base = nullptr;
+        m_map_size = 0;
+        m_tx = m_rx = nullptr;
+        m_tx_data = m_rx_data = nullptr;
+        m_is_host = false;
+        m_pending_consume = 0;
+        m_assembly.clear();
+    }
+
+    bool ShmChannel::PeerConnected() const {
+        if (!m_base || !m_base->host_open.load(std::memory_order_acquire)) return false;
+        if (m_base->client_state.load(std::memory_order_acquire) != kAttached) return false;
+        if (m_is_host) {
+            const std::int32_t pid = m_base->client_pid.load(std::memory_order_acquire);
+            // pid is published just after the attach CAS
+            return pid == 0 || ProcessAlive(pid);
+        }
+        return ProcessAlive(m_base->host_pid.load(std::memory_order_acquire));
+    }
+
+    bool ShmChannel::WaitForClient(int timeout_ms) {
+        if (!m_base || !m_is_host) return false;
+        Region& region = *m_base;
+
+        // A client that left (or died) leaves the rings mid-message; reset them
+        // while nobody is attached
+        const std::uint32_t state = region.client_state.load(std::memory_order_acquire);
+        const std::int32_t pid = region.client_pid.load(std::memory_order_acquire);
+        if (state == kDetached || (state == kAttached && pid != 0 && !ProcessAlive(pid))) {
+            for (Ring* ring : { &region.request, &region.response }) {
+                ring->head.store(0, std::memory_order_relaxed);
+                ring->tail.store(0, std::memory_order_relaxed);
+            }
+            m_first_fragment = true;
+            m_pending_consume = 0;
+            m_assembly.clear();
+            region.client_pid.store(0, std::memory_order_relaxed);
+            region.client_state.store(kListening, std::memory_order_seq_cst);
+        }
+
+        return WaitFor([&] { return region.client_state.load(std::memory_order_acquire) == kAttached; },
+                       [&] { return region.host_open.load(std::memory_order_acquire) != 0; },
+                       region.state_seq, region.state_waiting, timeout_ms);
+    }
+
+    // ============================================================================
+    // WRITING
+    // ============================================================================
+
+    bool ShmChannel::Send(std::span<const std::byte> message) {
+        BeginMessage();
+        return WriteFragment(message, true);
+    }
+
+    void ShmChannel::BeginMessage() {
+        m_first_fragment = true;
+    }
+
+    bool ShmChannel::Write(std::span<const std::byte> bytes) {
+        if (bytes.empty()) return true;
+        return WriteFragment(bytes, false);
+    }
+
+    bool ShmChannel::EndMessage() {
+        return WriteFragment({}, true);
+    }
+
+    bool ShmChannel::WriteFragment(std::span<const std::byte> bytes, bool last) {
+        if (!m_tx) return Fail("channel is not open");
+        Ring& ring = *m_tx;
+        const std::uint64_t capacity = m_base->ring_bytes;
+        auto alive = [this] { return PeerConnected(); };
+
+        do {
+            const std::uint64_t head = ring.head.load(std::memory_order_relaxed);
+            const std::uint64_t pos = head % capacity;
+            const std::uint64_t to_end = capacity - pos;
+            const std::uint64_t want = sizeof(Fragment) + Align16(bytes.size());
+
+            // A whole message that fits the ring is kept contiguous so the
+            // reader can use it in place; otherwise split at the wrap point
+            const bool whole = m_first_fragment && last && want <= capacity && want <= kMaxFragment;
+            if (to_end < want && (whole || to_end < sizeof(Fragment) + kMinFragment)) {
+                if (!WaitFor([&] { return capacity - (head - ring.tail.load(std::memory_order_acquire)) >= to_end; },
+                             alive, ring.space_seq, ring.writer_waiting, -1)) {
+                    return Fail("peer disconnected");
+                }
+                const Fragment pad{ 0, kPad, 0 };
+                std::memcpy(m_tx_data + pos, &pad, sizeof(pad));
+                ring.head.store(head + to_end, std::memory_order_seq_cst);
+                Notify(ring.data_seq, ring.reader_waiting);
+                continue;
+            }
+
+            const std::uint64_t needed = whole ? want : sizeof(Fragment) + Align16(std::min<std::uint64_t>(bytes.size(), kMinFragment));
+            std::uint64_t free = capacity - (head - ring.tail.load(std::memory_order_acquire));
+            if (free < needed) {
+                if (!WaitFor([&] { return capacity - (head - ring.tail.load(std::memory_order_acquire)) >= needed; },
+                             alive, ring.space_seq, ring.writer_waiting, -1)) {
+                    return Fail("peer disconnected");
+                }
+                free = capacity - (head - ring.tail.load(std::memory_order_acquire));
+            }
+
+            const std::uint64_t room = std::min(AlignDown16(std::min(to_end, free) - sizeof(Fragment)), kMaxFragment);
+            const std::size_t chunk = static_cast<std::size_t>(std::min<std::uint64_t>(bytes.size(), room));
+            Fragment fragment{ static_cast<std::uint32_t>(chunk), 0, 0 };
+            if (m_first_fragment) fragment.flags |= kFirst;
+            if (last && chunk == bytes.size()) fragment.flags |= kLast;
+
+            std::memcpy(m_tx_data + pos, &fragment, sizeof(fragment));
+            if (chunk) std::memcpy(m_tx_data + pos + sizeof(fragment), bytes.data(), chunk);
+            ring.head.store(head + sizeof(Fragment) + Align16(chunk), std::memory_order_seq_cst);
+            Notify(ring.data_seq, ring.reader_waiting);
+
+            m_first_fragment = false;
+            bytes = bytes.subspan(chunk);
+        } while (!bytes.empty());
+
+        if (last) m_first_fragment = true;
+        return true;
+    }
+
+    // ============================================================================
+    // READING
+    // ============================================================================
+
+    bool ShmChannel::Receive(std::span<const std::byte>& message, int timeout_ms) {
+        if (!m_rx) return Fail("channel is not open");
+        Consume();
+        Ring& ring = *m_rx;
+        const std::uint64_t capacity = m_base->ring_bytes;
+        auto alive = [this] { return PeerConnected(); };
+
+        m_assembly.clear();
+        bool assembling = false;
+        for (;;) {
+            const std::uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+            if (!WaitFor([&] { return ring.head.load(std::memory_order_acquire) != tail; },
+                         alive, ring.data_seq, ring.reader_waiting, assembling ? -1 : timeout_ms)) {
+                return false;
+            }
+
+            // The writer publishes head only after a whole fragment is written
+            const std::uint64_t head = ring.head.load(std::memory_order_acquire);
+            const std::uint64_t pos = tail % capacity;
+            Fragment fragment;
+            std::memcpy(&fragment, m_rx_data + pos, sizeof(fragment));
+            const std::uint64_t record = (fragment.flags & kPad) ? capacity - pos
+                                                                 : sizeof(Fragment) + Align16(fragment.size);
+
+            // The header is peer-written: a record must stay inside the ring
+            // and inside what was published, or payload spans would leave the
+            // mapping. Nothing after a bad record can be trusted.
+            const bool valid = (fragment.flags & ~std::uint32_t(kFirst | kLast | kPad)) == 0 &&
+                               ((fragment.flags & kPad) ? pos != 0
+                                                        : fragment.size <= kMaxFragment && record <= capacity - pos) &&
+                               record <= head - tail;
+            if (!valid) {
+                Interrupt();
+                return Fail("corrupt fragment in receive ring");
+            }
+            const std::byte* payload = m_rx_data + pos + sizeof(Fragment);
+
+            if (!(fragment.flags & kPad)) {
+                if (!assembling && (fragment.flags & kFirst) && (fragment.flags & kLast)) {
+                    // Zero copy: the record stays in the ring until Consume()
+                    message = std::span<const std::byte>(payload, fragment.size);
+                    m_pending_consume = record;
+                    return true;
+                }
+                m_assembly.insert(m_assembly.end(), payload, payload + fragment.size);
+                assembling = true;
+            }
+
+            ring.tail.store(tail + record, std::memory_order_seq_cst);
+            Notify(ring.space_seq, ring.writer_waiting);
+
+            if (assembling && (fragment.flags & kLast)) {
+                message = m_assembly;
+                return true;
+            }
+        }
+    }
+
+    void ShmChannel::Consume() {
+        if (!m_pending_consume || !m_rx) return;
+        Ring& ring = *m_rx;
+        ring.tail.store(ring.tail.load(std::memory_order_relaxed) + m_pending_consume, std::memory_order_seq_cst);
+        m_pending_consume = 0;
+        Notify(ring.space_seq, ring.writer_waiting);
+    }
+
+} // namespace Bridge
@@ -0,0 +1,113 @@
+#pragma once
+
+// Same-host message channel over shared memory.
+//
+// One named region (shm_open) holds two single-producer/single-consumer byte
+// rings: requests (client -> host) and responses (host -> client). Messages
+// are written straight into the ring and, when they fit in one fragment, read
+// in place, so large vertex buffers cross the process boundary with a single
+// memcpy and no syscalls on the fast path. Blocking waits spin briefly, then
+// sleep on a futex in the shared region (Linux; other POSIX systems back off
+// with short sleeps). Messages larger than a ring are streamed as fragments
+// and reassembled by the reader.
+//
+// One client per region at a time. Windows is not supported yet: Create and
+// Connect fail with an error.
+
+#include "BridgeAPI.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Bridge {
+
+    class BRIDGE_API ShmChannel {
+    public:
+        static constexpr std::size_t kDefaultRingBytes = 64ull << 20;
+
+        ShmChannel() = default;
+        ~ShmChannel();
+
+        ShmChannel(const ShmChannel&) = delete;
+        ShmChannel& operator=(const ShmChannel&) = delete;
+
+        // Host side: creates (or replaces) the region `name` with two rings of
+        // `ring_bytes` each
+        bool Create(const std::string& name, std::size_t ring_bytes = kDefaultRingBytes);
+
+        // Client side: attaches to a region created by a host
+        bool Connect(const std::string& name);
+
+        // Marks this side closed (waking the peer) and unmaps; the host also
+        // unlinks the name
+        void Close();
+
+        // Thread-safe: marks this side closed and wakes blocked calls on both
+        // sides so they fail promptly. Follow with Close() on the owning thread.
+        void Interrupt();
+
+        bool IsOpen() const { return m_base != nullptr; }
+
+        // Host: true while a client is attached. Client: true while the host is up.
+        bool PeerConnected() const;
+
+        // Host: blocks until a client attaches, `timeout_ms` < 0 waits forever
+        bool WaitForClient(int timeout_ms = -1);
+
+        // ============================================================================
+        // WRITING
+        // ============================================================================
+
+        // Whole message in one call
+        bool Send(std::span<const std::byte> message);
+
+        // Streamed message: any number of Write() calls between Begin/End.
+        // Each Write may block until the reader frees space.
+        void BeginMessage();
+        bool Write(std::span<const std::byte> bytes);
+        bool EndMessage();
+
+        // ============================================================================
+        // READING
+        // ============================================================================
+
+        // Next message. Single-fragment messages are returned in place (zero
+        // copy) and stay valid until Consume(); larger ones are reassembled
+        // into an internal buffer. False on timeout or when the peer closed.
+        // A fragment header that points outside the ring interrupts the
+        // channel, since nothing after it can be trusted.
+        bool Receive(std::span<const std::byte>& message, int timeout_ms = -1);
+
+        // Releases the message returned by Receive()
+        void Consume();
+
+        const std::string& Error() const { return m_error; }
+
+    private:
+        struct Region;
+        struct Ring;
+
+        bool Map(int fd, std::size_t size);
+        bool WriteFragment(std::span<const std::byte> bytes, bool last);
+        bool Fail(std::string message);
+
+        Region* m_base = nullptr;
+        std::size_t m_map_size = 0;
+        bool m_is_host = false;
+        std::string m_name;
+        std::string m_error;
+
+        // Rings as seen from this side
+        Ring* m_tx = nullptr;
+        Ring* m_rx = nullptr;
+        std::byte* m_tx_data = nullptr;
+        std::byte* m_rx_data = nullptr;
+
+        bool m_first_fragment = true;
+        std::uint64_t m_pending_consume = 0;
+        std::vector<std::byte> m_assembly;
+    };
+
+} // namespace Bridge
@@ -0,0 +1,196 @@
+#pragma once
+
+// Font file loading for WindowSetup::LoadFonts.
+//
+// Font paths are resolved against a small set of asset roots once per process
+// (hits and misses are both remembered), and files are memory-mapped instead
+// of read into heap copies. Prefetch() starts resolution and mapping on a
+// background thread so disk I/O overlaps GLFW/GL context creation; Acquire()
+// waits for it. Mappings are handed to ImGui with FontDataOwnedByAtlas=false
+// and must outlive the ImGui context (see Release()).
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace FontCache {
+
+    // ============================================================================
+    // MAPPED FILE
+    // ============================================================================
+
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile() { Close(); }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool Open(const std::string& path) {
+            Close();
+#if defined(_WIN32)
+            HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                      OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (file == INVALID_HANDLE_VALUE) return false;
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+                CloseHandle(file);
+                return false;
+            }
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(file);
+            if (!mapping) return false;
+            m_data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+            if (!m_data) return false;
+            m_size = static_cast<std::size_t>(size.QuadPart);
+#else
+            const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) return false;
+            struct stat st;
+            if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+                ::close(fd);
+                return false;
+            }
+            void* data = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (data == MAP_FAILED) return false;
+            // The whole file is parsed by stb_truetype; fault it in ahead of use
+            ::madvise(data, static_cast<std::size_t>(st.st_size), MADV_WILLNEED);
+            m_data = data;
+            m_size = static_cast<std::size_t>(st.st_size);
+#endif
+            return true;
+        }
+
+        void Close() {
+            if (!m_data) return;
+#if defined(_WIN32)
+            UnmapViewOfFile(m_data);
+#else
+            ::munmap(m_data, m_size);
+#endif
+            m_data = nullptr;
+            m_size = 0;
+        }
+
+        const void* Data() const { return m_data; }
+        std::size_t Size() const { return m_size; }
+        bool IsOpen() const { return m_data != nullptr; }
+
+    private:
+        void* m_data = nullptr;
+        std::size_t m_size = 0;
+    };
+
+    // ============================================================================
+    // PATH RESOLUTION
+    // ============================================================================
+
+    namespace Internal {
+        inline std::mutex s_mutex;
+        inline std::map<std::string, std::string> s_resolved;   // Request -> path ("" = not found)
+        inline std::map<std::string, std::unique_ptr<MappedFile>> s_files;
+        inline std::future<void> s_prefetch;
+    }
+
+    // Tries the path as given, relative to parent directories, and by file name.
+    // The first root that yields a hit is tried first for later requests.
+    inline std::string ResolvePath(const std::string& path) {
+        std::lock_guard<std::mutex> lock(Internal::s_mutex);
+        auto it = Internal::s_resolved.find(path);
+        if (it != Internal::s_resolved.end()) return it->second;
+
+        static std::string s_hit_prefix;
+        const std::string file_name = std::filesystem::path(path).filename().string();
+        const std::string candidates[] = { s_hit_prefix + path, path, "../" + path, "../../" + path, file_name };
+
+        std::string resolved;
+        std::error_code ec;
+        for (const std::string& candidate : candidates) {
+            if (std::filesystem::is_regular_file(candidate, ec)) {
+                resolved = candidate;
+                if (candidate.size() > path.size() && candidate.ends_with(path)) {
+                    s_hit_prefix = candidate.substr(0, candidate.size() - path.size());
+                }
+                break;
+            }
+        }
+
+        Internal::s_resolved[path] = resolved;
+        return resolved;
+    }
+
+    // ============================================================================
+    // LOADING
+    // ============================================================================
+
+    namespace Internal {
+        inline const MappedFile* MapLocked(const std::string& path, const std::string& resolved) {
+            auto it = s_files.find(path);
+            if (it != s_files.end()) return it->second.get();
+            auto file = std::make_unique<MappedFile>();
+            if (resolved.empty() || !file->Open(resolved)) {
+                s_files[path] = nullptr;
+                return nullptr;
+            }
+            return (s_files[path] = std::move(file)).get();
+        }
+    }
+
+    // Starts resolving and mapping `paths` on a background thread (call early)
+    inline void Prefetch(std::vector<std::string> paths) {
+        if (Internal::s_prefetch.valid()) return;
+        Internal::s_prefetch = std::async(std::launch::async, [paths = std::move(paths)] {
+            for (const std::string& path : paths) {
+                if (path.empty()) continue;
+                const std::string resolved = ResolvePath(path);
+                std::lock_guard<std::mutex> lock(Internal::s_mutex);
+                Internal::MapLocked(path, resolved);
+            }
+        });
+    }
+
+    // Returns the mapped font or nullptr if it cannot be found; waits for Prefetch()
+    inline const MappedFile* Acquire(const std::string& path) {
+        if (Internal::s_prefetch.valid()) {
+            Internal::s_prefetch.wait();
+        }
+        const std::string resolved = ResolvePath(path);
+        std::lock_guard<std::mutex> lock(Internal::s_mutex);
+        return Internal::MapLocked(path, resolved);
+    }
+
+    // Unmaps everything; only after ImGui::DestroyContext()
+    inline void Release() {
+        if (Internal::s_prefetch.valid()) {
+            Internal::s_prefetch.wait();
+            Internal::s_prefetch = {};
+        }
+        std::lock_guard<std::mutex> lock(Internal::s_mutex);
+        Internal::s_files.clear();
+    }
+
+} // namespace FontCache
@@ -0,0 +1,230 @@
+#pragma once
+
+// Frame pacing measurements for WindowSetup.
+//
+// FrameHistory keeps the last kCapacity frames in a ring buffer. Push only
+// updates running totals and the stutter flag; percentiles are selected on
+// demand when Stats() is read (the DebugPanel), never per frame. GpuTimer brackets the main
+// viewport's draw submission with GL_TIME_ELAPSED queries; results are read
+// back a few frames later without stalling the pipeline.
+
+#include "GLFunctions.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace FrameTiming {
+
+    // ============================================================================
+    // SAMPLES & STATS
+    // ============================================================================
+
+    struct FrameSample {
+        float frame_ms = 0.0f;      // Swap-to-swap interval
+        float events_ms = 0.0f;     // glfwPollEvents
+        float update_ms = 0.0f;     // NewFrame .. EndFrame (UI + app update)
+        float render_ms = 0.0f;     // ImGui::Render + draw submission + viewports
+        float swap_ms = 0.0f;       // glfwSwapBuffers (includes vsync wait)
+        float gpu_ms = -1.0f;       // -1 until the timer query resolves
+        std::uint32_t draw_commands = 0;
+        bool stutter = false;
+    };
+
+    struct FrameStats {
+        float avg_ms = 0.0f;
+        float p50_ms = 0.0f;
+        float p95_ms = 0.0f;
+        float p99_ms = 0.0f;
+        float max_ms = 0.0f;
+        std::uint64_t stutter_count = 0;
+        std::uint64_t frame_count = 0;
+    };
+
+    // ============================================================================
+    // HISTORY
+    // ============================================================================
+
+    class FrameHistory {
+    public:
+        static constexpr std::size_t kCapacity = 512;
+
+        // A frame counts as a stutter when it exceeds both ratio x median and
+        // median + margin; the margin keeps tiny medians (uncapped FPS) quiet.
+        float stutter_ratio = 2.0f;
+        float stutter_margin_ms = 4.0f;
+
+        // Returns the frame index assigned to the sample
+        std::uint64_t Push(FrameSample sample) {
+            // Judge against the median of the frames before this one; refreshed
+            // every kMedianRefresh frames, which is plenty for a stutter baseline
+            if (m_count >= 16) {
+                if (m_median_age >= kMedianRefresh) {
+                    m_median_ms = Select(0.50f);
+                    m_median_age = 0;
+                }
+                ++m_median_age;
+                const float threshold = std::max(m_median_ms * stutter_ratio, m_median_ms + stutter_margin_ms);
+                sample.stutter = sample.frame_ms > threshold;
+            }
+            if (sample.stutter) ++m_stats.stutter_count;
+
+            if (m_count == kCapacity) m_sum_ms -= m_samples[m_head].frame_ms;
+            m_sum_ms += sample.frame_ms;
+            m_samples[m_head] = sample;
+            m_head = (m_head + 1) % kCapacity;
+            m_count = m_count < kCapacity ? m_count + 1 : kCapacity;
+            ++m_stats.frame_count;
+            m_stats.avg_ms = static_cast<float>(m_sum_ms / static_cast<double>(m_count));
+            m_percentiles_valid = false;
+            return m_stats.frame_count - 1;
+        }
+
+        // GPU results arrive late; patch the sample if it is still in the ring
+        void SetGpuTime(std::uint64_t frame_index, float gpu_ms) {
+            const std::uint64_t newest = m_stats.frame_count - 1;
+            if (m_stats.frame_count == 0 || frame_index > newest) return;
+            const std::uint64_t ago = newest - frame_index;
+            if (ago >= m_count) return;
+            m_samples[(m_head + kCapacity - 1 - ago) % kCapacity].gpu_ms = gpu_ms;
+        }
+
+        std::size_t Count() const { return m_count; }
+        std::uint64_t FrameCount() const { return m_stats.frame_count; }
+        float AverageMs() const { return m_stats.avg_ms; }
+        std::uint64_t StutterCount() const { return m_stats.stutter_count; }
+
+        // Percentiles are selected here, at most once per pushed frame
+        const FrameStats& Stats() const {
+            if (!m_percentiles_valid && m_count > 0) {
+                m_stats.p50_ms = Select(0.50f);
+                m_stats.p95_ms = Select(0.95f);
+                m_stats.p99_ms = Select(0.99f);
+                m_stats.max_ms = Select(1.0f);
+            }
+            m_percentiles_valid = true;
+            return m_stats;
+        }
+
+        // 0 = most recent frame
+        const FrameSample& At(std::size_t frames_ago) const {
+            return m_samples[(m_head + kCapacity - 1 - frames_ago) % kCapacity];
+        }
+
+        // Copies one field oldest-first into `out` (for ImGui::PlotLines); returns the count
+        template <typename Field>
+        std::size_t Copy(float* out, std::size_t max_count, Field FrameSample::* field) const {
+            const std::size_t n = std::min(m_count, max_count);
+            for (std::size_t i = 0; i < n; ++i) {
+                out[i] = static_cast<float>(At(n - 1 - i).*field);
+            }
+            return n;
+        }
+
+        void Clear() {
+            m_head = 0;
+            m_count = 0;
+            m_sum_ms = 0.0;
+            m_median_ms = 0.0f;
+            m_median_age = kMedianRefresh;
+            m_percentiles_valid = false;
+            m_stats = FrameStats{};
+        }
+
+    private:
+        static constexpr std::uint32_t kMedianRefresh = 32;
+
+        // Frame time at percentile p of the window; nth_element on a scratch copy
+        float Select(float p) const {
+            for (std::size_t i = 0; i < m_count; ++i) m_scratch[i] = m_samples[i].frame_ms;
+            const std::size_t rank = static_cast<std::size_t>(p * static_cast<float>(m_count - 1) + 0.5f);
+            std::nth_element(m_scratch, m_scratch + rank, m_scratch + m_count);
+            return m_scratch[rank];
+        }
+
+        FrameSample m_samples[kCapacity];
+        mutable float m_scratch[kCapacity];
+        std::size_t m_head = 0;
+        std::size_t m_count = 0;
+        double m_sum_ms = 0.0;
+        float m_median_ms = 0.0f;
+        std::uint32_t m_median_age = kMedianRefresh;
+        mutable bool m_percentiles_valid = false;
+        mutable FrameStats m_stats;
+    };
+
+    // ============================================================================
+    // GPU TIMER
+    // ============================================================================
+
+    class GpuTimer {
+    public:
+        // Enough in-flight queries to cover the driver's frame queue
+        static constexpr int kQueryCount = 4;
+
+        struct Result {
+            std::uint64_t frame_index;
+            float gpu_ms;
+        };
+
+        bool Initialize() {
+            const GLFunctions::Table& gl = GLFunctions::Load();
+            if (!gl.HasTimerQueries()) return false;
+            gl.GenQueries(kQueryCount, m_queries);
+            m_available = true;
+            return true;
+        }
+
+        void Shutdown() {
+            if (!m_available) return;
+            GLFunctions::Get().DeleteQueries(kQueryCount, m_queries);
+            m_available = false;
+            for (bool& pending : m_pending) pending = false;
+        }
+
+        bool IsAvailable() const { return m_available; }
+
+        // Skips the frame if the slot is still waiting on the GPU
+        void Begin(std::uint64_t frame_index) {
+            m_active = false;
+            if (!m_available || m_pending[m_slot]) return;
+            GLFunctions::Get().BeginQuery(GLFunctions::kTimeElapsed, m_queries[m_slot]);
+            m_frames[m_slot] = frame_index;
+            m_active = true;
+        }
+
+        void End() {
+            if (!m_active) return;
+            GLFunctions::Get().EndQuery(GLFunctions::kTimeElapsed);
+            m_pending[m_slot] = true;
+            m_slot = (m_slot + 1) % kQueryCount;
+            m_active = false;
+        }
+
+        // Non-blocking; returns the number of results written to `out`
+        int Collect(Result* out) {
+            if (!m_available) return 0;
+            const GLFunctions::Table& gl = GLFunctions::Get();
+            int n = 0;
+            for (int i = 0; i < kQueryCount; ++i) {
+                if (!m_pending[i]) continue;
+                int ready = 0;
+                gl.GetQueryObjectiv(m_queries[i], GLFunctions::kQueryResultAvailable, &ready);
+                if (!ready) continue;
+                std::uint64_t ns = 0;
+                gl.GetQueryObjectui64v(m_queries[i], GLFunctions::kQueryResult, &ns);
+                out[n++] = Result{ m_frames[i], static_cast<float>(static_cast<double>(ns) / 1.0e6) };
+                m_pending[i] = false;
+            }
+            return n;
+        }
+
+    private:
+        unsigned int m_queries[kQueryCount] = {};
+        std::uint64_t m_frames[kQueryCount] = {};
+        bool m_pending[kQueryCount] = {};
+        int m_slot = 0;
+        bool m_active = false;
+        bool m_available = false;
+    };
+
+} // namespace FrameTiming
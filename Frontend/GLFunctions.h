@@ -0,0 +1,226 @@
+#pragma once
+
+// Minimal loader for the GL entry points the Frontend uses beyond what the
+// platform gl.h exports (Windows only ships GL 1.1 there). Loaded once after
+// the context is current; each pointer stays null if the driver lacks it.
+
+#include <GLFW/glfw3.h>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_WIN32)
+    #define GE_GL_APIENTRY __stdcall
+#else
+    #define GE_GL_APIENTRY
+#endif
+
+namespace GLFunctions {
+
+    // Enums not present in every platform gl.h
+    inline constexpr unsigned int kQueryResult          = 0x8866;
+    inline constexpr unsigned int kQueryResultAvailable = 0x8867;
+    inline constexpr unsigned int kTimeElapsed          = 0x88BF;
+    inline constexpr unsigned int kFramebuffer          = 0x8D40;
+    inline constexpr unsigned int kRenderbuffer         = 0x8D41;
+    inline constexpr unsigned int kColorAttachment0     = 0x8CE0;
+    inline constexpr unsigned int kFramebufferComplete  = 0x8CD5;
+    inline constexpr unsigned int kRGBA8                = 0x8058;
+
+    // Buffers, shaders, sync objects (ImGuiRenderer)
+    inline constexpr unsigned int kArrayBuffer          = 0x8892;
+    inline constexpr unsigned int kElementArrayBuffer   = 0x8893;
+    inline constexpr unsigned int kStreamDraw           = 0x88E0;
+    inline constexpr unsigned int kMapWriteBit          = 0x0002;
+    inline constexpr unsigned int kMapInvalidateBuffer  = 0x0008;
+    inline constexpr unsigned int kMapPersistentBit     = 0x0040;
+    inline constexpr unsigned int kMapCoherentBit       = 0x0080;
+    inline constexpr unsigned int kVertexShader         = 0x8B31;
+    inline constexpr unsigned int kFragmentShader       = 0x8B30;
+    inline constexpr unsigned int kCompileStatus        = 0x8B81;
+    inline constexpr unsigned int kLinkStatus           = 0x8B82;
+    inline constexpr unsigned int kInfoLogLength        = 0x8B84;
+    inline constexpr unsigned int kTexture0             = 0x84C0;
+    inline constexpr unsigned int kFuncAdd              = 0x8006;
+    inline constexpr unsigned int kMajorVersion         = 0x821B;
+    inline constexpr unsigned int kMinorVersion         = 0x821C;
+    inline constexpr unsigned int kNumExtensions        = 0x821D;
+    inline constexpr unsigned int kSyncGpuCommandsComplete = 0x9117;
+    inline constexpr unsigned int kSyncFlushCommandsBit = 0x00000001;
+    inline constexpr unsigned int kTimeoutExpired       = 0x911B;
+    inline constexpr unsigned int kWaitFailed           = 0x911D;
+
+    struct SyncObject;              // GLsync
+    using Sync = SyncObject*;
+
+    struct Table {
+        // GL 1.5 queries + GL 3.3 / ARB_timer_query
+        void (GE_GL_APIENTRY* GenQueries)(int n, unsigned int* ids) = nullptr;
+        void (GE_GL_APIENTRY* DeleteQueries)(int n, const unsigned int* ids) = nullptr;
+        void (GE_GL_APIENTRY* BeginQuery)(unsigned int target, unsigned int id) = nullptr;
+        void (GE_GL_APIENTRY* EndQuery)(unsigned int target) = nullptr;
+        void (GE_GL_APIENTRY* GetQueryObjectiv)(unsigned int id, unsigned int pname, int* params) = nullptr;
+        void (GE_GL_APIENTRY* GetQueryObjectui64v)(unsigned int id, unsigned int pname, std::uint64_t* params) = nullptr;
+
+        // GL 3.0 framebuffer objects (headless rendering)
+        void (GE_GL_APIENTRY* GenFramebuffers)(int n, unsigned int* ids) = nullptr;
+        void (GE_GL_APIENTRY* DeleteFramebuffers)(int n, const unsigned int* ids) = nullptr;
+        void (GE_GL_APIENTRY* BindFramebuffer)(unsigned int target, unsigned int id) = nullptr;
+        unsigned int (GE_GL_APIENTRY* CheckFramebufferStatus)(unsigned int target) = nullptr;
+        void (GE_GL_APIENTRY* FramebufferRenderbuffer)(unsigned int target, unsigned int attachment, unsigned int rb_target, unsigned int rb) = nullptr;
+        void (GE_GL_APIENTRY* GenRenderbuffers)(int n, unsigned int* ids) = nullptr;
+        void (GE_GL_APIENTRY* DeleteRenderbuffers)(int n, const unsigned int* ids) = nullptr;
+        void (GE_GL_APIENTRY* BindRenderbuffer)(unsigned int target, unsigned int id) = nullptr;
+        void (GE_GL_APIENTRY* RenderbufferStorage)(unsigned int target, unsigned int format, int width, int height) = nullptr;
+
+        // GL 2.0 shaders
+        unsigned int (GE_GL_APIENTRY* CreateShader)(unsigned int type) = nullptr;
+        void (GE_GL_APIENTRY* ShaderSource)(unsigned int shader, int count, const char* const* sources, const int* lengths) = nullptr;
+        void (GE_GL_APIENTRY* CompileShader)(unsigned int shader) = nullptr;
+        void (GE_GL_APIENTRY* GetShaderiv)(unsigned int shader, unsigned int pname, int* params) = nullptr;
+        void (GE_GL_APIENTRY* GetShaderInfoLog)(unsigned int shader, int size, int* length, char* log) = nullptr;
+        void (GE_GL_APIENTRY* DeleteShader)(unsigned int shader) = nullptr;
+        unsigned int (GE_GL_APIENTRY* CreateProgram)() = nullptr;
+        void (GE_GL_APIENTRY* AttachShader)(unsigned int program, unsigned int shader) = nullptr;
+        void (GE_GL_APIENTRY* BindAttribLocation)(unsigned int program, unsigned int index, const char* name) = nullptr;
+        void (GE_GL_APIENTRY* LinkProgram)(unsigned int program) = nullptr;
+        void (GE_GL_APIENTRY* GetProgramiv)(unsigned int program, unsigned int pname, int* params) = nullptr;
+        void (GE_GL_APIENTRY* GetProgramInfoLog)(unsigned int program, int size, int* length, char* log) = nullptr;
+        void (GE_GL_APIENTRY* DeleteProgram)(unsigned int program) = nullptr;
+        void (GE_GL_APIENTRY* UseProgram)(unsigned int program) = nullptr;
+        int (GE_GL_APIENTRY* GetUniformLocation)(unsigned int program, const char* name) = nullptr;
+        void (GE_GL_APIENTRY* Uniform1i)(int location, int value) = nullptr;
+        void (GE_GL_APIENTRY* UniformMatrix4fv)(int location, int count, unsigned char transpose, const float* value) = nullptr;
+        void (GE_GL_APIENTRY* ActiveTexture)(unsigned int texture) = nullptr;
+        void (GE_GL_APIENTRY* BlendEquation)(unsigned int mode) = nullptr;
+        void (GE_GL_APIENTRY* BlendFuncSeparate)(unsigned int src_rgb, unsigned int dst_rgb, unsigned int src_alpha, unsigned int dst_alpha) = nullptr;
+
+        // GL 1.5 / 3.0 buffers and vertex arrays
+        void (GE_GL_APIENTRY* GenBuffers)(int n, unsigned int* ids) = nullptr;
+        void (GE_GL_APIENTRY* DeleteBuffers)(int n, const unsigned int* ids) = nullptr;
+        void (GE_GL_APIENTRY* BindBuffer)(unsigned int target, unsigned int id) = nullptr;
+        void (GE_GL_APIENTRY* BufferData)(unsigned int target, std::ptrdiff_t size, const void* data, unsigned int usage) = nullptr;
+        void* (GE_GL_APIENTRY* MapBufferRange)(unsigned int target, std::ptrdiff_t offset, std::ptrdiff_t length, unsigned int access) = nullptr;
+        unsigned char (GE_GL_APIENTRY* UnmapBuffer)(unsigned int target) = nullptr;
+        void (GE_GL_APIENTRY* GenVertexArrays)(int n, unsigned int* ids) = nullptr;
+        void (GE_GL_APIENTRY* DeleteVertexArrays)(int n, const unsigned int* ids) = nullptr;
+        void (GE_GL_APIENTRY* BindVertexArray)(unsigned int id) = nullptr;
+        void (GE_GL_APIENTRY* EnableVertexAttribArray)(unsigned int index) = nullptr;
+        void (GE_GL_APIENTRY* VertexAttribPointer)(unsigned int index, int size, unsigned int type, unsigned char normalized, int stride, const void* offset) = nullptr;
+        const unsigned char* (GE_GL_APIENTRY* GetStringi)(unsigned int name, unsigned int index) = nullptr;
+
+        // GL 3.2 base vertex + sync objects, GL 3.3 samplers
+        void (GE_GL_APIENTRY* DrawElementsBaseVertex)(unsigned int mode, int count, unsigned int type, const void* indices, int base_vertex) = nullptr;
+        Sync (GE_GL_APIENTRY* FenceSync)(unsigned int condition, unsigned int flags) = nullptr;
+        unsigned int (GE_GL_APIENTRY* ClientWaitSync)(Sync sync, unsigned int flags, std::uint64_t timeout) = nullptr;
+        void (GE_GL_APIENTRY* DeleteSync)(Sync sync) = nullptr;
+        void (GE_GL_APIENTRY* BindSampler)(unsigned int unit, unsigned int sampler) = nullptr;
+
+        // GL 4.4 / ARB_buffer_storage (immutable, persistently mappable buffers)
+        void (GE_GL_APIENTRY* BufferStorage)(unsigned int target, std::ptrdiff_t size, const void* data, unsigned int flags) = nullptr;
+
+        bool loaded = false;
+
+        bool HasTimerQueries() const {
+            return GenQueries && DeleteQueries && BeginQuery && EndQuery && GetQueryObjectiv && GetQueryObjectui64v;
+        }
+
+        // Everything ImGuiRenderer needs except BufferStorage
+        bool HasStreamRendering() const {
+            return CreateShader && ShaderSource && CompileShader && GetShaderiv && GetShaderInfoLog && DeleteShader &&
+                   CreateProgram && AttachShader && BindAttribLocation && LinkProgram && GetProgramiv &&
+                   GetProgramInfoLog && DeleteProgram && UseProgram && GetUniformLocation && Uniform1i &&
+                   UniformMatrix4fv && ActiveTexture && BlendEquation && BlendFuncSeparate && GenBuffers &&
+                   DeleteBuffers && BindBuffer && BufferData && MapBufferRange && UnmapBuffer && GenVertexArrays &&
+                   DeleteVertexArrays && BindVertexArray && EnableVertexAttribArray && VertexAttribPointer &&
+                   GetStringi && DrawElementsBaseVertex && FenceSync && ClientWaitSync && DeleteSync && BindSampler;
+        }
+
+        // The entry point alone is not enough: check the version or extension too
+        bool HasBufferStorage() const { return BufferStorage != nullptr; }
+
+        bool HasFramebufferObjects() const {
+            return GenFramebuffers && DeleteFramebuffers && BindFramebuffer && CheckFramebufferStatus &&
+                   FramebufferRenderbuffer && GenRenderbuffers && DeleteRenderbuffers && BindRenderbuffer &&
+                   RenderbufferStorage;
+        }
+    };
+
+    inline Table& Get() {
+        static Table table;
+        return table;
+    }
+
+    template <typename Fn>
+    inline void LoadProc(Fn& fn, const char* name) {
+        fn = reinterpret_cast<Fn>(glfwGetProcAddress(name));
+    }
+
+    // Requires a current GL context
+    inline const Table& Load() {
+        Table& gl = Get();
+        if (gl.loaded) return gl;
+
+        LoadProc(gl.GenQueries, "glGenQueries");
+        LoadProc(gl.DeleteQueries, "glDeleteQueries");
+        LoadProc(gl.BeginQuery, "glBeginQuery");
+        LoadProc(gl.EndQuery, "glEndQuery");
+        LoadProc(gl.GetQueryObjectiv, "glGetQueryObjectiv");
+        LoadProc(gl.GetQueryObjectui64v, "glGetQueryObjectui64v");
+
+        LoadProc(gl.GenFramebuffers, "glGenFramebuffers");
+        LoadProc(gl.DeleteFramebuffers, "glDeleteFramebuffers");
+        LoadProc(gl.BindFramebuffer, "glBindFramebuffer");
+        LoadProc(gl.CheckFramebufferStatus, "glCheckFramebufferStatus");
+        LoadProc(gl.FramebufferRenderbuffer, "glFramebufferRenderbuffer");
+        LoadProc(gl.GenRenderbuffers, "glGenRenderbuffers");
+        LoadProc(gl.DeleteRenderbuffers, "glDeleteRenderbuffers");
+        LoadProc(gl.BindRenderbuffer, "glBindRenderbuffer");
+        LoadProc(gl.RenderbufferStorage, "glRenderbufferStorage");
+
+        LoadProc(gl.CreateShader, "glCreateShader");
+        LoadProc(gl.ShaderSource, "glShaderSource");
+        LoadProc(gl.CompileShader, "glCompileShader");
+        LoadProc(gl.GetShaderiv, "glGetShaderiv");
+        LoadProc(gl.GetShaderInfoLog, "glGetShaderInfoLog");
+        LoadProc(gl.DeleteShader, "glDeleteShader");
+        LoadProc(gl.CreateProgram, "glCreateProgram");
+        LoadProc(gl.AttachShader, "glAttachShader");
+        LoadProc(gl.BindAttribLocation, "glBindAttribLocation");
+        LoadProc(gl.LinkProgram, "glLinkProgram");
+        LoadProc(gl.GetProgramiv, "glGetProgramiv");
+        LoadProc(gl.GetProgramInfoLog, "glGetProgramInfoLog");
+        LoadProc(gl.DeleteProgram, "glDeleteProgram");
+        LoadProc(gl.UseProgram, "glUseProgram");
+        LoadProc(gl.GetUniformLocation, "glGetUniformLocation");
+        LoadProc(gl.Uniform1i, "glUniform1i");
+        LoadProc(gl.UniformMatrix4fv, "glUniformMatrix4fv");
+        LoadProc(gl.ActiveTexture, "glActiveTexture");
+        LoadProc(gl.BlendEquation, "glBlendEquation");
+        LoadProc(gl.BlendFuncSeparate, "glBlendFuncSeparate");
+
+        LoadProc(gl.GenBuffers, "glGenBuffers");
+        LoadProc(gl.DeleteBuffers, "glDeleteBuffers");
+        LoadProc(gl.BindBuffer, "glBindBuffer");
+        LoadProc(gl.BufferData, "glBufferData");
+        LoadProc(gl.MapBufferRange, "glMapBufferRange");
+        LoadProc(gl.UnmapBuffer, "glUnmapBuffer");
+        LoadProc(gl.GenVertexArrays, "glGenVertexArrays");
+        LoadProc(gl.DeleteVertexArrays, "glDeleteVertexArrays");
+        LoadProc(gl.BindVertexArray, "glBindVertexArray");
+        LoadProc(gl.EnableVertexAttribArray, "glEnableVertexAttribArray");
+        LoadProc(gl.VertexAttribPointer, "glVertexAttribPointer");
+        LoadProc(gl.GetStringi, "glGetStringi");
+
+        LoadProc(gl.DrawElementsBaseVertex, "glDrawElementsBaseVertex");
+        LoadProc(gl.FenceSync, "glFenceSync");
+        LoadProc(gl.ClientWaitSync, "glClientWaitSync");
+        LoadProc(gl.DeleteSync, "glDeleteSync");
+        LoadProc(gl.BindSampler, "glBindSampler");
+
+        LoadProc(gl.BufferStorage, "glBufferStorage");
+
+        gl.loaded = true;
+        return gl;
+    }
+
+} // namespace GLFunctions
@@ -0,0 +1,159 @@
+#pragma once
+
+// Headless benchmark driver shared by Editor and UISandbox.
+//
+//   Editor --headless [--frames=300] [--warmup=30] [--capture-every=0]
+//          [--out=headless_out] [--egl] [--size=1600x900]
+//
+// Runs the normal frame loop a fixed number of times against an offscreen
+// framebuffer, then writes frames.csv (one row per measured frame),
+// summary.txt (percentiles) and PPM captures into the output directory.
+
+#include "WindowSetup.h"
+#include "Logging/Log.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace Headless {
+
+    struct Options {
+        bool enabled = false;
+        int frames = 300;          // Measured frames (after warm-up)
+        int warmup_frames = 30;    // Shader compile, atlas upload, first layout passes
+        int capture_every = 0;     // 0 = only the last frame
+        int width = 1600;
+        int height = 900;
+        std::string output_dir = "headless_out";
+        WindowSetup::HeadlessContext context = WindowSetup::HeadlessContext::OSMesa;
+    };
+
+    inline Options ParseArgs(int argc, char** argv) {
+        Options options;
+        auto value_of = [](const char* arg, const char* flag) -> const char* {
+            const size_t n = std::strlen(flag);
+            return std::strncmp(arg, flag, n) == 0 ? arg + n : nullptr;
+        };
+
+        for (int i = 1; i < argc; i++) {
+            const char* arg = argv[i];
+            const char* v = nullptr;
+            if (std::strcmp(arg, "--headless") == 0) options.enabled = true;
+            else if (std::strcmp(arg, "--egl") == 0) options.context = WindowSetup::HeadlessContext::EGL;
+            else if ((v = value_of(arg, "--frames="))) options.frames = std::max(1, std::atoi(v));
+            else if ((v = value_of(arg, "--warmup="))) options.warmup_frames = std::max(0, std::atoi(v));
+            else if ((v = value_of(arg, "--capture-every="))) options.capture_every = std::max(0, std::atoi(v));
+            else if ((v = value_of(arg, "--out="))) options.output_dir = v;
+            else if ((v = value_of(arg, "--size="))) std::sscanf(v, "%dx%d", &options.width, &options.height);
+        }
+        return options;
+    }
+
+    inline void Apply(const Options& options, WindowSetup::WindowConfig& config) {
+        if (!options.enabled) return;
+        config.headless = true;
+        config.headless_context = options.context;
+        config.width = options.width;
+        config.height = options.height;
+        config.vsync = WindowSetup::VSyncMode::Disabled;
+    }
+
+    // ============================================================================
+    // RECORDER
+    // ============================================================================
+
+    class Recorder {
+    public:
+        explicit Recorder(const Options& options) : m_options(options) {
+            if (m_options.enabled) {
+                m_samples.reserve(static_cast<size_t>(m_options.frames));
+            }
+        }
+
+        // Interactive runs never stop here
+        bool Continue() const {
+            return !m_options.enabled || m_frame < m_options.warmup_frames + m_options.frames;
+        }
+
+        // Call after WindowSetup::Render()
+        void EndFrame() {
+            if (!m_options.enabled) return;
+            ++m_frame;
+            if (m_frame <= m_options.warmup_frames) return;
+
+            // Headless Render() waits on glFinish, so the GPU query is already resolved
+            m_samples.push_back(WindowSetup::GetFrameHistory().At(0));
+
+            const int measured = m_frame - m_options.warmup_frames;
+            const bool last = measured == m_options.frames;
+            if (last || (m_options.capture_every > 0 && measured % m_options.capture_every == 0)) {
+                char name[32];
+                std::snprintf(name, sizeof(name), "frame_%05d.ppm", measured);
+                EnsureOutputDir();
+                if (!WindowSetup::SaveFramebufferPPM((std::filesystem::path(m_options.output_dir) / name).string())) {
+                    GE_LOG_WARN(Window, "Headless: failed to write {}", name);
+                }
+            }
+        }
+
+        // Writes frames.csv and summary.txt; returns false if nothing was recorded
+        bool Finish() {
+            if (!m_options.enabled) return true;
+            if (m_samples.empty()) {
+                GE_LOG_WARN(Window, "Headless: no frames recorded");
+                return false;
+            }
+            EnsureOutputDir();
+            const std::filesystem::path dir(m_options.output_dir);
+
+            std::ofstream csv(dir / "frames.csv", std::ios::trunc);
+            csv << "frame,frame_ms,events_ms,update_ms,render_ms,finish_ms,gpu_ms,draw_commands\n";
+            for (size_t i = 0; i < m_samples.size(); i++) {
+                const FrameTiming::FrameSample& s = m_samples[i];
+                csv << i + 1 << ',' << s.frame_ms << ',' << s.events_ms << ',' << s.update_ms << ','
+                    << s.render_ms << ',' << s.swap_ms << ',' << s.gpu_ms << ',' << s.draw_commands << '\n';
+            }
+
+            std::ofstream summary(dir / "summary.txt", std::ios::trunc);
+            auto report = [&](const char* label, float FrameTiming::FrameSample::* field) {
+                std::vector<float> v;
+                v.reserve(m_samples.size());
+                for (const FrameTiming::FrameSample& s : m_samples) {
+                    if (s.*field >= 0.0f) v.push_back(s.*field);
+                }
+                if (v.empty()) return;
+                std::sort(v.begin(), v.end());
+                auto pct = [&v](double p) { return v[static_cast<size_t>(p * static_cast<double>(v.size() - 1) + 0.5)]; };
+                char line[160];
+                std::snprintf(line, sizeof(line), "%-8s p50 %8.3f  p95 %8.3f  p99 %8.3f  max %8.3f ms",
+                              label, pct(0.50), pct(0.95), pct(0.99), v.back());
+                summary << line << '\n';
+                GE_LOG_INFO(Window, "Headless: {}", line);
+            };
+            summary << "frames " << m_samples.size() << " (warm-up " << m_options.warmup_frames << ")\n";
+            report("frame", &FrameTiming::FrameSample::frame_ms);
+            report("update", &FrameTiming::FrameSample::update_ms);
+            report("render", &FrameTiming::FrameSample::render_ms);
+            report("gpu", &FrameTiming::FrameSample::gpu_ms);
+
+            GE_LOG_INFO(Window, "Headless: results written to {}", dir.string());
+            return static_cast<bool>(csv) && static_cast<bool>(summary);
+        }
+
+    private:
+        void EnsureOutputDir() {
+            std::error_code ec;
+            std::filesystem::create_directories(m_options.output_dir, ec);
+        }
+
+        Options m_options;
+        int m_frame = 0;
+        std::vector<FrameTiming::FrameSample> m_samples;
+    };
+
+} // namespace Headless
@@ -0,0 +1,579 @@
+#pragma once
+
+// Main-viewport ImGui renderer that uploads each frame's geometry once.
+//
+// ImGui_ImplOpenGL3_RenderDrawData re-specifies a vertex and an index buffer
+// with glBufferData for every draw list, and backs up / restores the whole
+// GL state around each call. StreamRenderer copies all draw lists of a frame
+// back to back into one region of a ring buffer and draws them with base
+// vertex offsets:
+//
+//  - Persistent: GL 4.4 or GL_ARB_buffer_storage. Immutable buffers mapped
+//    once (coherent), split into kFramesInFlight regions; a fence per region
+//    keeps the CPU from overwriting data the GPU is still reading.
+//  - Orphaning: any GL 3.3 context. One glBufferData orphan and one
+//    glMapBufferRange per buffer per frame.
+//
+// Fixed pipeline state is set once per frame; texture binds and scissor
+// rects are filtered against the last values set, without glGet calls. The
+// stock OpenGL3 backend still owns textures (font atlas, dynamic textures)
+// and renders secondary viewports in their own contexts.
+
+#include "GLFunctions.h"
+#include "imgui.h"
+#include "imgui_impl_opengl3.h"
+#include "Logging/Log.h"
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace ImGuiRenderer {
+
+    enum class Path {
+        Stock,       // Not initialized: ImGui_ImplOpenGL3_RenderDrawData
+        Orphaning,
+        Persistent
+    };
+
+    inline const char* PathName(Path path) {
+        switch (path) {
+            case Path::Persistent: return "persistent-mapped";
+            case Path::Orphaning: return "orphaning";
+            default: return "stock";
+        }
+    }
+
+    // Last frame, except the running totals
+    struct Stats {
+        Path path = Path::Stock;
+        std::size_t upload_bytes = 0;
+        std::size_t capacity_bytes = 0;     // Per region, vertices + indices
+        std::uint32_t draw_calls = 0;
+        std::uint32_t texture_binds = 0;
+        std::uint32_t scissor_changes = 0;
+        std::uint64_t fence_waits = 0;      // Total frames whose region was still in use
+        std::uint64_t skipped_frames = 0;   // Total frames dropped because the region stayed busy
+        std::uint64_t reallocations = 0;    // Total
+    };
+
+    class StreamRenderer {
+    public:
+        static constexpr int kFramesInFlight = 3;
+        static constexpr int kInitialVertices = 1 << 16;
+        static constexpr int kInitialIndices = 1 << 17;
+
+        StreamRenderer() = default;
+        StreamRenderer(const StreamRenderer&) = delete;
+        StreamRenderer& operator=(const StreamRenderer&) = delete;
+
+        // After ImGui_ImplOpenGL3_Init, with the main context current. False
+        // leaves RenderDrawData on the stock backend
+        bool Initialize(bool allow_persistent = true) {
+            if (m_initialized) return true;
+            const GLFunctions::Table& gl = GLFunctions::Load();
+            if (!gl.HasStreamRendering()) return false;
+
+            int major = 0;
+            int minor = 0;
+            glGetIntegerv(GLFunctions::kMajorVersion, &major);
+            glGetIntegerv(GLFunctions::kMinorVersion, &minor);
+            const int version = major * 10 + minor;
+            if (version < 33) return false;
+
+            if (!CreateProgram()) return false;
+            gl.GenVertexArrays(1, &m_vao);
+
+            const bool storage = allow_persistent && gl.HasBufferStorage() &&
+                                 (version >= 44 || HasExtension("GL_ARB_buffer_storage"));
+            m_stats.path = storage ? Path::Persistent : Path::Orphaning;
+            if (!CreateBuffers(kInitialVertices, kInitialIndices)) {
+                if (m_stats.path != Path::Persistent) {
+                    DestroyDeviceObjects();
+                    m_stats.path = Path::Stock;
+                    return false;
+                }
+                // Some drivers expose the entry point but refuse persistent maps
+                m_stats.path = Path::Orphaning;
+                if (!CreateBuffers(kInitialVertices, kInitialIndices)) {
+                    DestroyDeviceObjects();
+                    m_stats.path = Path::Stock;
+                    return false;
+                }
+            }
+
+            ImGui::GetIO().BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+            m_initialized = true;
+            return true;
+        }
+
+        void Shutdown() {
+            if (!m_initialized) return;
+            WaitForAllRegions();
+            DestroyBuffers();
+            DestroyDeviceObjects();
+            m_initialized = false;
+            m_stats = Stats{};
+        }
+
+        bool IsInitialized() const { return m_initialized; }
+        const Stats& GetStats() const { return m_stats; }
+
+        void RenderDrawData(ImDrawData* draw_data) {
+            if (!m_initialized) {
+                ImGui_ImplOpenGL3_RenderDrawData(draw_data);
+                return;
+            }
+
+            const int fb_width = static_cast<int>(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+            const int fb_height = static_cast<int>(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+            if (fb_width <= 0 || fb_height <= 0) return;
+
+            UpdateTextures(draw_data);
+
+            m_stats.upload_bytes = 0;
+            m_stats.draw_calls = 0;
+            m_stats.texture_binds = 0;
+            m_stats.scissor_changes = 0;
+            if (draw_data->TotalVtxCount <= 0 || draw_data->TotalIdxCount <= 0) return;
+
+            if (!Reserve(draw_data->TotalVtxCount, draw_data->TotalIdxCount)) return;
+
+            std::size_t vtx_base = 0;    // Region start, in vertices
+            std::size_t idx_base = 0;    // Region start, in bytes
+            if (!Upload(draw_data, vtx_base, idx_base)) return;
+
+            SetupRenderState(draw_data, fb_width, fb_height);
+
+            const GLFunctions::Table& gl = GLFunctions::Get();
+            const ImVec2 clip_off = draw_data->DisplayPos;
+            const ImVec2 clip_scale = draw_data->FramebufferScale;
+            const unsigned int index_type = sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
+            std::size_t list_vtx = 0;
+            std::size_t list_idx = 0;
+            for (const ImDrawList* draw_list : draw_data->CmdLists) {
+                for (const ImDrawCmd& cmd : draw_list->CmdBuffer) {
+                    if (cmd.UserCallback) {
+                        if (cmd.UserCallback == ImDrawCallback_ResetRenderState) {
+                            SetupRenderState(draw_data, fb_width, fb_height);
+                        } else {
+                            cmd.UserCallback(draw_list, &cmd);
+                            InvalidateCache();
+                        }
+                        continue;
+                    }
+
+                    const ImVec2 clip_min((cmd.ClipRect.x - clip_off.x) * clip_scale.x,
+                                          (cmd.ClipRect.y - clip_off.y) * clip_scale.y);
+                    const ImVec2 clip_max((cmd.ClipRect.z - clip_off.x) * clip_scale.x,
+                                          (cmd.ClipRect.w - clip_off.y) * clip_scale.y);
+                    if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y) continue;
+
+                    // GL's scissor origin is bottom-left
+                    SetScissor(static_cast<int>(clip_min.x), static_cast<int>(fb_height - clip_max.y),
+                               static_cast<int>(clip_max.x - clip_min.x), static_cast<int>(clip_max.y - clip_min.y));
+                    BindTexture((unsigned int)(std::intptr_t)cmd.GetTexID());
+
+                    const std::size_t index_offset = idx_base + (list_idx + cmd.IdxOffset) * sizeof(ImDrawIdx);
+                    gl.DrawElementsBaseVertex(GL_TRIANGLES, static_cast<int>(cmd.ElemCount), index_type,
+                                              reinterpret_cast<const void*>(index_offset),
+                                              static_cast<int>(vtx_base + list_vtx + cmd.VtxOffset));
+                    ++m_stats.draw_calls;
+                }
+                list_vtx += static_cast<std::size_t>(draw_list->VtxBuffer.Size);
+                list_idx += static_cast<std::size_t>(draw_list->IdxBuffer.Size);
+            }
+
+            if (m_stats.path == Path::Persistent) {
+                m_fences[m_region] = gl.FenceSync(GLFunctions::kSyncGpuCommandsComplete, 0);
+                m_region = (m_region + 1) % kFramesInFlight;
+            }
+
+            // Leave the state the rest of the frame expects
+            glDisable(GL_SCISSOR_TEST);
+            gl.BindVertexArray(0);
+            gl.UseProgram(0);
+        }
+
+    private:
+        // ============================================================================
+        // SETUP
+        // ============================================================================
+
+        static bool HasExtension(std::string_view name) {
+            const GLFunctions::Table& gl = GLFunctions::Get();
+            int count = 0;
+            glGetIntegerv(GLFunctions::kNumExtensions, &count);
+            for (int i = 0; i < count; ++i) {
+                const unsigned char* ext = gl.GetStringi(GL_EXTENSIONS, static_cast<unsigned int>(i));
+                if (ext && name == reinterpret_cast<const char*>(ext)) return true;
+            }
+            return false;
+        }
+
+        static unsigned int CompileShader(unsigned int type, const char* source) {
+            const GLFunctions::Table& gl = GLFunctions::Get();
+            const unsigned int shader = gl.CreateShader(type);
+            gl.ShaderSource(shader, 1, &source, nullptr);
+            gl.CompileShader(shader);
+            int status = 0;
+            gl.GetShaderiv(shader, GLFunctions::kCompileStatus, &status);
+            if (!status) {
+                char log[512] = {};
+                gl.GetShaderInfoLog(shader, sizeof(log), nullptr, log);
+                GE_LOG_WARN(Render, "ImGui stream shader failed to compile: {}", log);
+                gl.DeleteShader(shader);
+                return 0;
+            }
+            return shader;
+        }
+
+        bool CreateProgram() {
+            static const char* const kVertexSource =
+                "#version 330 core\n"
+                "in vec2 Position;\n"
+                "in vec2 UV;\n"
+                "in vec4 Color;\n"
+                "uniform mat4 ProjMtx;\n"
+                "out vec2 Frag_UV;\n"
+                "out vec4 Frag_Color;\n"
+                "void main() {\n"
+                "    Frag_UV = UV;\n"
+                "    Frag_Color = Color;\n"
+                "    gl_Position = ProjMtx * vec4(Position.xy, 0.0, 1.0);\n"
+                "}\n";
+            static const char* const kFragmentSource =
+                "#version 330 core\n"
+                "in vec2 Frag_UV;\n"
+                "in vec4 Frag_Color;\n"
+                "uniform sampler2D Texture;\n"
+                "layout (location = 0) out vec4 Out_Color;\n"
+                "void main() {\n"
+                "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+                "}\n";
+
+            const GLFunctions::Table& gl = GLFunctions::Get();
+            const unsigned int vs = CompileShader(GLFunctions::kVertexShader, kVertexSource);
+            const unsigned int fs = CompileShader(GLFunctions::kFragmentShader, kFragmentSource);
+            if (!vs || !fs) {
+                if (vs) gl.DeleteShader(vs);
+                if (fs) gl.DeleteShader(fs);
+                return false;
+            }
+
+            m_program = gl.CreateProgram();
+            gl.AttachShader(m_program, vs);
+            gl.AttachShader(m_program, fs);
+            gl.BindAttribLocation(m_program, 0, "Position");
+            gl.BindAttribLocation(m_program, 1, "UV");
+            gl.BindAttribLocation(m_program, 2, "Color");
+            gl.LinkProgram(m_program);
+            gl.DeleteShader(vs);
+            gl.DeleteShader(fs);
+
+            int status = 0;
+            gl.GetProgramiv(m_program, GLFunctions::kLinkStatus, &status);
+            if (!status) {
+                char log[512] = {};
+                gl.GetProgramInfoLog(m_program, sizeof(log), nullptr, log);
+                GE_LOG_WARN(Render, "ImGui stream program failed to link: {}", log);
+                gl.DeleteProgram(m_program);
+                m_program = 0;
+                return false;
+            }
+            m_loc_texture = gl.GetUniformLocation(m_program, "Texture");
+            m_loc_projection = gl.GetUniformLocation(m_program, "ProjMtx");
+            return true;
+        }
+
+        void DestroyDeviceObjects() {
+            const GLFunctions::Table& gl = GLFunctions::Get();
+            if (m_vao) gl.DeleteVertexArrays(1, &m_vao);
+            if (m_program) gl.DeleteProgram(m_program);
+            m_vao = 0;
+            m_program = 0;
+        }
+
+        // ============================================================================
+        // BUFFERS
+        // ============================================================================
+
+        // Capacities are per region; the persistent path allocates kFramesInFlight regions
+        bool CreateBuffers(std::size_t vertices, std::size_t indices) {
+            const GLFunctions::Table& gl = GLFunctions::Get();
+            const bool persistent = m_stats.path == Path::Persistent;
+            const int regions = persistent ? kFramesInFlight : 1;
+            const auto vtx_bytes = static_cast<std::ptrdiff_t>(vertices * sizeof(ImDrawVert) * regions);
+            const auto idx_bytes = static_cast<std::ptrdiff_t>(indices * sizeof(ImDrawIdx) * regions);
+
+            gl.GenBuffers(1, &m_vbo);
+            gl.GenBuffers(1, &m_ibo);
+            gl.BindVertexArray(m_vao);  // The element buffer binding is VAO state
+            gl.BindBuffer(GLFunctions::kArrayBuffer, m_vbo);
+            gl.BindBuffer(GLFunctions::kElementArrayBuffer, m_ibo);
+
+            if (persistent) {
+                const unsigned int flags = GLFunctions::kMapWriteBit | GLFunctions::kMapPersistentBit |
+                                           GLFunctions::kMapCoherentBit;
+                gl.BufferStorage(GLFunctions::kArrayBuffer, vtx_bytes, nullptr, flags);
+                gl.BufferStorage(GLFunctions::kElementArrayBuffer, idx_bytes, nullptr, flags);
+                m_vtx_map = static_cast<unsigned char*>(gl.MapBufferRange(GLFunctions::kArrayBuffer, 0, vtx_bytes, flags));
+                m_idx_map = static_cast<unsigned char*>(gl.MapBufferRange(GLFunctions::kElementArrayBuffer, 0, idx_bytes, flags));
+                if (!m_vtx_map || !m_idx_map) {
+                    DestroyBuffers();
+                    return false;
+                }
+            } else {
+                gl.BufferData(GLFunctions::kArrayBuffer, vtx_bytes, nullptr, GLFunctions::kStreamDraw);
+                gl.BufferData(GLFunctions::kElementArrayBuffer, idx_bytes, nullptr, GLFunctions::kStreamDraw);
+            }
+
+            const int stride = static_cast<int>(sizeof(ImDrawVert));
+            gl.EnableVertexAttribArray(0);
+            gl.EnableVertexAttribArray(1);
+            gl.EnableVertexAttribArray(2);
+            gl.VertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride,
+                                   reinterpret_cast<const void*>(offsetof(ImDrawVert, pos)));
+            gl.VertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride,
+                                   reinterpret_cast<const void*>(offsetof(ImDrawVert, uv)));
+            gl.VertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride,
+                                   reinterpret_cast<const void*>(offsetof(ImDrawVert, col)));
+            gl.BindVertexArray(0);
+            gl.BindBuffer(GLFunctions::kArrayBuffer, 0);
+
+            m_vtx_capacity = vertices;
+            m_idx_capacity = indices;
+            m_region = 0;
+            m_stats.capacity_bytes = vertices * sizeof(ImDrawVert) + indices * sizeof(ImDrawIdx);
+            return true;
+        }
+
+        void DestroyBuffers() {
+            const GLFunctions::Table& gl = GLFunctions::Get();
+            if (m_vtx_map || m_idx_map) {
+                gl.BindVertexArray(m_vao);
+                gl.BindBuffer(GLFunctions::kArrayBuffer, m_vbo);
+                if (m_vtx_map) gl.UnmapBuffer(GLFunctions::kArrayBuffer);
+                if (m_idx_map) gl.UnmapBuffer(GLFunctions::kElementArrayBuffer);
+                gl.BindBuffer(GLFunctions::kArrayBuffer, 0);
+                gl.BindVertexArray(0);
+            }
+            if (m_vbo) gl.DeleteBuffers(1, &m_vbo);
+            if (m_ibo) gl.DeleteBuffers(1, &m_ibo);
+            m_vbo = 0;
+            m_ibo = 0;
+            m_vtx_map = nullptr;
+            m_idx_map = nullptr;
+            m_vtx_capacity = 0;
+            m_idx_capacity = 0;
+        }
+
+        // Grows (1.5x the need, never shrinks) before the frame is written
+        bool Reserve(int vertices, int indices) {
+            const auto need_vtx = static_cast<std::size_t>(vertices);
+            const auto need_idx = static_cast<std::size_t>(indices);
+            if (need_vtx <= m_vtx_capacity && need_idx <= m_idx_capacity) return true;
+
+            const std::size_t new_vtx = std::max(m_vtx_capacity, need_vtx + need_vtx / 2);
+            const std::size_t new_idx = std::max(m_idx_capacity, need_idx + need_idx / 2);
+            WaitForAllRegions();
+            DestroyBuffers();
+            ++m_stats.reallocations;
+            if (CreateBuffers(new_vtx, new_idx)) return true;
+
+            GE_LOG_WARN(Render, "ImGui stream buffers could not grow to {} vertices, using the stock renderer", new_vtx);
+            DestroyDeviceObjects();
+            m_initialized = false;
+            m_stats.path = Path::Stock;
+            return false;
+        }
+
+        // True once the GPU has finished reading `region`. A fence still
+        // pending after the timeout, or a failed wait, leaves the region busy
+        // and the fence in place, to be retried next frame
+        bool WaitForRegion(int region) {
+            GLFunctions::Sync& fence = m_fences[region];
+            if (!fence) return true;
+            const GLFunctions::Table& gl = GLFunctions::Get();
+            unsigned int result = gl.ClientWaitSync(fence, 0, 0);
+            if (result == GLFunctions::kTimeoutExpired) {
+                ++m_stats.fence_waits;
+                constexpr std::uint64_t kTimeoutNs = 1'000'000'000;
+                result = gl.ClientWaitSync(fence, GLFunctions::kSyncFlushCommandsBit, kTimeoutNs);
+            }
+            if (result == GLFunctions::kTimeoutExpired || result == GLFunctions::kWaitFailed) return false;
+            gl.DeleteSync(fence);
+            fence = nullptr;
+            return true;
+        }
+
+        // Before the buffers are reallocated or destroyed nothing may read
+        // them any more; falls back to glFinish if a fence will not signal
+        void WaitForAllRegions() {
+            bool idle = true;
+            for (int i = 0; i < kFramesInFlight; ++i) idle &= WaitForRegion(i);
+            if (idle) return;
+            glFinish();
+            const GLFunctions::Table& gl = GLFunctions::Get();
+            for (GLFunctions::Sync& fence : m_fences) {
+                if (fence) gl.DeleteSync(fence);
+                fence = nullptr;
+            }
+        }
+
+        // One copy of every draw list into this frame's region
+        bool Upload(const ImDrawData* draw_data, std::size_t& vtx_base, std::size_t& idx_base) {
+            const GLFunctions::Table& gl = GLFunctions::Get();
+            const std::size_t vtx_bytes = static_cast<std::size_t>(draw_data->TotalVtxCount) * sizeof(ImDrawVert);
+            const std::size_t idx_bytes = static_cast<std::size_t>(draw_data->TotalIdxCount) * sizeof(ImDrawIdx);
+
+            unsigned char* vtx_dst = nullptr;
+            unsigned char* idx_dst = nullptr;
+            if (m_stats.path == Path::Persistent) {
+                // Writing into a region the GPU still reads would corrupt the
+                // frame in flight; drop this one instead
+                if (!WaitForRegion(m_region)) {
+                    ++m_stats.skipped_frames;
+                    return false;
+                }
+                vtx_base = static_cast<std::size_t>(m_region) * m_vtx_capacity;
+                idx_base = static_cast<std::size_t>(m_region) * m_idx_capacity * sizeof(ImDrawIdx);
+                vtx_dst = m_vtx_map + vtx_base * sizeof(ImDrawVert);
+                idx_dst = m_idx_map + idx_base;
+            } else {
+                // Orphan the old storage so the driver need not wait for the GPU
+                const unsigned int access = GLFunctions::kMapWriteBit | GLFunctions::kMapInvalidateBuffer;
+                gl.BindVertexArray(m_vao);
+                gl.BindBuffer(GLFunctions::kArrayBuffer, m_vbo);
+                gl.BufferData(GLFunctions::kArrayBuffer, static_cast<std::ptrdiff_t>(m_vtx_capacity * sizeof(ImDrawVert)),
+                              nullptr, GLFunctions::kStreamDraw);
+                gl.BufferData(GLFunctions::kElementArrayBuffer, static_cast<std::ptrdiff_t>(m_idx_capacity * sizeof(ImDrawIdx)),
+                              nullptr, GLFunctions::kStreamDraw);
+                vtx_dst = static_cast<unsigned char*>(
+                    gl.MapBufferRange(GLFunctions::kArrayBuffer, 0, static_cast<std::ptrdiff_t>(vtx_bytes), access));
+                idx_dst = static_cast<unsigned char*>(
+                    gl.MapBufferRange(GLFunctions::kElementArrayBuffer, 0, static_cast<std::ptrdiff_t>(idx_bytes), access));
+                vtx_base = 0;
+                idx_base = 0;
+            }
+
+            if (vtx_dst && idx_dst) {
+                for (const ImDrawList* draw_list : draw_data->CmdLists) {
+                    const std::size_t v = static_cast<std::size_t>(draw_list->VtxBuffer.Size) * sizeof(ImDrawVert);
+                    const std::size_t i = static_cast<std::size_t>(draw_list->IdxBuffer.Size) * sizeof(ImDrawIdx);
+                    std::memcpy(vtx_dst, draw_list->VtxBuffer.Data, v);
+                    std::memcpy(idx_dst, draw_list->IdxBuffer.Data, i);
+                    vtx_dst += v;
+                    idx_dst += i;
+                }
+            }
+
+            bool ok = vtx_dst && idx_dst;
+            if (m_stats.path == Path::Orphaning) {
+                // Unmapping reports false if the store was lost (e.g. mode switch); skip the frame
+                if (vtx_dst) ok &= gl.UnmapBuffer(GLFunctions::kArrayBuffer) != 0;
+                if (idx_dst) ok &= gl.UnmapBuffer(GLFunctions::kElementArrayBuffer) != 0;
+                gl.BindBuffer(GLFunctions::kArrayBuffer, 0);
+                gl.BindVertexArray(0);
+            }
+            if (ok) m_stats.upload_bytes = vtx_bytes + idx_bytes;
+            return ok;
+        }
+
+        // ============================================================================
+        // STATE
+        // ============================================================================
+
+        // ImGui 1.92+: create/update/destroy requested textures through the stock backend
+        static void UpdateTextures(ImDrawData* draw_data) {
+#if IMGUI_VERSION_NUM >= 19200
+            if (!draw_data->Textures) return;
+            for (ImTextureData* tex : *draw_data->Textures) {
+                if (tex->Status != ImTextureStatus_OK) ImGui_ImplOpenGL3_UpdateTexture(tex);
+            }
+#else
+            (void)draw_data;
+#endif
+        }
+
+        void SetupRenderState(const ImDrawData* draw_data, int fb_width, int fb_height) {
+            const GLFunctions::Table& gl = GLFunctions::Get();
+            glEnable(GL_BLEND);
+            gl.BlendEquation(GLFunctions::kFuncAdd);
+            gl.BlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+            glDisable(GL_CULL_FACE);
+            glDisable(GL_DEPTH_TEST);
+            glDisable(GL_STENCIL_TEST);
+            glEnable(GL_SCISSOR_TEST);
+            glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+            glViewport(0, 0, fb_width, fb_height);
+
+            const float l = draw_data->DisplayPos.x;
+            const float r = draw_data->DisplayPos.x + draw_data->DisplaySize.x;
+            const float t = draw_data->DisplayPos.y;
+            const float b = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
+            const float projection[16] = {
+                2.0f / (r - l),    0.0f,              0.0f,  0.0f,
+                0.0f,              2.0f / (t - b),    0.0f,  0.0f,
+                0.0f,              0.0f,             -1.0f,  0.0f,
+                (r + l) / (l - r), (t + b) / (b - t), 0.0f,  1.0f,
+            };
+
+            gl.UseProgram(m_program);
+            gl.Uniform1i(m_loc_texture, 0);
+            gl.UniformMatrix4fv(m_loc_projection, 1, GL_FALSE, projection);
+            gl.ActiveTexture(GLFunctions::kTexture0);
+            gl.BindSampler(0, 0);
+            gl.BindVertexArray(m_vao);
+            InvalidateCache();
+        }
+
+        // Callbacks and other renderers may have changed these behind our back
+        void InvalidateCache() {
+            m_bound_texture = kNoTexture;
+            m_scissor[0] = -1;
+        }
+
+        void BindTexture(unsigned int texture) {
+            if (texture == m_bound_texture) return;
+            glBindTexture(GL_TEXTURE_2D, texture);
+            m_bound_texture = texture;
+            ++m_stats.texture_binds;
+        }
+
+        void SetScissor(int x, int y, int width, int height) {
+            if (m_scissor[0] == x && m_scissor[1] == y && m_scissor[2] == width && m_scissor[3] == height) return;
+            glScissor(x, y, width, height);
+            m_scissor[0] = x;
+            m_scissor[1] = y;
+            m_scissor[2] = width;
+            m_scissor[3] = height;
+            ++m_stats.scissor_changes;
+        }
+
+        static constexpr unsigned int kNoTexture = 0xFFFFFFFFu;
+
+        bool m_initialized = false;
+        unsigned int m_program = 0;
+        int m_loc_texture = -1;
+        int m_loc_projection = -1;
+        unsigned int m_vao = 0;
+        unsigned int m_vbo = 0;
+        unsigned int m_ibo = 0;
+
+        std::size_t m_vtx_capacity = 0;     // Per region
+        std::size_t m_idx_capacity = 0;
+        unsigned char* m_vtx_map = nullptr; // Persistent path only
+        unsigned char* m_idx_map = nullptr;
+        GLFunctions::Sync m_fences[kFramesInFlight] = {};
+        int m_region = 0;
+
+        unsigned int m_bound_texture = kNoTexture;
+        int m_scissor[4] = { -1, -1, -1, -1 };
+        Stats m_stats;
+    };
+
+} // namespace ImGuiRenderer
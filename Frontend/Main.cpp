@@ -1,34 +1,178 @@
 ﻿#include "WindowSetup.h"
+#include "HeadlessRun.h"
+#include "Startup.h"
 #include "UILayouts.h"
+#include "Scene/Scene.h"
+#include "IO/SceneJournal.h"
+#include "Engine.h"
+#include "Bridge.h"
+#include "Logging/Log.h"
+#include "Render/Renderer.h"
+#include "Render/FramePipeline.h"
+#include "Geometry/LodLibrary.h"
+#include "ModuleHost.h"
 
-// Backend API
-namespace Backend { extern void Init(); }
+// Heap counters for the DebugPanel (global operator new, this TU only)
+#include "Memory/HeapHooks.h"
+
+// The module's final unload runs Backend::Shutdown
+static void ShutdownBackend(ModuleHost::Host& modules) {
+#ifdef GE_BACKEND_OPS_MODULE
+    modules.Unload();
+#else
+    (void)modules;
+    Backend::Shutdown();
+#endif
+}
+
+int main(int argc, char** argv) {
+    Startup::Trace::Begin();
+
+    // Async logging first: window setup already logs, and the frame path
+    // must never wait on stdout
+    {
+        Startup::Phase phase("logging");
+        Backend::Logging::LogConfig log_config;
+        log_config.structured_path = "editor_log.bin";
+        Backend::Logging::Initialize(log_config);
+    }
 
-int main(int, char**) {
     // 1. Configure
     WindowSetup::WindowConfig config;
     config.title = "Geometry Engine";
     config.width = 1920;
     config.height = 1080;
     
+    // Editors sit idle most of the time; only redraw on input or request
+    config.loop_mode = WindowSetup::LoopMode::Idle;
+    
+    // --headless: fixed frame count into an offscreen target (CI benchmarks)
+    const Headless::Options headless = Headless::ParseArgs(argc, argv);
+    Headless::Apply(headless, config);
+    
+    // Editor scene (owned here, edited through the UI panels) and the
+    // imported meshes with their LOD chains (built on the library's own
+    // thread). The startup tasks below own the scene until startup.WaitAll();
+    // nothing else touches it before that
+    Backend::Scene scene;
+    Backend::Geometry::LodLibrary library;
+
+    // Job workers spin up while the window is created. Not a background
+    // task: the thread that initializes the job system becomes worker 0.
+    // The Backend entry points come from the BackendOps module, which the
+    // host reloads whenever that target is rebuilt
+    ModuleHost::Host modules;
+    {
+        Startup::Phase phase("backend_init");
+        GE_LOG_INFO(Engine, "Initializing Engine Backend...");
+#ifdef GE_BACKEND_OPS_MODULE
+        if (!modules.Load(GE_BACKEND_OPS_MODULE, { &scene, &library })) {
+            phase.Fail();
+            GE_LOG_ERROR(Modules, "Backend module unavailable, jobs run inline until it is rebuilt: {}", modules.Error());
+        }
+#else
+        Backend::Init();
+#endif
+    }
+
     // FIX 1: 'on_init' -> 'on_post_init' (Callback signature changed)
     config.on_post_init = [](GLFWwindow* window) {
-        std::cout << "[INFO] Initializing Engine Backend..." << std::endl;
-        
-        // Initialize your engine backend here
-        Backend::Init(); 
+        Backend::SetRedrawHandler([] { WindowSetup::RequestRedraw(); });
         
         // Optional: Nice touch for the main editor window
         WindowSetup::CenterWindow();
     };
+    config.on_shutdown = [&modules]() { ShutdownBackend(modules); };
+
+    // The scene's journal and the scene renderer, owned by the startup tasks
+    // below until startup.WaitAll() like the scene
+    Backend::IO::SceneJournal journal;
+    Backend::Render::Renderer renderer;
+
+    // Headless runs only measure submission, so they skip the GPU with the
+    // Noop backend
+    Backend::Render::RendererConfig render_config;
+    render_config.backend = headless.enabled ? Backend::Render::RendererBackend::Noop
+                                             : Backend::Render::RendererBackend::Auto;
+
+    // Independent of the window: run them while it comes up. Each one wakes
+    // the idle loop when it finishes
+    Startup::Orchestrator startup;
+    startup.on_task_finished = [] { WindowSetup::RequestRedraw(); };
+    startup.Launch("bridge_init", [] {
+        Bridge::Init();
+        return true;
+    });
+
+    // Persisted state from the last session, or the default scene
+    startup.Launch("scene_load", [&scene, &journal] {
+        if (!journal.Open("scene")) {
+            GE_LOG_WARN(IO, "Scene journal unavailable: {}", journal.LastError());
+        }
+        if (journal.IsOpen() && journal.GetStatus().persisted_entities > 0) {
+            journal.Load(scene);
+            scene.SetSelected(scene.Registry().view<Backend::Transform>().front());
+        } else {
+            const Backend::Entity player = scene.CreateEntity("Player_01", { glm::vec3(0.0f, 10.0f, 0.0f) });
+            scene.SetSelected(player);
+        }
+        return journal.IsOpen();
+    });
+
+    // bgfx comes up on the renderer's own submission thread (offscreen, so
+    // it does not need the window); shaders are loaded there too
+    startup.Launch("renderer_start", [&renderer, &render_config] {
+        if (!renderer.Start(render_config)) {
+            GE_LOG_WARN(Render, "Renderer unavailable: {}", renderer.Error());
+            return false;
+        } else if (!renderer.Error().empty()) {
+            GE_LOG_WARN(Render, "{}", renderer.Error());
+        }
+        return true;
+    });
 
     // FIX 2: 'Init' -> 'Initialize'
     // This sets up GLFW, ImGui, VSync, and Fonts automatically
-    if (!WindowSetup::Initialize(config)) return 1;
+    if (!WindowSetup::Initialize(config)) {
+        startup.WaitAll();
+        renderer.Stop();
+        journal.Close();
+        ShutdownBackend(modules);
+        Backend::Logging::Shutdown();
+        return 1;
+    }
+
+    // The window is up: keep it drawn and responsive while the tasks finish
+    bool first_frame = true;
+    auto mark_first_frame = [&first_frame] {
+        if (!first_frame) return;
+        Startup::Trace::Mark("first_frame");
+        first_frame = false;
+    };
+    while (!startup.Ready() && !WindowSetup::ShouldClose()) {
+        WindowSetup::BeginFrame();
+        Startup::RenderProgress(startup);
+        WindowSetup::EndFrame();
+        WindowSetup::Render();
+        mark_first_frame();
+    }
+    if (!startup.WaitAll()) {
+        GE_LOG_WARN(Engine, "Some startup tasks failed; see above");
+    }
+
+    // Scene updates for the renderer run on the workers, overlapping this
+    // thread's presentation; 1 frame in flight keeps viewport latency low
+    Backend::Render::FramePipelineConfig pipeline_config;
+    pipeline_config.frames_in_flight = 1;
+    Backend::Render::FramePipeline pipeline(&renderer, pipeline_config);
+
+    Startup::Trace::Mark("ready");
+    bool startup_reported = false;
 
     // 2. Main Loop
     // FIX 3: Use WindowSetup::ShouldClose() instead of manual glfw calls
-    while (!WindowSetup::ShouldClose()) {
+    Headless::Recorder recorder(headless);
+    while (!WindowSetup::ShouldClose() && recorder.Continue()) {
         
         // FIX 4: Centralized frame start (Handles PollEvents + NewFrame)
         WindowSetup::BeginFrame();
@@ -38,7 +182,8 @@ int main(int, char**) {
         WindowSetup::BeginDockspace("EditorDockSpace");
 
         // --- RENDER EDITOR UI ---
-        UILab::Render(); 
+        modules.Update(ImGui::GetIO().DeltaTime);
+        UILab::Render(scene, journal, renderer, pipeline, library, &modules); 
         // ------------------------
 
         WindowSetup::EndDockspace();
@@ -51,9 +196,35 @@ int main(int, char**) {
         // - UpdatePlatformWindows (Multi-Viewports)
         // - glfwSwapBuffers
         WindowSetup::Render();
+        recorder.EndFrame();
+
+        // The first full editor frame completes startup
+        if (!startup_reported) {
+            mark_first_frame();
+            Startup::Trace::Mark("interactive");
+            GE_LOG_INFO(Engine, "Startup: first frame {:.0f} ms, interactive {:.0f} ms",
+                        Startup::Trace::EndOf("first_frame"), Startup::Trace::EndOf("interactive"));
+            Startup::Trace::LogSummary();
+            Startup::Trace::WriteChromeTrace("startup_trace.json");
+            startup_reported = true;
+        }
+
+        // Between frames: nothing from the module image is on the stack
+        modules.PollReload();
     }
+    const bool recorded = recorder.Finish();
+
+    // Before Backend::Shutdown (the module's final unload, in on_shutdown):
+    // the submission thread requests redraws
+    pipeline.Flush();
+    renderer.Stop();
+    library.Stop();
+
+    // Unsaved edits are discarded, as before; just let pending saves land
+    journal.Close();
 
     // FIX 7: Shutdown takes no arguments now
     WindowSetup::Shutdown();
-    return 0;
+    Backend::Logging::Shutdown();
+    return recorded ? 0 : 1;
 }
\ No newline at end of file
@@ -0,0 +1,308 @@
+#pragma once
+
+// Hot reload for Backend modules (see Backend/Module/ModuleAPI.h).
+//
+// The host loads a shadow copy of the module library, so the build can
+// overwrite the original while the Editor runs. A watcher thread polls the
+// original's size and write time and, once a change has settled (same stamp
+// on two polls, i.e. the linker is done), flags it and wakes the UI loop.
+// PollReload() then swaps the module between frames: the new copy is opened
+// and validated first, so a build without a matching entry point leaves the
+// old module running. An image whose load() fails is unloaded and closed
+// instead of staying installed; the next build starts the module afresh.
+//
+// The module's state block comes from a host-owned arena and is handed to
+// every image in turn; the Scene and LodLibrary are host-owned anyway, so a
+// reload keeps the whole editing session, assets included.
+
+#include "Module/ModuleAPI.h"
+#include "Memory/Arena.h"
+#include "Engine.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <dlfcn.h>
+    #include <unistd.h>
+#endif
+
+namespace ModuleHost {
+
+    namespace Detail {
+
+#if defined(_WIN32)
+        inline void* OpenLibrary(const std::string& path, std::string& error) {
+            HMODULE module = LoadLibraryA(path.c_str());
+            if (!module) error = "LoadLibrary failed (" + std::to_string(GetLastError()) + "): " + path;
+            return reinterpret_cast<void*>(module);
+        }
+        inline void* FindSymbol(void* library, const char* name) {
+            return reinterpret_cast<void*>(GetProcAddress(reinterpret_cast<HMODULE>(library), name));
+        }
+        inline void CloseLibrary(void* library) {
+            FreeLibrary(reinterpret_cast<HMODULE>(library));
+        }
+        inline unsigned long ProcessId() { return GetCurrentProcessId(); }
+#else
+        inline void* OpenLibrary(const std::string& path, std::string& error) {
+            // RTLD_LOCAL: two images of the same module never resolve against each other
+            void* library = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+            if (!library) error = dlerror();
+            return library;
+        }
+        inline void* FindSymbol(void* library, const char* name) {
+            return dlsym(library, name);
+        }
+        inline void CloseLibrary(void* library) {
+            dlclose(library);
+        }
+        inline unsigned long ProcessId() { return static_cast<unsigned long>(getpid()); }
+#endif
+
+        struct FileStamp {
+            std::filesystem::file_time_type time{};
+            std::uintmax_t size = 0;
+            bool exists = false;
+
+            bool operator==(const FileStamp&) const = default;
+        };
+
+        inline FileStamp Stamp(const std::filesystem::path& path) {
+            std::error_code ec;
+            FileStamp stamp;
+            stamp.time = std::filesystem::last_write_time(path, ec);
+            if (ec) return {};
+            stamp.size = std::filesystem::file_size(path, ec);
+            stamp.exists = !ec;
+            return stamp;
+        }
+
+    } // namespace Detail
+
+    class Host {
+    public:
+        Host() = default;
+        ~Host() { Unload(); }
+
+        Host(const Host&) = delete;
+        Host& operator=(const Host&) = delete;
+
+        // Loads `path` and starts watching it. `context` supplies the scene and
+        // library; its state fields are managed by the host. False when no
+        // usable image is installed (API() and Ops() are null); the watcher
+        // still runs, so the next rebuild is tried.
+        bool Load(const std::string& path, const Backend::Module::ModuleContext& context) {
+            Unload();
+            m_reloads = 0;
+            m_path = std::filesystem::absolute(path);
+            m_context = context;
+            ResetState();
+            m_loaded_stamp = Detail::Stamp(m_path);
+            const bool loaded = Swap();
+
+            m_stop = false;
+            m_watcher = std::thread([this] { WatchLoop(); });
+            return loaded;
+        }
+
+        void Unload() {
+            if (m_watcher.joinable()) {
+                {
+                    std::lock_guard<std::mutex> lock(m_watch_mutex);
+                    m_stop = true;
+                }
+                m_watch_wake.notify_one();
+                m_watcher.join();
+            }
+            if (m_api && m_api->unload) m_api->unload(m_context, false);
+            CloseImage(m_library, m_shadow);
+            m_library = nullptr;
+            m_shadow.clear();
+            m_api = nullptr;
+            m_change_pending.store(false, std::memory_order_relaxed);
+        }
+
+        // Call between frames. Reloads when the watcher saw a settled change.
+        bool PollReload() {
+            if (!m_change_pending.exchange(false, std::memory_order_acq_rel)) return false;
+            return Reload();
+        }
+
+        // Forces a reload from the current file
+        bool Reload() {
+            if (m_path.empty()) return false;
+            {
+                // A failed build is not retried until the file changes again
+                std::lock_guard<std::mutex> lock(m_watch_mutex);
+                m_loaded_stamp = Detail::Stamp(m_path);
+            }
+            return Swap();
+        }
+
+        void Update(double dt) {
+            if (m_api && m_api->update) m_api->update(m_context, dt);
+        }
+
+        bool RunCommand(std::uint32_t index) {
+            if (!m_api || !m_api->run_command || index >= m_api->command_count) return false;
+            return m_api->run_command(m_context, index);
+        }
+
+        bool IsLoaded() const { return m_api != nullptr; }
+        const Backend::Module::ModuleAPI* API() const { return m_api; }
+        // The module's Backend operations, or null; call them as op(Context(), ...)
+        const Backend::Module::BackendOps* Ops() const { return m_api ? m_api->ops : nullptr; }
+        Backend::Module::ModuleContext& Context() { return m_context; }
+        const std::filesystem::path& Path() const { return m_path; }
+        const std::string& Error() const { return m_error; }
+        std::uint32_t ReloadCount() const { return m_reloads; }
+        double LastReloadMs() const { return m_last_reload_ms; }
+        bool StateKept() const { return m_state_kept; }
+
+    private:
+        void ResetState() {
+            m_context.state = nullptr;
+            m_context.state_size = 0;
+            m_context.state_version = 0;
+            m_context.reloads = 0;
+        }
+
+        static void CloseImage(void* library, const std::filesystem::path& shadow) {
+            if (library) Detail::CloseLibrary(library);
+            if (!shadow.empty()) {
+                std::error_code ec;
+                std::filesystem::remove(shadow, ec);
+            }
+        }
+
+        // Loads a fresh shadow copy; only replaces the running image once the
+        // new one resolved its entry point with a matching API version. An
+        // image whose load() fails is unloaded for good and closed, and the
+        // next one starts a new session (reloads 0, zeroed state)
+        bool Swap() {
+            const auto start = std::chrono::steady_clock::now();
+            std::error_code ec;
+            const std::filesystem::path shadow = std::filesystem::temp_directory_path(ec) /
+                (m_path.stem().string() + "." + std::to_string(Detail::ProcessId()) + "." +
+                 std::to_string(m_generation++) + m_path.extension().string());
+            if (ec || !std::filesystem::copy_file(m_path, shadow, std::filesystem::copy_options::overwrite_existing, ec)) {
+                m_error = "Cannot copy " + m_path.string() + ": " + ec.message();
+                return false;
+            }
+
+            std::string error;
+            void* library = Detail::OpenLibrary(shadow.string(), error);
+            const Backend::Module::ModuleAPI* api = nullptr;
+            if (library) {
+                auto entry = reinterpret_cast<Backend::Module::ModuleEntryPoint>(
+                    Detail::FindSymbol(library, Backend::Module::kModuleEntryPoint));
+                api = entry ? entry() : nullptr;
+                if (!api) error = std::string("Missing entry point ") + Backend::Module::kModuleEntryPoint;
+                else if (api->api_version != Backend::Module::kModuleApiVersion) {
+                    error = "Module API version " + std::to_string(api->api_version) + ", host expects " +
+                            std::to_string(Backend::Module::kModuleApiVersion);
+                    api = nullptr;
+                }
+            }
+            if (!api) {
+                CloseImage(library, shadow);
+                m_error = error;
+                return false;
+            }
+
+            const bool reloading = m_api != nullptr;
+            if (reloading) {
+                if (m_api->unload) m_api->unload(m_context, true);
+                CloseImage(m_library, m_shadow);
+                ++m_reloads;
+            }
+            m_library = library;
+            m_shadow = shadow;
+            m_api = api;
+
+            // Keep the state block if the layout is unchanged, else start over
+            m_state_kept = reloading && m_context.state && m_context.state_size == api->state_size &&
+                           m_context.state_version == api->state_version;
+            if (!m_state_kept) {
+                m_arena.Reset();
+                m_context.state = api->state_size ? m_arena.Allocate(api->state_size, alignof(std::max_align_t)) : nullptr;
+                if (m_context.state) std::memset(m_context.state, 0, api->state_size);
+                m_context.state_size = api->state_size;
+                m_context.state_version = api->state_version;
+            }
+
+            m_error.clear();
+            m_context.reloads = reloading ? m_context.reloads + 1 : 0;
+            if (api->load && !api->load(m_context, m_state_kept)) {
+                m_error = std::string("Module '") + api->name + "' failed to load";
+                if (api->unload) api->unload(m_context, false);
+                CloseImage(m_library, m_shadow);
+                m_library = nullptr;
+                m_shadow.clear();
+                m_api = nullptr;
+                m_state_kept = false;
+                ResetState();
+            }
+            m_last_reload_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            return m_error.empty();
+        }
+
+        void WatchLoop() {
+            Detail::FileStamp last = m_loaded_stamp;
+            std::unique_lock<std::mutex> lock(m_watch_mutex);
+            while (!m_watch_wake.wait_for(lock, std::chrono::milliseconds(250), [this] { return m_stop; })) {
+                const Detail::FileStamp stamp = Detail::Stamp(m_path);
+                // A change counts once it held still for a whole poll interval
+                if (stamp.exists && stamp == last && !(stamp == m_watched_stamp) &&
+                    !m_change_pending.load(std::memory_order_acquire)) {
+                    m_watched_stamp = stamp;
+                    if (!(stamp == m_loaded_stamp)) {
+                        m_change_pending.store(true, std::memory_order_release);
+                        Backend::RequestRedraw();
+                    }
+                }
+                last = stamp;
+            }
+        }
+
+        std::filesystem::path m_path;
+        std::filesystem::path m_shadow;
+        void* m_library = nullptr;
+        const Backend::Module::ModuleAPI* m_api = nullptr;
+        Backend::Module::ModuleContext m_context;
+
+        // Module state lives here, across images
+        Backend::Memory::LinearArena m_arena{ 4096 };
+        bool m_state_kept = false;
+
+        std::string m_error;
+        std::uint32_t m_generation = 0;
+        std::uint32_t m_reloads = 0;
+        double m_last_reload_ms = 0.0;
+
+        std::thread m_watcher;
+        std::mutex m_watch_mutex;
+        std::condition_variable m_watch_wake;
+        bool m_stop = false;
+        std::atomic<bool> m_change_pending{ false };
+        Detail::FileStamp m_loaded_stamp;     // Guarded by m_watch_mutex once the watcher runs
+        Detail::FileStamp m_watched_stamp;    // Watcher thread only
+    };
+
+} // namespace ModuleHost
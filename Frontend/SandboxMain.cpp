@@ -1,18 +1,59 @@
-#include <iostream>
 #include "WindowSetup.h"
+#include "HeadlessRun.h"
 #include "UILayouts.h"
+#include "Scene/Scene.h"
+#include "IO/SceneJournal.h"
+#include "Engine.h"
+#include "Logging/Log.h"
+#include "Render/Renderer.h"
+#include "Render/FramePipeline.h"
+#include "Geometry/LodLibrary.h"
 
+// Heap counters for the DebugPanel (global operator new, this TU only)
+#include "Memory/HeapHooks.h"
+
+
+int main(int argc, char** argv) {
+    Backend::Logging::Initialize();
 
-int main(int, char**) {
     WindowSetup::WindowConfig config;
     config.title = "UI SANDBOX";
-    config.on_post_init = [](GLFWwindow*) { std::cout << "Sandbox Ready.\n"; };
+    config.loop_mode = WindowSetup::LoopMode::Idle;
+    const Headless::Options headless = Headless::ParseArgs(argc, argv);
+    Headless::Apply(headless, config);
+    config.on_post_init = [](GLFWwindow*) {
+        Backend::SetRedrawHandler([] { WindowSetup::RequestRedraw(); });
+        GE_LOG_INFO(UI, "Sandbox Ready.");
+    };
+    config.on_shutdown = []() { Backend::SetRedrawHandler(nullptr); };
 
     // 1. Initialize
     if (!WindowSetup::Initialize(config)) return 1;
 
+    // Small demo scene so panels have something to edit
+    Backend::Scene scene;
+    Backend::IO::SceneJournal journal;
+    if (journal.Open("sandbox_scene") && journal.GetStatus().persisted_entities > 0) {
+        journal.Load(scene);
+        scene.SetSelected(scene.Registry().view<Backend::Transform>().front());
+    } else {
+        scene.SetSelected(scene.CreateEntity("Player_01", { glm::vec3(0.0f, 10.0f, 0.0f) }));
+    }
+
+    Backend::Render::RendererConfig render_config;
+    render_config.backend = headless.enabled ? Backend::Render::RendererBackend::Noop
+                                             : Backend::Render::RendererBackend::Auto;
+    Backend::Render::Renderer renderer;
+    if (!renderer.Start(render_config) || !renderer.Error().empty()) {
+        GE_LOG_WARN(Render, "Renderer: {}", renderer.Error());
+    }
+
+    Backend::Render::FramePipeline pipeline(&renderer);
+    Backend::Geometry::LodLibrary library;
+
     // 2. Loop
-    while (!WindowSetup::ShouldClose()) {
+    Headless::Recorder recorder(headless);
+    while (!WindowSetup::ShouldClose() && recorder.Continue()) {
         
         // This helper handles ImGui::NewFrame() AND the Polling
         WindowSetup::BeginFrame();
@@ -22,7 +63,7 @@ int main(int, char**) {
         WindowSetup::BeginDockspace("SandboxDockSpace");
 
         // --- RENDER YOUR UI PANELS HERE ---
-        UILab::Render(); 
+        UILab::Render(scene, journal, renderer, pipeline, library); 
         // ----------------------------------
 
         WindowSetup::EndDockspace();
@@ -30,8 +71,15 @@ int main(int, char**) {
 
         // This helper handles Clear, Viewports, and SwapBuffers
         WindowSetup::Render();
+        recorder.EndFrame();
     }
+    const bool recorded = recorder.Finish();
+    pipeline.Flush();
+    renderer.Stop();
+    library.Stop();
+    journal.Close();
 
     WindowSetup::Shutdown();
-    return 0;
+    Backend::Logging::Shutdown();
+    return recorded ? 0 : 1;
 }
\ No newline at end of file
@@ -0,0 +1,255 @@
+#pragma once
+
+// Startup orchestration and phase tracing for the Frontend executables.
+//
+// Trace records named phases (start/end relative to process start, and the
+// thread that ran them) from any thread. Phase is the scoped recorder;
+// WindowSetup::Initialize uses it for each of its steps. Orchestrator runs
+// independent startup work (scene loading, renderer start-up) on
+// background threads while the window comes up; the caller keeps drawing
+// frames until Ready() and only then touches the objects those tasks
+// initialized.
+//
+// At the end, LogSummary() prints the phases and WriteChromeTrace() writes
+// them for chrome://tracing or Perfetto.
+
+#include "imgui.h"
+#include "Logging/Log.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace Startup {
+
+    // ============================================================================
+    // TRACE
+    // ============================================================================
+
+    struct PhaseRecord {
+        const char* name = "";      // String literal
+        double start_ms = 0.0;      // Since Trace::Begin()
+        double end_ms = 0.0;
+        std::uint32_t thread = 0;   // 0 = the thread that called Begin()
+        bool ok = true;
+    };
+
+    namespace Internal {
+        inline std::mutex s_mutex;
+        inline std::vector<PhaseRecord> s_records;
+        inline std::vector<std::thread::id> s_threads;
+        inline std::chrono::steady_clock::time_point s_origin = std::chrono::steady_clock::now();
+
+        // Small stable ids for the trace; caller holds s_mutex
+        inline std::uint32_t ThreadIdLocked() {
+            const std::thread::id id = std::this_thread::get_id();
+            const auto it = std::find(s_threads.begin(), s_threads.end(), id);
+            if (it != s_threads.end()) return static_cast<std::uint32_t>(it - s_threads.begin());
+            s_threads.push_back(id);
+            return static_cast<std::uint32_t>(s_threads.size() - 1);
+        }
+    }
+
+    class Trace {
+    public:
+        // First thing in main(): resets the origin and makes this thread 0
+        static void Begin() {
+            std::lock_guard<std::mutex> lock(Internal::s_mutex);
+            Internal::s_origin = std::chrono::steady_clock::now();
+            Internal::s_records.clear();
+            Internal::s_threads.assign(1, std::this_thread::get_id());
+        }
+
+        static double NowMs() {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Internal::s_origin).count();
+        }
+
+        static void Record(const char* name, double start_ms, double end_ms, bool ok = true) {
+            std::lock_guard<std::mutex> lock(Internal::s_mutex);
+            Internal::s_records.push_back(PhaseRecord{ name, start_ms, end_ms, Internal::ThreadIdLocked(), ok });
+        }
+
+        // Zero-length phase, e.g. "first_frame"
+        static void Mark(const char* name) {
+            const double now = NowMs();
+            Record(name, now, now);
+        }
+
+        static std::vector<PhaseRecord> Records() {
+            std::lock_guard<std::mutex> lock(Internal::s_mutex);
+            return Internal::s_records;
+        }
+
+        // End time of the first phase called `name`, or -1
+        static double EndOf(const char* name) {
+            std::lock_guard<std::mutex> lock(Internal::s_mutex);
+            for (const PhaseRecord& record : Internal::s_records) {
+                if (std::string_view(record.name) == name) return record.end_ms;
+            }
+            return -1.0;
+        }
+
+        static void LogSummary() {
+            std::vector<PhaseRecord> records = Records();
+            std::stable_sort(records.begin(), records.end(),
+                             [](const PhaseRecord& a, const PhaseRecord& b) { return a.start_ms < b.start_ms; });
+            for (const PhaseRecord& record : records) {
+                GE_LOG_DEBUG(Engine, "Startup {:>8.1f} .. {:>8.1f} ms  [t{}] {}{}", record.start_ms, record.end_ms,
+                             record.thread, record.name, record.ok ? "" : " (failed)");
+            }
+        }
+
+        // Chrome trace event format (complete events, microseconds), built
+        // like Profiling::ExportChromeTrace so names are escaped
+        static bool WriteChromeTrace(const std::string& path) {
+            nlohmann::json events = nlohmann::json::array();
+            for (const PhaseRecord& r : Records()) {
+                events.push_back({
+                    { "name", r.name }, { "cat", "startup" }, { "ph", "X" }, { "pid", 1 }, { "tid", r.thread },
+                    { "ts", r.start_ms * 1000.0 }, { "dur", (r.end_ms - r.start_ms) * 1000.0 },
+                    { "args", { { "ok", r.ok } } }
+                });
+            }
+
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            if (!file) return false;
+            file << nlohmann::json{ { "traceEvents", std::move(events) } }.dump() << '\n';
+            return static_cast<bool>(file);
+        }
+    };
+
+    // Records [construction, End() or destruction) as one phase
+    class Phase {
+    public:
+        explicit Phase(const char* name) : m_name(name), m_start(Trace::NowMs()) {}
+        ~Phase() { End(); }
+
+        Phase(const Phase&) = delete;
+        Phase& operator=(const Phase&) = delete;
+
+        void Fail() { m_ok = false; }
+
+        void End() {
+            if (m_ended) return;
+            m_ended = true;
+            Trace::Record(m_name, m_start, Trace::NowMs(), m_ok);
+        }
+
+    private:
+        const char* m_name;
+        double m_start;
+        bool m_ok = true;
+        bool m_ended = false;
+    };
+
+    // ============================================================================
+    // ORCHESTRATOR
+    // ============================================================================
+
+    class Orchestrator {
+    public:
+        // Called from the task's thread after each task finishes (e.g. to wake
+        // an idle event loop). Set before the first Launch()
+        std::function<void()> on_task_finished;
+
+        Orchestrator() = default;
+        ~Orchestrator() { WaitAll(); }
+
+        Orchestrator(const Orchestrator&) = delete;
+        Orchestrator& operator=(const Orchestrator&) = delete;
+
+        // Runs `fn` (returning bool) on its own thread as phase `name`. Whatever
+        // it touches belongs to the task until WaitAll()
+        template <typename Fn>
+        void Launch(const char* name, Fn&& fn) {
+            auto task = std::make_unique<Task>();
+            task->name = name;
+            Task* raw = task.get();
+            task->result = std::async(std::launch::async, [this, raw, fn = std::forward<Fn>(fn)]() mutable {
+                bool ok = false;
+                {
+                    // A throwing task counts as failed: the exception must not
+                    // escape into result.get(), which ~Orchestrator reaches
+                    // through WaitAll, and done must still be set for Ready()
+                    Phase phase(raw->name);
+                    try {
+                        ok = fn();
+                    } catch (const std::exception& e) {
+                        GE_LOG_ERROR(Engine, "Startup task {} threw: {}", raw->name, e.what());
+                    } catch (...) {
+                        GE_LOG_ERROR(Engine, "Startup task {} threw an unknown exception", raw->name);
+                    }
+                    if (!ok) phase.Fail();
+                }
+                raw->done.store(true, std::memory_order_release);
+                if (on_task_finished) on_task_finished();
+                return ok;
+            });
+            m_tasks.push_back(std::move(task));
+        }
+
+        // Every task has finished (non-blocking)
+        bool Ready() const {
+            return std::all_of(m_tasks.begin(), m_tasks.end(),
+                               [](const auto& task) { return task->done.load(std::memory_order_acquire); });
+        }
+
+        // Joins every task; false if any of them failed. Time spent blocked
+        // here is recorded as "wait_tasks"
+        bool WaitAll() {
+            if (m_tasks.empty()) return m_ok;
+            Phase phase("wait_tasks");
+            for (auto& task : m_tasks) {
+                m_ok &= task->result.get();
+            }
+            m_tasks.clear();
+            return m_ok;
+        }
+
+        // For a progress display: (name, done) per task
+        template <typename Fn>
+        void ForEachTask(Fn&& fn) const {
+            for (const auto& task : m_tasks) fn(task->name, task->done.load(std::memory_order_acquire));
+        }
+
+    private:
+        struct Task {
+            const char* name = "";
+            std::future<bool> result;
+            std::atomic<bool> done{ false };
+        };
+
+        std::vector<std::unique_ptr<Task>> m_tasks;
+        bool m_ok = true;
+    };
+
+    // Minimal frame while tasks run: keeps the window responsive and shows
+    // what is still loading
+    inline void RenderProgress(const Orchestrator& orchestrator) {
+        const ImGuiViewport* viewport = ImGui::GetMainViewport();
+        ImGui::SetNextWindowPos(viewport->GetCenter(), ImGuiCond_Always, ImVec2(0.5f, 0.5f));
+        const ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize |
+                                       ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoDocking |
+                                       ImGuiWindowFlags_NoMove;
+        if (ImGui::Begin("##Startup", nullptr, flags)) {
+            ImGui::TextUnformatted("Starting Geometry Engine...");
+            ImGui::Separator();
+            orchestrator.ForEachTask([](const char* name, bool done) {
+                if (done) ImGui::TextDisabled("%s", name);
+                else ImGui::Text("%s", name);
+            });
+        }
+        ImGui::End();
+    }
+
+} // namespace Startup
@@ -1,12 +1,17 @@
 #pragma once
 #include "imgui.h"
 #include "imgui_internal.h" 
+#include <cstdio>
 
 // 1. Icons
 #include "../Core/IconsFontAwesome6.h" 
 
 // 2. WindowSetup - Direct include works now thanks to CMake
 #include "WindowSetup.h"
+#include "ProfilerView.h"
+#include "../Core/PanelCache.h"
+#include "Memory/Memory.h"
+#include "ModuleHost.h"
 
 // Fallback for safety
 #ifndef ICON_FA_GEARS
@@ -18,21 +23,189 @@ namespace UILab {
     struct DebugPanelState {
         bool showMetrics = false;
         bool showStack = false;
+        
+        // Heap allocations per frame, ring buffer for the plot
+        static constexpr int kAllocHistory = 240;
+        float allocHistory[kAllocHistory] = {};
+        int allocHead = 0;
+        std::uint64_t allocFrame = 0;
     };
     
     inline DebugPanelState g_DebugPanelState;
     
-    inline void RenderDebugPanel() {
+    inline void RenderFramePacing() {
+        const WindowSetup::PerformanceMetrics& m = WindowSetup::GetMetrics();
+        FrameTiming::FrameHistory& history = WindowSetup::GetFrameHistoryMutable();
+        const float width = ImGui::GetContentRegionAvail().x;
+        
+        ImGui::Text("FPS: %.1f  (%.2f ms)", m.fps, m.frame_time_ms);
+        const FrameTiming::FrameStats& stats = history.Stats();
+        ImGui::Text("p50 %.2f  p95 %.2f  p99 %.2f  max %.2f ms", stats.p50_ms, stats.p95_ms, stats.p99_ms, stats.max_ms);
+        if (m.stutter_count > 0) {
+            ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "Stutters: %llu", static_cast<unsigned long long>(m.stutter_count));
+        } else {
+            ImGui::Text("Stutters: 0");
+        }
+        
+        // Frame-time graph, scaled so p99 sits around two thirds of the height
+        static float values[FrameTiming::FrameHistory::kCapacity];
+        int count = static_cast<int>(history.Copy(values, FrameTiming::FrameHistory::kCapacity, &FrameTiming::FrameSample::frame_ms));
+        char overlay[32];
+        snprintf(overlay, sizeof(overlay), "frame %.2f ms", m.frame_time_ms);
+        ImGui::PlotLines("##FrameTime", values, count, 0, overlay, 0.0f,
+                         stats.p99_ms * 1.5f + 1.0f, ImVec2(width, 60.0f));
+        
+        // CPU phases for the last frame
+        ImGui::Text("CPU  events %.2f | update %.2f | render %.2f | swap %.2f ms",
+                    m.events_time_ms, m.update_time_ms, m.render_time_ms, m.swap_time_ms);
+        count = static_cast<int>(history.Copy(values, FrameTiming::FrameHistory::kCapacity, &FrameTiming::FrameSample::update_ms));
+        ImGui::PlotLines("##UpdateTime", values, count, 0, "update ms", 0.0f, FLT_MAX, ImVec2(width, 40.0f));
+        count = static_cast<int>(history.Copy(values, FrameTiming::FrameHistory::kCapacity, &FrameTiming::FrameSample::render_ms));
+        ImGui::PlotLines("##RenderTime", values, count, 0, "render ms", 0.0f, FLT_MAX, ImVec2(width, 40.0f));
+        
+        // GPU
+        if (m.gpu_time_ms >= 0.0) {
+            ImGui::Text("GPU  %.3f ms", m.gpu_time_ms);
+            count = static_cast<int>(history.Copy(values, FrameTiming::FrameHistory::kCapacity, &FrameTiming::FrameSample::gpu_ms));
+            for (int i = 0; i < count; i++) {
+                if (values[i] < 0.0f) values[i] = 0.0f;  // Unresolved queries
+            }
+            ImGui::PlotLines("##GpuTime", values, count, 0, "gpu ms", 0.0f, FLT_MAX, ImVec2(width, 40.0f));
+        } else {
+            ImGui::TextDisabled("GPU  n/a (no timer queries)");
+        }
+        
+        ImGui::Text("Latency (poll -> swap): %.2f ms", m.input_latency_ms);
+        ImGui::Text("Draw calls: %zu  Vertices: %zu  Indices: %zu", m.draw_calls, m.vertices, m.indices);
+        const ImGuiRenderer::Stats& renderer = WindowSetup::GetRendererStats();
+        ImGui::Text("ImGui upload: %s, %.1f KB/frame, %u binds, %llu fence waits, %llu skipped",
+                    ImGuiRenderer::PathName(renderer.path), renderer.upload_bytes / 1024.0,
+                    renderer.texture_binds, static_cast<unsigned long long>(renderer.fence_waits),
+                    static_cast<unsigned long long>(renderer.skipped_frames));
+        
+        ImGui::SetNextItemWidth(120.0f);
+        ImGui::SliderFloat("Stutter ratio", &history.stutter_ratio, 1.25f, 4.0f, "%.2fx");
+        
+        // Live graphs only move while frames are drawn; disable idle mode to watch them
+        bool idle = WindowSetup::GetConfig().loop_mode == WindowSetup::LoopMode::Idle;
+        if (ImGui::Checkbox("Idle loop (redraw on demand)", &idle)) {
+            WindowSetup::SetLoopMode(idle ? WindowSetup::LoopMode::Idle : WindowSetup::LoopMode::Continuous);
+        }
+    }
+    
+    // Target: zero heap allocations per steady-state frame. Per-frame scratch
+    // belongs in the frame arena, per-job scratch in the thread arenas
+    inline void RenderMemory() {
+        DebugPanelState& state = g_DebugPanelState;
+        const Backend::Memory::MemoryStats m = Backend::Memory::GetStats();
+        if (m.frame != state.allocFrame) {
+            state.allocHistory[state.allocHead] = static_cast<float>(m.heap_allocations);
+            state.allocHead = (state.allocHead + 1) % DebugPanelState::kAllocHistory;
+            state.allocFrame = m.frame;
+        }
+        
+        if (m.heap_tracking) {
+            const ImVec4 color = m.heap_allocations == 0 ? ImVec4(0.4f, 0.9f, 0.4f, 1.0f) : ImVec4(1.0f, 0.6f, 0.2f, 1.0f);
+            ImGui::TextColored(color, "Heap: %llu allocs, %llu frees, %.1f KB last frame",
+                               static_cast<unsigned long long>(m.heap_allocations),
+                               static_cast<unsigned long long>(m.heap_frees), m.heap_bytes / 1024.0);
+            ImGui::Text("Heap total: %llu allocs, %.1f MB",
+                        static_cast<unsigned long long>(m.total_heap_allocations), m.total_heap_bytes / (1024.0 * 1024.0));
+            ImGui::PlotHistogram("##HeapAllocs", state.allocHistory, DebugPanelState::kAllocHistory, state.allocHead,
+                                 "allocs / frame", 0.0f, FLT_MAX, ImVec2(ImGui::GetContentRegionAvail().x, 40.0f));
+        } else {
+            ImGui::TextDisabled("Heap: not tracked (include Memory/HeapHooks.h in the executable)");
+        }
+        
+        ImGui::Text("Frame arena: %.1f / %.1f KB (peak %.1f KB)", m.frame_arena_used / 1024.0,
+                    m.frame_arena_capacity / 1024.0, m.frame_arena_peak / 1024.0);
+        ImGui::Text("UI pools: %zu live blocks, %zu slabs, %.1f KB (%llu pooled, %llu upstream)",
+                    m.ui_pools.live_blocks, m.ui_pools.slabs, m.ui_pools.capacity / 1024.0,
+                    static_cast<unsigned long long>(m.ui_pools.pooled),
+                    static_cast<unsigned long long>(m.ui_pools.upstream));
+    }
+    
+    // Retained panels (PanelCache): hit rate and why the last frame rebuilt
+    inline void RenderPanelCaches() {
+        ImGui::Checkbox("Replay unchanged panels", &g_PanelCacheEnabled);
+        if (ImGui::BeginTable("PanelCaches", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            ImGui::TableSetupColumn("Panel");
+            ImGui::TableSetupColumn("Hit rate");
+            ImGui::TableSetupColumn("Hits / rebuilds");
+            ImGui::TableSetupColumn("Vertices");
+            ImGui::TableSetupColumn("Last rebuild");
+            ImGui::TableHeadersRow();
+            for (const PanelCache* cache : PanelCacheDetail::Registry()) {
+                const PanelCacheStats& stats = cache->Stats();
+                const std::uint64_t frames = stats.hits + stats.rebuilds;
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(cache->Name());
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f%%", frames ? 100.0 * static_cast<double>(stats.hits) / static_cast<double>(frames) : 0.0);
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu / %llu", static_cast<unsigned long long>(stats.hits),
+                            static_cast<unsigned long long>(stats.rebuilds));
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", stats.vertices);
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(stats.last_rebuild[0] ? stats.last_rebuild : "-");
+            }
+            ImGui::EndTable();
+        }
+    }
+    
+    // Hot-reloaded modules: rebuild the module target and the host swaps it
+    // in between frames; commands run against the live scene
+    inline void RenderModules(ModuleHost::Host* modules) {
+        if (!modules || modules->Path().empty()) {
+            ImGui::TextDisabled("No modules loaded");
+            return;
+        }
+        
+        const Backend::Module::ModuleAPI* api = modules->API();
+        ImGui::Text("%s", api ? api->name : modules->Path().filename().string().c_str());
+        ImGui::TextDisabled("%s", modules->Path().string().c_str());
+        ImGui::Text("Reloads: %u (last %.1f ms, state %s)", modules->ReloadCount(), modules->LastReloadMs(),
+                    modules->StateKept() ? "kept" : "reset");
+        if (!modules->Error().empty()) {
+            ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%s", modules->Error().c_str());
+        }
+        
+        if (api) {
+            for (std::uint32_t i = 0; i < api->command_count; ++i) {
+                if (i > 0) ImGui::SameLine();
+                if (ImGui::Button(api->commands[i])) modules->RunCommand(i);
+            }
+        }
+        if (ImGui::Button("Reload now")) modules->Reload();
+    }
+    
+    inline void RenderDebugPanel(ModuleHost::Host* modules = nullptr) {
         if (ImGui::Begin("Lab Controls " ICON_FA_GEARS)) {
             ImGui::Text("Diagnostics");
             ImGui::Separator();
             
             // Performance Section
             if (ImGui::CollapsingHeader("Performance", ImGuiTreeNodeFlags_DefaultOpen)) {
-                ImGui::Text("FPS: %.1f", ImGui::GetIO().Framerate);
-                // Public API for metrics
-                ImGui::Text("Vertices: %d", ImGui::GetIO().MetricsRenderVertices);
-                ImGui::Text("Indices:  %d", ImGui::GetIO().MetricsRenderIndices);
+                RenderFramePacing();
+            }
+            
+            if (ImGui::CollapsingHeader("Memory")) {
+                RenderMemory();
+            }
+            
+            if (ImGui::CollapsingHeader("UI cache")) {
+                RenderPanelCaches();
+            }
+            
+            if (ImGui::CollapsingHeader("Modules")) {
+                RenderModules(modules);
+            }
+            
+            // Profiler Section
+            if (ImGui::CollapsingHeader("Profiler")) {
+                RenderProfilerTimeline();
             }
             
             ImGui::Separator();
@@ -1,42 +1,189 @@
 #pragma once
 #include "imgui.h"
 #include "../Core/IconsFontAwesome6.h"
+#include "../Core/PanelCache.h"
+#include "Scene/Scene.h"
+#include "IO/SceneJournal.h"
+#include "Geometry/LodLibrary.h"
+#include "ModuleHost.h"
+#include <algorithm>
+#include <cstring>
 #include <string>
 
 namespace UILab {
 
-    struct InspectorState {
-        std::string objectName = "Player_01";
-        float position[3] = {0, 10, 0};
+    struct InspectorLodState {
+        char path[256] = "mesh.gemesh";
+        int max_levels = 6;
+        float ratio = 0.5f;
+        std::string message;
+        Backend::Geometry::LodMeshInfo info;   // Refilled every frame, capacity reused
     };
-    
-    inline InspectorState g_InspectorState;
-    
-    inline void RenderInspector() {
-        ImGui::Begin("Inspector " ICON_FA_MAGNIFYING_GLASS);
-        
-        ImGui::Text("Object Properties");
-        ImGui::Separator();
-        
-        // Requires <cstring> for cross-platform compatibility
-        char buf[64];
-        strncpy(buf, g_InspectorState.objectName.c_str(), sizeof(buf));
-        buf[sizeof(buf) - 1] = '\0'; // Ensure null termination
-        if (ImGui::InputText("Name", buf, sizeof(buf))) {
-            g_InspectorState.objectName = buf;
+
+    inline InspectorLodState g_InspectorLodState;
+    inline PanelCache g_InspectorCache{ "Inspector" };
+
+    namespace InspectorDetail {
+
+        // Chain of the selected entity's mesh: build on the library's thread,
+        // import a .gemesh onto the entity, export the chain as a .gemesh.
+        // Import and export are Backend module operations (BackendOps)
+        inline void RenderLodSection(Backend::Scene& scene, Backend::Entity selected,
+                                     Backend::Geometry::LodLibrary& library, ModuleHost::Host* modules) {
+            InspectorLodState& state = g_InspectorLodState;
+            if (!ImGui::CollapsingHeader(ICON_FA_LAYER_GROUP " Level of detail")) return;
+
+            const Backend::Module::BackendOps* ops = modules ? modules->Ops() : nullptr;
+            ImGui::InputText("File", state.path, sizeof(state.path));
+            ImGui::BeginDisabled(!ops || !ops->import_mesh);
+            if (ImGui::Button("Import .gemesh")) {
+                ops->import_mesh(modules->Context(), selected, state.path, state.message);
+            }
+            ImGui::EndDisabled();
+
+            const Backend::MeshHandle mesh = scene.GetMesh(selected);
+            Backend::Geometry::LodMeshInfo& info = state.info;
+            if (!mesh.IsValid() || !library.GetInfo(mesh.id, info)) {
+                ImGui::TextDisabled("No library mesh on this entity");
+                if (!state.message.empty()) ImGui::TextDisabled("%s", state.message.c_str());
+                return;
+            }
+
+            ImGui::Text("Mesh %u: %zu triangles, %zu vertices", mesh.id, info.triangles, info.vertices);
+            ImGui::SliderInt("Levels", &state.max_levels, 2, 8);
+            ImGui::SliderFloat("Ratio", &state.ratio, 0.1f, 0.9f, "%.2f");
+
+            ImGui::BeginDisabled(info.building);
+            if (ImGui::Button(info.building ? "Building..." : "Build LODs")) {
+                Backend::Geometry::LodChainOptions options;
+                options.max_levels = static_cast<std::uint32_t>(state.max_levels);
+                options.ratio = state.ratio;
+                library.RequestLods(mesh.id, options);
+            }
+            ImGui::EndDisabled();
+
+            if (!info.levels.empty()) {
+                ImGui::SameLine();
+                ImGui::BeginDisabled(!ops || !ops->export_lods);
+                if (ImGui::Button("Export")) {
+                    ops->export_lods(modules->Context(), mesh.id, state.path, state.message);
+                }
+                ImGui::EndDisabled();
+                ImGui::TextDisabled("Built in %.1f ms", info.build_ms);
+                if (ImGui::BeginTable("Lods", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+                    ImGui::TableSetupColumn("Level");
+                    ImGui::TableSetupColumn("Triangles");
+                    ImGui::TableSetupColumn("Error");
+                    ImGui::TableHeadersRow();
+                    for (std::size_t level = 0; level < info.levels.size(); ++level) {
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%zu", level);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%zu", info.levels[level].triangles);
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%.4g", info.levels[level].error);
+                    }
+                    ImGui::EndTable();
+                }
+            }
+            if (!state.message.empty()) ImGui::TextDisabled("%s", state.message.c_str());
         }
-        ImGui::DragFloat3("Position", g_InspectorState.position, 0.1f);
-        
-        if(ImGui::Button(ICON_FA_FLOPPY_DISK " Save Asset")) {
-            ImGui::OpenPopup("Saved");
+
+        // Everything the properties show; LOD builds bump the library generation
+        // when they finish, and starting one takes a click (which rebuilds)
+        inline std::uint64_t PanelKey(const Backend::Scene& scene, const Backend::IO::SceneJournal& journal,
+                                      const Backend::Geometry::LodLibrary& library, const ModuleHost::Host* modules) {
+            const InspectorLodState& state = g_InspectorLodState;
+            ContentKey key;
+            key.Add(scene.EntityCount()).Add(journal.IsOpen()).Add(library.Generation());
+            key.Add(modules ? modules->Ops() : nullptr);
+            key.Add(std::string_view(state.path)).Add(state.max_levels).Add(state.ratio).Add(std::string_view(state.message));
+            const Backend::Entity selected = scene.GetSelected();
+            key.Add(selected);
+            if (selected != Backend::NullEntity) {
+                key.Add(scene.GetName(selected)).Add(scene.GetTransform(selected));
+                key.Add(scene.GetBounds(selected).local).Add(scene.GetMesh(selected));
+            }
+            return key.Value();
         }
 
-        if(ImGui::BeginPopup("Saved")) {
-            ImGui::Text("Data saved to disk!");
-            ImGui::EndPopup();
+        inline void RenderProperties(Backend::Scene& scene, Backend::IO::SceneJournal& journal,
+                                     Backend::Geometry::LodLibrary& library, ModuleHost::Host* modules) {
+            ImGui::Text("Object Properties");
+            ImGui::Separator();
+
+            const Backend::Entity selected = scene.GetSelected();
+            if (selected == Backend::NullEntity) {
+                ImGui::TextDisabled("No entity selected");
+                ImGui::Text("Entities: %zu", scene.EntityCount());
+                return;
+            }
+
+            // Stack buffer, the name itself stays interned in the scene
+            char buf[64];
+            const std::string_view name = scene.GetName(selected);
+            const size_t len = name.size() < sizeof(buf) - 1 ? name.size() : sizeof(buf) - 1;
+            std::memcpy(buf, name.data(), len);
+            buf[len] = '\0';
+            if (ImGui::InputText("Name", buf, sizeof(buf))) {
+                scene.SetName(selected, buf);
+            }
+
+            Backend::Transform& transform = scene.GetTransform(selected);
+            bool moved = ImGui::DragFloat3("Position", &transform.position.x, 0.1f);
+            moved |= ImGui::DragFloat3("Rotation", &transform.rotation.x, 1.0f);
+            moved |= ImGui::DragFloat3("Scale", &transform.scale.x, 0.01f);
+            if (moved) {
+                scene.MarkDirty(selected, Backend::kDirtyTransform);
+            }
+
+            // Bounds::world is not refreshed every frame; the selected entity's
+            // are cheap enough to compute here, edits included
+            const Backend::Geometry::Aabb world = Backend::WorldBounds(transform, scene.GetBounds(selected).local);
+            if (world.IsValid()) {
+                ImGui::TextDisabled("Bounds: (%.2f, %.2f, %.2f) - (%.2f, %.2f, %.2f)",
+                    world.min.x, world.min.y, world.min.z,
+                    world.max.x, world.max.y, world.max.z);
+            }
+
+            RenderLodSection(scene, selected, library, modules);
+
+            ImGui::BeginDisabled(!journal.IsOpen());
+            if(ImGui::Button(ICON_FA_FLOPPY_DISK " Save Asset")) {
+                journal.Save(scene);
+                ImGui::OpenPopup("Saved");
+            }
+            ImGui::EndDisabled();
+
+            if(ImGui::BeginPopup("Saved")) {
+                // Status only; the write itself happens on the journal thread
+                const Backend::IO::SceneJournalStatus status = journal.GetStatus();
+                if (status.failed) {
+                    ImGui::Text("Save failed: %s", journal.LastError().c_str());
+                } else if (status.written_seq < status.submitted_seq) {
+                    ImGui::Text("Saving %zu changed entities...", status.last_batch_entities);
+                } else {
+                    ImGui::Text("Data saved to disk! (%zu entities)", status.persisted_entities);
+                }
+                ImGui::EndPopup();
+            }
         }
 
+    } // namespace InspectorDetail
+
+    // Edits the scene's selected entity in place; no per-panel copy of entity data
+    // Save Asset hands the dirty entities to the journal's writer thread.
+    // While nothing it shows changes and the mouse is elsewhere, the panel
+    // replays last frame's draw data (PanelCache)
+    inline void RenderInspector(Backend::Scene& scene, Backend::IO::SceneJournal& journal,
+                                Backend::Geometry::LodLibrary& library, ModuleHost::Host* modules = nullptr) {
+        ImGui::Begin("Inspector " ICON_FA_MAGNIFYING_GLASS);
+        if (g_InspectorCache.Begin(InspectorDetail::PanelKey(scene, journal, library, modules))) {
+            InspectorDetail::RenderProperties(scene, journal, library, modules);
+        }
+        g_InspectorCache.End();
         ImGui::End();
     }
-    
-} // namespace UILab
\ No newline at end of file
+
+} // namespace UILab
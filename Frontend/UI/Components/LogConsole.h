@@ -0,0 +1,227 @@
+#pragma once
+#include "imgui.h"
+#include "../Core/IconsFontAwesome6.h"
+#include "../Core/VirtualList.h"
+#include "Logging/Log.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <deque>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace UILab {
+
+    struct LogConsoleRow {
+        Backend::Logging::ConsoleEntry entry;
+        char time[16] = "";     // Local HH:MM:SS.mmm, formatted once on arrival
+    };
+
+    struct LogConsoleState {
+        static constexpr std::size_t kMaxRows = 8192;
+
+        std::deque<LogConsoleRow> rows;
+        std::uint64_t last_sequence = 0;
+        std::vector<Backend::Logging::ConsoleEntry> incoming;   // Reused
+
+        // Filters; `visible` indexes `rows` and is rebuilt when rows or filters change
+        int min_level = static_cast<int>(Backend::Logging::Level::Trace);
+        std::array<bool, Backend::Logging::kChannelCount> channels = [] {
+            std::array<bool, Backend::Logging::kChannelCount> all;
+            all.fill(true);
+            return all;
+        }();
+        char text[128] = "";
+        std::vector<std::uint32_t> visible;
+        bool dirty = true;
+
+        bool auto_scroll = true;
+        bool show_levels = false;
+    };
+
+    inline LogConsoleState g_LogConsoleState;
+
+    namespace LogConsoleDetail {
+
+        inline ImVec4 LevelColor(Backend::Logging::Level level) {
+            using Backend::Logging::Level;
+            switch (level) {
+                case Level::Trace:
+                case Level::Debug: return ImVec4(0.55f, 0.55f, 0.6f, 1.0f);
+                case Level::Warn: return ImVec4(1.0f, 0.75f, 0.25f, 1.0f);
+                case Level::Error: return ImVec4(1.0f, 0.4f, 0.35f, 1.0f);
+                case Level::Critical: return ImVec4(1.0f, 0.25f, 0.6f, 1.0f);
+                default: return ImGui::GetStyleColorVec4(ImGuiCol_Text);
+            }
+        }
+
+        inline void FormatTime(std::int64_t time_ns, char (&out)[16]) {
+            const std::time_t seconds = static_cast<std::time_t>(time_ns / 1000000000);
+            const int millis = static_cast<int>((time_ns / 1000000) % 1000);
+            const std::tm* local = std::localtime(&seconds);    // UI thread only
+            if (!local) {
+                out[0] = '\0';
+                return;
+            }
+            std::snprintf(out, sizeof(out), "%02d:%02d:%02d.%03d", local->tm_hour, local->tm_min, local->tm_sec, millis);
+        }
+
+        inline bool Matches(const LogConsoleState& state, const Backend::Logging::ConsoleEntry& entry) {
+            if (static_cast<int>(entry.level) < state.min_level) return false;
+            if (!state.channels[static_cast<std::size_t>(entry.channel)]) return false;
+            if (state.text[0] == '\0') return true;
+            // Case-insensitive, like the Outliner search
+            const std::string_view text(entry.text);
+            const std::string_view query(state.text);
+            for (std::size_t i = 0; i + query.size() <= text.size(); ++i) {
+                std::size_t k = 0;
+                while (k < query.size() && FilterSource::Lower(text[i + k]) == FilterSource::Lower(query[k])) ++k;
+                if (k == query.size()) return true;
+            }
+            return false;
+        }
+
+        inline void RebuildVisible(LogConsoleState& state) {
+            state.visible.clear();
+            for (std::size_t i = 0; i < state.rows.size(); ++i) {
+                if (Matches(state, state.rows[i].entry)) state.visible.push_back(static_cast<std::uint32_t>(i));
+            }
+            state.dirty = false;
+        }
+
+        // Only messages logged since the last frame are copied out of the ring,
+        // and only they are matched against unchanged filters
+        inline void Poll(LogConsoleState& state) {
+            state.incoming.clear();
+            state.last_sequence = Backend::Logging::ReadConsole(state.last_sequence, state.incoming);
+            if (state.incoming.empty()) return;
+            const std::size_t first_new = state.rows.size();
+            for (Backend::Logging::ConsoleEntry& entry : state.incoming) {
+                LogConsoleRow& row = state.rows.emplace_back();
+                FormatTime(entry.time_ns, row.time);
+                row.entry = std::move(entry);
+            }
+            std::size_t popped = 0;
+            for (; state.rows.size() > LogConsoleState::kMaxRows; ++popped) state.rows.pop_front();
+
+            if (state.dirty || popped > first_new) {
+                state.dirty = true;
+                return;
+            }
+            const auto kept = std::find_if(state.visible.begin(), state.visible.end(),
+                                           [&](std::uint32_t row) { return row >= popped; });
+            state.visible.erase(state.visible.begin(), kept);
+            for (std::uint32_t& row : state.visible) row -= static_cast<std::uint32_t>(popped);
+            for (std::size_t i = first_new - popped; i < state.rows.size(); ++i) {
+                if (Matches(state, state.rows[i].entry)) state.visible.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+
+        // Channel levels are the loggers' own: raising one here stops those
+        // messages before they are formatted, not just from being shown
+        inline void RenderChannelLevels() {
+            namespace L = Backend::Logging;
+            const char* levels[] = { "trace", "debug", "info", "warn", "error", "critical", "off" };
+            if (!ImGui::BeginTable("ChannelLevels", 2, ImGuiTableFlags_SizingFixedFit)) return;
+            for (std::size_t i = 0; i < L::kChannelCount; ++i) {
+                const auto channel = static_cast<L::Channel>(i);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(L::ChannelName(channel));
+                ImGui::TableNextColumn();
+                int level = static_cast<int>(L::GetLevel(channel));
+                ImGui::PushID(static_cast<int>(i));
+                ImGui::SetNextItemWidth(ImGui::GetFontSize() * 7.0f);
+                if (ImGui::Combo("##Level", &level, levels, IM_ARRAYSIZE(levels))) {
+                    L::SetLevel(channel, static_cast<L::Level>(level));
+                }
+                ImGui::PopID();
+            }
+            ImGui::EndTable();
+        }
+
+    } // namespace LogConsoleDetail
+
+    // Messages from every channel, newest at the bottom. The log worker fills
+    // a ring; this panel only copies what arrived since the last frame and
+    // submits the rows on screen
+    inline void RenderLogConsole() {
+        namespace L = Backend::Logging;
+        LogConsoleState& state = g_LogConsoleState;
+        ImGui::Begin("Log " ICON_FA_TERMINAL);
+
+        LogConsoleDetail::Poll(state);
+
+        // Toolbar
+        const char* levels[] = { "trace", "debug", "info", "warn", "error", "critical" };
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 6.0f);
+        state.dirty |= ImGui::Combo("Show", &state.min_level, levels, IM_ARRAYSIZE(levels));
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 12.0f);
+        state.dirty |= ImGui::InputTextWithHint("##Filter", "Filter text", state.text, sizeof(state.text));
+        ImGui::SameLine();
+        if (ImGui::Button("Clear")) {
+            L::ClearConsole();
+            state.rows.clear();
+            state.dirty = true;
+        }
+        ImGui::SameLine();
+        ImGui::Checkbox("Auto-scroll", &state.auto_scroll);
+        ImGui::SameLine();
+        ImGui::Checkbox("Levels", &state.show_levels);
+
+        for (std::size_t i = 0; i < L::kChannelCount; ++i) {
+            if (i > 0) ImGui::SameLine();
+            state.dirty |= ImGui::Checkbox(L::ChannelName(static_cast<L::Channel>(i)), &state.channels[i]);
+        }
+
+        const L::LogStats stats = L::GetStats();
+        ImGui::TextDisabled("%zu / %zu shown, %llu logged, %llu dropped", state.visible.size(), state.rows.size(),
+                            static_cast<unsigned long long>(stats.written), static_cast<unsigned long long>(stats.dropped));
+
+        if (state.show_levels) {
+            LogConsoleDetail::RenderChannelLevels();
+            ImGui::Separator();
+        }
+
+        if (state.dirty) LogConsoleDetail::RebuildVisible(state);
+
+        const ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV |
+                                      ImGuiTableFlags_Resizable;
+        if (ImGui::BeginTable("Messages", 4, flags, ImGui::GetContentRegionAvail())) {
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableSetupColumn("Time", ImGuiTableColumnFlags_WidthFixed, ImGui::GetFontSize() * 6.0f);
+            ImGui::TableSetupColumn("Level", ImGuiTableColumnFlags_WidthFixed, ImGui::GetFontSize() * 4.0f);
+            ImGui::TableSetupColumn("Channel", ImGuiTableColumnFlags_WidthFixed, ImGui::GetFontSize() * 4.5f);
+            ImGui::TableSetupColumn("Message", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableHeadersRow();
+
+            // Follow new messages only while already at the bottom
+            const bool at_bottom = ImGui::GetScrollY() >= ImGui::GetScrollMaxY();
+
+            const float row_height = TableRowHeight();
+            VirtualRows(static_cast<int>(state.visible.size()), row_height, [&](int index) {
+                const LogConsoleRow& row = state.rows[state.visible[static_cast<std::size_t>(index)]];
+                const L::ConsoleEntry& entry = row.entry;
+                ImGui::TableNextRow(ImGuiTableRowFlags_None, row_height);
+                ImGui::TableNextColumn();
+                ImGui::TextDisabled("%s", row.time);
+                ImGui::TableNextColumn();
+                ImGui::TextColored(LogConsoleDetail::LevelColor(entry.level), "%s", L::LevelName(entry.level));
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(L::ChannelName(entry.channel));
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(entry.text.data(), entry.text.data() + entry.text.size());
+            });
+
+            if (state.auto_scroll && at_bottom) ImGui::SetScrollHereY(1.0f);
+            ImGui::EndTable();
+        }
+
+        ImGui::End();
+    }
+
+} // namespace UILab
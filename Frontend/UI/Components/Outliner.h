@@ -0,0 +1,180 @@
+#pragma once
+#include "imgui.h"
+#include "../Core/IconsFontAwesome6.h"
+#include "../Core/VirtualList.h"
+#include "Scene/Scene.h"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace UILab {
+
+    struct OutlinerState {
+        char query[128] = "";
+        AsyncFilter filter;
+
+        // Search index, rebuilt when the scene's entity set changes
+        std::uint64_t scene_revision = ~0ull;
+        std::size_t entities = 0;
+
+        // Result on screen and where the selection sits in it (-1: filtered out)
+        std::shared_ptr<const FilterResult> result;
+        Backend::Entity selection = Backend::NullEntity;
+        int selected_row = -1;
+        bool scroll_to_selection = false;
+    };
+
+    inline OutlinerState g_OutlinerState;
+
+    namespace OutlinerDetail {
+
+        inline Backend::Entity RowEntity(const FilterResult& result, int row) {
+            return static_cast<Backend::Entity>(result.source->ids[result.rows[static_cast<std::size_t>(row)]]);
+        }
+
+        // Runs when entities are added, removed or renamed. Only ids and Name
+        // ranges are copied here; the filter thread lowercases the keys out
+        // of the scene's shared name table
+        inline void RebuildSource(OutlinerState& state, Backend::Scene& scene) {
+            struct Row {
+                std::uint64_t id;
+                Backend::Name name;
+            };
+            const auto view = scene.Registry().view<const Backend::Name>();
+            std::vector<Row> rows;
+            rows.reserve(view.size());
+            for (auto [entity, name] : view.each()) {
+                rows.push_back(Row{ static_cast<std::uint64_t>(entt::to_integral(entity)), name });
+            }
+            state.entities = rows.size();
+            state.scene_revision = scene.Revision();
+            state.filter.SetSource([rows = std::move(rows), table = scene.NameTable()] {
+                auto source = std::make_shared<FilterSource>();
+                source->Reserve(rows.size(), table->size());
+                for (const Row& row : rows) {
+                    source->Add(row.id, std::string_view(table->data() + row.name.offset, row.name.length));
+                }
+                return std::shared_ptr<const FilterSource>(std::move(source));
+            });
+        }
+
+        // Linear, but only when the result or the selection changed
+        inline int FindRow(const FilterResult& result, Backend::Entity entity) {
+            if (entity == Backend::NullEntity) return -1;
+            const auto id = static_cast<std::uint64_t>(entt::to_integral(entity));
+            for (std::size_t i = 0; i < result.rows.size(); ++i) {
+                if (result.source->ids[result.rows[i]] == id) return static_cast<int>(i);
+            }
+            return -1;
+        }
+
+        // Up/Down walk the filtered rows while the list has focus
+        inline void HandleKeys(OutlinerState& state, Backend::Scene& scene) {
+            const FilterResult& result = *state.result;
+            if (result.rows.empty() || ImGui::IsAnyItemActive() ||
+                !ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows)) {
+                return;
+            }
+            int row = state.selected_row;
+            if (ImGui::IsKeyPressed(ImGuiKey_DownArrow)) row = row < 0 ? 0 : row + 1;
+            else if (ImGui::IsKeyPressed(ImGuiKey_UpArrow)) row = row < 0 ? 0 : row - 1;
+            else return;
+            row = std::clamp(row, 0, static_cast<int>(result.rows.size()) - 1);
+            scene.SetSelected(RowEntity(result, row));
+            state.scroll_to_selection = true;
+        }
+
+    } // namespace OutlinerDetail
+
+    // Every entity in the scene, searchable by name. Only visible rows are
+    // submitted and the search runs on the filter's thread, so the panel
+    // costs the same at 100 or 500k entities. The selection is the scene's
+    // and survives any filter; one hidden by the filter is still reported
+    inline void RenderOutliner(Backend::Scene& scene) {
+        OutlinerState& state = g_OutlinerState;
+        ImGui::Begin("Outliner " ICON_FA_LIST);
+
+        if (scene.Revision() != state.scene_revision) {
+            OutlinerDetail::RebuildSource(state, scene);
+        }
+
+        ImGui::SetNextItemWidth(-1.0f);
+        if (ImGui::InputTextWithHint("##Search", "Search names", state.query, sizeof(state.query))) {
+            state.filter.SetQuery(state.query);
+        }
+
+        // Adopt finished results; remap the selection whenever rows or selection move
+        std::shared_ptr<const FilterResult> latest = state.filter.Result();
+        const Backend::Entity selected = scene.GetSelected();
+        if (latest && (latest != state.result || selected != state.selection)) {
+            const bool new_rows = latest != state.result;
+            state.result = std::move(latest);
+            state.selection = selected;
+            state.selected_row = OutlinerDetail::FindRow(*state.result, selected);
+            state.scroll_to_selection |= new_rows && state.selected_row >= 0;
+        }
+        if (!state.result) {
+            ImGui::TextDisabled("Indexing %zu entities...", state.entities);
+            ImGui::End();
+            return;
+        }
+
+        const FilterResult& result = *state.result;
+        ImGui::TextDisabled("%zu / %zu entities (%.1f ms%s)%s", result.rows.size(), result.source->Size(),
+                            result.filter_ms, result.incremental ? ", narrowed" : "",
+                            state.filter.Busy() ? "  searching..." : "");
+        if (selected != Backend::NullEntity && state.selected_row < 0) {
+            const std::string_view name = scene.GetName(selected);
+            ImGui::TextDisabled("Selected (hidden by search): %.*s", static_cast<int>(name.size()), name.data());
+        }
+
+        OutlinerDetail::HandleKeys(state, scene);
+
+        const ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV |
+                                      ImGuiTableFlags_Resizable;
+        if (ImGui::BeginTable("Entities", 2, flags, ImGui::GetContentRegionAvail())) {
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Mesh", ImGuiTableColumnFlags_WidthFixed, ImGui::GetFontSize() * 4.0f);
+            ImGui::TableHeadersRow();
+
+            const float row_height = TableRowHeight();
+            if (state.scroll_to_selection && state.selected_row >= 0) {
+                ScrollToRow(state.selected_row, row_height);
+            }
+            state.scroll_to_selection = false;
+
+            VirtualRows(static_cast<int>(result.rows.size()), row_height, [&](int row) {
+                const Backend::Entity entity = OutlinerDetail::RowEntity(result, row);
+                ImGui::TableNextRow(ImGuiTableRowFlags_None, row_height);
+                ImGui::TableNextColumn();
+                if (!scene.IsValid(entity)) {
+                    ImGui::TextDisabled("(removed)");   // Until the next index rebuild lands
+                    return;
+                }
+
+                ImGui::PushID(row);
+                if (ImGui::Selectable("##Row", row == state.selected_row,
+                                      ImGuiSelectableFlags_SpanAllColumns | ImGuiSelectableFlags_AllowOverlap)) {
+                    scene.SetSelected(entity);
+                }
+                ImGui::PopID();
+                ImGui::SameLine();
+                const std::string_view name = scene.GetName(entity);
+                if (name.empty()) ImGui::TextDisabled("(unnamed)");
+                else ImGui::TextUnformatted(name.data(), name.data() + name.size());
+
+                ImGui::TableNextColumn();
+                const Backend::MeshHandle mesh = scene.GetMesh(entity);
+                if (mesh.IsValid()) ImGui::Text("%u", mesh.id);
+                else ImGui::TextDisabled("-");
+            });
+            ImGui::EndTable();
+        }
+
+        ImGui::End();
+    }
+
+} // namespace UILab
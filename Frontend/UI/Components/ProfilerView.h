@@ -0,0 +1,206 @@
+#pragma once
+#include "imgui.h"
+#include "Profiling/Profiler.h"
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace UILab {
+
+    struct ProfilerViewState {
+        int framesAgo = 0;
+        float zoom = 1.0f;
+        int exportFrames = 120;
+        char exportPath[128] = "profile_trace.json";
+        const char* exportStatus = nullptr;
+
+        // Thread names change rarely; refreshed when the thread count changes
+        std::vector<Backend::Profiling::ThreadInfo> threads;
+    };
+
+    inline ProfilerViewState g_ProfilerViewState;
+
+    namespace ProfilerViewDetail {
+
+        inline ImU32 ZoneColor(const char* name) {
+            // Stable colour per zone name (names are literals, the pointer is stable)
+            std::uintptr_t h = reinterpret_cast<std::uintptr_t>(name);
+            h ^= h >> 17; h *= 0xed5ad4bbu; h ^= h >> 11;
+            const float hue = static_cast<float>(h % 360) / 360.0f;
+            float r, g, b;
+            ImGui::ColorConvertHSVtoRGB(hue, 0.55f, 0.85f, r, g, b);
+            return ImGui::GetColorU32(ImVec4(r, g, b, 1.0f));
+        }
+
+        struct ZoneTotal {
+            const char* name;
+            double total_us;
+            int calls;
+        };
+
+    } // namespace ProfilerViewDetail
+
+    inline void RenderProfilerTimeline() {
+        namespace P = Backend::Profiling;
+        ProfilerViewState& state = g_ProfilerViewState;
+
+        bool paused = P::IsPaused();
+        if (ImGui::Checkbox("Pause", &paused)) {
+            P::SetPaused(paused);
+        }
+        ImGui::SameLine();
+        const int history = static_cast<int>(P::HistorySize());
+        ImGui::SetNextItemWidth(160.0f);
+        ImGui::SliderInt("Frames ago", &state.framesAgo, 0, history > 0 ? history - 1 : 0);
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(100.0f);
+        ImGui::SliderFloat("Zoom", &state.zoom, 1.0f, 32.0f, "%.1fx", ImGuiSliderFlags_Logarithmic);
+
+        // Frame-time strip over the captured history (oldest on the left)
+        float frame_ms[240];
+        int frame_count = 0;
+        for (int i = history - 1; i >= 0 && frame_count < 240; --i) {
+            const P::FrameCapture* f = P::GetFrame(static_cast<std::size_t>(i));
+            frame_ms[frame_count++] = static_cast<float>(P::TicksToMicroseconds(f->end - f->start) / 1000.0);
+        }
+        if (frame_count > 0) {
+            ImGui::PlotHistogram("##FrameTimes", frame_ms, frame_count, 0, "frame ms", 0.0f, 33.3f,
+                                 ImVec2(ImGui::GetContentRegionAvail().x, 40.0f));
+        }
+
+        const P::FrameCapture* frame = P::GetFrame(static_cast<std::size_t>(state.framesAgo));
+        if (!frame) {
+            ImGui::TextDisabled("No frames captured yet");
+            return;
+        }
+
+        const P::ProfilerStats stats = P::GetStats();
+        if (state.threads.size() != stats.thread_count) {
+            state.threads = P::GetThreads();
+        }
+
+        const double frame_us = P::TicksToMicroseconds(frame->end - frame->start);
+        ImGui::Text("Frame %llu: %.3f ms, %zu zones, %zu threads",
+                    static_cast<unsigned long long>(frame->index), frame_us / 1000.0,
+                    frame->zones.size(), state.threads.size());
+        if (stats.dropped_events > 0) {
+            ImGui::SameLine();
+            ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "(%llu events dropped)",
+                               static_cast<unsigned long long>(stats.dropped_events));
+        }
+
+        // --- Timeline: one lane per thread, one row per nesting depth ---
+        const float row_h = ImGui::GetTextLineHeight() + 4.0f;
+        const float label_w = 110.0f;
+
+        std::uint32_t max_depth[64] = {};
+        bool has_zones[64] = {};
+        for (const P::ZoneRecord& z : frame->zones) {
+            if (z.thread_id >= 64) continue;
+            has_zones[z.thread_id] = true;
+            if (z.depth + 1 > max_depth[z.thread_id]) max_depth[z.thread_id] = z.depth + 1;
+        }
+        float lane_y[64] = {};
+        float total_h = 0.0f;
+        for (std::size_t t = 0; t < 64; ++t) {
+            lane_y[t] = total_h;
+            if (has_zones[t]) total_h += row_h * static_cast<float>(max_depth[t]) + 4.0f;
+        }
+
+        ImGui::BeginChild("##Timeline", ImVec2(0.0f, total_h + ImGui::GetStyle().ScrollbarSize + 8.0f),
+                          ImGuiChildFlags_Border, ImGuiWindowFlags_HorizontalScrollbar);
+        {
+            const float avail_w = ImGui::GetContentRegionAvail().x - label_w;
+            const float track_w = (avail_w > 50.0f ? avail_w : 50.0f) * state.zoom;
+            const ImVec2 origin = ImGui::GetCursorScreenPos();
+            ImDrawList* dl = ImGui::GetWindowDrawList();
+            const double us_to_px = frame_us > 0.0 ? track_w / frame_us : 0.0;
+
+            for (std::size_t t = 0; t < 64; ++t) {
+                if (!has_zones[t]) continue;
+                const char* label = t < state.threads.size() ? state.threads[t].name.c_str() : "?";
+                dl->AddText(ImVec2(origin.x + ImGui::GetScrollX(), origin.y + lane_y[t] + 2.0f),
+                            ImGui::GetColorU32(ImGuiCol_TextDisabled), label);
+            }
+
+            const ImVec2 mouse = ImGui::GetIO().MousePos;
+            const P::ZoneRecord* hovered = nullptr;
+            for (const P::ZoneRecord& z : frame->zones) {
+                if (z.thread_id >= 64) continue;
+                const double start_us = z.start > frame->start ? P::TicksToMicroseconds(z.start - frame->start) : 0.0;
+                const double dur_us = P::TicksToMicroseconds(z.end - z.start);
+                const float x0 = origin.x + label_w + static_cast<float>(start_us * us_to_px);
+                float x1 = x0 + static_cast<float>(dur_us * us_to_px);
+                if (x1 - x0 < 1.0f) x1 = x0 + 1.0f;
+                const float y0 = origin.y + lane_y[z.thread_id] + row_h * static_cast<float>(z.depth);
+                const float y1 = y0 + row_h - 1.0f;
+
+                dl->AddRectFilled(ImVec2(x0, y0), ImVec2(x1, y1), ProfilerViewDetail::ZoneColor(z.name));
+                const ImVec2 text_size = ImGui::CalcTextSize(z.name);
+                if (x1 - x0 > text_size.x + 4.0f) {
+                    dl->AddText(ImVec2(x0 + 2.0f, y0 + 2.0f), IM_COL32(20, 20, 20, 255), z.name);
+                }
+                if (mouse.x >= x0 && mouse.x < x1 && mouse.y >= y0 && mouse.y < y1) {
+                    hovered = &z;
+                }
+            }
+
+            ImGui::Dummy(ImVec2(label_w + track_w, total_h));
+            if (hovered && ImGui::IsWindowHovered()) {
+                ImGui::BeginTooltip();
+                ImGui::Text("%s", hovered->name);
+                ImGui::Text("%.3f ms", P::TicksToMicroseconds(hovered->end - hovered->start) / 1000.0);
+                ImGui::EndTooltip();
+            }
+        }
+        ImGui::EndChild();
+
+        // --- Per-zone totals for the selected frame ---
+        if (ImGui::TreeNode("Zone totals")) {
+            ProfilerViewDetail::ZoneTotal totals[64];
+            int total_count = 0;
+            for (const P::ZoneRecord& z : frame->zones) {
+                int i = 0;
+                while (i < total_count && totals[i].name != z.name) ++i;
+                if (i == total_count) {
+                    if (total_count == 64) continue;
+                    totals[total_count++] = { z.name, 0.0, 0 };
+                }
+                totals[i].total_us += P::TicksToMicroseconds(z.end - z.start);
+                totals[i].calls += 1;
+            }
+
+            if (ImGui::BeginTable("##ZoneTotals", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+                ImGui::TableSetupColumn("Zone");
+                ImGui::TableSetupColumn("Total ms");
+                ImGui::TableSetupColumn("Calls");
+                ImGui::TableHeadersRow();
+                for (int i = 0; i < total_count; ++i) {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn(); ImGui::TextUnformatted(totals[i].name);
+                    ImGui::TableNextColumn(); ImGui::Text("%.3f", totals[i].total_us / 1000.0);
+                    ImGui::TableNextColumn(); ImGui::Text("%d", totals[i].calls);
+                }
+                ImGui::EndTable();
+            }
+            ImGui::TreePop();
+        }
+
+        // --- Chrome trace export ---
+        ImGui::SetNextItemWidth(200.0f);
+        ImGui::InputText("##TracePath", state.exportPath, sizeof(state.exportPath));
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(80.0f);
+        ImGui::InputInt("frames", &state.exportFrames);
+        ImGui::SameLine();
+        if (ImGui::Button("Export Trace")) {
+            const bool ok = P::ExportChromeTrace(state.exportPath, static_cast<std::size_t>(state.exportFrames > 0 ? state.exportFrames : 1));
+            state.exportStatus = ok ? "Trace written" : "Export failed";
+        }
+        if (state.exportStatus) {
+            ImGui::SameLine();
+            ImGui::TextDisabled("%s", state.exportStatus);
+        }
+    }
+
+} // namespace UILab
@@ -0,0 +1,106 @@
+#pragma once
+#include "imgui.h"
+#include "../Core/IconsFontAwesome6.h"
+#include "../Core/VirtualList.h"
+#include "Outliner.h"
+#include "Scene/Scene.h"
+#include <cfloat>
+#include <string_view>
+
+namespace UILab {
+
+    struct PropertyTableState {
+        Backend::Entity followed = Backend::NullEntity;     // Selection last scrolled to
+    };
+
+    inline PropertyTableState g_PropertyTableState;
+
+    namespace PropertyTableDetail {
+
+        // One drag per component, spanning the cell
+        inline bool DragCell(const char* id, float* values, float speed) {
+            ImGui::SetNextItemWidth(-FLT_MIN);
+            return ImGui::DragFloat3(id, values, speed, 0.0f, 0.0f, "%.2f");
+        }
+
+    } // namespace PropertyTableDetail
+
+    // Transforms of the Outliner's filtered rows, editable in place. Widgets
+    // exist only for the visible rows, so it scales like the Outliner; edits
+    // go straight into the scene and mark the entity for the next save
+    inline void RenderPropertyTable(Backend::Scene& scene) {
+        const OutlinerState& outliner = g_OutlinerState;
+        PropertyTableState& state = g_PropertyTableState;
+        ImGui::Begin("Properties " ICON_FA_TABLE);
+
+        if (!outliner.result) {
+            ImGui::TextDisabled("Indexing %zu entities...", outliner.entities);
+            ImGui::End();
+            return;
+        }
+
+        const FilterResult& result = *outliner.result;
+        const ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV |
+                                      ImGuiTableFlags_Resizable;
+        if (ImGui::BeginTable("Properties", 5, flags, ImGui::GetContentRegionAvail())) {
+            const float drag_width = ImGui::GetFontSize() * 14.0f;
+            ImGui::TableSetupScrollFreeze(1, 1);
+            ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Position", ImGuiTableColumnFlags_WidthFixed, drag_width);
+            ImGui::TableSetupColumn("Rotation", ImGuiTableColumnFlags_WidthFixed, drag_width);
+            ImGui::TableSetupColumn("Scale", ImGuiTableColumnFlags_WidthFixed, drag_width);
+            ImGui::TableSetupColumn("Mesh", ImGuiTableColumnFlags_WidthFixed, ImGui::GetFontSize() * 4.0f);
+            ImGui::TableHeadersRow();
+
+            // Follow selection changes made elsewhere, like the Outliner does
+            const float row_height = FrameRowHeight();
+            const Backend::Entity selected = scene.GetSelected();
+            if (selected != state.followed) {
+                state.followed = selected;
+                if (outliner.selected_row >= 0) ScrollToRow(outliner.selected_row, row_height);
+            }
+
+            VirtualRows(static_cast<int>(result.rows.size()), row_height, [&](int row) {
+                const Backend::Entity entity = OutlinerDetail::RowEntity(result, row);
+                ImGui::TableNextRow(ImGuiTableRowFlags_None, row_height);
+                ImGui::TableNextColumn();
+                if (!scene.IsValid(entity)) {
+                    ImGui::TextDisabled("(removed)");   // Until the next index rebuild lands
+                    return;
+                }
+
+                ImGui::PushID(row);
+                ImGui::AlignTextToFramePadding();
+                if (ImGui::Selectable("##Row", entity == selected, ImGuiSelectableFlags_AllowOverlap)) {
+                    scene.SetSelected(entity);
+                    state.followed = entity;
+                }
+                ImGui::SameLine();
+                const std::string_view name = scene.GetName(entity);
+                if (name.empty()) ImGui::TextDisabled("(unnamed)");
+                else ImGui::TextUnformatted(name.data(), name.data() + name.size());
+
+                Backend::Transform& transform = scene.GetTransform(entity);
+                ImGui::TableNextColumn();
+                bool moved = PropertyTableDetail::DragCell("##Position", &transform.position.x, 0.1f);
+                ImGui::TableNextColumn();
+                moved |= PropertyTableDetail::DragCell("##Rotation", &transform.rotation.x, 1.0f);
+                ImGui::TableNextColumn();
+                moved |= PropertyTableDetail::DragCell("##Scale", &transform.scale.x, 0.01f);
+                if (moved) {
+                    scene.MarkDirty(entity, Backend::kDirtyTransform);
+                }
+
+                ImGui::TableNextColumn();
+                const Backend::MeshHandle mesh = scene.GetMesh(entity);
+                if (mesh.IsValid()) ImGui::Text("%u", mesh.id);
+                else ImGui::TextDisabled("-");
+                ImGui::PopID();
+            });
+            ImGui::EndTable();
+        }
+
+        ImGui::End();
+    }
+
+} // namespace UILab
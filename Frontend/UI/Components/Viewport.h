@@ -0,0 +1,228 @@
+#pragma once
+#include "imgui.h"
+#include "../Core/IconsFontAwesome6.h"
+#include "Scene/Scene.h"
+#include "Render/Renderer.h"
+#include "Render/FramePipeline.h"
+#include "Geometry/LodLibrary.h"
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+namespace UILab {
+
+    // What the renderer currently holds for a library mesh
+    struct ViewportMesh {
+        std::shared_ptr<const Backend::Geometry::MeshSoA> source;
+        std::shared_ptr<const Backend::Geometry::LodLibrary::LodChain> lods;
+        std::size_t level = 0;
+    };
+
+    struct ViewportState {
+        // Orbit camera around `target`; angles in radians
+        glm::vec3 target = glm::vec3(0.0f);
+        float yaw = 0.6f;
+        float pitch = 0.45f;
+        float distance = 30.0f;
+
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+        std::size_t entity_count = 0;
+        bool submitted = false;
+
+        // Latest read-back frame, mirrored into a GL texture for ImGui::Image
+        Backend::Render::ViewportImage image;
+        unsigned int texture = 0;
+        std::uint32_t texture_width = 0;
+        std::uint32_t texture_height = 0;
+
+        // LOD selection: allowed screen-space error in pixels, raised while
+        // frames are slow and lowered again once they are cheap
+        float lod_pixels = 1.0f;
+        std::uint64_t library_generation = ~0ull;
+        std::unordered_map<std::uint32_t, ViewportMesh> meshes;
+    };
+
+    inline ViewportState g_ViewportState;
+
+    namespace ViewportDetail {
+
+        inline Backend::Render::Camera OrbitCamera(const ViewportState& state) {
+            Backend::Render::Camera camera;
+            const float c = std::cos(state.pitch);
+            camera.eye = state.target + state.distance * glm::vec3(c * std::sin(state.yaw), std::sin(state.pitch),
+                                                                   c * std::cos(state.yaw));
+            camera.target = state.target;
+            camera.far_plane = std::max(1000.0f, state.distance * 4.0f);
+            return camera;
+        }
+
+        inline void UploadImage(ViewportState& state) {
+            if (state.texture == 0) {
+                glGenTextures(1, &state.texture);
+                glBindTexture(GL_TEXTURE_2D, state.texture);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            }
+            glBindTexture(GL_TEXTURE_2D, state.texture);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+            const auto w = static_cast<int>(state.image.width);
+            const auto h = static_cast<int>(state.image.height);
+            if (state.image.width != state.texture_width || state.image.height != state.texture_height) {
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, state.image.rgba.data());
+                state.texture_width = state.image.width;
+                state.texture_height = state.image.height;
+            } else {
+                glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, w, h, GL_RGBA, GL_UNSIGNED_BYTE, state.image.rgba.data());
+            }
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }
+
+        // Uploads the level of every library mesh that fits the pixel budget at
+        // the orbit distance; only meshes whose level or chain changed are re-sent
+        inline void SyncMeshes(ViewportState& state, Backend::Geometry::LodLibrary& library,
+                               Backend::Render::Renderer& renderer, const Backend::Render::RendererStats& stats) {
+            namespace Geo = Backend::Geometry;
+            const float frame_ms = stats.submit_ms + stats.frame_ms;
+            if (frame_ms > 16.0f) state.lod_pixels = std::min(state.lod_pixels * 2.0f, 16.0f);
+            else if (frame_ms < 4.0f) state.lod_pixels = std::max(state.lod_pixels * 0.5f, 1.0f);
+
+            const float max_error = Geo::ErrorForPixels(state.lod_pixels, state.distance,
+                                                        glm::radians(OrbitCamera(state).fov_y),
+                                                        static_cast<float>(std::max(state.height, 1u)));
+            const std::uint64_t generation = library.Generation();
+            if (generation != state.library_generation) {
+                std::erase_if(state.meshes, [&](const auto& entry) {
+                    if (library.Contains(entry.first)) return false;
+                    renderer.DropMesh(entry.first);
+                    return true;
+                });
+                state.library_generation = generation;
+            }
+
+            for (const std::uint32_t id : library.Ids()) {
+                ViewportMesh& uploaded = state.meshes[id];
+                std::shared_ptr<const Geo::MeshSoA> source = library.GetMesh(id);
+                std::shared_ptr<const Geo::LodLibrary::LodChain> lods = library.GetLods(id);
+                const std::size_t level = lods ? Geo::SelectLod(*lods, max_error) : 0;
+                if (uploaded.source == source && uploaded.lods == lods && uploaded.level == level) continue;
+
+                renderer.UploadMesh(id, level > 0 ? (*lods)[level].mesh.View() : source->View());
+                uploaded.source = std::move(source);
+                uploaded.lods = std::move(lods);
+                uploaded.level = level;
+            }
+        }
+
+    } // namespace ViewportDetail
+
+    // Scene view through the bgfx Renderer. The scene is only resubmitted on
+    // frames with input, resizes or entity count changes: the read-back that
+    // follows a submission requests one more redraw, which must not submit again.
+    // Submission goes through the frame pipeline, so the draw list is built on
+    // the workers while this thread presents the frame and builds the next one
+    inline void RenderViewport(Backend::Scene& scene, Backend::Render::Renderer& renderer,
+                               Backend::Geometry::LodLibrary& library, Backend::Render::FramePipeline& pipeline) {
+        ViewportState& state = g_ViewportState;
+        ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0.0f, 0.0f));
+        ImGui::Begin("Viewport " ICON_FA_CUBE);
+        ImGui::PopStyleVar();
+
+        if (!renderer.IsRunning()) {
+            ImGui::TextDisabled("Renderer not running");
+            ImGui::End();
+            return;
+        }
+
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        const ImVec2 avail = ImGui::GetContentRegionAvail();
+        const auto width = static_cast<std::uint32_t>(std::max(avail.x, 1.0f));
+        const auto height = static_cast<std::uint32_t>(std::max(avail.y, 1.0f));
+        bool changed = !state.submitted || state.entity_count != scene.EntityCount() ||
+                       state.library_generation != library.Generation();
+        if (width != state.width || height != state.height) {
+            renderer.Resize(width, height);
+            state.width = width;
+            state.height = height;
+            changed = true;
+        }
+
+        if (renderer.CopyLatestImage(state.image)) {
+            ViewportDetail::UploadImage(state);
+        }
+        if (state.texture != 0) {
+            const bool flip = state.image.origin_bottom_left;
+            ImGui::Image((ImTextureID)(std::intptr_t)state.texture, avail,
+                         ImVec2(0.0f, flip ? 1.0f : 0.0f), ImVec2(1.0f, flip ? 0.0f : 1.0f));
+        } else {
+            ImGui::Dummy(avail);
+        }
+
+        // Left drag orbits, middle drag pans, wheel zooms
+        const ImGuiIO& io = ImGui::GetIO();
+        if (ImGui::IsItemHovered()) {
+            if (ImGui::IsMouseDragging(ImGuiMouseButton_Left)) {
+                state.yaw -= io.MouseDelta.x * 0.01f;
+                state.pitch = std::clamp(state.pitch + io.MouseDelta.y * 0.01f, -1.5f, 1.5f);
+            }
+            if (ImGui::IsMouseDragging(ImGuiMouseButton_Middle)) {
+                const Backend::Render::Camera camera = ViewportDetail::OrbitCamera(state);
+                const glm::vec3 forward = glm::normalize(camera.target - camera.eye);
+                const glm::vec3 right = glm::normalize(glm::cross(forward, camera.up));
+                const glm::vec3 up = glm::cross(right, forward);
+                const float scale = state.distance * 0.002f;
+                state.target += (-io.MouseDelta.x * right + io.MouseDelta.y * up) * scale;
+            }
+            if (io.MouseWheel != 0.0f) {
+                state.distance = std::clamp(state.distance * std::pow(0.9f, io.MouseWheel), 0.5f, 5000.0f);
+            }
+        }
+
+        // Edits elsewhere in the UI always come with input (an active widget,
+        // a click or mouse movement)
+        changed |= ImGui::IsAnyItemActive() || ImGui::IsAnyMouseDown() || io.MouseWheel != 0.0f ||
+                   io.MouseDelta.x != 0.0f || io.MouseDelta.y != 0.0f ||
+                   ImGui::IsMouseReleased(ImGuiMouseButton_Left);
+        if (changed) {
+            ViewportDetail::SyncMeshes(state, library, renderer, renderer.GetStats());
+            pipeline.Submit(scene, ViewportDetail::OrbitCamera(state));
+            state.entity_count = scene.EntityCount();
+            state.submitted = true;
+        }
+
+        // Overlay
+        const Backend::Render::RendererStats stats = renderer.GetStats();
+        ImGui::SetCursorScreenPos(ImVec2(origin.x + 8.0f, origin.y + 8.0f));
+        ImGui::BeginGroup();
+        ImGui::Text("%s  %u items  %u batches  %u draws", renderer.BackendName(), stats.draw_items, stats.batches,
+                    stats.draw_calls);
+        ImGui::Text("sort %.2f  submit %.2f  frame %.2f ms", stats.sort_ms, stats.submit_ms, stats.frame_ms);
+        const Backend::Render::FramePipelineStats frames = pipeline.GetStats();
+        ImGui::Text("capture %.2f  wait %.2f  update %.2f ms", frames.capture_ms, frames.wait_ms, frames.update_ms);
+        ImGui::TextUnformatted("Frames in flight");
+        for (int n = 1; n <= static_cast<int>(Backend::Render::FramePipeline::kMaxFramesInFlight); ++n) {
+            ImGui::SameLine();
+            ImGui::PushID(n);
+            if (ImGui::RadioButton(n == 1 ? "1 (latency)" : "2 (throughput)", frames.frames_in_flight == static_cast<std::uint32_t>(n))) {
+                pipeline.SetFramesInFlight(static_cast<std::uint32_t>(n));
+            }
+            ImGui::PopID();
+        }
+        if (!state.meshes.empty()) {
+            ImGui::Text("LOD budget %.0f px (%zu meshes)", state.lod_pixels, state.meshes.size());
+        }
+        if (stats.skipped_items > 0) {
+            ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "Skipped: %u", stats.skipped_items);
+        }
+        if (state.texture == 0) {
+            ImGui::TextDisabled("No image: %s", renderer.Error().empty() ? "submission only" : renderer.Error().c_str());
+        }
+        ImGui::EndGroup();
+
+        ImGui::End();
+    }
+
+} // namespace UILab
@@ -0,0 +1,213 @@
+#pragma once
+
+// Text search for the virtualized lists (VirtualList.h), off the UI thread.
+//
+// AsyncFilter searches an immutable FilterSource on its own thread: the UI
+// thread only posts the query and picks up finished results, and a query
+// that extends the previous one only rescans the previous matches. The
+// source itself can be built on that thread too, from data the UI thread
+// snapshotted, so indexing a large scene never stalls a frame. Rows are
+// identified by stable 64-bit ids, so selections survive filter changes.
+
+#include "Engine.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace UILab {
+
+    // Rows to search: one id and one lowercased key per row, packed
+    struct FilterSource {
+        std::vector<std::uint64_t> ids;
+        std::vector<char> keys;
+        std::vector<std::uint32_t> offsets{ 0 };    // Row i: keys[offsets[i], offsets[i + 1])
+
+        std::size_t Size() const { return ids.size(); }
+
+        void Reserve(std::size_t rows, std::size_t key_bytes) {
+            ids.reserve(rows);
+            offsets.reserve(rows + 1);
+            keys.reserve(key_bytes);
+        }
+
+        void Add(std::uint64_t id, std::string_view key) {
+            ids.push_back(id);
+            for (const char c : key) keys.push_back(Lower(c));
+            offsets.push_back(static_cast<std::uint32_t>(keys.size()));
+        }
+
+        std::string_view Key(std::size_t row) const {
+            return std::string_view(keys.data() + offsets[row], offsets[row + 1] - offsets[row]);
+        }
+
+        static char Lower(char c) { return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c; }
+    };
+
+    struct FilterResult {
+        std::shared_ptr<const FilterSource> source;     // Rows index into this source
+        std::string query;                              // Lowercased
+        std::vector<std::uint32_t> rows;                // Matching rows, in source order
+        bool incremental = false;                       // Narrowed the previous result
+        float filter_ms = 0.0f;
+    };
+
+    // Case-insensitive substring search on a background thread. Set* calls
+    // are cheap and never wait for a scan: a newer request cancels a running
+    // one within a few thousand rows.
+    class AsyncFilter {
+    public:
+        // Runs on the filter thread, so it may only read what it captured
+        using SourceBuilder = std::function<std::shared_ptr<const FilterSource>()>;
+
+        AsyncFilter() = default;
+        ~AsyncFilter() {
+            if (!m_thread.joinable()) return;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+                m_requested.fetch_add(1, std::memory_order_acq_rel);   // Cancels a running scan
+            }
+            m_wake.notify_one();
+            m_thread.join();
+        }
+
+        AsyncFilter(const AsyncFilter&) = delete;
+        AsyncFilter& operator=(const AsyncFilter&) = delete;
+
+        void SetSource(std::shared_ptr<const FilterSource> source) {
+            SetSource([source = std::move(source)] { return source; });
+        }
+
+        // The build is not cancellable, but a source posted while it runs
+        // replaces its result before any scan uses it
+        void SetSource(SourceBuilder build) {
+            Post([&] { m_build = std::move(build); });
+        }
+
+        void SetQuery(std::string_view query) {
+            std::string lowered(query);
+            for (char& c : lowered) c = FilterSource::Lower(c);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (lowered == m_query) return;
+            }
+            Post([&] { m_query = std::move(lowered); });
+        }
+
+        // Newest finished result, or null before the first
+        std::shared_ptr<const FilterResult> Result() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_result;
+        }
+
+        // A request is queued or being scanned
+        bool Busy() const {
+            return m_done.load(std::memory_order_acquire) != m_requested.load(std::memory_order_acquire);
+        }
+
+    private:
+        static constexpr std::size_t kCancelCheckRows = 16384;
+
+        // The change and the new request number land under the lock the
+        // filter thread waits with, so its wakeup cannot be missed
+        template <typename Change>
+        void Post(Change&& change) {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                change();
+                m_requested.fetch_add(1, std::memory_order_acq_rel);
+            }
+            if (!m_thread.joinable()) {
+                m_thread = std::thread([this] { Loop(); });
+            }
+            m_wake.notify_one();
+        }
+
+        void Loop() {
+            std::uint64_t done = 0;
+            for (;;) {
+                SourceBuilder build;
+                std::shared_ptr<const FilterSource> source;
+                std::shared_ptr<const FilterResult> previous;
+                std::string query;
+                std::uint64_t request = 0;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_wake.wait(lock, [&] { return m_stop || m_requested.load(std::memory_order_acquire) != done; });
+                    if (m_stop) return;
+                    request = m_requested.load(std::memory_order_acquire);
+                    build = std::move(m_build);
+                    m_build = nullptr;
+                    source = m_source;
+                    previous = m_result;
+                    query = m_query;
+                }
+
+                if (build) {
+                    source = build();
+                    build = nullptr;    // Release whatever it captured before scanning
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (m_build || m_stop) continue;    // Superseded; the newer request is pending
+                    m_source = source;
+                }
+
+                auto result = std::make_shared<FilterResult>();
+                if (source && Scan(*source, previous.get(), query, request, *result)) {
+                    result->source = std::move(source);
+                    result->query = std::move(query);
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_result = std::move(result);
+                }
+                done = request;
+                m_done.store(done, std::memory_order_release);
+                Backend::RequestRedraw();
+            }
+        }
+
+        // False when a newer request arrived mid-scan
+        bool Scan(const FilterSource& source, const FilterResult* previous, const std::string& query,
+                  std::uint64_t request, FilterResult& out) const {
+            const auto start = std::chrono::steady_clock::now();
+            const std::size_t count = source.Size();
+            if (query.empty()) {
+                out.rows.resize(count);
+                std::iota(out.rows.begin(), out.rows.end(), 0u);
+            } else {
+                // Anything matching the longer query matched the shorter one
+                out.incremental = previous && previous->source.get() == &source &&
+                                  query.find(previous->query) != std::string::npos;
+                const std::size_t candidates = out.incremental ? previous->rows.size() : count;
+                for (std::size_t i = 0; i < candidates; ++i) {
+                    if (i % kCancelCheckRows == 0 && m_requested.load(std::memory_order_acquire) != request) return false;
+                    const std::uint32_t row = out.incremental ? previous->rows[i] : static_cast<std::uint32_t>(i);
+                    if (source.Key(row).find(query) != std::string_view::npos) out.rows.push_back(row);
+                }
+            }
+            out.filter_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+            return true;
+        }
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::thread m_thread;
+        bool m_stop = false;
+
+        SourceBuilder m_build;                          // Guarded by m_mutex
+        std::shared_ptr<const FilterSource> m_source;
+        std::string m_query;
+        std::shared_ptr<const FilterResult> m_result;
+
+        std::atomic<std::uint64_t> m_requested{ 0 };    // Bumped under m_mutex, read anywhere
+        std::atomic<std::uint64_t> m_done{ 0 };
+    };
+
+} // namespace UILab
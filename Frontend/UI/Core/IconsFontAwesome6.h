@@ -14,3 +14,8 @@
 #define ICON_FA_MAGNIFYING_GLASS "\xef\x80\x82"
 #define ICON_FA_FLOPPY_DISK "\xef\x83\x87"
 #define ICON_FA_GAMEPAD "\xef\x84\x9b"
+#define ICON_FA_CUBE "\xef\x86\xb2"
+#define ICON_FA_LAYER_GROUP "\xef\x97\xbd"
+#define ICON_FA_LIST "\xef\x80\xba"
+#define ICON_FA_TERMINAL "\xef\x84\xa0"
+#define ICON_FA_TABLE "\xef\x83\x8e"
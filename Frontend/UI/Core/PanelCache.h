@@ -0,0 +1,354 @@
+#pragma once
+
+// Retained draw data for panels whose content rarely changes.
+//
+// A PanelCache records the vertices, indices and draw commands a block of
+// widgets appended to the window's ImDrawList. On later frames, while the
+// caller's content key is unchanged and nobody interacts with the window, it
+// replays them (translated if the window moved) instead of running the
+// widget code, and restores the layout cursor so scrolling and auto-resize
+// still see the full content size.
+//
+//     ImGui::Begin("Inspector");
+//     if (cache.Begin(key)) {
+//         ...widgets...
+//     }
+//     cache.End();
+//     ImGui::End();
+//
+// The key must cover everything the widgets display. Replays never happen
+// while the window is hovered, owns the active item, gets key/text input or
+// a popup is open, since skipped widgets cannot react; a capture taken in
+// one of those states (hover highlights, text cursors) is not replayed
+// either. Blocks that open child windows or draw through callbacks are
+// rebuilt every frame.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace UILab {
+
+    // ============================================================================
+    // CONTENT KEYS
+    // ============================================================================
+
+    // FNV-1a over whatever a panel displays
+    class ContentKey {
+    public:
+        template <typename T>
+        ContentKey& Add(const T& value) {
+            static_assert(std::is_trivially_copyable_v<T>, "Hash the fields, not the object");
+            return AddBytes(&value, sizeof(T));
+        }
+
+        ContentKey& Add(std::string_view text) {
+            Add(text.size());
+            return AddBytes(text.data(), text.size());
+        }
+
+        ContentKey& AddBytes(const void* data, std::size_t size) {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i < size; ++i) {
+                m_hash = (m_hash ^ bytes[i]) * 1099511628211ull;
+            }
+            return *this;
+        }
+
+        std::uint64_t Value() const { return m_hash; }
+
+    private:
+        std::uint64_t m_hash = 14695981039346656037ull;
+    };
+
+    // ============================================================================
+    // PANEL CACHE
+    // ============================================================================
+
+    class PanelCache;
+
+    namespace PanelCacheDetail {
+
+#if IMGUI_VERSION_NUM >= 19200
+        using Texture = ImTextureRef;
+        inline Texture CommandTexture(const ImDrawCmd& cmd) { return cmd.TexRef; }
+        inline void PushTexture(ImDrawList* list, Texture texture) { list->PushTexture(texture); }
+        inline void PopTexture(ImDrawList* list) { list->PopTexture(); }
+#else
+        using Texture = ImTextureID;
+        inline Texture CommandTexture(const ImDrawCmd& cmd) { return cmd.TextureId; }
+        inline void PushTexture(ImDrawList* list, Texture texture) { list->PushTextureID(texture); }
+        inline void PopTexture(ImDrawList* list) { list->PopTextureID(); }
+#endif
+
+        // No IMGUI_DEFINE_MATH_OPERATORS here: other panels include imgui.h first
+        inline ImVec2 Add(ImVec2 a, ImVec2 b) { return ImVec2(a.x + b.x, a.y + b.y); }
+
+        // Every live cache, for the DebugPanel
+        inline std::vector<PanelCache*>& Registry() {
+            static std::vector<PanelCache*> caches;
+            return caches;
+        }
+
+        // Style and atlas state every cached vertex depends on; hashed once per
+        // ImGui frame (the current font is added per block)
+        inline std::uint64_t Environment() {
+            static int s_frame = -1;
+            static std::uint64_t s_hash = 0;
+            if (ImGui::GetFrameCount() != s_frame) {
+                const ImGuiIO& io = ImGui::GetIO();
+                ContentKey key;
+                key.AddBytes(&ImGui::GetStyle(), sizeof(ImGuiStyle));
+                key.Add(io.Fonts->TexUvScale).Add(io.DisplayFramebufferScale);
+                s_hash = key.Value();
+                s_frame = ImGui::GetFrameCount();
+            }
+            return s_hash;
+        }
+
+        // Key presses and text only; mouse events elsewhere do not concern a
+        // window that is not hovered
+        inline bool HasKeyboardInput() {
+            const ImGuiContext& g = *ImGui::GetCurrentContext();
+            for (const ImGuiInputEvent& event : g.InputEventsTrail) {
+                if (event.Type == ImGuiInputEventType_Key || event.Type == ImGuiInputEventType_Text) return true;
+            }
+            return false;
+        }
+
+    } // namespace PanelCacheDetail
+
+    // Replays are global on/off for A/B comparisons
+    inline bool g_PanelCacheEnabled = true;
+
+    struct PanelCacheStats {
+        std::uint64_t hits = 0;
+        std::uint64_t rebuilds = 0;
+        std::uint64_t uncacheable = 0;      // Rebuilds that could not be captured
+        std::uint32_t vertices = 0;         // Held in the cache
+        std::uint32_t indices = 0;
+        const char* last_rebuild = "";      // Why the last frame rebuilt; empty after a hit
+    };
+
+    class PanelCache {
+    public:
+        explicit PanelCache(const char* name) : m_name(name) {
+            PanelCacheDetail::Registry().push_back(this);
+        }
+        ~PanelCache() {
+            std::erase(PanelCacheDetail::Registry(), this);
+        }
+
+        PanelCache(const PanelCache&) = delete;
+        PanelCache& operator=(const PanelCache&) = delete;
+
+        // Inside an ImGui window. Returns true when the caller must submit the
+        // widgets; false when the previous draw data was replayed
+        bool Begin(std::uint64_t key) {
+            ImGuiWindow* window = ImGui::GetCurrentWindow();
+            m_recording = false;
+            if (window->SkipItems) return true;     // Collapsed or clipped: the widgets early out anyway
+
+            ImDrawList* list = window->DrawList;
+            const std::uint64_t environment =
+                ContentKey().Add(PanelCacheDetail::Environment()).Add(ImGui::GetFont()).Add(ImGui::GetFontSize()).Value();
+            const ImVec2 origin = window->DC.CursorPos;
+
+            const char* reason = Miss(window, key, environment);
+            if (!reason) {
+                Replay(window, ImVec2(origin.x - m_origin.x, origin.y - m_origin.y));
+                m_stats.hits += 1;
+                m_stats.last_rebuild = "";
+                return false;
+            }
+
+            m_stats.rebuilds += 1;
+            m_stats.last_rebuild = reason;
+            m_valid = false;
+            m_recording = list->_Splitter._Current == 0;
+            m_key = key;
+            m_environment = environment;
+            m_window_size = window->Size;
+            m_scroll = window->Scroll;
+            m_origin = origin;
+            m_window = window;
+            m_child_windows = window->DC.ChildWindows.Size;
+            m_first_cmd = list->CmdBuffer.Size - 1;
+            m_first_index = list->IdxBuffer.Size;
+            m_clean = !Interacting(window);
+            return true;
+        }
+
+        // Always pairs with Begin
+        void End() {
+            if (!m_recording) return;
+            m_recording = false;
+            ImGuiWindow* window = ImGui::GetCurrentWindow();
+            if (window != m_window || window->DC.ChildWindows.Size != m_child_windows || !Capture(window->DrawList)) {
+                m_stats.uncacheable += 1;
+                m_stats.last_rebuild = "uncacheable";
+                return;
+            }
+
+            m_cursor = window->DC.CursorPos;
+            m_cursor_prev_line = window->DC.CursorPosPrevLine;
+            m_cursor_max = window->DC.CursorMaxPos;
+            m_ideal_max = window->DC.IdealMaxPos;
+            m_prev_line_size = window->DC.PrevLineSize;
+            m_prev_line_baseline = window->DC.PrevLineTextBaseOffset;
+            m_valid = true;
+        }
+
+        void Invalidate() { m_valid = false; }
+
+        const char* Name() const { return m_name; }
+        const PanelCacheStats& Stats() const { return m_stats; }
+
+    private:
+        struct Segment {
+            ImVec4 clip_rect;
+            PanelCacheDetail::Texture texture;
+            std::uint32_t first_vertex = 0;
+            std::uint32_t vertex_count = 0;
+            std::uint32_t first_index = 0;
+            std::uint32_t index_count = 0;
+        };
+
+        static bool Interacting(ImGuiWindow* window) {
+            const ImGuiContext& g = *ImGui::GetCurrentContext();
+            if (ImGui::IsWindowHovered(ImGuiHoveredFlags_ChildWindows | ImGuiHoveredFlags_AllowWhenBlockedByActiveItem)) return true;
+            if (g.ActiveId != 0 && g.ActiveIdWindow && g.ActiveIdWindow->RootWindow == window->RootWindow) return true;
+            if (ImGui::IsPopupOpen("", ImGuiPopupFlags_AnyPopupId | ImGuiPopupFlags_AnyPopupLevel)) return true;
+            return ImGui::IsWindowFocused(ImGuiFocusedFlags_ChildWindows) && PanelCacheDetail::HasKeyboardInput();
+        }
+
+        // Null on a hit, else why the block is rebuilt
+        const char* Miss(ImGuiWindow* window, std::uint64_t key, std::uint64_t environment) const {
+            if (!g_PanelCacheEnabled) return "disabled";
+            if (!m_valid) return "no capture";
+            if (key != m_key) return "content";
+            if (environment != m_environment) return "style";
+            if (window != m_window || window->Size.x != m_window_size.x || window->Size.y != m_window_size.y ||
+                window->Scroll.x != m_scroll.x || window->Scroll.y != m_scroll.y) {
+                return "layout";
+            }
+            if (window->DrawList->_Splitter._Current != 0) return "channels";
+            if (Interacting(window)) return "interaction";
+            if (!m_clean) return "dirty capture";
+            return nullptr;
+        }
+
+        // Copies the commands appended since Begin, rebasing each segment's
+        // indices onto its own vertex range
+        bool Capture(const ImDrawList* list) {
+            m_segments.clear();
+            m_vertices.clear();
+            m_indices.clear();
+            const int end_index = list->IdxBuffer.Size;
+            for (int c = std::max(m_first_cmd, 0); c < list->CmdBuffer.Size; ++c) {
+                const ImDrawCmd& cmd = list->CmdBuffer[c];
+                const int begin = std::max(static_cast<int>(cmd.IdxOffset), m_first_index);
+                const int end = std::min(static_cast<int>(cmd.IdxOffset + cmd.ElemCount), end_index);
+                if (begin >= end) continue;
+                if (cmd.UserCallback != nullptr) return false;
+
+                unsigned int lo = ~0u, hi = 0;
+                for (int i = begin; i < end; ++i) {
+                    lo = std::min<unsigned int>(lo, list->IdxBuffer[i]);
+                    hi = std::max<unsigned int>(hi, list->IdxBuffer[i]);
+                }
+                Segment segment;
+                segment.clip_rect = cmd.ClipRect;
+                segment.texture = PanelCacheDetail::CommandTexture(cmd);
+                segment.first_vertex = static_cast<std::uint32_t>(m_vertices.size());
+                segment.vertex_count = hi - lo + 1;
+                segment.first_index = static_cast<std::uint32_t>(m_indices.size());
+                segment.index_count = static_cast<std::uint32_t>(end - begin);
+
+                const ImDrawVert* vertices = list->VtxBuffer.Data + cmd.VtxOffset + lo;
+                m_vertices.insert(m_vertices.end(), vertices, vertices + segment.vertex_count);
+                for (int i = begin; i < end; ++i) {
+                    m_indices.push_back(static_cast<ImDrawIdx>(list->IdxBuffer[i] - lo));
+                }
+                m_segments.push_back(segment);
+            }
+            m_stats.vertices = static_cast<std::uint32_t>(m_vertices.size());
+            m_stats.indices = static_cast<std::uint32_t>(m_indices.size());
+            return true;
+        }
+
+        void Replay(ImGuiWindow* window, ImVec2 delta) {
+            ImDrawList* list = window->DrawList;
+            for (const Segment& segment : m_segments) {
+                const ImVec4& clip = segment.clip_rect;
+                list->PushClipRect(ImVec2(clip.x + delta.x, clip.y + delta.y), ImVec2(clip.z + delta.x, clip.w + delta.y));
+                PanelCacheDetail::PushTexture(list, segment.texture);
+
+                // PrimReserve starts a new command when 16-bit indices run out
+                list->PrimReserve(static_cast<int>(segment.index_count), static_cast<int>(segment.vertex_count));
+                const ImDrawVert* source = m_vertices.data() + segment.first_vertex;
+                ImDrawVert* vertices = list->_VtxWritePtr;
+                for (std::uint32_t v = 0; v < segment.vertex_count; ++v) {
+                    vertices[v] = source[v];
+                    vertices[v].pos.x += delta.x;
+                    vertices[v].pos.y += delta.y;
+                }
+                const ImDrawIdx* indices = m_indices.data() + segment.first_index;
+                const unsigned int base = list->_VtxCurrentIdx;
+                for (std::uint32_t i = 0; i < segment.index_count; ++i) {
+                    list->_IdxWritePtr[i] = static_cast<ImDrawIdx>(base + indices[i]);
+                }
+                list->_VtxWritePtr += segment.vertex_count;
+                list->_IdxWritePtr += segment.index_count;
+                list->_VtxCurrentIdx += segment.vertex_count;
+
+                PanelCacheDetail::PopTexture(list);
+                list->PopClipRect();
+            }
+
+            // Layout as if the widgets had run
+            using PanelCacheDetail::Add;
+            window->DC.CursorPos = Add(m_cursor, delta);
+            window->DC.CursorPosPrevLine = Add(m_cursor_prev_line, delta);
+            window->DC.CursorMaxPos = ImMax(window->DC.CursorMaxPos, Add(m_cursor_max, delta));
+            window->DC.IdealMaxPos = ImMax(window->DC.IdealMaxPos, Add(m_ideal_max, delta));
+            window->DC.PrevLineSize = m_prev_line_size;
+            window->DC.PrevLineTextBaseOffset = m_prev_line_baseline;
+        }
+
+        const char* m_name;
+        PanelCacheStats m_stats;
+
+        // Capture state
+        bool m_valid = false;
+        bool m_recording = false;
+        bool m_clean = false;
+        std::uint64_t m_key = 0;
+        std::uint64_t m_environment = 0;
+        ImGuiWindow* m_window = nullptr;
+        ImVec2 m_window_size;
+        ImVec2 m_scroll;
+        ImVec2 m_origin;
+        int m_child_windows = 0;
+        int m_first_cmd = 0;
+        int m_first_index = 0;
+
+        // Layout after the block, relative to m_origin via the replay delta
+        ImVec2 m_cursor;
+        ImVec2 m_cursor_prev_line;
+        ImVec2 m_cursor_max;
+        ImVec2 m_ideal_max;
+        ImVec2 m_prev_line_size;
+        float m_prev_line_baseline = 0.0f;
+
+        std::vector<Segment> m_segments;
+        std::vector<ImDrawVert> m_vertices;
+        std::vector<ImDrawIdx> m_indices;
+    };
+
+} // namespace UILab
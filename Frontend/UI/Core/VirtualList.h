@@ -0,0 +1,49 @@
+#pragma once
+
+// Lists and tables that stay cheap at hundreds of thousands of rows.
+//
+// VirtualRows submits only the rows inside the visible part of the current
+// scrolling region (ImGuiListClipper), so frame cost follows the window
+// height, not the row count. Search over the rows runs on AsyncFilter's
+// thread (AsyncFilter.h).
+
+#include "imgui.h"
+#include "AsyncFilter.h"
+#include <algorithm>
+
+namespace UILab {
+
+    // ============================================================================
+    // VIRTUAL ROWS
+    // ============================================================================
+
+    // Row height of a default table row (one text line plus cell padding)
+    inline float TableRowHeight() {
+        return ImGui::GetTextLineHeight() + ImGui::GetStyle().CellPadding.y * 2.0f;
+    }
+
+    // Row height of a table row holding framed widgets (drags, inputs)
+    inline float FrameRowHeight() {
+        return ImGui::GetFrameHeight() + ImGui::GetStyle().CellPadding.y * 2.0f;
+    }
+
+    // fn(row) for the rows of [0, count) inside the visible part of the current
+    // scrolling region (a table with ScrollY, or a child window)
+    template <typename Fn>
+    void VirtualRows(int count, float row_height, Fn&& fn) {
+        ImGuiListClipper clipper;
+        clipper.Begin(count, row_height);
+        while (clipper.Step()) {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                fn(row);
+            }
+        }
+    }
+
+    // Scrolls the current region so `row` sits in the middle; call before VirtualRows
+    inline void ScrollToRow(int row, float row_height) {
+        const float visible = ImGui::GetWindowHeight();
+        ImGui::SetScrollY(std::max(0.0f, row * row_height - (visible - row_height) * 0.5f));
+    }
+
+} // namespace UILab
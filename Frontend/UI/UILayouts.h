@@ -2,13 +2,24 @@
 
 #include "Components/DebugPanel.h"
 #include "Components/Inspector.h"
+#include "Components/LogConsole.h"
+#include "Components/Outliner.h"
+#include "Components/PropertyTable.h"
+#include "Components/Viewport.h"
 
 namespace UILab {
 
     // Main Entry Point
-    inline void Render() {
-        RenderDebugPanel();
-        RenderInspector();
+    inline void Render(Backend::Scene& scene, Backend::IO::SceneJournal& journal,
+                       Backend::Render::Renderer& renderer, Backend::Render::FramePipeline& pipeline,
+                       Backend::Geometry::LodLibrary& library, ModuleHost::Host* modules = nullptr) {
+        GE_PROFILE_ZONE("UILab::Render");
+        RenderDebugPanel(modules);
+        RenderOutliner(scene);
+        RenderPropertyTable(scene);
+        RenderInspector(scene, journal, library, modules);
+        RenderLogConsole();
+        RenderViewport(scene, renderer, library, pipeline);
 
         // Debug windows (conditionally rendered)
         if (g_DebugPanelState.showMetrics) {
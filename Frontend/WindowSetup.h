@@ -4,22 +4,46 @@
 // Purpose: Unified window and ImGui setup for Geometry Engine
 // Features: Docking (Fixed), Viewports, Themes, Error Handling
 
+// Included before GLFW so windows.h sees no APIENTRY redefinition
+#include "FontCache.h"
+
 #include "imgui.h"
+#include "imgui_internal.h"
 #include "imgui_impl_glfw.h"
 #include "imgui_impl_opengl3.h"
 #include <GLFW/glfw3.h>
-#include <iostream>
 #include <functional>
 #include <string>
 #include <filesystem>
 #include <vector>
 #include <memory>
 #include <chrono>
+#include <atomic>
+#include <algorithm>
+#include <cstdio>
 
 // Include your icon definitions
 // Ensure this path matches your file structure relative to WindowSetup.h
 #include "UI/Core/IconsFontAwesome6.h"
 
+// Frame profiler (Backend)
+#include "Profiling/Profiler.h"
+
+// Async logging (Backend); never blocks the frame on stdout
+#include "Logging/Log.h"
+
+// Per-frame arena and allocation counters (Backend)
+#include "Memory/Memory.h"
+
+// Frame pacing history + GL timer queries
+#include "FrameTiming.h"
+
+// Startup phase trace (each Initialize step is one phase)
+#include "Startup.h"
+
+// Single-upload ImGui renderer for the main viewport
+#include "ImGuiRenderer.h"
+
 namespace WindowSetup {
 
     // ============================================================================
@@ -44,6 +68,16 @@ namespace WindowSetup {
         Adaptive = -1  // GLFW: -1 for adaptive vsync
     };
 
+    enum class LoopMode {
+        Continuous,  // Poll and redraw every vsync
+        Idle         // Block in glfwWaitEventsTimeout until input or RequestRedraw()
+    };
+
+    enum class HeadlessContext {
+        OSMesa,  // Software rasterizer, no GPU or display required
+        EGL      // EGL surfaceless (Mesa llvmpipe or a real GPU)
+    };
+
     enum class ThemePreset {
         ClassicDark,
         ClassicLight,
@@ -73,6 +107,22 @@ namespace WindowSetup {
         bool double_buffer = true;
         int samples = 4;  // MSAA samples
         
+        // Main-viewport ImGui rendering through ImGuiRenderer (needs GL 3.3).
+        // Persistent mapping also needs GL 4.4 or GL_ARB_buffer_storage;
+        // without it the renderer orphans its buffers each frame instead.
+        bool stream_renderer = true;
+        bool persistent_mapping = true;
+        
+        // Event loop
+        LoopMode loop_mode = LoopMode::Continuous;
+        double idle_wait_timeout = 0.5;  // Seconds; bounds the wait while text cursor blinks
+        int idle_settle_frames = 2;      // Extra frames after input so ImGui layout settles
+        
+        // Headless: GLFW null platform + offscreen framebuffer (GLFW 3.4+).
+        // Forces windowed mode, no viewports, continuous loop, fixed 60 Hz delta time.
+        bool headless = false;
+        HeadlessContext headless_context = HeadlessContext::OSMesa;
+        
         // ImGui settings
         bool docking_enabled = true;
         bool viewports_enabled = true;
@@ -104,25 +154,26 @@ namespace WindowSetup {
         bool enable_debug_output = true;
     };
 
+    // Filled once per frame by Render(), after the swap. Per-phase times are
+    // CPU wall time; gpu_time_ms lags a few frames behind (timer queries).
     struct PerformanceMetrics {
-        double frame_time_ms = 0.0;
-        double fps = 0.0;
-        double input_latency_ms = 0.0;
-        double render_time_ms = 0.0;
+        double frame_time_ms = 0.0;     // Swap-to-swap interval
+        double fps = 0.0;               // From the rolling average frame time
+        double input_latency_ms = 0.0;  // Event poll -> swap complete (excludes scanout)
+        double events_time_ms = 0.0;
         double update_time_ms = 0.0;
-        size_t draw_calls = 0;
+        double render_time_ms = 0.0;
+        double swap_time_ms = 0.0;
+        double gpu_time_ms = -1.0;      // -1 if timer queries are unavailable
+        size_t draw_calls = 0;          // ImDrawCmd count across all viewports
         size_t vertices = 0;
         size_t indices = 0;
         
+        // Rolling-window percentiles: GetFrameHistory().Stats(), computed on read
+        uint64_t stutter_count = 0;
+        
         void Reset() {
-            frame_time_ms = 0.0;
-            fps = 0.0;
-            input_latency_ms = 0.0;
-            render_time_ms = 0.0;
-            update_time_ms = 0.0;
-            draw_calls = 0;
-            vertices = 0;
-            indices = 0;
+            *this = PerformanceMetrics{};
         }
     };
 
@@ -130,21 +181,14 @@ namespace WindowSetup {
     // UTILITY CLASSES
     // ============================================================================
 
+    // Records a profiler zone (see Profiling/Profiler.h); shows up in the
+    // DebugPanel timeline and trace export. Name must be a string literal.
     class ScopedTimer {
     public:
-        ScopedTimer(const std::string& name) : m_name(name) {
-            m_start = std::chrono::high_resolution_clock::now();
-        }
-        
-        ~ScopedTimer() {
-            auto end = std::chrono::high_resolution_clock::now();
-            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - m_start);
-            std::cout << "[TIMER] " << m_name << ": " << duration.count() << "us" << std::endl;
-        }
+        explicit ScopedTimer(const char* name) : m_zone(name) {}
         
     private:
-        std::string m_name;
-        std::chrono::high_resolution_clock::time_point m_start;
+        Backend::Profiling::Zone m_zone;
     };
 
     // ============================================================================
@@ -160,6 +204,53 @@ namespace WindowSetup {
         static bool s_should_close = false;
         static std::chrono::high_resolution_clock::time_point s_frame_start;
         
+        // Frame pacing
+        static std::chrono::high_resolution_clock::time_point s_events_end;
+        static std::chrono::high_resolution_clock::time_point s_update_start;
+        static std::chrono::high_resolution_clock::time_point s_update_end;
+        static std::chrono::high_resolution_clock::time_point s_last_swap;
+        static bool s_has_last_swap = false;
+        static FrameTiming::FrameHistory s_frame_history;
+        static FrameTiming::GpuTimer s_gpu_timer;
+        static ImGuiRenderer::StreamRenderer s_imgui_renderer;
+        
+        // Headless render target
+        static unsigned int s_offscreen_fbo = 0;
+        static unsigned int s_offscreen_rbo = 0;
+        static int s_offscreen_width = 0;
+        static int s_offscreen_height = 0;
+        
+        // Idle loop: frames still owed, settable from any thread
+        static std::atomic<int> s_redraw_frames{ 0 };
+        static std::atomic<bool> s_wake_enabled{ false };
+        
+        inline void RaiseRedrawFrames(int frames) {
+            int current = s_redraw_frames.load(std::memory_order_relaxed);
+            while (current < frames &&
+                   !s_redraw_frames.compare_exchange_weak(current, frames, std::memory_order_relaxed)) {
+            }
+        }
+        
+        inline double ElapsedMs(std::chrono::high_resolution_clock::time_point from,
+                                std::chrono::high_resolution_clock::time_point to) {
+            return std::chrono::duration<double, std::milli>(to - from).count();
+        }
+        
+        // Counts real draw commands (not draw lists) for every rendered viewport
+        inline void CountDrawData(const ImDrawData* draw_data, PerformanceMetrics& metrics) {
+            if (!draw_data || !draw_data->Valid) return;
+            for (int i = 0; i < draw_data->CmdListsCount; i++) {
+                const ImDrawList* cmd_list = draw_data->CmdLists[i];
+                metrics.vertices += cmd_list->VtxBuffer.Size;
+                metrics.indices += cmd_list->IdxBuffer.Size;
+                for (const ImDrawCmd& cmd : cmd_list->CmdBuffer) {
+                    if (cmd.UserCallback == nullptr && cmd.ElemCount > 0) {
+                        ++metrics.draw_calls;
+                    }
+                }
+            }
+        }
+        
         // Font cache
         static ImFont* s_main_font = nullptr;
         static ImFont* s_bold_font = nullptr;
@@ -168,7 +259,7 @@ namespace WindowSetup {
         
         // Error callback
         static void glfw_error_callback(int error, const char* description) {
-            std::cerr << "[GLFW Error " << error << "]: " << description << std::endl;
+            GE_LOG_ERROR(Window, "GLFW error {}: {}", error, description);
             if (s_config.assert_on_error) {
                 IM_ASSERT(false && "GLFW error occurred");
             }
@@ -186,9 +277,16 @@ namespace WindowSetup {
             if (width > 0 && height > 0) {
                 s_config.width = width;
                 s_config.height = height;
-                std::cout << "[WINDOW] Resized to " << width << "x" << height << std::endl;
+                RaiseRedrawFrames(s_config.idle_settle_frames);
+                GE_LOG_DEBUG(Window, "Resized to {}x{}", width, height);
             }
         }
+        
+        // Window damaged/exposed: contents must be redrawn even without input
+        static void window_refresh_callback(GLFWwindow* window) {
+            (void)window; // Suppress unused parameter warning
+            RaiseRedrawFrames(1);
+        }
     }
 
     // ============================================================================
@@ -202,39 +300,21 @@ namespace WindowSetup {
         
         bool success = true;
         
-        // Helper function to load font with fallback
+        // Helper function to load font with fallback (path probing + mapping: FontCache.h)
         auto load_font_with_fallback = [&](const std::string& path, float size, 
                                           const ImWchar* ranges = nullptr, 
                                           const ImFontConfig* config = nullptr) -> ImFont* {
-            if (std::filesystem::exists(path)) {
-                try {
-                    return io.Fonts->AddFontFromFileTTF(path.c_str(), size, config, ranges);
-                } catch (const std::exception& e) {
-                    std::cerr << "[FONT] Failed to load " << path << ": " << e.what() << std::endl;
-                }
+            const FontCache::MappedFile* file = FontCache::Acquire(path);
+            if (!file) {
+                GE_LOG_WARN(Window, "Font unavailable, using default for: {}", path);
+                return nullptr;
             }
             
-            // Try alternative paths
-            std::vector<std::string> alternative_paths = {
-                "./" + path,
-                "../" + path,
-                "../../" + path,
-                path.substr(path.find_last_of('/') + 1)
-            };
-            
-            for (const auto& alt_path : alternative_paths) {
-                if (std::filesystem::exists(alt_path)) {
-                    std::cout << "[FONT] Found alternative: " << alt_path << std::endl;
-                    try {
-                        return io.Fonts->AddFontFromFileTTF(alt_path.c_str(), size, config, ranges);
-                    } catch (...) {
-                        continue;
-                    }
-                }
-            }
-            
-            std::cerr << "[FONT] Using default for: " << path << std::endl;
-            return nullptr;
+            // The atlas reads straight from the mapping; it is unmapped in Shutdown()
+            ImFontConfig font_config = config ? *config : ImFontConfig();
+            font_config.FontDataOwnedByAtlas = false;
+            return io.Fonts->AddFontFromMemoryTTF(const_cast<void*>(file->Data()), static_cast<int>(file->Size()),
+                                                  size, &font_config, ranges);
         };
         
         // Load main font
@@ -255,7 +335,8 @@ namespace WindowSetup {
             Internal::s_mono_font = load_font_with_fallback(config.fonts.mono_path, config.fonts.size * 0.9f, mono_ranges);
         }
         
-        // Load Font Awesome icons (merged with main font)
+        // Load Font Awesome icons (merged with main font). With ImGui 1.92+ glyphs are
+        // rasterized on first use, so the full icon range costs nothing up front.
         if (config.fonts.load_font_awesome && !config.fonts.font_awesome_path.empty()) {
             static const ImWchar icon_ranges[] = { ICON_MIN_FA, ICON_MAX_FA, 0 };
             ImFontConfig icons_config;
@@ -271,9 +352,9 @@ namespace WindowSetup {
             );
             
             if (Internal::s_icon_font) {
-                std::cout << "[FONT] Font Awesome icons loaded successfully" << std::endl;
+                GE_LOG_DEBUG(Window, "Font Awesome icons loaded");
             } else {
-                std::cerr << "[FONT] Failed to load Font Awesome icons" << std::endl;
+                GE_LOG_WARN(Window, "Failed to load Font Awesome icons");
                 success = false;
             }
         }
@@ -343,28 +424,103 @@ namespace WindowSetup {
         }
     }
 
+    // ============================================================================
+    // OFFSCREEN TARGET (HEADLESS)
+    // ============================================================================
+
+    namespace Internal {
+        inline bool CreateOffscreenTarget(int width, int height) {
+            const GLFunctions::Table& gl = GLFunctions::Load();
+            if (!gl.HasFramebufferObjects()) return false;
+            
+            gl.GenRenderbuffers(1, &s_offscreen_rbo);
+            gl.BindRenderbuffer(GLFunctions::kRenderbuffer, s_offscreen_rbo);
+            gl.RenderbufferStorage(GLFunctions::kRenderbuffer, GLFunctions::kRGBA8, width, height);
+            
+            gl.GenFramebuffers(1, &s_offscreen_fbo);
+            gl.BindFramebuffer(GLFunctions::kFramebuffer, s_offscreen_fbo);
+            gl.FramebufferRenderbuffer(GLFunctions::kFramebuffer, GLFunctions::kColorAttachment0,
+                                       GLFunctions::kRenderbuffer, s_offscreen_rbo);
+            
+            if (gl.CheckFramebufferStatus(GLFunctions::kFramebuffer) != GLFunctions::kFramebufferComplete) {
+                gl.BindFramebuffer(GLFunctions::kFramebuffer, 0);
+                gl.DeleteFramebuffers(1, &s_offscreen_fbo);
+                gl.DeleteRenderbuffers(1, &s_offscreen_rbo);
+                s_offscreen_fbo = 0;
+                s_offscreen_rbo = 0;
+                return false;
+            }
+            
+            s_offscreen_width = width;
+            s_offscreen_height = height;
+            return true;
+        }
+        
+        inline void DestroyOffscreenTarget() {
+            const GLFunctions::Table& gl = GLFunctions::Get();
+            if (s_offscreen_fbo) {
+                gl.BindFramebuffer(GLFunctions::kFramebuffer, 0);
+                gl.DeleteFramebuffers(1, &s_offscreen_fbo);
+                gl.DeleteRenderbuffers(1, &s_offscreen_rbo);
+            }
+            s_offscreen_fbo = 0;
+            s_offscreen_rbo = 0;
+        }
+    }
+
     // ============================================================================
     // CORE WINDOW FUNCTIONS
     // ============================================================================
 
     inline GLFWwindow* Initialize(const WindowConfig& config = WindowConfig()) {
         if (Internal::s_initialized) {
-            std::cerr << "[ERROR] Window already initialized!" << std::endl;
+            GE_LOG_ERROR(Window, "Window already initialized");
             return Internal::s_window;
         }
         
         Internal::s_config = config;
+        WindowMode mode = config.mode;
+        if (config.headless) {
+            mode = WindowMode::Windowed;
+            Internal::s_config.mode = WindowMode::Windowed;
+            Internal::s_config.viewports_enabled = false;  // Platform windows need a real display
+            Internal::s_config.loop_mode = LoopMode::Continuous;
+        }
         
         // Start timer for initialization
         auto init_start = std::chrono::high_resolution_clock::now();
+        Startup::Phase init_phase("window_initialize");
+        Backend::Profiling::SetThreadName("Main");
+        
+        // Map font files while GLFW and the GL context come up; LoadFonts waits on it
+        FontCache::Prefetch({
+            config.fonts.regular_path,
+            config.fonts.bold_path,
+            config.fonts.mono_path,
+            config.fonts.load_font_awesome ? config.fonts.font_awesome_path : std::string()
+        });
         
         // Set error callback
         glfwSetErrorCallback(Internal::glfw_error_callback);
         
-        // Initialize GLFW
-        if (!glfwInit()) {
-            std::cerr << "[FATAL] Failed to initialize GLFW" << std::endl;
+        // Headless runs on GLFW's null platform: no display server, no monitor
+        if (config.headless) {
+#if GLFW_VERSION_MAJOR > 3 || (GLFW_VERSION_MAJOR == 3 && GLFW_VERSION_MINOR >= 4)
+            glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+#else
+            GE_LOG_CRITICAL(Window, "Headless mode requires GLFW 3.4 or newer");
             return nullptr;
+#endif
+        }
+        
+        // Initialize GLFW
+        {
+            Startup::Phase phase("glfw_init");
+            if (!glfwInit()) {
+                phase.Fail();
+                GE_LOG_CRITICAL(Window, "Failed to initialize GLFW");
+                return nullptr;
+            }
         }
         
         // Pre-init callback
@@ -384,15 +540,26 @@ namespace WindowSetup {
         if (config.double_buffer) {
             glfwWindowHint(GLFW_DOUBLEBUFFER, GL_TRUE);
         }
-        if (config.samples > 1) {
+        if (config.samples > 1 && !config.headless) {
             glfwWindowHint(GLFW_SAMPLES, config.samples);
         }
+        if (config.headless) {
+            glfwWindowHint(GLFW_CONTEXT_CREATION_API,
+                config.headless_context == HeadlessContext::EGL ? GLFW_EGL_CONTEXT_API : GLFW_OSMESA_CONTEXT_API);
+            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        }
         
-        // Create window based on mode
+        // Create window based on mode (monitor may be missing on remote/virtual sessions)
         GLFWmonitor* primary_monitor = glfwGetPrimaryMonitor();
-        const GLFWvidmode* video_mode = glfwGetVideoMode(primary_monitor);
+        const GLFWvidmode* video_mode = primary_monitor ? glfwGetVideoMode(primary_monitor) : nullptr;
+        if (!video_mode && mode != WindowMode::Windowed) {
+            GE_LOG_WARN(Window, "No monitor available, falling back to windowed mode");
+            mode = WindowMode::Windowed;
+            Internal::s_config.mode = mode;
+        }
         
-        switch (config.mode) {
+        Startup::Phase create_phase("window_create");
+        switch (mode) {
             case WindowMode::Fullscreen:
                 Internal::s_window = glfwCreateWindow(
                     video_mode->width, video_mode->height,
@@ -415,22 +582,33 @@ namespace WindowSetup {
         }
         
         if (!Internal::s_window) {
-            std::cerr << "[FATAL] Failed to create GLFW window" << std::endl;
+            create_phase.Fail();
+            GE_LOG_CRITICAL(Window, "Failed to create GLFW window");
             glfwTerminate();
             return nullptr;
         }
         
         // Make context current
         glfwMakeContextCurrent(Internal::s_window);
+        create_phase.End();
         
         // Set vsync
-        glfwSwapInterval(static_cast<int>(config.vsync));
+        glfwSwapInterval(config.headless ? 0 : static_cast<int>(config.vsync));
+        
+        // Headless renders into an FBO; OSMesa still has a usable default framebuffer if this fails
+        if (config.headless) {
+            if (!Internal::CreateOffscreenTarget(config.width, config.height)) {
+                GE_LOG_WARN(Window, "Offscreen framebuffer unavailable, using the default framebuffer");
+            }
+        }
         
         // Set callbacks
         glfwSetWindowCloseCallback(Internal::s_window, Internal::window_close_callback);
         glfwSetFramebufferSizeCallback(Internal::s_window, Internal::framebuffer_size_callback);
+        glfwSetWindowRefreshCallback(Internal::s_window, Internal::window_refresh_callback);
         
         // Initialize ImGui
+        Startup::Phase context_phase("imgui_context");
         IMGUI_CHECKVERSION();
         ImGui::CreateContext();
         ImGuiIO& io = ImGui::GetIO();
@@ -439,7 +617,7 @@ namespace WindowSetup {
         if (config.docking_enabled) {
             io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
         }
-        if (config.viewports_enabled) {
+        if (Internal::s_config.viewports_enabled) {
             io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
             ImGui::GetStyle().WindowRounding = 0.0f;
             ImGui::GetStyle().Colors[ImGuiCol_WindowBg].w = 1.0f;
@@ -451,31 +629,64 @@ namespace WindowSetup {
             io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;
         }
         
-        // Load fonts
-        if (!LoadFonts(config)) {
-            std::cerr << "[WARNING] Some fonts failed to load, using defaults" << std::endl;
+        context_phase.End();
+        
+        // Load fonts (waits for the prefetch; glyphs are rasterized on first use)
+        {
+            Startup::Phase phase("fonts");
+            if (!LoadFonts(config)) {
+                phase.Fail();
+                GE_LOG_WARN(Window, "Some fonts failed to load, using defaults");
+            }
         }
         
         // Initialize ImGui platform/renderer backends
+        Startup::Phase backends_phase("imgui_backends");
         if (!ImGui_ImplGlfw_InitForOpenGL(Internal::s_window, true)) {
-            std::cerr << "[FATAL] Failed to initialize ImGui GLFW backend" << std::endl;
+            backends_phase.Fail();
+            GE_LOG_CRITICAL(Window, "Failed to initialize ImGui GLFW backend");
             return nullptr;
         }
         
         if (!ImGui_ImplOpenGL3_Init(config.glsl_version)) {
-            std::cerr << "[FATAL] Failed to initialize ImGui OpenGL3 backend" << std::endl;
+            backends_phase.Fail();
+            GE_LOG_CRITICAL(Window, "Failed to initialize ImGui OpenGL3 backend");
             return nullptr;
         }
         
+        // Falls back to ImGui_ImplOpenGL3_RenderDrawData when unavailable
+        if (config.stream_renderer) {
+            Internal::s_imgui_renderer.Initialize(config.persistent_mapping);
+            if (config.log_initialization) {
+                GE_LOG_INFO(Window, "ImGui renderer: {}",
+                            ImGuiRenderer::PathName(Internal::s_imgui_renderer.GetStats().path));
+            }
+        }
+        backends_phase.End();
+        
         // Apply default theme
+        Startup::Phase theme_phase("theme");
         ApplyTheme(ThemePreset::ClassicDark);
         
+        // GPU timing is optional (GL 3.3 / ARB_timer_query)
+        if (!Internal::s_gpu_timer.Initialize() && config.log_initialization) {
+            GE_LOG_INFO(Window, "GL timer queries unavailable, GPU time disabled");
+        }
+        Internal::s_frame_history.Clear();
+        Internal::s_has_last_swap = false;
+        theme_phase.End();
+        
+        // First frames always draw; later ones are on demand in LoopMode::Idle
+        Internal::s_redraw_frames.store(config.idle_settle_frames + 1, std::memory_order_relaxed);
+        Internal::s_wake_enabled.store(true, std::memory_order_release);
+        
         // Set initialized flag
         Internal::s_initialized = true;
         Internal::s_should_close = false;
         
         // Post-init callback
         if (config.on_post_init) {
+            Startup::Phase phase("post_init");
             config.on_post_init(Internal::s_window);
         }
         
@@ -484,26 +695,85 @@ namespace WindowSetup {
         auto init_duration = std::chrono::duration_cast<std::chrono::milliseconds>(init_end - init_start);
         
         if (config.log_initialization) {
-            std::cout << "[INIT] Window initialized in " << init_duration.count() << "ms" << std::endl;
-            std::cout << "[INIT] OpenGL " << config.gl_major << "." << config.gl_minor 
-                      << " | " << config.width << "x" << config.height 
-                      << " | " << config.title << std::endl;
+            GE_LOG_INFO(Window, "Window initialized in {}ms", init_duration.count());
+            GE_LOG_INFO(Window, "OpenGL {}.{} | {}x{} | {}{}", config.gl_major, config.gl_minor,
+                        config.width, config.height, config.title, config.headless ? " | headless" : "");
         }
         
         return Internal::s_window;
     }
 
+    // ============================================================================
+    // ON-DEMAND REDRAW
+    // ============================================================================
+
+    // Thread-safe. Schedules `frames` more frames and wakes an idle loop; call it
+    // every frame while animating. No effect on LoopMode::Continuous.
+    inline void RequestRedraw(int frames = 1) {
+        Internal::RaiseRedrawFrames(frames);
+        if (Internal::s_wake_enabled.load(std::memory_order_acquire)) {
+            glfwPostEmptyEvent();
+        }
+    }
+
+    namespace Internal {
+        // Blocks until there is something to draw. ImGui's GLFW callbacks queue
+        // input for every viewport, so a non-empty queue means real input.
+        inline void WaitForRedraw() {
+            bool waited = false;
+            for (;;) {
+                if (s_should_close || glfwWindowShouldClose(s_window)) break;
+                
+                if (!ImGui::GetCurrentContext()->InputEventsQueue.empty()) {
+                    RaiseRedrawFrames(s_config.idle_settle_frames);
+                    break;
+                }
+                
+                int owed = s_redraw_frames.load(std::memory_order_relaxed);
+                if (owed > 0 && s_redraw_frames.compare_exchange_strong(owed, owed - 1, std::memory_order_relaxed)) {
+                    break;
+                }
+                
+                // Blinking cursor and held buttons need a refresh even without events
+                const ImGuiIO& io = ImGui::GetIO();
+                if (waited && (io.WantTextInput || ImGui::IsAnyMouseDown())) break;
+                
+                glfwWaitEventsTimeout(s_config.idle_wait_timeout);
+                waited = true;
+            }
+            
+            // Time spent asleep is not frame time
+            if (waited) s_has_last_swap = false;
+        }
+    }
+
     inline void BeginFrame() {
         if (!Internal::s_initialized) return;
         
+        if (Internal::s_config.loop_mode == LoopMode::Idle) {
+            Internal::WaitForRedraw();
+        }
+        
         Internal::s_frame_start = std::chrono::high_resolution_clock::now();
+        Backend::Profiling::BeginFrame();
+        Backend::Memory::BeginFrame();
         
         // Poll events
-        glfwPollEvents();
+        {
+            GE_PROFILE_ZONE("PollEvents");
+            glfwPollEvents();
+        }
+        Internal::s_events_end = std::chrono::high_resolution_clock::now();
+        Internal::s_update_start = Internal::s_events_end;
         
         // Start ImGui frame
+        GE_PROFILE_ZONE("NewFrame");
         ImGui_ImplOpenGL3_NewFrame();
         ImGui_ImplGlfw_NewFrame();
+        if (Internal::s_config.headless) {
+            // Deterministic animation so captured frames are comparable run to run
+            ImGui::GetIO().DeltaTime = 1.0f / 60.0f;
+        }
         ImGui::NewFrame();
         
         // Frame start callback
@@ -520,70 +790,137 @@ namespace WindowSetup {
             Internal::s_config.on_frame_end();
         }
         
-        // Update performance metrics
-        auto frame_end = std::chrono::high_resolution_clock::now();
-        auto frame_duration = std::chrono::duration_cast<std::chrono::microseconds>(
-            frame_end - Internal::s_frame_start);
-        
-        Internal::s_metrics.frame_time_ms = frame_duration.count() / 1000.0;
-        Internal::s_metrics.fps = 1000000.0 / frame_duration.count();
-        
-        // Update draw statistics
-        ImDrawData* draw_data = ImGui::GetDrawData();
-        if (draw_data) {
-            Internal::s_metrics.draw_calls = draw_data->CmdListsCount;
-            Internal::s_metrics.vertices = 0;
-            Internal::s_metrics.indices = 0;
-            for (int i = 0; i < draw_data->CmdListsCount; i++) {
-                const ImDrawList* cmd_list = draw_data->CmdLists[i];
-                Internal::s_metrics.vertices += cmd_list->VtxBuffer.Size;
-                Internal::s_metrics.indices += cmd_list->IdxBuffer.Size;
-            }
-        }
+        // Frame time and draw statistics are finalized in Render(), after the swap
+        Internal::s_update_end = std::chrono::high_resolution_clock::now();
     }
 
     inline void Render() {
         if (!Internal::s_initialized) return;
         
-        // Render ImGui
-        ImGui::Render();
-        
-        // Get framebuffer size
-        int display_w, display_h;
-        glfwGetFramebufferSize(Internal::s_window, &display_w, &display_h);
+        using Clock = std::chrono::high_resolution_clock;
+        PerformanceMetrics& metrics = Internal::s_metrics;
+        const Clock::time_point render_start = Clock::now();
+        Clock::time_point swap_start;
         
-        // Clear screen
-        glViewport(0, 0, display_w, display_h);
-        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
+        metrics.draw_calls = 0;
+        metrics.vertices = 0;
+        metrics.indices = 0;
         
-        // Render ImGui draw data
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        {
+            GE_PROFILE_ZONE("Render");
+            
+            // Render ImGui
+            {
+                GE_PROFILE_ZONE("ImGui::Render");
+                ImGui::Render();
+            }
+            
+            // Get framebuffer size
+            int display_w, display_h;
+            if (Internal::s_offscreen_fbo) {
+                GLFunctions::Get().BindFramebuffer(GLFunctions::kFramebuffer, Internal::s_offscreen_fbo);
+                display_w = Internal::s_offscreen_width;
+                display_h = Internal::s_offscreen_height;
+            } else {
+                glfwGetFramebufferSize(Internal::s_window, &display_w, &display_h);
+            }
+            
+            // Clear screen
+            glViewport(0, 0, display_w, display_h);
+            glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+            
+            // Render ImGui draw data (GPU-timed; main viewport only)
+            {
+                GE_PROFILE_ZONE("RenderDrawData");
+                Internal::s_gpu_timer.Begin(Internal::s_frame_history.FrameCount());
+                Internal::s_imgui_renderer.RenderDrawData(ImGui::GetDrawData());
+                Internal::s_gpu_timer.End();
+            }
+            Internal::CountDrawData(ImGui::GetDrawData(), metrics);
+            
+            // Handle multi-viewports (Updated for Docking branch)
+            if (Internal::s_config.viewports_enabled) {
+                GE_PROFILE_ZONE("PlatformWindows");
+                GLFWwindow* backup_current_context = glfwGetCurrentContext();
+                ImGui::UpdatePlatformWindows();
+                ImGui::RenderPlatformWindowsDefault();
+                glfwMakeContextCurrent(backup_current_context);
+                
+                const ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+                for (int i = 1; i < platform_io.Viewports.Size; i++) {
+                    Internal::CountDrawData(platform_io.Viewports[i]->DrawData, metrics);
+                }
+            }
+            
+            // Swap buffers (headless: wait for the GPU so frame time includes rendering)
+            swap_start = Clock::now();
+            if (Internal::s_config.headless) {
+                GE_PROFILE_ZONE("Finish");
+                glFinish();
+            } else {
+                GE_PROFILE_ZONE("SwapBuffers");
+                glfwSwapBuffers(Internal::s_window);
+            }
+        }
         
-        // Handle multi-viewports (Updated for Docking branch)
-        if (Internal::s_config.viewports_enabled) {
-            GLFWwindow* backup_current_context = glfwGetCurrentContext();
-            ImGui::UpdatePlatformWindows();
-            ImGui::RenderPlatformWindowsDefault();
-            glfwMakeContextCurrent(backup_current_context);
+        // Metrics are measured after the swap so they cover the whole frame
+        const Clock::time_point swap_end = Clock::now();
+        const Clock::time_point previous_swap = Internal::s_has_last_swap ? Internal::s_last_swap : Internal::s_frame_start;
+        Internal::s_last_swap = swap_end;
+        Internal::s_has_last_swap = true;
+        
+        FrameTiming::FrameSample sample;
+        sample.frame_ms = static_cast<float>(Internal::ElapsedMs(previous_swap, swap_end));
+        sample.events_ms = static_cast<float>(Internal::ElapsedMs(Internal::s_frame_start, Internal::s_events_end));
+        sample.update_ms = static_cast<float>(Internal::ElapsedMs(Internal::s_update_start, Internal::s_update_end));
+        sample.render_ms = static_cast<float>(Internal::ElapsedMs(render_start, swap_start));
+        sample.swap_ms = static_cast<float>(Internal::ElapsedMs(swap_start, swap_end));
+        sample.draw_commands = static_cast<uint32_t>(metrics.draw_calls);
+        Internal::s_frame_history.Push(sample);
+        
+        FrameTiming::GpuTimer::Result results[FrameTiming::GpuTimer::kQueryCount];
+        const int result_count = Internal::s_gpu_timer.Collect(results);
+        for (int i = 0; i < result_count; i++) {
+            Internal::s_frame_history.SetGpuTime(results[i].frame_index, results[i].gpu_ms);
+            metrics.gpu_time_ms = results[i].gpu_ms;
         }
         
-        // Swap buffers
-        glfwSwapBuffers(Internal::s_window);
+        const FrameTiming::FrameHistory& history = Internal::s_frame_history;
+        metrics.frame_time_ms = sample.frame_ms;
+        metrics.fps = history.AverageMs() > 0.0f ? 1000.0 / history.AverageMs() : 0.0;
+        metrics.input_latency_ms = Internal::ElapsedMs(Internal::s_events_end, swap_end);
+        metrics.events_time_ms = sample.events_ms;
+        metrics.update_time_ms = sample.update_ms;
+        metrics.render_time_ms = sample.render_ms;
+        metrics.swap_time_ms = sample.swap_ms;
+        metrics.stutter_count = history.StutterCount();
+        
+        // Close the profiler frame after swap so it covers the whole frame
+        Backend::Profiling::EndFrame();
     }
 
     inline void Shutdown() {
         if (!Internal::s_initialized) return;
         
+        // No more glfwPostEmptyEvent once GLFW starts tearing down
+        Internal::s_wake_enabled.store(false, std::memory_order_release);
+        
         // Shutdown callback
         if (Internal::s_config.on_shutdown) {
             Internal::s_config.on_shutdown();
         }
         
+        // Release GL objects while the context is still alive
+        Internal::s_gpu_timer.Shutdown();
+        Internal::s_imgui_renderer.Shutdown();
+        Internal::DestroyOffscreenTarget();
+        
         // Cleanup ImGui
         ImGui_ImplOpenGL3_Shutdown();
         ImGui_ImplGlfw_Shutdown();
         ImGui::DestroyContext();
+        FontCache::Release();
         
         // Cleanup GLFW
         glfwDestroyWindow(Internal::s_window);
@@ -595,7 +932,7 @@ namespace WindowSetup {
         Internal::s_should_close = false;
         Internal::s_metrics.Reset();
         
-        std::cout << "[SHUTDOWN] Window system terminated" << std::endl;
+        GE_LOG_INFO(Window, "Window system terminated");
     }
 
     // ============================================================================
@@ -613,7 +950,11 @@ namespace WindowSetup {
     }
     
     inline const WindowConfig& GetConfig() { return Internal::s_config; }
+    inline void SetLoopMode(LoopMode mode) { Internal::s_config.loop_mode = mode; }
     inline const PerformanceMetrics& GetMetrics() { return Internal::s_metrics; }
+    inline const FrameTiming::FrameHistory& GetFrameHistory() { return Internal::s_frame_history; }
+    inline const ImGuiRenderer::Stats& GetRendererStats() { return Internal::s_imgui_renderer.GetStats(); }
+    inline FrameTiming::FrameHistory& GetFrameHistoryMutable() { return Internal::s_frame_history; }
     
     inline ImFont* GetMainFont() { return Internal::s_main_font; }
     inline ImFont* GetBoldFont() { return Internal::s_bold_font; }
@@ -642,16 +983,57 @@ namespace WindowSetup {
     }
     
     inline void GetFramebufferSize(int& width, int& height) {
-        if (Internal::s_window) {
+        if (Internal::s_offscreen_fbo) {
+            width = Internal::s_offscreen_width;
+            height = Internal::s_offscreen_height;
+        } else if (Internal::s_window) {
             glfwGetFramebufferSize(Internal::s_window, &width, &height);
         }
     }
     
+    inline bool IsHeadless() { return Internal::s_config.headless; }
+    
+    // Reads the last rendered frame as tightly packed RGB, top row first.
+    // Call after Render(); only meaningful in headless mode (on-screen back
+    // buffers are undefined after the swap).
+    inline bool ReadFramebuffer(std::vector<unsigned char>& rgb, int& width, int& height) {
+        if (!Internal::s_window) return false;
+        GetFramebufferSize(width, height);
+        if (width <= 0 || height <= 0) return false;
+        
+        const size_t row = static_cast<size_t>(width) * 3;
+        std::vector<unsigned char> flipped(row * static_cast<size_t>(height));
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, flipped.data());
+        
+        // GL origin is bottom-left
+        rgb.resize(flipped.size());
+        for (int y = 0; y < height; y++) {
+            std::copy_n(flipped.data() + row * (height - 1 - y), row, rgb.data() + row * y);
+        }
+        return true;
+    }
+    
+    // Binary PPM (P6): no image library needed, opens in most viewers
+    inline bool SaveFramebufferPPM(const std::string& path) {
+        std::vector<unsigned char> rgb;
+        int width = 0, height = 0;
+        if (!ReadFramebuffer(rgb, width, height)) return false;
+        
+        FILE* file = std::fopen(path.c_str(), "wb");
+        if (!file) return false;
+        std::fprintf(file, "P6\n%d %d\n255\n", width, height);
+        const bool ok = std::fwrite(rgb.data(), 1, rgb.size(), file) == rgb.size();
+        std::fclose(file);
+        return ok;
+    }
+    
     inline void CenterWindow() {
         if (!Internal::s_window) return;
         
         GLFWmonitor* primary_monitor = glfwGetPrimaryMonitor();
-        const GLFWvidmode* video_mode = glfwGetVideoMode(primary_monitor);
+        const GLFWvidmode* video_mode = primary_monitor ? glfwGetVideoMode(primary_monitor) : nullptr;
+        if (!video_mode) return;
         
         int monitor_x, monitor_y;
         glfwGetMonitorPos(primary_monitor, &monitor_x, &monitor_y);
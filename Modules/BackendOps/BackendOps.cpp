@@ -0,0 +1,185 @@
+// The Editor's Backend entry points, built as a hot-reloadable module
+// (Backend/Module/ModuleAPI.h): Backend startup and shutdown, the geometry
+// and scene operations behind the panels, and the editor commands. Rebuild
+// the BackendOps target while the Editor runs and the host swaps it in
+// between frames; the scene, imported meshes and the turntable state survive.
+
+#include "Module/ModuleAPI.h"
+#include "Engine.h"
+#include "Geometry/LodLibrary.h"
+#include "Geometry/MeshKernels.h"
+#include "Geometry/Terrain.h"
+#include "IO/MeshFile.h"
+#include "IO/MeshWriter.h"
+#include "Scene/Scene.h"
+
+#include <cmath>
+#include <iterator>
+#include <string>
+
+namespace {
+
+    namespace Geo = Backend::Geometry;
+    namespace Module = Backend::Module;
+
+    // Host-owned; bump kStateVersion when the layout changes
+    struct ToolState {
+        std::uint32_t terrains = 0;
+        std::uint32_t scatters = 0;
+        std::uint32_t turntable = 0;    // Spin the selected entity
+        float degrees_per_second = 0.0f;
+    };
+
+    constexpr std::uint32_t kStateVersion = 1;
+
+    ToolState& State(Module::ModuleContext& context) {
+        return *static_cast<ToolState*>(context.state);
+    }
+
+    // ============================================================================
+    // GEOMETRY
+    // ============================================================================
+
+    bool ImportMesh(Module::ModuleContext& context, Backend::Entity entity, const char* path, std::string& message) {
+        if (!context.library || !context.scene->IsValid(entity)) return false;
+        Backend::IO::MeshFile file;
+        if (!file.Open(path)) {
+            message = "Import failed: " + file.Error();
+            return false;
+        }
+        Geo::MeshSoA mesh = file.LoadLod(0);
+        const Geo::Aabb bounds = Geo::ComputeBounds(mesh.View());
+        const std::size_t triangles = mesh.TriangleCount();
+        const std::uint32_t id = context.library->Add(std::move(mesh));
+        context.scene->SetMesh(entity, Backend::MeshHandle{ id }, bounds);
+        message = "Imported " + std::to_string(triangles) + " triangles";
+        return true;
+    }
+
+    // Every built level goes into the file, coarsening, with its error
+    bool ExportLods(Module::ModuleContext& context, std::uint32_t mesh, const char* path, std::string& message) {
+        const auto lods = context.library ? context.library->GetLods(mesh) : nullptr;
+        if (!lods) return false;
+        Backend::IO::MeshWriter writer;
+        bool ok = writer.Open(path);
+        for (std::size_t level = 0; ok && level < lods->size(); ++level) {
+            if (level > 0) writer.BeginLod((*lods)[level].error);
+            ok = writer.WriteChunked((*lods)[level].mesh.View());
+        }
+        ok = ok && writer.Finish();
+        message = ok ? "Exported " + std::to_string(lods->size()) + " levels" : "Export failed: " + writer.Error();
+        return ok;
+    }
+
+    // ============================================================================
+    // SCENE
+    // ============================================================================
+
+    bool AddTerrain(Module::ModuleContext& context) {
+        if (!context.library) return false;
+        ToolState& state = State(context);
+        Geo::TerrainOptions shape;
+        shape.cells = 256;
+        shape.cell_size = 0.25f;
+        shape.height = 6.0f;
+        shape.centered = true;
+        Geo::MeshSoA mesh = Geo::MakeTerrain(shape);
+        const Geo::Aabb bounds = Geo::ComputeBounds(mesh.View());
+        const std::uint32_t id = context.library->Add(std::move(mesh));
+
+        const std::string name = "Terrain_" + std::to_string(++state.terrains);
+        const Backend::Entity entity = context.scene->CreateEntity(name);
+        context.scene->SetMesh(entity, Backend::MeshHandle{ id }, bounds);
+        context.scene->SetSelected(entity);
+        return true;
+    }
+
+    // 16 x 16 placeholder cubes on a grid next to the origin
+    bool Scatter(Module::ModuleContext& context) {
+        ToolState& state = State(context);
+        const float offset = static_cast<float>(state.scatters++) * 40.0f;
+        for (int z = 0; z < 16; ++z) {
+            for (int x = 0; x < 16; ++x) {
+                Backend::Transform transform;
+                transform.position = glm::vec3(static_cast<float>(x) * 2.0f + offset, 0.5f, static_cast<float>(z) * 2.0f);
+                context.scene->CreateEntity("Cube", transform);
+            }
+        }
+        return true;
+    }
+
+    bool ToggleTurntable(Module::ModuleContext& context) {
+        ToolState& state = State(context);
+        state.turntable = !state.turntable;
+        if (state.degrees_per_second == 0.0f) state.degrees_per_second = 45.0f;
+        return true;
+    }
+
+    // ============================================================================
+    // MODULE ENTRY
+    // ============================================================================
+
+    // The first image brings the Backend up (the UI thread becomes job
+    // worker 0) and the last one takes it down; reloads in between keep it
+    bool Load(Module::ModuleContext& context, bool /*reloaded*/) {
+        if (context.reloads == 0) Backend::Init();
+        return context.scene != nullptr && context.state != nullptr;
+    }
+
+    void Unload(Module::ModuleContext& /*context*/, bool reloading) {
+        if (!reloading) Backend::Shutdown();
+    }
+
+    void Update(Module::ModuleContext& context, double dt) {
+        const ToolState& state = State(context);
+        if (!state.turntable) return;
+        const Backend::Entity selected = context.scene->GetSelected();
+        if (selected == Backend::NullEntity) return;
+
+        Backend::Transform& transform = context.scene->GetTransform(selected);
+        transform.rotation.y = std::fmod(transform.rotation.y + state.degrees_per_second * static_cast<float>(dt), 360.0f);
+        context.scene->MarkDirty(selected, Backend::kDirtyTransform);
+        // Keep an idle editor animating
+        Backend::RequestRedraw();
+    }
+
+    const char* const kCommands[] = { "Add terrain", "Scatter cubes", "Toggle turntable" };
+
+    bool RunCommand(Module::ModuleContext& context, std::uint32_t index) {
+        switch (index) {
+            case 0: return AddTerrain(context);
+            case 1: return Scatter(context);
+            case 2: return ToggleTurntable(context);
+            default: return false;
+        }
+    }
+
+    const Module::BackendOps kOps = [] {
+        Module::BackendOps ops;
+        ops.import_mesh = &ImportMesh;
+        ops.export_lods = &ExportLods;
+        ops.add_terrain = &AddTerrain;
+        ops.scatter = &Scatter;
+        return ops;
+    }();
+
+    const Module::ModuleAPI kApi = [] {
+        Module::ModuleAPI api;
+        api.name = "BackendOps";
+        api.state_size = sizeof(ToolState);
+        api.state_version = kStateVersion;
+        api.load = &Load;
+        api.unload = &Unload;
+        api.update = &Update;
+        api.command_count = static_cast<std::uint32_t>(std::size(kCommands));
+        api.commands = kCommands;
+        api.run_command = &RunCommand;
+        api.ops = &kOps;
+        return api;
+    }();
+
+} // namespace
+
+GE_MODULE_EXPORT const Backend::Module::ModuleAPI* GeometryEngineModule() {
+    return &kApi;
+}
@@ -0,0 +1,292 @@
+#pragma once
+
+// Closed-form metrics of primitive shapes, shared by Backend and Bridge.
+//
+// Shapes are plain aggregates; a ShapeTraits<S> specialization supplies the
+// area, perimeter and validity of each, so a call on a shape type resolves
+// at compile time and inlines (no virtual calls, no switch per element).
+// Everything is constexpr, so metrics of shapes known at compile time fold
+// to constants. The span overloads run one shape type over
+// structure-of-arrays fields in plain loops the compiler can vectorize:
+// callers choose the shape once per batch, not once per element.
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <utility>
+
+namespace Shared::Geometry {
+
+    // ============================================================================
+    // SCALAR HELPERS
+    // ============================================================================
+
+    // std::sqrt only becomes constexpr in C++26; Newton's method from above
+    // when constant-evaluated, the library call otherwise
+    template <std::floating_point T>
+    constexpr T Sqrt(T value) {
+        if consteval {
+            if (value != value || value == std::numeric_limits<T>::infinity() || value == T(0)) return value;
+            if (value < T(0)) return std::numeric_limits<T>::quiet_NaN();
+            T x = value > T(1) ? value : T(1);
+            for (;;) {
+                const T next = T(0.5) * (x + value / x);
+                if (next >= x) return x;
+                x = next;
+            }
+        } else {
+            return std::sqrt(value);
+        }
+    }
+
+    // ============================================================================
+    // SHAPES
+    // ============================================================================
+
+    template <std::floating_point T = double>
+    struct Circle {
+        T radius = T(0);
+    };
+
+    template <std::floating_point T = double>
+    struct Rectangle {
+        T width = T(0);
+        T height = T(0);
+    };
+
+    // Base and height give the area. The sides are optional (all 0 when
+    // unknown) and only feed the perimeter, which is then 0
+    template <std::floating_point T = double>
+    struct Triangle {
+        T base = T(0);
+        T height = T(0);
+        T side_a = T(0);
+        T side_b = T(0);
+        T side_c = T(0);
+    };
+
+    template <std::floating_point T = double>
+    struct Point3 {
+        T x = T(0);
+        T y = T(0);
+        T z = T(0);
+    };
+
+    // Triangle given by its corners, as stored in meshes
+    template <std::floating_point T = double>
+    struct Triangle3 {
+        Point3<T> a;
+        Point3<T> b;
+        Point3<T> c;
+    };
+
+    template <std::floating_point T>
+    constexpr Point3<T> Cross(const Point3<T>& u, const Point3<T>& v) {
+        return Point3<T>{ u.y * v.z - u.z * v.y, u.z * v.x - u.x * v.z, u.x * v.y - u.y * v.x };
+    }
+
+    template <std::floating_point T>
+    constexpr T Length(const Point3<T>& p) {
+        return Sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+    }
+
+    // Unnormalized face normal (counter-clockwise winding); its length is twice the area
+    template <std::floating_point T>
+    constexpr Point3<T> FaceNormal(const Triangle3<T>& t) {
+        const Point3<T> e1{ t.b.x - t.a.x, t.b.y - t.a.y, t.b.z - t.a.z };
+        const Point3<T> e2{ t.c.x - t.a.x, t.c.y - t.a.y, t.c.z - t.a.z };
+        return Cross(e1, e2);
+    }
+
+    // ============================================================================
+    // TRAITS
+    // ============================================================================
+
+    // Specialize with Scalar, kName, kFields (scalars in declaration order, the
+    // layout the span overloads read) and constexpr Area, Perimeter and IsValid
+    template <typename S>
+    struct ShapeTraits;
+
+    template <std::floating_point T>
+    struct ShapeTraits<Circle<T>> {
+        using Scalar = T;
+        static constexpr const char* kName = "Circle";
+        static constexpr std::size_t kFields = 1;
+
+        static constexpr T Area(const Circle<T>& s) { return std::numbers::pi_v<T> * s.radius * s.radius; }
+        static constexpr T Perimeter(const Circle<T>& s) { return T(2) * std::numbers::pi_v<T> * s.radius; }
+        static constexpr bool IsValid(const Circle<T>& s) { return s.radius > T(0); }
+    };
+
+    template <std::floating_point T>
+    struct ShapeTraits<Rectangle<T>> {
+        using Scalar = T;
+        static constexpr const char* kName = "Rectangle";
+        static constexpr std::size_t kFields = 2;
+
+        static constexpr T Area(const Rectangle<T>& s) { return s.width * s.height; }
+        static constexpr T Perimeter(const Rectangle<T>& s) { return T(2) * (s.width + s.height); }
+        static constexpr bool IsValid(const Rectangle<T>& s) { return s.width > T(0) && s.height > T(0); }
+    };
+
+    template <std::floating_point T>
+    struct ShapeTraits<Triangle<T>> {
+        using Scalar = T;
+        static constexpr const char* kName = "Triangle";
+        static constexpr std::size_t kFields = 5;
+
+        static constexpr T Area(const Triangle<T>& s) { return T(0.5) * s.base * s.height; }
+        static constexpr T Perimeter(const Triangle<T>& s) { return s.side_a + s.side_b + s.side_c; }
+
+        static constexpr bool IsValid(const Triangle<T>& s) {
+            const bool no_sides = s.side_a == T(0) && s.side_b == T(0) && s.side_c == T(0);
+            const bool sides = s.side_a > T(0) && s.side_b > T(0) && s.side_c > T(0);
+            return s.base > T(0) && s.height > T(0) && (no_sides || sides);
+        }
+    };
+
+    template <std::floating_point T>
+    struct ShapeTraits<Triangle3<T>> {
+        using Scalar = T;
+        static constexpr const char* kName = "Triangle3";
+        static constexpr std::size_t kFields = 9;
+
+        static constexpr T Area(const Triangle3<T>& s) { return T(0.5) * Length(FaceNormal(s)); }
+
+        static constexpr T Perimeter(const Triangle3<T>& s) {
+            return Length(Point3<T>{ s.b.x - s.a.x, s.b.y - s.a.y, s.b.z - s.a.z })
+                 + Length(Point3<T>{ s.c.x - s.b.x, s.c.y - s.b.y, s.c.z - s.b.z })
+                 + Length(Point3<T>{ s.a.x - s.c.x, s.a.y - s.c.y, s.a.z - s.c.z });
+        }
+
+        // Degenerate (zero-area) triangles are valid mesh faces
+        static constexpr bool IsValid(const Triangle3<T>&) { return true; }
+    };
+
+    template <typename S>
+    concept Shape = requires(const S& s) {
+        typename ShapeTraits<S>::Scalar;
+        { ShapeTraits<S>::kName } -> std::convertible_to<const char*>;
+        { ShapeTraits<S>::kFields } -> std::convertible_to<std::size_t>;
+        { ShapeTraits<S>::Area(s) } -> std::same_as<typename ShapeTraits<S>::Scalar>;
+        { ShapeTraits<S>::Perimeter(s) } -> std::same_as<typename ShapeTraits<S>::Scalar>;
+        { ShapeTraits<S>::IsValid(s) } -> std::same_as<bool>;
+    };
+
+    template <Shape S>
+    using ScalarOf = typename ShapeTraits<S>::Scalar;
+
+    template <std::floating_point T>
+    struct ShapeMetrics {
+        T area = T(0);
+        T perimeter = T(0);
+    };
+
+    // ============================================================================
+    // SINGLE SHAPES
+    // ============================================================================
+
+    template <Shape S>
+    constexpr ScalarOf<S> Area(const S& shape) { return ShapeTraits<S>::Area(shape); }
+
+    template <Shape S>
+    constexpr ScalarOf<S> Perimeter(const S& shape) { return ShapeTraits<S>::Perimeter(shape); }
+
+    template <Shape S>
+    constexpr bool IsValid(const S& shape) { return ShapeTraits<S>::IsValid(shape); }
+
+    template <Shape S>
+    constexpr const char* ShapeName() { return ShapeTraits<S>::kName; }
+
+    template <Shape S>
+    constexpr ShapeMetrics<ScalarOf<S>> Metrics(const S& shape) {
+        return ShapeMetrics<ScalarOf<S>>{ Area(shape), Perimeter(shape) };
+    }
+
+    // ============================================================================
+    // BATCHES
+    // Structure of arrays: fields[k][i] is field k of shape i, fields in
+    // declaration order (Circle: radius; Triangle: base, height, side_a..c;
+    // Triangle3: a.x, a.y, a.z, b.x, ...). Every span holds at least as many
+    // elements as the outputs.
+    // ============================================================================
+
+    template <Shape S>
+    using FieldSpans = std::array<std::span<const ScalarOf<S>>, ShapeTraits<S>::kFields>;
+
+    namespace Detail {
+
+        template <Shape S, std::size_t... K>
+        constexpr S Load(const FieldSpans<S>& fields, std::size_t i, std::index_sequence<K...>) {
+            return S{ fields[K][i]... };
+        }
+
+        template <Shape S>
+        constexpr S Load(const FieldSpans<S>& fields, std::size_t i) {
+            return Load<S>(fields, i, std::make_index_sequence<ShapeTraits<S>::kFields>{});
+        }
+
+    } // namespace Detail
+
+    template <Shape S>
+    constexpr void ComputeAreas(const FieldSpans<S>& fields, std::span<ScalarOf<S>> out_areas) {
+        for (std::size_t i = 0; i < out_areas.size(); ++i) {
+            out_areas[i] = Area(Detail::Load<S>(fields, i));
+        }
+    }
+
+    template <Shape S>
+    constexpr void ComputePerimeters(const FieldSpans<S>& fields, std::span<ScalarOf<S>> out_perimeters) {
+        for (std::size_t i = 0; i < out_perimeters.size(); ++i) {
+            out_perimeters[i] = Perimeter(Detail::Load<S>(fields, i));
+        }
+    }
+
+    // Both metrics in one pass; the outputs must be the same size
+    template <Shape S>
+    constexpr void ComputeMetrics(const FieldSpans<S>& fields, std::span<ScalarOf<S>> out_areas,
+                                  std::span<ScalarOf<S>> out_perimeters) {
+        for (std::size_t i = 0; i < out_areas.size(); ++i) {
+            const S shape = Detail::Load<S>(fields, i);
+            out_areas[i] = Area(shape);
+            out_perimeters[i] = Perimeter(shape);
+        }
+    }
+
+    // Sums over the first `count` shapes
+    template <Shape S>
+    constexpr ShapeMetrics<ScalarOf<S>> SumMetrics(const FieldSpans<S>& fields, std::size_t count) {
+        ShapeMetrics<ScalarOf<S>> sum;
+        for (std::size_t i = 0; i < count; ++i) {
+            const S shape = Detail::Load<S>(fields, i);
+            sum.area += Area(shape);
+            sum.perimeter += Perimeter(shape);
+        }
+        return sum;
+    }
+
+    template <Shape S>
+    constexpr bool AllValid(const FieldSpans<S>& fields, std::size_t count) {
+        bool valid = true;
+        for (std::size_t i = 0; i < count; ++i) {
+            valid &= IsValid(Detail::Load<S>(fields, i));
+        }
+        return valid;
+    }
+
+    // ============================================================================
+    // COMPILE-TIME CHECKS (the reference values of test.ps1)
+    // ============================================================================
+
+    static_assert(Area(Rectangle<>{ 4.0, 5.0 }) == 20.0 && Perimeter(Rectangle<>{ 4.0, 5.0 }) == 18.0);
+    static_assert(Area(Triangle<>{ 6.0, 4.0, 3.0, 4.0, 5.0 }) == 12.0 && Perimeter(Triangle<>{ 6.0, 4.0, 3.0, 4.0, 5.0 }) == 12.0);
+    static_assert(Area(Circle<>{ 3.0 }) > 28.274333 && Area(Circle<>{ 3.0 }) < 28.274334);
+    static_assert(!IsValid(Circle<>{ 0.0 }) && !IsValid(Triangle<>{ 1.0, 1.0, 1.0, 0.0, 0.0 }));
+    static_assert(Perimeter(Triangle3<>{ { 0, 0, 0 }, { 3, 0, 0 }, { 0, 4, 0 } }) == 12.0);
+    static_assert(Area(Triangle3<float>{ { 0, 0, 0 }, { 3, 0, 0 }, { 0, 4, 0 } }) == 6.0f);
+
+} // namespace Shared::Geometry
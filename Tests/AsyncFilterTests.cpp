@@ -0,0 +1,219 @@
+// Behaviour tests for the Outliner's background search: case-insensitive
+// matching, incremental narrowing, the newest request winning over queued
+// and running ones, and sources built on the filter thread.
+
+#include "TestHarness.h"
+
+#include "UI/Core/AsyncFilter.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace {
+
+    using UILab::AsyncFilter;
+    using UILab::FilterSource;
+
+    constexpr std::size_t kLargeRows = 4'000'000;     // Tens of milliseconds per full scan
+
+    // "Entity_<i>" for every row, ids offset so they differ from row indices
+    std::shared_ptr<const FilterSource> MakeSource(std::size_t rows) {
+        auto source = std::make_shared<FilterSource>();
+        source->Reserve(rows, rows * 14);
+        for (std::size_t i = 0; i < rows; ++i) {
+            source->Add(1000 + i, "Entity_" + std::to_string(i));
+        }
+        return source;
+    }
+
+    bool WaitIdle(const AsyncFilter& filter) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (filter.Busy()) {
+            if (std::chrono::steady_clock::now() > deadline) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    // A source builder that holds the filter thread until Release()
+    struct Gate {
+        std::mutex mutex;
+        std::condition_variable changed;
+        bool entered = false;
+        bool released = false;
+
+        AsyncFilter::SourceBuilder Builder(std::shared_ptr<const FilterSource> source) {
+            return [this, source] {
+                std::unique_lock<std::mutex> lock(mutex);
+                entered = true;
+                changed.notify_all();
+                changed.wait(lock, [this] { return released; });
+                return source;
+            };
+        }
+
+        void WaitEntered() {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [this] { return entered; });
+        }
+
+        void Release() {
+            std::lock_guard<std::mutex> lock(mutex);
+            released = true;
+            changed.notify_all();
+        }
+    };
+
+} // namespace
+
+// ============================================================================
+// MATCHING
+// ============================================================================
+
+GE_TEST(EmptyQueryListsEveryRow) {
+    AsyncFilter filter;
+    GE_CHECK(filter.Result() == nullptr);
+    filter.SetSource(MakeSource(1000));
+    GE_CHECK(WaitIdle(filter));
+
+    const auto result = filter.Result();
+    GE_CHECK(result != nullptr);
+    if (!result) return;
+    GE_CHECK_EQ(result->rows.size(), 1000u);
+    GE_CHECK_EQ(result->rows[999], 999u);
+    GE_CHECK_EQ(result->source->ids[result->rows[0]], 1000u);
+}
+
+GE_TEST(SearchIsCaseInsensitiveSubstring) {
+    AsyncFilter filter;
+    filter.SetSource(MakeSource(1000));
+    filter.SetQuery("TITY_12");
+    GE_CHECK(WaitIdle(filter));
+
+    // Entity_12 and Entity_120 .. Entity_129
+    const auto result = filter.Result();
+    GE_CHECK(result != nullptr);
+    if (!result) return;
+    GE_CHECK_EQ(result->query, std::string("tity_12"));
+    GE_CHECK_EQ(result->rows.size(), 11u);
+    bool all_match = true;
+    for (const std::uint32_t row : result->rows) {
+        all_match = all_match && result->source->Key(row).find("tity_12") != std::string_view::npos;
+    }
+    GE_CHECK(all_match);
+}
+
+GE_TEST(LongerQueryNarrowsThePreviousResult) {
+    AsyncFilter filter;
+    filter.SetSource(MakeSource(1000));
+    filter.SetQuery("_5");
+    GE_CHECK(WaitIdle(filter));
+    const auto wide = filter.Result();
+
+    filter.SetQuery("_55");
+    GE_CHECK(WaitIdle(filter));
+    const auto narrow = filter.Result();
+    GE_CHECK(wide != nullptr && narrow != nullptr);
+    if (!wide || !narrow) return;
+    GE_CHECK(!wide->incremental);
+    GE_CHECK(narrow->incremental);
+    GE_CHECK_EQ(wide->rows.size(), 111u);      // 5, 50..59, 500..599
+    GE_CHECK_EQ(narrow->rows.size(), 11u);     // 55, 550..559
+}
+
+// ============================================================================
+// CANCELLATION
+// ============================================================================
+
+// Requests queued behind a busy filter collapse into the newest one
+GE_TEST(QueuedQueriesCollapseIntoTheLatest) {
+    AsyncFilter filter;
+    Gate gate;
+    filter.SetSource(gate.Builder(MakeSource(1000)));
+    gate.WaitEntered();
+    filter.SetQuery("entity_1");
+    filter.SetQuery("entity_2");
+    filter.SetQuery("entity_33");
+    GE_CHECK(filter.Busy());
+    gate.Release();
+    GE_CHECK(WaitIdle(filter));
+
+    const auto result = filter.Result();
+    GE_CHECK(result != nullptr);
+    if (!result) return;
+    GE_CHECK_EQ(result->query, std::string("entity_33"));
+    GE_CHECK_EQ(result->rows.size(), 11u);     // 33, 330..339
+}
+
+// A source posted while a builder runs wins; the built one is never scanned
+GE_TEST(SourcePostedDuringABuildReplacesIt) {
+    AsyncFilter filter;
+    Gate gate;
+    filter.SetSource(gate.Builder(MakeSource(1000)));
+    gate.WaitEntered();
+    const auto newer = MakeSource(10);
+    filter.SetSource(newer);
+    gate.Release();
+    GE_CHECK(WaitIdle(filter));
+
+    const auto result = filter.Result();
+    GE_CHECK(result != nullptr);
+    if (!result) return;
+    GE_CHECK(result->source == newer);
+    GE_CHECK_EQ(result->rows.size(), 10u);
+}
+
+// A query that matches nothing scans every row; the next one, posted while
+// that scan runs, cancels it, so its empty result is never published
+GE_TEST(NewerQueryCancelsARunningScan) {
+    AsyncFilter filter;
+    filter.SetSource(MakeSource(kLargeRows));
+    GE_CHECK(WaitIdle(filter));
+
+    filter.SetQuery("#");
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    filter.SetQuery("entity_3999999");
+    bool stale = false;
+    while (filter.Busy()) {
+        const auto result = filter.Result();
+        stale = stale || (result && result->query == "#");
+        std::this_thread::yield();
+    }
+    const auto result = filter.Result();
+    GE_CHECK(!stale);
+    GE_CHECK(result != nullptr);
+    if (!result) return;
+    GE_CHECK_EQ(result->query, std::string("entity_3999999"));
+    GE_CHECK_EQ(result->rows.size(), 1u);
+}
+
+// The destructor cancels a running scan instead of waiting it out
+GE_TEST(DestroyingTheFilterCancelsItsScan) {
+    const auto source = MakeSource(kLargeRows);
+    float full_scan_ms = 0.0f;
+    {
+        AsyncFilter filter;
+        filter.SetSource(source);
+        filter.SetQuery("#");
+        GE_CHECK(WaitIdle(filter));
+        const auto result = filter.Result();
+        GE_CHECK(result != nullptr && result->query == "#" && result->rows.empty());
+        if (result) full_scan_ms = result->filter_ms;
+    }
+
+    auto filter = std::make_unique<AsyncFilter>();
+    filter->SetSource(source);
+    filter->SetQuery("#");
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    const auto start = std::chrono::steady_clock::now();
+    filter.reset();
+    const float destroy_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    GE_CHECK(destroy_ms < full_scan_ms * 0.5f);
+}
+
+GE_TEST_MAIN()
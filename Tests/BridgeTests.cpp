@@ -0,0 +1,357 @@
+// Behaviour tests for the Bridge batch processor: Parse() refusing malformed
+// framing, Step() rejecting bad op payloads without touching the mesh library
+// or the scene, and queries seeing the edits before them in request order.
+
+#include "TestHarness.h"
+
+#include "BatchProcessor.h"
+#include "Jobs/JobSystem.h"
+#include "Protocol.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Protocol = Bridge::Protocol;
+
+namespace {
+
+    using Protocol::BatchWriter;
+    using Protocol::Op;
+    using Protocol::Status;
+
+    constexpr std::uint32_t kMaxShapeBatch = 1u << 24;     // BatchProcessor.cpp
+    constexpr auto kNoResult = static_cast<Status>(0xFFFF);
+
+    struct Response {
+        std::vector<std::byte> body;
+        std::vector<Protocol::ResultReader::Result> results;
+
+        Status At(std::size_t i) const { return i < results.size() ? results[i].GetStatus() : kNoResult; }
+    };
+
+    // Parses and steps `body` to the end, as a transport would
+    Response Execute(Bridge::BatchProcessor& processor, std::span<const std::byte> body) {
+        Response response;
+        Bridge::BatchCursor cursor;
+        GE_CHECK(processor.Parse(body, cursor));
+        while (!cursor.Done()) {
+            const std::span<const std::byte> chunk = processor.Step(cursor);
+            response.body.insert(response.body.end(), chunk.begin(), chunk.end());
+        }
+
+        Protocol::ResultReader reader(response.body);
+        GE_CHECK(reader.IsValid() && !reader.IsRejected());
+        GE_CHECK_EQ(reader.Count(), cursor.OpCount());
+        Protocol::ResultReader::Result result;
+        while (reader.Next(result)) response.results.push_back(result);
+        GE_CHECK_EQ(response.results.size(), cursor.OpCount());
+        return response;
+    }
+
+    Response Execute(Bridge::BatchProcessor& processor, BatchWriter& batch) {
+        return Execute(processor, batch.Bytes());
+    }
+
+    bool Parses(const Bridge::BatchProcessor& processor, std::span<const std::byte> body) {
+        Bridge::BatchCursor cursor;
+        return processor.Parse(body, cursor);
+    }
+
+    // Unit square in z = 0, two triangles
+    void UploadQuad(BatchWriter& batch, std::uint32_t mesh_id, std::uint64_t tag = 0) {
+        const float x[] = { 0.0f, 1.0f, 1.0f, 0.0f };
+        const float y[] = { 0.0f, 0.0f, 1.0f, 1.0f };
+        const float z[] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        const std::uint32_t i0[] = { 0, 0 };
+        const std::uint32_t i1[] = { 1, 2 };
+        const std::uint32_t i2[] = { 2, 3 };
+        batch.UploadMesh(mesh_id, x, y, z, i0, i1, i2, tag);
+    }
+
+    // Triangle count of a stored mesh, or -1 if the library has none
+    std::int64_t Triangles(Bridge::BatchProcessor& processor, std::uint32_t mesh_id) {
+        BatchWriter batch;
+        batch.MeshQuery(Op::MeshMetrics, mesh_id);
+        const Response response = Execute(processor, batch);
+        Protocol::MetricsResult metrics;
+        if (response.At(0) != Status::Ok || !response.results[0].Read(metrics)) return -1;
+        return static_cast<std::int64_t>(metrics.triangle_count);
+    }
+
+    // Entities with bounds anywhere in the scene
+    std::uint32_t EntityCount(Bridge::BatchProcessor& processor) {
+        constexpr float kFar = 1.0e30f;
+        BatchWriter batch;
+        batch.QueryBounds(Protocol::BoundsResult{ { -kFar, -kFar, -kFar }, { kFar, kFar, kFar } });
+        const Response response = Execute(processor, batch);
+        std::uint32_t count = 0;
+        GE_CHECK(response.At(0) == Status::Ok && response.results[0].Read(count));
+        return count;
+    }
+
+    // Overwrites the OpHeader::payload_bytes of the op starting at `op_offset`
+    void PatchPayloadBytes(std::vector<std::byte>& body, std::size_t op_offset, std::uint32_t payload_bytes) {
+        std::memcpy(body.data() + op_offset + offsetof(Protocol::OpHeader, payload_bytes), &payload_bytes,
+                    sizeof(payload_bytes));
+    }
+
+    std::vector<std::byte> Copy(std::span<const std::byte> bytes) {
+        return std::vector<std::byte>(bytes.begin(), bytes.end());
+    }
+
+} // namespace
+
+// ============================================================================
+// FRAMING
+// ============================================================================
+
+GE_TEST(TruncatedBatchHeaderIsRejected) {
+    Bridge::BatchProcessor processor;
+    BatchWriter batch;
+    batch.Ping();
+    const std::span<const std::byte> body = batch.Bytes();
+
+    GE_CHECK(Parses(processor, body));
+    GE_CHECK(!Parses(processor, {}));
+    GE_CHECK(!Parses(processor, body.first(sizeof(Protocol::BatchHeader) - 1)));
+
+    std::vector<std::byte> bad_magic = Copy(body);
+    bad_magic[0] ^= std::byte{ 0xFF };
+    GE_CHECK(!Parses(processor, bad_magic));
+}
+
+GE_TEST(TruncatedOpIsRejected) {
+    Bridge::BatchProcessor processor;
+    BatchWriter batch;
+    batch.Ping();
+    batch.MeshQuery(Op::MeshMetrics, 1);
+    const std::span<const std::byte> body = batch.Bytes();
+    const std::size_t second_op = sizeof(Protocol::BatchHeader) + sizeof(Protocol::OpHeader);
+
+    // Inside the second op header, then inside its payload
+    GE_CHECK(!Parses(processor, body.first(second_op + sizeof(Protocol::OpHeader) / 2)));
+    GE_CHECK(!Parses(processor, body.first(body.size() - 1)));
+
+    // The header promises an op the body does not hold
+    std::vector<std::byte> missing = Copy(body);
+    const std::uint32_t op_count = 3;
+    std::memcpy(missing.data() + offsetof(Protocol::BatchHeader, op_count), &op_count, sizeof(op_count));
+    GE_CHECK(!Parses(processor, missing));
+
+    // Bytes after the last op
+    std::vector<std::byte> trailing = Copy(body);
+    trailing.resize(trailing.size() + 4, std::byte{ 0 });
+    GE_CHECK(!Parses(processor, trailing));
+}
+
+// A payload length running past the body rejects the whole batch, so none
+// of its ops run
+GE_TEST(PayloadPastTheBodyEndIsRejected) {
+    Bridge::BatchProcessor processor;
+    BatchWriter batch;
+    batch.Ping();
+    UploadQuad(batch, 7);
+    std::vector<std::byte> body = Copy(batch.Bytes());
+    const std::size_t upload_op = sizeof(Protocol::BatchHeader) + sizeof(Protocol::OpHeader);
+    const auto payload = static_cast<std::uint32_t>(body.size() - upload_op - sizeof(Protocol::OpHeader));
+
+    PatchPayloadBytes(body, upload_op, payload + 4);
+    GE_CHECK(!Parses(processor, body));
+    PatchPayloadBytes(body, upload_op, 0xFFFFFFFFu);
+    GE_CHECK(!Parses(processor, body));
+    GE_CHECK_EQ(Triangles(processor, 7), -1);
+
+    PatchPayloadBytes(body, upload_op, payload);
+    const Response response = Execute(processor, body);
+    GE_CHECK(response.At(1) == Status::Ok);
+    GE_CHECK_EQ(Triangles(processor, 7), 2);
+}
+
+// ============================================================================
+// PAYLOADS
+// ============================================================================
+
+// A rejected upload neither adds the mesh nor replaces one with the same id
+GE_TEST(UploadWithOutOfRangeIndicesIsRejected) {
+    Bridge::BatchProcessor processor;
+    BatchWriter batch;
+    UploadQuad(batch, 1);
+    GE_CHECK(Execute(processor, batch).At(0) == Status::Ok);
+
+    const float x[] = { 0.0f, 1.0f, 0.0f };
+    const float y[] = { 0.0f, 0.0f, 1.0f };
+    const float z[] = { 0.0f, 0.0f, 0.0f };
+    const std::uint32_t i0[] = { 0 };
+    const std::uint32_t i1[] = { 1 };
+    const std::uint32_t past_end[] = { 3 };
+    const std::uint32_t huge[] = { 0xFFFFFFFFu };
+    batch.Clear();
+    batch.UploadMesh(1, x, y, z, i0, i1, past_end);
+    batch.UploadMesh(2, x, y, z, i0, i1, huge);
+    batch.UploadMesh(3, x, y, z, i0, huge, i1);
+    const Response response = Execute(processor, batch);
+    GE_CHECK(response.At(0) == Status::BadRequest);
+    GE_CHECK(response.At(1) == Status::BadRequest);
+    GE_CHECK(response.At(2) == Status::BadRequest);
+
+    GE_CHECK_EQ(Triangles(processor, 1), 2);
+    GE_CHECK_EQ(Triangles(processor, 2), -1);
+    GE_CHECK_EQ(Triangles(processor, 3), -1);
+}
+
+// Counts are checked against the payload before anything is allocated
+GE_TEST(UploadWithOversizedCountsIsRejected) {
+    Bridge::BatchProcessor processor;
+    const float coords[12] = {};
+    BatchWriter batch;
+
+    batch.Begin(Op::UploadMesh);
+    batch.Write(Protocol::UploadMeshDesc{ 1, 0xFFFFFFFFu, 0xFFFFFFFFu, 0 });
+    batch.WriteBytes(coords, sizeof(coords));
+
+    // Vertices fit, the triangles they claim do not
+    batch.Begin(Op::UploadMesh);
+    batch.Write(Protocol::UploadMeshDesc{ 2, 4, 1000, 0 });
+    batch.WriteBytes(coords, sizeof(coords));
+
+    // Shorter than the descriptor itself
+    batch.Begin(Op::UploadMesh);
+    batch.Write(std::uint32_t{ 3 });
+
+    const Response response = Execute(processor, batch);
+    GE_CHECK(response.At(0) == Status::BadRequest);
+    GE_CHECK(response.At(1) == Status::BadRequest);
+    GE_CHECK(response.At(2) == Status::BadRequest);
+    for (std::uint32_t id = 1; id <= 3; ++id) GE_CHECK_EQ(Triangles(processor, id), -1);
+}
+
+GE_TEST(ShapeBatchOverTheCapIsRejected) {
+    Bridge::BatchProcessor processor;
+    const double radii[] = { 1.0, 2.0 };
+    BatchWriter batch;
+    batch.ShapeMetrics(Protocol::ShapeKind::Circle, 2, radii);
+    batch.ShapeMetrics(Protocol::ShapeKind::Circle, kMaxShapeBatch + 1, radii);
+    batch.ShapeMetrics(Protocol::ShapeKind::Circle, 0xFFFFFFFFu, radii);
+    batch.ShapeMetrics(Protocol::ShapeKind::Circle, 3, radii);     // Under the cap, payload too short
+    batch.ShapeMetrics(static_cast<Protocol::ShapeKind>(9), 2, radii);
+    const Response response = Execute(processor, batch);
+
+    GE_CHECK(response.At(0) == Status::Ok);
+    Protocol::ShapeBatchResult header;
+    double area = 0.0;
+    GE_CHECK(response.results[0].Read(header) && response.results[0].Read(area, sizeof(header)));
+    GE_CHECK_EQ(header.count, 2u);
+    GE_CHECK(std::abs(area - 3.14159265358979) < 1e-9);
+
+    for (std::size_t i = 1; i < 5; ++i) {
+        GE_CHECK(response.At(i) == Status::BadRequest);
+        GE_CHECK(response.results.size() > i && response.results[i].payload.empty());
+    }
+}
+
+// BuildLods rejects ratios outside (0, 1), NaN included, and keeps no chain
+GE_TEST(NaNSimplifyRatioIsRejected) {
+    Bridge::BatchProcessor processor;
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    BatchWriter batch;
+    UploadQuad(batch, 1);
+    batch.BuildLods(1, 4, nan);
+    batch.BuildLods(1, 4, 1.0f);
+    batch.BuildLods(1, 4, 0.5f, nan);
+    batch.BuildLods(1, 0, 0.5f);
+    batch.LodMetrics(1, 1.0e9f);
+    const Response response = Execute(processor, batch);
+
+    GE_CHECK(response.At(0) == Status::Ok);
+    for (std::size_t i = 1; i < 5; ++i) GE_CHECK(response.At(i) == Status::BadRequest);
+
+    // Without a chain the coarsest level is the uploaded mesh
+    Protocol::MetricsResult metrics;
+    GE_CHECK(response.At(5) == Status::Ok && response.results[5].Read(metrics));
+    GE_CHECK_EQ(metrics.triangle_count, 2u);
+}
+
+GE_TEST(RejectedEditsLeaveTheSceneUnchanged) {
+    Bridge::BatchProcessor processor;
+    BatchWriter batch;
+    UploadQuad(batch, 1);
+    batch.CreateEntity("quad", Protocol::TransformData{}, 1);
+    Response response = Execute(processor, batch);
+    GE_CHECK(response.At(1) == Status::Ok);
+    GE_CHECK_EQ(EntityCount(processor), 1u);
+
+    batch.Clear();
+    batch.Begin(Op::CreateEntity);      // Name longer than the payload
+    batch.Write(Protocol::CreateEntityDesc{ Protocol::TransformData{}, 1, 100 });
+    batch.WriteBytes("quad", 4);
+    batch.CreateEntity("orphan", Protocol::TransformData{}, 42);
+    batch.DestroyEntity(Protocol::kInvalidId);
+    batch.SetTransform(Protocol::kInvalidId, Protocol::TransformData{});
+    batch.Begin(Op::SetTransform);      // Truncated descriptor
+    batch.Write(std::uint32_t{ 0 });
+    response = Execute(processor, batch);
+
+    GE_CHECK(response.At(0) == Status::BadRequest);
+    GE_CHECK(response.At(1) == Status::NotFound);
+    GE_CHECK(response.At(2) == Status::NotFound);
+    GE_CHECK(response.At(3) == Status::NotFound);
+    GE_CHECK(response.At(4) == Status::BadRequest);
+    GE_CHECK_EQ(EntityCount(processor), 1u);
+}
+
+// ============================================================================
+// ORDERING
+// ============================================================================
+
+// Read-only runs execute in parallel but never move across an edit: each
+// query sees exactly the edits submitted before it
+GE_TEST(QueriesSeeEditsInRequestOrder) {
+    Backend::Jobs::JobSystemConfig config;
+    config.worker_count = 3;
+    Backend::Jobs::Initialize(config);
+    {
+        constexpr std::uint32_t kQueries = 64;
+        Bridge::BatchProcessor processor;
+        BatchWriter batch;
+        std::uint64_t tag = 0;
+        batch.MeshQuery(Op::MeshMetrics, 5, tag++);
+        UploadQuad(batch, 5, tag++);
+        for (std::uint32_t i = 0; i < kQueries; ++i) batch.MeshQuery(Op::MeshMetrics, 5, tag++);
+        batch.MeshQuery(Op::MeshBounds, 5, tag++);
+        batch.MeshQuery(Op::DropMesh, 5, tag++);
+        batch.MeshQuery(Op::MeshBounds, 5, tag++);
+        batch.Ping(tag++);
+        const Response response = Execute(processor, batch);
+
+        bool in_order = response.results.size() == tag;
+        for (std::size_t i = 0; in_order && i < response.results.size(); ++i) {
+            in_order = response.results[i].header.tag == i;
+        }
+        GE_CHECK(in_order);
+        GE_CHECK(response.At(0) == Status::NotFound);
+        GE_CHECK(response.At(1) == Status::Ok);
+
+        std::uint32_t metrics_ok = 0;
+        for (std::uint32_t i = 0; i < kQueries; ++i) {
+            Protocol::MetricsResult metrics;
+            metrics_ok += response.At(2 + i) == Status::Ok && response.results[2 + i].Read(metrics) &&
+                          metrics.triangle_count == 2;
+        }
+        GE_CHECK_EQ(metrics_ok, kQueries);
+
+        Protocol::BoundsResult bounds;
+        GE_CHECK(response.At(2 + kQueries) == Status::Ok && response.results[2 + kQueries].Read(bounds));
+        GE_CHECK(bounds.min[0] == 0.0f && bounds.max[0] == 1.0f && bounds.max[1] == 1.0f && bounds.max[2] == 0.0f);
+        GE_CHECK(response.At(3 + kQueries) == Status::Ok);
+        GE_CHECK(response.At(4 + kQueries) == Status::NotFound);
+        GE_CHECK(response.At(5 + kQueries) == Status::Ok);
+    }
+    Backend::Jobs::Shutdown();
+}
+
+GE_TEST_MAIN()
@@ -0,0 +1,210 @@
+// Behaviour tests for the work-stealing deque and the job scheduler:
+// ownership of every item under concurrent steals, counters as
+// dependencies, ParallelFor coverage and the inline path before Initialize.
+
+#include "TestHarness.h"
+
+#include "Jobs/JobSystem.h"
+#include "Jobs/WorkStealingDeque.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Jobs = Backend::Jobs;
+
+namespace {
+
+    struct Item {
+        int value = 0;
+    };
+
+    void InitializeWorkers() {
+        Jobs::JobSystemConfig config;
+        config.worker_count = 3;
+        Jobs::Initialize(config);
+    }
+
+} // namespace
+
+// ============================================================================
+// DEQUE
+// ============================================================================
+
+GE_TEST(DequeOwnerPopsLifoThievesStealFifo) {
+    Jobs::WorkStealingDeque<Item, 8> deque;
+    Item items[3] = { { 0 }, { 1 }, { 2 } };
+    for (Item& item : items) GE_CHECK(deque.Push(&item));
+    GE_CHECK_EQ(deque.ApproxSize(), 3u);
+
+    GE_CHECK_EQ(deque.Steal(), &items[0]);
+    GE_CHECK_EQ(deque.Pop(), &items[2]);
+    GE_CHECK_EQ(deque.Pop(), &items[1]);
+    GE_CHECK(deque.Pop() == nullptr);
+    GE_CHECK(deque.Steal() == nullptr);
+    GE_CHECK_EQ(deque.ApproxSize(), 0u);
+}
+
+GE_TEST(DequePushFailsWhenFull) {
+    Jobs::WorkStealingDeque<Item, 4> deque;
+    Item items[5];
+    for (int i = 0; i < 4; ++i) GE_CHECK(deque.Push(&items[i]));
+    GE_CHECK(!deque.Push(&items[4]));
+
+    // A steal frees a slot; indices keep wrapping around the ring
+    GE_CHECK_EQ(deque.Steal(), &items[0]);
+    GE_CHECK(deque.Push(&items[4]));
+    GE_CHECK_EQ(deque.Pop(), &items[4]);
+}
+
+// Every pushed item is taken exactly once, by the owner or by a thief
+GE_TEST(DequeConcurrentStealsTakeEachItemOnce) {
+    constexpr int kItems = 200000;
+    constexpr int kThieves = 3;
+    auto deque = std::make_unique<Jobs::WorkStealingDeque<Item, 256>>();
+    std::vector<Item> items(kItems);
+    std::vector<std::atomic<int>> taken(kItems);
+    for (int i = 0; i < kItems; ++i) items[i].value = i;
+
+    std::atomic<bool> done{ false };
+    std::atomic<int> total{ 0 };
+    auto take = [&](Item* item) {
+        taken[item->value].fetch_add(1, std::memory_order_relaxed);
+        total.fetch_add(1, std::memory_order_relaxed);
+    };
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < kThieves; ++t) {
+        thieves.emplace_back([&] {
+            while (!done.load(std::memory_order_acquire)) {
+                if (Item* item = deque->Steal()) take(item);
+            }
+        });
+    }
+
+    for (int i = 0; i < kItems; ++i) {
+        while (!deque->Push(&items[i])) {
+            if (Item* item = deque->Pop()) take(item);
+        }
+        if (i % 3 == 0) {
+            if (Item* item = deque->Pop()) take(item);
+        }
+    }
+    while (Item* item = deque->Pop()) take(item);
+    while (total.load(std::memory_order_acquire) < kItems) std::this_thread::yield();
+    done.store(true, std::memory_order_release);
+    for (std::thread& thief : thieves) thief.join();
+
+    GE_CHECK_EQ(total.load(), kItems);
+    int wrong = 0;
+    for (const std::atomic<int>& count : taken) wrong += count.load() != 1;
+    GE_CHECK_EQ(wrong, 0);
+}
+
+// ============================================================================
+// SCHEDULER
+// ============================================================================
+
+GE_TEST(RunExecutesInlineBeforeInitialize) {
+    GE_CHECK(!Jobs::IsInitialized());
+    int value = 0;
+    Jobs::JobCounter counter;
+    Jobs::Run([&value]() { value = 42; }, &counter);
+    GE_CHECK_EQ(value, 42);
+    GE_CHECK(counter.IsDone());
+}
+
+GE_TEST(CounterTracksEveryJob) {
+    InitializeWorkers();
+    constexpr int kJobs = 20000;   // More than one job ring, so slots get reused
+    std::atomic<int> ran{ 0 };
+    Jobs::JobCounter counter;
+    for (int i = 0; i < kJobs; ++i) {
+        Jobs::Run([&ran]() { ran.fetch_add(1, std::memory_order_relaxed); }, &counter);
+    }
+    Jobs::Wait(counter);
+    GE_CHECK(counter.IsDone());
+    GE_CHECK_EQ(ran.load(), kJobs);
+    Jobs::Shutdown();
+}
+
+// A job submitted with depends_on starts only after that counter drains
+GE_TEST(DependentJobsRunAfterTheirDependency) {
+    InitializeWorkers();
+    constexpr int kStages = 8;
+    constexpr int kWidth = 16;
+    std::atomic<int> finished[kStages] = {};
+    std::atomic<int> violations{ 0 };
+    std::vector<std::unique_ptr<Jobs::JobCounter>> counters;
+    for (int s = 0; s < kStages; ++s) counters.push_back(std::make_unique<Jobs::JobCounter>());
+
+    for (int s = 0; s < kStages; ++s) {
+        Jobs::JobCounter* depends_on = s > 0 ? counters[s - 1].get() : nullptr;
+        for (int j = 0; j < kWidth; ++j) {
+            Jobs::Run([&finished, &violations, s]() {
+                if (s > 0 && finished[s - 1].load(std::memory_order_acquire) != kWidth) {
+                    violations.fetch_add(1, std::memory_order_relaxed);
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+                finished[s].fetch_add(1, std::memory_order_acq_rel);
+            }, counters[s].get(), depends_on);
+        }
+    }
+    Jobs::Wait(*counters[kStages - 1]);
+
+    GE_CHECK_EQ(violations.load(), 0);
+    for (int s = 0; s < kStages; ++s) GE_CHECK_EQ(finished[s].load(), kWidth);
+    Jobs::Shutdown();
+}
+
+GE_TEST(ParallelForCoversEachIndexOnce) {
+    InitializeWorkers();
+    constexpr std::size_t kCount = 100003;   // Not a multiple of the grain
+    std::vector<std::atomic<int>> hits(kCount);
+    Jobs::ParallelFor(0, kCount, 64, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) hits[i].fetch_add(1, std::memory_order_relaxed);
+    });
+    int wrong = 0;
+    for (const std::atomic<int>& hit : hits) wrong += hit.load() != 1;
+    GE_CHECK_EQ(wrong, 0);
+    Jobs::Shutdown();
+}
+
+// Shutdown right after submitting: jobs spawned by running jobs and jobs
+// parked on a counter still run on the workers, none inline after they stop
+GE_TEST(ShutdownRunsNestedAndParkedJobs) {
+    InitializeWorkers();
+    const std::uint64_t inlined = Jobs::GetStats().jobs_inlined;
+    constexpr int kRoots = 64;
+    constexpr int kChildren = 8;
+    std::atomic<int> ran{ 0 };
+    std::atomic<int> parked_ran{ 0 };
+    Jobs::JobCounter slow;
+    Jobs::Run([]() { std::this_thread::sleep_for(std::chrono::milliseconds(20)); }, &slow);
+    Jobs::Run([&parked_ran]() { parked_ran.fetch_add(1, std::memory_order_relaxed); }, nullptr, &slow);
+
+    for (int r = 0; r < kRoots; ++r) {
+        Jobs::Run([&ran]() {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            for (int c = 0; c < kChildren; ++c) {
+                Jobs::Run([&ran]() {
+                    Jobs::Run([&ran]() { ran.fetch_add(1, std::memory_order_relaxed); });
+                    ran.fetch_add(1, std::memory_order_relaxed);
+                });
+            }
+            ran.fetch_add(1, std::memory_order_relaxed);
+        });
+    }
+    Jobs::Shutdown();
+
+    GE_CHECK(!Jobs::IsInitialized());
+    GE_CHECK(slow.IsDone());
+    GE_CHECK_EQ(parked_ran.load(), 1);
+    GE_CHECK_EQ(ran.load(), kRoots * (1 + kChildren * 2));
+    GE_CHECK_EQ(Jobs::GetStats().jobs_inlined, inlined);
+}
+
+GE_TEST_MAIN()
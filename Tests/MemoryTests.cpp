@@ -0,0 +1,230 @@
+// Behaviour tests for the allocators in Backend/Memory: arena alignment,
+// rewind and block merging, pool reuse and size classes, and the counting
+// operator new replacements (this executable installs them).
+
+#include "TestHarness.h"
+
+#include "Memory/HeapHooks.h"
+#include "Memory/Memory.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <new>
+#include <set>
+#include <vector>
+
+namespace Memory = Backend::Memory;
+
+namespace {
+
+    bool Aligned(const void* p, std::size_t align) {
+        return reinterpret_cast<std::uintptr_t>(p) % align == 0;
+    }
+
+} // namespace
+
+// ============================================================================
+// LINEAR ARENA
+// ============================================================================
+
+GE_TEST(ArenaAllocationsAreAlignedAndDisjoint) {
+    Memory::LinearArena arena(1024);
+    struct Span {
+        std::byte* p;
+        std::size_t size;
+    };
+    std::vector<Span> spans;
+    bool aligned = true;
+    for (std::size_t i = 0; i < 200; ++i) {
+        const std::size_t size = 1 + (i * 37) % 300;
+        const std::size_t align = std::size_t(1) << (i % 7);    // 1 .. 64
+        auto* p = static_cast<std::byte*>(arena.Allocate(size, align));
+        aligned = aligned && Aligned(p, align);
+        std::memset(p, static_cast<int>(i & 0xFF), size);
+        spans.push_back({ p, size });
+    }
+    GE_CHECK(aligned);
+
+    // Every span still holds its own fill, so none overlapped a later one
+    bool intact = true;
+    for (std::size_t i = 0; i < spans.size(); ++i) {
+        for (std::size_t b = 0; b < spans[i].size; ++b) {
+            intact = intact && spans[i].p[b] == static_cast<std::byte>(i & 0xFF);
+        }
+    }
+    GE_CHECK(intact);
+    GE_CHECK(arena.Used() >= 200);
+    GE_CHECK(arena.BlockAllocations() > 1);
+}
+
+GE_TEST(ArenaRewindReleasesLaterAllocations) {
+    Memory::LinearArena arena(4096);
+    arena.Allocate(100);
+    const Memory::LinearArena::Marker marker = arena.Mark();
+    const std::size_t used = arena.Used();
+
+    void* first = arena.Allocate(64);
+    for (int i = 0; i < 100; ++i) arena.Allocate(128);    // Spills into further blocks
+    arena.Rewind(marker);
+    GE_CHECK_EQ(arena.Used(), used);
+    GE_CHECK_EQ(arena.Allocate(64), first);
+}
+
+// A cycle that spilled over several blocks is merged into one on Reset, so
+// the same cycle afterwards allocates no blocks at all
+GE_TEST(ArenaResetMergesSpilledBlocks) {
+    Memory::LinearArena arena(1024);
+    auto cycle = [&arena] {
+        for (int i = 0; i < 20; ++i) arena.Allocate(700);
+    };
+    cycle();
+    GE_CHECK(arena.BlockAllocations() > 2);
+    arena.Reset();
+    GE_CHECK_EQ(arena.Used(), 0u);
+
+    const std::uint64_t blocks = arena.BlockAllocations();
+    cycle();
+    arena.Reset();
+    cycle();
+    GE_CHECK_EQ(arena.BlockAllocations(), blocks);
+    GE_CHECK(arena.Capacity() >= arena.Peak());
+}
+
+GE_TEST(ArenaScopeRewindsAndTrims) {
+    Memory::LinearArena arena(1024);
+    const std::size_t capacity = arena.Capacity();
+    {
+        Memory::ArenaScope scope(arena, capacity);
+        for (int i = 0; i < 50; ++i) arena.Allocate(512);
+        GE_CHECK(arena.Capacity() > capacity);
+    }
+    GE_CHECK_EQ(arena.Used(), 0u);
+    GE_CHECK_EQ(arena.Capacity(), capacity);
+}
+
+GE_TEST(ArenaResourceBacksPmrContainers) {
+    Memory::LinearArena arena(1024);
+    Memory::ArenaResource resource(arena);
+    std::pmr::vector<int> values(&resource);
+    for (int i = 0; i < 10000; ++i) values.push_back(i);
+    GE_CHECK_EQ(values[9999], 9999);
+    GE_CHECK(arena.Used() >= values.size() * sizeof(int));
+}
+
+// ============================================================================
+// POOLS
+// ============================================================================
+
+GE_TEST(FixedPoolReusesFreedBlocks) {
+    Memory::FixedPool pool(48, 16, 4096);
+    GE_CHECK(pool.BlockSize() >= 48 && pool.BlockSize() % 16 == 0);
+
+    std::vector<void*> blocks;
+    std::set<void*> distinct;
+    bool aligned = true;
+    for (int i = 0; i < 1000; ++i) {
+        void* p = pool.Allocate();
+        aligned = aligned && Aligned(p, 16);
+        blocks.push_back(p);
+        distinct.insert(p);
+    }
+    GE_CHECK(aligned);
+    GE_CHECK_EQ(distinct.size(), blocks.size());
+    GE_CHECK_EQ(pool.Live(), 1000u);
+
+    const std::size_t slabs = pool.Slabs();
+    void* last = blocks.back();
+    for (void* p : blocks) pool.Free(p);
+    GE_CHECK_EQ(pool.Live(), 0u);
+
+    // The free list is LIFO and the working set fits without new slabs
+    GE_CHECK_EQ(pool.Allocate(), last);
+    for (int i = 1; i < 1000; ++i) pool.Allocate();
+    GE_CHECK_EQ(pool.Slabs(), slabs);
+}
+
+GE_TEST(PoolResourceRoutesBySizeAndAlignment) {
+    std::pmr::monotonic_buffer_resource upstream;
+    Memory::PoolResource pools(&upstream);
+
+    void* small = pools.allocate(24, 8);
+    void* aligned = pools.allocate(8, 256);      // Alignment picks the 256 B class
+    void* large = pools.allocate(4096, 16);
+    GE_CHECK(Aligned(small, 32));
+    GE_CHECK(Aligned(aligned, 256));
+
+    Memory::PoolResource::Stats stats = pools.GetStats();
+    GE_CHECK_EQ(stats.pooled, 2u);
+    GE_CHECK_EQ(stats.upstream, 1u);
+    GE_CHECK_EQ(stats.live_blocks, 2u);
+
+    pools.deallocate(small, 24, 8);
+    pools.deallocate(aligned, 8, 256);
+    pools.deallocate(large, 4096, 16);
+    stats = pools.GetStats();
+    GE_CHECK_EQ(stats.live_blocks, 0u);
+    GE_CHECK_EQ(pools.allocate(20, 8), small);
+}
+
+// ============================================================================
+// HEAP HOOKS
+// ============================================================================
+
+// new(0, align) must return distinct, aligned, freeable pointers
+GE_TEST(ZeroSizeAlignedNewReturnsUniquePointers) {
+    void* a = ::operator new(0, std::align_val_t{ 64 });
+    void* b = ::operator new(0, std::align_val_t{ 64 });
+    GE_CHECK(a != nullptr && b != nullptr && a != b);
+    GE_CHECK(Aligned(a, 64) && Aligned(b, 64));
+    ::operator delete(a, std::align_val_t{ 64 });
+    ::operator delete(b, std::align_val_t{ 64 });
+
+    void* c = ::operator new(0, std::align_val_t{ 4096 }, std::nothrow);
+    GE_CHECK(c != nullptr && Aligned(c, 4096));
+    ::operator delete(c, std::align_val_t{ 4096 });
+}
+
+// A request whose rounded size would wrap fails; the new-handler gets its
+// chance to free memory before bad_alloc, and nothrow forms return null
+GE_TEST(FailedNewCallsTheNewHandlerFirst) {
+    static int calls = 0;
+    calls = 0;
+    auto give_up = [] {
+        ++calls;
+        std::set_new_handler(nullptr);
+    };
+
+    std::set_new_handler(give_up);
+    bool threw = false;
+    try {
+        void* p = ::operator new(SIZE_MAX - 8, std::align_val_t{ 64 });
+        ::operator delete(p, std::align_val_t{ 64 });
+    } catch (const std::bad_alloc&) {
+        threw = true;
+    }
+    GE_CHECK(threw);
+    GE_CHECK_EQ(calls, 1);
+
+    std::set_new_handler(give_up);
+    GE_CHECK(::operator new(SIZE_MAX - 8, std::align_val_t{ 64 }, std::nothrow) == nullptr);
+    GE_CHECK_EQ(calls, 2);
+    GE_CHECK(::operator new(SIZE_MAX, std::nothrow) == nullptr);
+    GE_CHECK_EQ(calls, 2);
+}
+
+GE_TEST(HeapHooksFeedTheFrameCounters) {
+    Memory::BeginFrame();
+    std::vector<int*> values;
+    for (int i = 0; i < 10; ++i) values.push_back(new int(i));
+    for (int* value : values) delete value;
+    Memory::BeginFrame();
+
+    const Memory::MemoryStats stats = Memory::GetStats();
+    GE_CHECK(stats.heap_tracking);
+    GE_CHECK(stats.heap_allocations >= 10);
+    GE_CHECK(stats.heap_frees >= 10);
+}
+
+GE_TEST_MAIN()
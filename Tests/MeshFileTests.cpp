@@ -0,0 +1,181 @@
+// Behaviour tests for the .gemesh reader: a chunked round trip through
+// MeshWriter, and Open() rejecting truncated files, bad headers, chunks
+// outside the file and indices outside their chunk.
+
+#include "TestHarness.h"
+
+#include "Geometry/MeshKernels.h"
+#include "Geometry/Terrain.h"
+#include "IO/MeshFile.h"
+#include "IO/MeshWriter.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace Geo = Backend::Geometry;
+namespace IO = Backend::IO;
+namespace fs = std::filesystem;
+
+namespace {
+
+    constexpr std::uint32_t kCells = 64;            // 8192 triangles
+    constexpr std::uint32_t kChunkTriangles = 1000;
+
+    std::string TempPath(const char* name) {
+        const fs::path dir = fs::temp_directory_path() / "ge_meshfile_tests";
+        fs::create_directories(dir);
+        return (dir / name).string();
+    }
+
+    std::string WriteTerrain(const char* name) {
+        const std::string path = TempPath(name);
+        std::string error;
+        GE_CHECK(IO::WriteMeshFile(path, Geo::MakeTerrain(kCells), kChunkTriangles, &error));
+        GE_CHECK(error.empty());
+        return path;
+    }
+
+    std::vector<char> ReadAll(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    void WriteAll(const std::string& path, const std::vector<char>& bytes) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    IO::MeshFileHeader HeaderOf(const std::vector<char>& bytes) {
+        IO::MeshFileHeader header;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        return header;
+    }
+
+    std::size_t ChunkDescOffset(const std::vector<char>& bytes, std::uint32_t chunk) {
+        return static_cast<std::size_t>(HeaderOf(bytes).chunk_table_offset) + chunk * sizeof(IO::MeshChunkDesc);
+    }
+
+    IO::MeshChunkDesc ChunkOf(const std::vector<char>& bytes, std::uint32_t chunk) {
+        IO::MeshChunkDesc desc;
+        std::memcpy(&desc, bytes.data() + ChunkDescOffset(bytes, chunk), sizeof(desc));
+        return desc;
+    }
+
+    bool OpenFails(const std::string& path, const char* expected) {
+        IO::MeshFile file;
+        if (file.Open(path)) return false;
+        return file.Error() == expected && !file.IsOpen();
+    }
+
+} // namespace
+
+// ============================================================================
+// ROUND TRIP
+// ============================================================================
+
+GE_TEST(ChunkedRoundTripKeepsTheMesh) {
+    const Geo::MeshSoA mesh = Geo::MakeTerrain(kCells);
+    const std::string path = WriteTerrain("round_trip.gemesh");
+
+    IO::MeshFile file;
+    GE_CHECK(file.Open(path));
+    GE_CHECK_EQ(file.Header().triangle_count, mesh.TriangleCount());
+    GE_CHECK_EQ(file.Lods().size(), 1u);
+    GE_CHECK(file.Chunks().size() > 1);
+
+    std::size_t triangles = 0;
+    bool chunks_fit = true;
+    bool hashes_match = true;
+    file.StreamLod(0, [&](std::uint32_t chunk, const Geo::MeshView& view) {
+        triangles += view.triangle_count;
+        chunks_fit = chunks_fit && view.triangle_count <= kChunkTriangles;
+        hashes_match = hashes_match && file.VerifyChunk(chunk);
+    });
+    GE_CHECK_EQ(triangles, mesh.TriangleCount());
+    GE_CHECK(chunks_fit);
+    GE_CHECK(hashes_match);
+
+    const Geo::MeshSoA loaded = file.LoadLod(0);
+    GE_CHECK_EQ(loaded.TriangleCount(), mesh.TriangleCount());
+    const double expected = Geo::ComputeMetrics(mesh.View()).surface_area;
+    const double actual = Geo::ComputeMetrics(loaded.View()).surface_area;
+    GE_CHECK(std::abs(actual - expected) <= expected * 1e-5);
+
+    const Geo::Aabb bounds = file.Bounds();
+    const Geo::Aabb reference = Geo::ComputeBounds(mesh.View());
+    GE_CHECK(bounds.min == reference.min && bounds.max == reference.max);
+}
+
+// ============================================================================
+// VALIDATION
+// ============================================================================
+
+GE_TEST(OpenRejectsATruncatedFile) {
+    const std::string path = WriteTerrain("truncated.gemesh");
+    std::vector<char> bytes = ReadAll(path);
+    bytes.resize(bytes.size() - 1);
+    WriteAll(path, bytes);
+    GE_CHECK(OpenFails(path, "file truncated or has trailing data"));
+
+    bytes.resize(sizeof(IO::MeshFileHeader) - 1);
+    WriteAll(path, bytes);
+    GE_CHECK(OpenFails(path, "file too small"));
+}
+
+GE_TEST(OpenRejectsABadHeader) {
+    const std::string path = WriteTerrain("bad_header.gemesh");
+    std::vector<char> bytes = ReadAll(path);
+    bytes[0] = 'X';
+    WriteAll(path, bytes);
+    GE_CHECK(OpenFails(path, "not a gemesh file"));
+
+    bytes[0] = IO::kMeshMagic[0];
+    const std::uint32_t version = IO::kMeshVersion + 1;
+    std::memcpy(bytes.data() + offsetof(IO::MeshFileHeader, version), &version, sizeof(version));
+    WriteAll(path, bytes);
+    GE_CHECK(OpenFails(path, "unsupported gemesh version"));
+}
+
+GE_TEST(OpenRejectsAChunkOutsideTheFile) {
+    const std::string path = WriteTerrain("chunk_outside.gemesh");
+    std::vector<char> bytes = ReadAll(path);
+    const std::uint64_t offset = bytes.size();
+    std::memcpy(bytes.data() + ChunkDescOffset(bytes, 1) + offsetof(IO::MeshChunkDesc, offset), &offset, sizeof(offset));
+    WriteAll(path, bytes);
+    GE_CHECK(OpenFails(path, "corrupt chunk table"));
+}
+
+// Corrupt index columns used to reach MeshView readers and read past the chunk
+GE_TEST(OpenRejectsAnIndexOutsideItsChunk) {
+    const std::string path = WriteTerrain("bad_index.gemesh");
+    const std::vector<char> original = ReadAll(path);
+    const IO::MeshChunkDesc chunk = ChunkOf(original, 1);
+    const IO::MeshChunkLayout layout = IO::ComputeChunkLayout(chunk.vertex_count, chunk.triangle_count);
+
+    // First index of each column, then the last index of i2
+    const std::uint64_t columns[] = { layout.i0, layout.i1, layout.i2,
+                                      layout.i2 + (chunk.triangle_count - 1) * sizeof(std::uint32_t) };
+    for (const std::uint64_t column : columns) {
+        std::vector<char> bytes = original;
+        const std::uint32_t index = chunk.vertex_count;
+        std::memcpy(bytes.data() + chunk.offset + column, &index, sizeof(index));
+        WriteAll(path, bytes);
+        GE_CHECK(OpenFails(path, "index out of range"));
+    }
+
+    // The last valid index still opens
+    std::vector<char> bytes = original;
+    const std::uint32_t index = chunk.vertex_count - 1;
+    std::memcpy(bytes.data() + chunk.offset + layout.i0, &index, sizeof(index));
+    WriteAll(path, bytes);
+    IO::MeshFile file;
+    GE_CHECK(file.Open(path));
+}
+
+GE_TEST_MAIN()
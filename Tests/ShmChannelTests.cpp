@@ -0,0 +1,191 @@
+// Behaviour tests for the shared-memory channel: in-place and reassembled
+// messages, streamed writes, wrap-around with pad records, and Receive()
+// refusing fragment headers that point outside the ring.
+
+#include "TestHarness.h"
+
+#include "ShmChannel.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace {
+
+    constexpr std::size_t kRingBytes = 64 * 1024;      // The minimum, so tests wrap quickly
+    constexpr std::size_t kRingOffset = 4096;           // Request ring data, after the region header
+
+    std::string RegionName(const char* test) {
+        return "/ge_shm_" + std::string(test) + "_" + std::to_string(getpid());
+    }
+
+    std::vector<std::byte> Pattern(std::size_t size, std::uint32_t seed) {
+        std::vector<std::byte> bytes(size);
+        std::uint32_t state = seed * 2654435761u + 1;
+        for (std::byte& b : bytes) {
+            state = state * 1664525u + 1013904223u;
+            b = static_cast<std::byte>(state >> 24);
+        }
+        return bytes;
+    }
+
+    bool Equal(std::span<const std::byte> a, std::span<const std::byte> b) {
+        return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size()) == 0);
+    }
+
+    struct Pair {
+        Bridge::ShmChannel host;
+        Bridge::ShmChannel client;
+
+        explicit Pair(const char* test) {
+            const std::string name = RegionName(test);
+            GE_CHECK(host.Create(name, kRingBytes));
+            GE_CHECK(client.Connect(name));
+            GE_CHECK(host.WaitForClient(1000));
+        }
+    };
+
+    // Overwrites `bytes` at `offset` into the request ring through a second mapping
+    void PatchRequestRing(const char* test, std::size_t offset, const void* bytes, std::size_t size) {
+        const std::string name = RegionName(test);
+        const int fd = shm_open(name.c_str(), O_RDWR, 0);
+        GE_CHECK(fd >= 0);
+        if (fd < 0) return;
+        const std::size_t length = kRingOffset + kRingBytes;
+        void* base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        GE_CHECK(base != MAP_FAILED);
+        if (base == MAP_FAILED) return;
+        std::memcpy(static_cast<std::byte*>(base) + kRingOffset + offset, bytes, size);
+        munmap(base, length);
+    }
+
+} // namespace
+
+// ============================================================================
+// MESSAGES
+// ============================================================================
+
+GE_TEST(SmallMessageRoundTrips) {
+    Pair pair("small");
+    const std::vector<std::byte> sent = Pattern(1000, 1);
+    GE_CHECK(pair.client.Send(sent));
+
+    std::span<const std::byte> received;
+    GE_CHECK(pair.host.Receive(received, 1000));
+    GE_CHECK(Equal(received, sent));
+    pair.host.Consume();
+
+    // Empty messages are legal too
+    GE_CHECK(pair.client.Send({}));
+    GE_CHECK(pair.host.Receive(received, 1000));
+    GE_CHECK(received.empty());
+}
+
+// Larger than the ring: the writer blocks on space while the reader reassembles
+GE_TEST(MessageLargerThanTheRingIsReassembled) {
+    Pair pair("large");
+    const std::vector<std::byte> sent = Pattern(kRingBytes * 16 + 123, 2);
+    bool sent_ok = false;
+    std::thread writer([&] { sent_ok = pair.client.Send(sent); });
+
+    std::span<const std::byte> received;
+    GE_CHECK(pair.host.Receive(received, 5000));
+    writer.join();
+    GE_CHECK(sent_ok);
+    GE_CHECK(Equal(received, sent));
+}
+
+GE_TEST(StreamedWritesFormOneMessage) {
+    Pair pair("streamed");
+    const std::vector<std::byte> sent = Pattern(3 * kRingBytes, 3);
+    bool sent_ok = true;
+    std::thread writer([&] {
+        pair.client.BeginMessage();
+        for (std::size_t offset = 0; offset < sent.size(); offset += 7777) {
+            const std::size_t n = std::min<std::size_t>(7777, sent.size() - offset);
+            sent_ok = sent_ok && pair.client.Write(std::span<const std::byte>(sent).subspan(offset, n));
+        }
+        sent_ok = sent_ok && pair.client.EndMessage();
+    });
+
+    std::span<const std::byte> received;
+    GE_CHECK(pair.host.Receive(received, 5000));
+    writer.join();
+    GE_CHECK(sent_ok);
+    GE_CHECK(Equal(received, sent));
+}
+
+// Odd sizes walk the write position around the ring many times, so whole
+// messages regularly hit the end and are preceded by pad records
+GE_TEST(MessagesSurviveManyWraps) {
+    Pair pair("wrap");
+    constexpr int kMessages = 400;
+    bool sent_ok = true;
+    std::thread writer([&] {
+        for (int i = 0; i < kMessages; ++i) {
+            sent_ok = sent_ok && pair.client.Send(Pattern(1000 + (i * 3571) % 20000, static_cast<std::uint32_t>(i)));
+        }
+    });
+
+    int matched = 0;
+    for (int i = 0; i < kMessages; ++i) {
+        std::span<const std::byte> received;
+        if (!pair.host.Receive(received, 5000)) break;
+        matched += Equal(received, Pattern(1000 + (i * 3571) % 20000, static_cast<std::uint32_t>(i)));
+    }
+    writer.join();
+    GE_CHECK(sent_ok);
+    GE_CHECK_EQ(matched, kMessages);
+}
+
+// ============================================================================
+// CORRUPT INPUT
+// ============================================================================
+
+// Fragment header layout: u32 size, u32 flags, u64 reserved
+GE_TEST(OversizedFragmentFailsTheChannel) {
+    Pair pair("oversized");
+    GE_CHECK(pair.client.Send(Pattern(100, 4)));
+    const std::uint32_t size = 0xFFFFFFF0u;
+    PatchRequestRing("oversized", 0, &size, sizeof(size));
+
+    std::span<const std::byte> received;
+    GE_CHECK(!pair.host.Receive(received, 1000));
+    GE_CHECK(!pair.host.Error().empty());
+    GE_CHECK(!pair.host.PeerConnected());
+}
+
+GE_TEST(FragmentPastTheRingEndFailsTheChannel) {
+    Pair pair("past_end");
+    GE_CHECK(pair.client.Send(Pattern(100, 5)));
+    const std::uint32_t size = static_cast<std::uint32_t>(kRingBytes);   // Under kMaxFragment, over the ring
+    PatchRequestRing("past_end", 0, &size, sizeof(size));
+
+    std::span<const std::byte> received;
+    GE_CHECK(!pair.host.Receive(received, 1000));
+    GE_CHECK(!pair.host.Error().empty());
+}
+
+// A pad at the ring start would skip a whole ring of unpublished bytes
+GE_TEST(PadAtTheRingStartFailsTheChannel) {
+    Pair pair("pad_start");
+    GE_CHECK(pair.client.Send(Pattern(100, 6)));
+    const std::uint32_t flags = 4;
+    PatchRequestRing("pad_start", sizeof(std::uint32_t), &flags, sizeof(flags));
+
+    std::span<const std::byte> received;
+    GE_CHECK(!pair.host.Receive(received, 1000));
+    GE_CHECK(!pair.host.Error().empty());
+}
+
+GE_TEST_MAIN()
@@ -0,0 +1,72 @@
+#pragma once
+
+// Minimal runner for the behaviour tests under Tests/. A test executable
+// declares cases with GE_TEST, checks with GE_CHECK / GE_CHECK_EQ and ends
+// with GE_TEST_MAIN(). It exits non-zero when any check failed, so CTest
+// needs nothing else. Pass a substring to run only the matching cases.
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace Test {
+
+    struct Case {
+        const char* name;
+        void (*fn)();
+    };
+
+    inline std::vector<Case>& Registry() {
+        static std::vector<Case> cases;
+        return cases;
+    }
+
+    // Failed checks in the running case
+    inline int& Failures() {
+        static int failures = 0;
+        return failures;
+    }
+
+    struct Registrar {
+        Registrar(const char* name, void (*fn)()) { Registry().push_back(Case{ name, fn }); }
+    };
+
+    inline void Fail(const char* file, int line, const char* expr) {
+        ++Failures();
+        std::fprintf(stderr, "  %s:%d: check failed: %s\n", file, line, expr);
+    }
+
+    inline int RunAll(int argc, char** argv) {
+        const char* filter = argc > 1 ? argv[1] : nullptr;
+        int run = 0;
+        int failed = 0;
+        for (const Case& test : Registry()) {
+            if (filter && !std::strstr(test.name, filter)) continue;
+            Failures() = 0;
+            std::printf("[ RUN  ] %s\n", test.name);
+            std::fflush(stdout);
+            test.fn();
+            ++run;
+            if (Failures() > 0) ++failed;
+            std::printf("[ %s ] %s\n", Failures() > 0 ? "FAIL" : " OK ", test.name);
+        }
+        std::printf("%d test(s), %d failed\n", run, failed);
+        return failed > 0 || run == 0 ? 1 : 0;
+    }
+
+} // namespace Test
+
+#define GE_TEST(name)                                                   \
+    static void name();                                                 \
+    static const ::Test::Registrar name##_registrar(#name, &name);      \
+    static void name()
+
+#define GE_CHECK(expr)                                                  \
+    do {                                                                \
+        if (!(expr)) ::Test::Fail(__FILE__, __LINE__, #expr);           \
+    } while (0)
+
+#define GE_CHECK_EQ(a, b) GE_CHECK((a) == (b))
+
+#define GE_TEST_MAIN()                                                  \
+    int main(int argc, char** argv) { return ::Test::RunAll(argc, argv); }